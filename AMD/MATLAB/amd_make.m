@@ -24,7 +24,8 @@ end
 
 i = sprintf ('-I../Include -I../../SuiteSparse_config') ;
 cmd = sprintf ('mex -O %s -output amd2 %s amd_mex.c %s', d, i, ...
-    '../../SuiteSparse_config/SuiteSparse_config.c') ;
+    ['../../SuiteSparse_config/SuiteSparse_config.c ' ...
+    '../../SuiteSparse_config/SuiteSparse_memstats.c']) ;
 files = {'amd_l_order', 'amd_l_dump', 'amd_l_postorder', 'amd_l_post_tree', ...
     'amd_l_aat', 'amd_l2', 'amd_l1', 'amd_l_defaults', 'amd_l_control', ...
     'amd_l_info', 'amd_l_valid', 'amd_l_preprocess' } ;
@@ -0,0 +1,199 @@
+//------------------------------------------------------------------------------
+// SuiteSparse/Benchmark/Include/ss_bench.h: cross-package benchmark
+//------------------------------------------------------------------------------
+
+// Copyright (c) 2023-2024, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: BSD-3-clause
+
+//------------------------------------------------------------------------------
+
+// Internal include file for ss_bench, a benchmark of the main SuiteSparse
+// packages on matrices generated locally, with no download.  Each package is
+// optional except SuiteSparse_config and CHOLMOD (whose cholmod_sparse matrix
+// holds the generated matrices); the packages not found are excluded at
+// compile time with -DNO_AMD, -DNO_UMFPACK, and so on.
+
+#ifndef SS_BENCH_H
+#define SS_BENCH_H
+
+#include "SuiteSparse_config.h"
+#include "cholmod.h"
+
+//------------------------------------------------------------------------------
+// matrix families
+//------------------------------------------------------------------------------
+
+// Each generated matrix belongs to one family, and has one kind, which
+// decides which packages are benchmarked on it.
+
+typedef enum
+{
+    BENCH_SPD = 0,          // symmetric positive definite: AMD, CHOLMOD,
+                            // UMFPACK, KLU, ParU
+    BENCH_UNSYM = 1,        // square unsymmetric: AMD, UMFPACK, KLU, ParU
+    BENCH_LSQ = 2,          // tall and thin, full column rank: SPQR
+    BENCH_GRAPH = 3         // adjacency matrix of an undirected graph: AMD,
+                            // GraphBLAS, LAGraph
+}
+bench_kind ;
+
+typedef struct
+{
+    char name [64] ;        // family and size, "laplace2d_200" for example
+    const char *family ;    // "laplace2d", "laplace3d", "fe", "circuit",
+                            // "rmat", or "lsq"
+    bench_kind kind ;
+    cholmod_sparse *A ;     // the matrix: int64, double, stype 0, sorted
+}
+bench_matrix ;
+
+// number of matrix families, and their names
+#define BENCH_NFAMILIES 6
+extern const char *bench_families [BENCH_NFAMILIES] ;
+
+// bench_generate: create the matrix of one family, at a given scale
+int bench_generate              // returns 1 if successful, 0 otherwise
+(
+    bench_matrix *M,            // output matrix
+    int family,                 // index into bench_families
+    int scale,                  // 0: tiny, 1: small, 2: medium, 3: large
+    cholmod_common *cc
+) ;
+
+void bench_matrix_free (bench_matrix *M, cholmod_common *cc) ;
+
+//------------------------------------------------------------------------------
+// results
+//------------------------------------------------------------------------------
+
+// Each result is the best time of one phase (ordering, symbolic analysis,
+// numeric factorization, and so on) of one package on one matrix.
+
+typedef struct
+{
+    char package [32] ;
+    char matrix [64] ;
+    char phase [32] ;
+    int64_t n ;             // dimension (# of columns) of the matrix
+    int64_t nnz ;           // # of entries in the matrix
+    double time ;           // best time, in seconds
+}
+bench_result ;
+
+typedef struct
+{
+    bench_result *result ;
+    int64_t nresults ;
+    int64_t nmax ;
+}
+bench_results ;
+
+// bench_add: add a result to the list (returns 0 if out of memory)
+int bench_add
+(
+    bench_results *R,
+    const char *package,
+    const bench_matrix *M,
+    const char *phase,
+    double time
+) ;
+
+void bench_results_free (bench_results *R) ;
+
+//------------------------------------------------------------------------------
+// benchmark of each package
+//------------------------------------------------------------------------------
+
+// Each method times the phases of one package on the matrix M, repeated
+// "reps" times, and adds the best time of each phase to R.  Matrices of a
+// kind the package does not handle are skipped.  Returns 0 if the package
+// failed (out of memory, for example), 1 otherwise.
+
+typedef int (*bench_method)
+(
+    bench_results *R,
+    const bench_matrix *M,
+    int reps,
+    cholmod_common *cc
+) ;
+
+typedef struct
+{
+    const char *name ;      // name of the package, as used in the results
+    bench_method method ;   // NULL if the package is not compiled in
+}
+bench_package ;
+
+// list of packages, and their number
+extern const bench_package bench_packages [ ] ;
+extern const int bench_npackages ;
+
+// bench_start: start CHOLMOD, and GraphBLAS and LAGraph if compiled in
+int bench_start (cholmod_common *cc) ;
+
+// bench_finish: finish all packages started by bench_start
+void bench_finish (cholmod_common *cc) ;
+
+//------------------------------------------------------------------------------
+// JSON output, and comparison with a baseline
+//------------------------------------------------------------------------------
+
+int bench_json_write            // returns 1 if successful, 0 otherwise
+(
+    const char *filename,
+    const bench_results *R,
+    int scale,
+    int reps
+) ;
+
+int bench_json_read             // returns 1 if successful, 0 otherwise
+(
+    const char *filename,
+    bench_results *R
+) ;
+
+// bench_compare: compare results against a baseline, and return the # of
+// phases that got slower by more than the relative tolerance tol.  Phases
+// that take less than tmin seconds in both are not compared.
+int64_t bench_compare
+(
+    const bench_results *R,
+    const bench_results *Baseline,
+    double tol,
+    double tmin
+) ;
+
+//------------------------------------------------------------------------------
+// timing and pseudo-random numbers
+//------------------------------------------------------------------------------
+
+#define BENCH_MIN(a,b) (((a) < (b)) ? (a) : (b))
+#define BENCH_MAX(a,b) (((a) > (b)) ? (a) : (b))
+
+// time a statement, keeping the best time in tbest
+#define BENCH_TIME(tbest,statement)                                     \
+{                                                                       \
+    double t0 = SuiteSparse_time ( ) ;                                  \
+    statement ;                                                         \
+    double t1 = SuiteSparse_time ( ) - t0 ;                             \
+    tbest = BENCH_MIN (tbest, t1) ;                                     \
+}
+
+// xorshift64* generator: the same matrices are generated on all platforms
+static inline uint64_t bench_rand (uint64_t *state)
+{
+    uint64_t x = (*state) ;
+    x ^= x >> 12 ;
+    x ^= x << 25 ;
+    x ^= x >> 27 ;
+    (*state) = x ;
+    return (x * UINT64_C (0x2545F4914F6CDD1D)) ;
+}
+
+// uniform random number in [0,1)
+static inline double bench_rand_double (uint64_t *state)
+{
+    return ((double) (bench_rand (state) >> 11) * (1.0 / 9007199254740992.0)) ;
+}
+
+#endif
@@ -0,0 +1,231 @@
+//------------------------------------------------------------------------------
+// SuiteSparse/Benchmark/Source/ss_bench.c: cross-package benchmark
+//------------------------------------------------------------------------------
+
+// Copyright (c) 2023-2024, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: BSD-3-clause
+
+//------------------------------------------------------------------------------
+
+// Usage:
+//
+//  ss_bench [options]
+//
+//  -s scale        size of the matrices: 0 (tiny), 1 (small, the default),
+//                  2 (medium), or 3 (large)
+//  -r reps         # of times each phase is run; the best time is kept
+//                  (default 3)
+//  -p list         comma-separated list of packages to run (default: all)
+//  -m list         comma-separated list of matrix families (default: all)
+//  -o file         write the results to this JSON file (default ss_bench.json)
+//  -c baseline     compare the results with a baseline JSON file, written by
+//                  an earlier run of ss_bench
+//  -i file         with -c: compare the results in this JSON file with the
+//                  baseline, instead of running the benchmark
+//  -t tol          with -c: a phase is reported as slower if its time grows
+//                  by more than this fraction (default 0.1)
+//  -T tmin         with -c: phases that take less than tmin seconds are not
+//                  compared (default 1e-3)
+//
+// The exit status is 0 if successful, 1 if an error occurred, and 2 if the
+// comparison with the baseline found a phase that got slower.
+//
+// Example:
+//
+//  ss_bench -s 2 -o before.json
+//  (change SuiteSparse, and recompile)
+//  ss_bench -s 2 -o after.json -c before.json
+
+#include "ss_bench.h"
+
+//------------------------------------------------------------------------------
+// in_list: return true if name is in a comma-separated list (or list is NULL)
+//------------------------------------------------------------------------------
+
+static int in_list (const char *name, const char *list)
+{
+    if (list == NULL) return (1) ;
+    size_t len = strlen (name) ;
+    const char *p = list ;
+    while (*p != '\0')
+    {
+        const char *q = strchr (p, ',') ;
+        size_t plen = (q == NULL) ? strlen (p) : (size_t) (q - p) ;
+        if (plen == len && strncmp (p, name, len) == 0) return (1) ;
+        if (q == NULL) break ;
+        p = q + 1 ;
+    }
+    return (0) ;
+}
+
+//------------------------------------------------------------------------------
+// usage
+//------------------------------------------------------------------------------
+
+static void usage (void)
+{
+    printf ("usage: ss_bench [-s scale] [-r reps] [-p packages] "
+        "[-m families]\n"
+        "                [-o file.json] [-c baseline.json [-i file.json] "
+        "[-t tol] [-T tmin]]\n") ;
+    printf ("packages:") ;
+    for (int k = 0 ; k < bench_npackages ; k++)
+    {
+        printf (" %s%s", bench_packages [k].name,
+            (bench_packages [k].method == NULL) ? " (not compiled)" : "") ;
+    }
+    printf ("\nmatrix families:") ;
+    for (int f = 0 ; f < BENCH_NFAMILIES ; f++)
+    {
+        printf (" %s", bench_families [f]) ;
+    }
+    printf ("\n") ;
+}
+
+//------------------------------------------------------------------------------
+// ss_bench main program
+//------------------------------------------------------------------------------
+
+int main (int argc, char **argv)
+{
+
+    //--------------------------------------------------------------------------
+    // get the options
+    //--------------------------------------------------------------------------
+
+    int scale = 1, reps = 3 ;
+    double tol = 0.1, tmin = 1e-3 ;
+    const char *packages = NULL, *families = NULL, *output = "ss_bench.json" ;
+    const char *baseline = NULL, *input = NULL ;
+    for (int k = 1 ; k < argc ; k++)
+    {
+        const char *arg = argv [k] ;
+        const char *val = (k+1 < argc) ? argv [k+1] : NULL ;
+        if (arg [0] != '-' || arg [1] == '\0' || arg [2] != '\0' ||
+            (val == NULL && strchr ("srpmocitT", arg [1]) != NULL))
+        {
+            usage ( ) ;
+            return (1) ;
+        }
+        switch (arg [1])
+        {
+            case 's': scale = atoi (val) ;  k++ ; break ;
+            case 'r': reps = atoi (val) ;   k++ ; break ;
+            case 'p': packages = val ;      k++ ; break ;
+            case 'm': families = val ;      k++ ; break ;
+            case 'o': output = val ;        k++ ; break ;
+            case 'c': baseline = val ;      k++ ; break ;
+            case 'i': input = val ;         k++ ; break ;
+            case 't': tol = atof (val) ;    k++ ; break ;
+            case 'T': tmin = atof (val) ;   k++ ; break ;
+            default:
+                usage ( ) ;
+                return (arg [1] == 'h' ? 0 : 1) ;
+        }
+    }
+    if (scale < 0 || scale > 3 || reps < 1 || (input != NULL && !baseline))
+    {
+        usage ( ) ;
+        return (1) ;
+    }
+
+    bench_results R, Baseline ;
+    memset (&R, 0, sizeof (bench_results)) ;
+    memset (&Baseline, 0, sizeof (bench_results)) ;
+    int status = 0 ;
+
+    if (input != NULL)
+    {
+
+        //----------------------------------------------------------------------
+        // read prior results
+        //----------------------------------------------------------------------
+
+        if (!bench_json_read (input, &R))
+        {
+            fprintf (stderr, "ss_bench: unable to read %s\n", input) ;
+            return (1) ;
+        }
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // run the benchmark
+        //----------------------------------------------------------------------
+
+        cholmod_common Common, *cc = &Common ;
+        if (!bench_start (cc))
+        {
+            fprintf (stderr, "ss_bench: unable to start\n") ;
+            return (1) ;
+        }
+        printf ("SuiteSparse benchmark: v%d.%d.%d, BLAS: %s, scale %d, "
+            "reps %d\n", SUITESPARSE_MAIN_VERSION, SUITESPARSE_SUB_VERSION,
+            SUITESPARSE_SUBSUB_VERSION, SuiteSparse_BLAS_library ( ), scale,
+            reps) ;
+
+        for (int f = 0 ; f < BENCH_NFAMILIES && status == 0 ; f++)
+        {
+            if (!in_list (bench_families [f], families)) continue ;
+            bench_matrix M ;
+            double t = SuiteSparse_time ( ) ;
+            if (!bench_generate (&M, f, scale, cc))
+            {
+                fprintf (stderr, "ss_bench: unable to generate %s\n",
+                    bench_families [f]) ;
+                status = 1 ;
+                break ;
+            }
+            t = SuiteSparse_time ( ) - t ;
+            printf ("\nmatrix %s: %" PRId64 "-by-%" PRId64 ", nnz %" PRId64
+                ", generated in %g sec\n", M.name, (int64_t) M.A->nrow,
+                (int64_t) M.A->ncol, ((int64_t *) M.A->p) [M.A->ncol], t) ;
+            for (int k = 0 ; k < bench_npackages ; k++)
+            {
+                const bench_package *P = &(bench_packages [k]) ;
+                if (P->method == NULL || !in_list (P->name, packages)) continue;
+                if (!P->method (&R, &M, reps, cc))
+                {
+                    fprintf (stderr, "ss_bench: %s failed on %s\n", P->name,
+                        M.name) ;
+                    status = 1 ;
+                }
+            }
+            bench_matrix_free (&M, cc) ;
+        }
+        bench_finish (cc) ;
+
+        if (status == 0 && !bench_json_write (output, &R, scale, reps))
+        {
+            fprintf (stderr, "ss_bench: unable to write %s\n", output) ;
+            status = 1 ;
+        }
+        if (status == 0)
+        {
+            printf ("\nresults written to %s\n", output) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // compare with the baseline
+    //--------------------------------------------------------------------------
+
+    if (status == 0 && baseline != NULL)
+    {
+        if (!bench_json_read (baseline, &Baseline))
+        {
+            fprintf (stderr, "ss_bench: unable to read %s\n", baseline) ;
+            status = 1 ;
+        }
+        else if (bench_compare (&R, &Baseline, tol, tmin) > 0)
+        {
+            status = 2 ;
+        }
+    }
+
+    bench_results_free (&R) ;
+    bench_results_free (&Baseline) ;
+    return (status) ;
+}
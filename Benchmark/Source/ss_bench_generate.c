@@ -0,0 +1,440 @@
+//------------------------------------------------------------------------------
+// SuiteSparse/Benchmark/Source/ss_bench_generate.c: generate test matrices
+//------------------------------------------------------------------------------
+
+// Copyright (c) 2023-2024, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: BSD-3-clause
+
+//------------------------------------------------------------------------------
+
+// Six families of matrices are generated, each at four scales (0: tiny, for
+// a quick test of the benchmark itself, to 3: large).  The pseudo-random
+// numbers are computed by ss_bench itself from a fixed seed, so the matrices
+// are the same on all platforms and in all runs.
+//
+//  laplace2d   5-point Laplacian on a k-by-k mesh (SPD)
+//  laplace3d   7-point Laplacian on a k-by-k-by-k mesh (SPD)
+//  fe          finite-element-like: a 9-point k-by-k mesh with 3 unknowns
+//              per node, and dense 3-by-3 blocks coupling neighboring nodes
+//              (SPD, since it is symmetric and diagonally dominant)
+//  circuit     circuit-like: block upper triangular, with many 1-by-1 blocks
+//              and small strongly-connected blocks, hidden by a random
+//              symmetric permutation (unsymmetric)
+//  rmat        R-MAT (Kronecker) graph with 16 edges per node on average,
+//              made undirected, with no self-edges (pattern only)
+//  lsq         tall and thin (4n-by-n) least-squares matrix of full column
+//              rank, with a banded structure
+
+#include "ss_bench.h"
+
+const char *bench_families [BENCH_NFAMILIES] =
+{
+    "laplace2d", "laplace3d", "fe", "circuit", "rmat", "lsq"
+} ;
+
+// size parameter of each family, at each scale
+static const int64_t bench_size [BENCH_NFAMILIES][4] =
+{
+    {  16,   200,    700,   1500 },    // laplace2d: mesh is k-by-k
+    {   6,    30,     60,    100 },    // laplace3d: mesh is k-by-k-by-k
+    {   8,   100,    300,    600 },    // fe: mesh is k-by-k, 3 unknowns/node
+    {  20,  5000,  50000, 300000 },    // circuit: # of diagonal blocks
+    {   8,    14,     18,     21 },    // rmat: n = 2^k nodes
+    {  50,  5000,  40000, 150000 },    // lsq: A is 4k-by-k
+} ;
+
+//------------------------------------------------------------------------------
+// bench_entry: add an entry to a triplet matrix, increasing its size if needed
+//------------------------------------------------------------------------------
+
+static int bench_entry
+(
+    cholmod_triplet *T,
+    int64_t i,
+    int64_t j,
+    double x,
+    cholmod_common *cc
+)
+{
+    if (T->nnz >= T->nzmax)
+    {
+        if (!cholmod_l_reallocate_triplet (2 * T->nzmax + 16, T, cc))
+        {
+            return (0) ;
+        }
+    }
+    int64_t *Ti = (int64_t *) T->i ;
+    int64_t *Tj = (int64_t *) T->j ;
+    double  *Tx = (double  *) T->x ;
+    Ti [T->nnz] = i ;
+    Tj [T->nnz] = j ;
+    Tx [T->nnz] = x ;
+    T->nnz++ ;
+    return (1) ;
+}
+
+#define ENTRY(i,j,x)                                        \
+{                                                           \
+    if (!bench_entry (T, i, j, x, cc)) goto done ;          \
+}
+
+//------------------------------------------------------------------------------
+// laplace: 2D or 3D Laplacian on a k-by-k(-by-k) mesh
+//------------------------------------------------------------------------------
+
+static int laplace (cholmod_triplet *T, int64_t k, int dim, cholmod_common *cc)
+{
+    int ok = 0 ;
+    int64_t kz = (dim == 3) ? k : 1 ;
+    for (int64_t z = 0 ; z < kz ; z++)
+    {
+        for (int64_t y = 0 ; y < k ; y++)
+        {
+            for (int64_t x = 0 ; x < k ; x++)
+            {
+                int64_t i = x + k * (y + k * z) ;
+                ENTRY (i, i, 2.0 * dim) ;
+                if (x > 0)      ENTRY (i, i-1, -1) ;
+                if (x < k-1)    ENTRY (i, i+1, -1) ;
+                if (y > 0)      ENTRY (i, i-k, -1) ;
+                if (y < k-1)    ENTRY (i, i+k, -1) ;
+                if (z > 0)      ENTRY (i, i-k*k, -1) ;
+                if (z < kz-1)   ENTRY (i, i+k*k, -1) ;
+            }
+        }
+    }
+    ok = 1 ;
+done:
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+// fe: finite-element-like matrix with 3-by-3 blocks on a 9-point mesh
+//------------------------------------------------------------------------------
+
+#define FE_B 3      // # of unknowns per mesh node
+
+static int fe (cholmod_triplet *T, int64_t k, uint64_t *seed,
+    cholmod_common *cc)
+{
+    int ok = 0 ;
+    int64_t n = k * k * FE_B ;
+    double *D = calloc (n, sizeof (double)) ;  // sum |A(i,:)| of offdiagonal
+    if (D == NULL) return (0) ;
+
+    // a symmetric pair of entries A(i,j) = A(j,i) = v, with v < 0
+    #define FE_PAIR(i,j)                                        \
+    {                                                           \
+        double v = -bench_rand_double (seed) - 0.1 ;            \
+        ENTRY (i, j, v) ;                                       \
+        ENTRY (j, i, v) ;                                       \
+        D [i] -= v ;                                            \
+        D [j] -= v ;                                            \
+    }
+
+    for (int64_t y = 0 ; y < k ; y++)
+    {
+        for (int64_t x = 0 ; x < k ; x++)
+        {
+            int64_t node = x + k * y ;
+            // couplings inside the node
+            for (int r = 0 ; r < FE_B ; r++)
+            {
+                for (int c = r+1 ; c < FE_B ; c++)
+                {
+                    FE_PAIR (node * FE_B + r, node * FE_B + c) ;
+                }
+            }
+            // couplings to the neighbors that follow this node: (x+1,y),
+            // (x-1,y+1), (x,y+1), and (x+1,y+1)
+            for (int nb = 0 ; nb < 4 ; nb++)
+            {
+                int64_t x2 = x + ((nb == 0 || nb == 3) ? 1 : (nb == 1) ? -1:0);
+                int64_t y2 = y + ((nb == 0) ? 0 : 1) ;
+                if (x2 < 0 || x2 >= k || y2 >= k) continue ;
+                int64_t node2 = x2 + k * y2 ;
+                for (int r = 0 ; r < FE_B ; r++)
+                {
+                    for (int c = 0 ; c < FE_B ; c++)
+                    {
+                        FE_PAIR (node * FE_B + r, node2 * FE_B + c) ;
+                    }
+                }
+            }
+        }
+    }
+
+    // diagonal: strictly diagonally dominant
+    for (int64_t i = 0 ; i < n ; i++)
+    {
+        ENTRY (i, i, D [i] + 1) ;
+    }
+    ok = 1 ;
+done:
+    free (D) ;
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+// circuit: block upper triangular matrix, symmetrically permuted
+//------------------------------------------------------------------------------
+
+static int circuit (cholmod_triplet *T, int64_t nblocks, uint64_t *seed,
+    int64_t *n_output, cholmod_common *cc)
+{
+    int ok = 0 ;
+    int64_t *Bstart = malloc ((nblocks+1) * sizeof (int64_t)) ;
+    int64_t *P = NULL ;
+    double *D = NULL ;
+    if (Bstart == NULL) goto done ;
+
+    //--------------------------------------------------------------------------
+    // block sizes: 60% are 1-by-1, the rest are 2-by-2 to 20-by-20
+    //--------------------------------------------------------------------------
+
+    int64_t n = 0 ;
+    for (int64_t b = 0 ; b < nblocks ; b++)
+    {
+        Bstart [b] = n ;
+        int64_t bsize = 1 ;
+        if (bench_rand_double (seed) >= 0.6)
+        {
+            bsize = 2 + (int64_t) (bench_rand (seed) % 19) ;
+        }
+        n += bsize ;
+    }
+    Bstart [nblocks] = n ;
+    (*n_output) = n ;
+    P = malloc (n * sizeof (int64_t)) ;
+    D = calloc (n, sizeof (double)) ;
+    if (P == NULL || D == NULL) goto done ;
+
+    // random permutation P, to hide the block structure
+    for (int64_t i = 0 ; i < n ; i++) P [i] = i ;
+    for (int64_t i = n-1 ; i > 0 ; i--)
+    {
+        int64_t j = bench_rand (seed) % (i+1) ;
+        int64_t t = P [i] ; P [i] = P [j] ; P [j] = t ;
+    }
+
+    #define CIRCUIT_ENTRY(i,j)                                  \
+    {                                                           \
+        double v = 2 * bench_rand_double (seed) - 1 ;           \
+        ENTRY (P [i], P [j], v) ;                               \
+        D [i] += fabs (v) ;                                     \
+    }
+
+    for (int64_t b = 0 ; b < nblocks ; b++)
+    {
+        int64_t k1 = Bstart [b] ;
+        int64_t k2 = Bstart [b+1] ;
+        int64_t bsize = k2 - k1 ;
+        for (int64_t i = k1 ; i < k2 ; i++)
+        {
+            if (bsize > 1)
+            {
+                // a cycle through the block keeps it strongly connected
+                CIRCUIT_ENTRY (i, (i+1 < k2) ? (i+1) : k1) ;
+                // and one more entry inside the block
+                CIRCUIT_ENTRY (i, k1 + (int64_t) (bench_rand (seed) % bsize)) ;
+            }
+            // couplings to nearby later blocks (upper block triangular)
+            if (k2 < n && bench_rand_double (seed) < 0.3)
+            {
+                int64_t w = BENCH_MIN (200, n - k2) ;
+                CIRCUIT_ENTRY (i, k2 + (int64_t) (bench_rand (seed) % w)) ;
+            }
+        }
+    }
+
+    // diagonal: strictly diagonally dominant
+    for (int64_t i = 0 ; i < n ; i++)
+    {
+        ENTRY (P [i], P [i], D [i] + 1) ;
+    }
+    ok = 1 ;
+done:
+    free (Bstart) ;
+    free (P) ;
+    free (D) ;
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+// rmat: undirected R-MAT graph with n = 2^scale nodes
+//------------------------------------------------------------------------------
+
+static int rmat (cholmod_triplet *T, int64_t rscale, uint64_t *seed,
+    cholmod_common *cc)
+{
+    int ok = 0 ;
+    int64_t n = ((int64_t) 1) << rscale ;
+    int64_t nedges = 16 * n ;
+    for (int64_t e = 0 ; e < nedges ; e++)
+    {
+        int64_t i = 0, j = 0 ;
+        for (int64_t level = 0 ; level < rscale ; level++)
+        {
+            // quadrant probabilities: a = 0.57, b = 0.19, c = 0.19, d = 0.05
+            double r = bench_rand_double (seed) ;
+            int64_t bit = ((int64_t) 1) << level ;
+            if (r < 0.57)
+            {
+                ;
+            }
+            else if (r < 0.76)
+            {
+                j |= bit ;
+            }
+            else if (r < 0.95)
+            {
+                i |= bit ;
+            }
+            else
+            {
+                i |= bit ;
+                j |= bit ;
+            }
+        }
+        if (i == j) continue ;
+        ENTRY (i, j, 1) ;
+        ENTRY (j, i, 1) ;
+    }
+    ok = 1 ;
+done:
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+// lsq: 4n-by-n least-squares matrix of full column rank
+//------------------------------------------------------------------------------
+
+// Row i has a 4 in column i mod n, and 3 entries of magnitude less than 1
+// near it.  The first n rows are then strictly diagonally dominant, so A has
+// full column rank.
+
+static int lsq (cholmod_triplet *T, int64_t n, uint64_t *seed,
+    cholmod_common *cc)
+{
+    int ok = 0 ;
+    int64_t m = 4 * n ;
+    for (int64_t i = 0 ; i < m ; i++)
+    {
+        int64_t c = i % n ;
+        ENTRY (i, c, 4) ;
+        for (int k = 0 ; k < 3 ; k++)
+        {
+            int64_t j = c + (int64_t) (bench_rand (seed) % 21) - 10 ;
+            j = BENCH_MAX (0, BENCH_MIN (j, n-1)) ;
+            if (j == c) continue ;
+            ENTRY (i, j, (2 * bench_rand_double (seed) - 1) / 3) ;
+        }
+    }
+    ok = 1 ;
+done:
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+// bench_generate: create a matrix
+//------------------------------------------------------------------------------
+
+int bench_generate              // returns 1 if successful, 0 otherwise
+(
+    bench_matrix *M,            // output matrix
+    int family,                 // index into bench_families
+    int scale,                  // 0: tiny, 1: small, 2: medium, 3: large
+    cholmod_common *cc
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    memset (M, 0, sizeof (bench_matrix)) ;
+    if (family < 0 || family >= BENCH_NFAMILIES || scale < 0 || scale > 3)
+    {
+        return (0) ;
+    }
+    int64_t k = bench_size [family][scale] ;
+    M->family = bench_families [family] ;
+    snprintf (M->name, sizeof (M->name), "%s_%" PRId64, M->family, k) ;
+    uint64_t seed = UINT64_C (0x9E3779B97F4A7C15) + family ;
+
+    //--------------------------------------------------------------------------
+    // generate the matrix in triplet form
+    //--------------------------------------------------------------------------
+
+    cholmod_triplet *T = cholmod_l_allocate_triplet (1, 1, 1024, 0,
+        CHOLMOD_REAL + CHOLMOD_DOUBLE, cc) ;
+    if (T == NULL) return (0) ;
+    int64_t nrow = 0, ncol = 0 ;
+    int ok = 0 ;
+    switch (family)
+    {
+        case 0:     // laplace2d
+            M->kind = BENCH_SPD ;
+            nrow = ncol = k * k ;
+            ok = laplace (T, k, 2, cc) ;
+            break ;
+        case 1:     // laplace3d
+            M->kind = BENCH_SPD ;
+            nrow = ncol = k * k * k ;
+            ok = laplace (T, k, 3, cc) ;
+            break ;
+        case 2:     // fe
+            M->kind = BENCH_SPD ;
+            nrow = ncol = k * k * FE_B ;
+            ok = fe (T, k, &seed, cc) ;
+            break ;
+        case 3:     // circuit
+            M->kind = BENCH_UNSYM ;
+            ok = circuit (T, k, &seed, &nrow, cc) ;
+            ncol = nrow ;
+            break ;
+        case 4:     // rmat
+            M->kind = BENCH_GRAPH ;
+            nrow = ncol = ((int64_t) 1) << k ;
+            ok = rmat (T, k, &seed, cc) ;
+            break ;
+        case 5:     // lsq
+            M->kind = BENCH_LSQ ;
+            nrow = 4 * k ;
+            ncol = k ;
+            ok = lsq (T, k, &seed, cc) ;
+            break ;
+    }
+
+    //--------------------------------------------------------------------------
+    // convert to a sparse matrix, summing up duplicates
+    //--------------------------------------------------------------------------
+
+    if (ok)
+    {
+        T->nrow = nrow ;
+        T->ncol = ncol ;
+        M->A = cholmod_l_triplet_to_sparse (T, T->nnz, cc) ;
+        ok = (M->A != NULL) ;
+    }
+    cholmod_l_free_triplet (&T, cc) ;
+
+    if (ok && M->kind == BENCH_GRAPH)
+    {
+        // duplicate edges were summed; the graph is unweighted
+        double *Ax = (double *) M->A->x ;
+        int64_t nz = cholmod_l_nnz (M->A, cc) ;
+        for (int64_t p = 0 ; p < nz ; p++) Ax [p] = 1 ;
+    }
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+// bench_matrix_free: free a generated matrix
+//------------------------------------------------------------------------------
+
+void bench_matrix_free (bench_matrix *M, cholmod_common *cc)
+{
+    if (M == NULL) return ;
+    cholmod_l_free_sparse (&(M->A), cc) ;
+}
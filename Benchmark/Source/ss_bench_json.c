@@ -0,0 +1,246 @@
+//------------------------------------------------------------------------------
+// SuiteSparse/Benchmark/Source/ss_bench_json.c: results, in JSON
+//------------------------------------------------------------------------------
+
+// Copyright (c) 2023-2024, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: BSD-3-clause
+
+//------------------------------------------------------------------------------
+
+// The results are written as a JSON file with one result per line, so that a
+// file written by ss_bench can be read back here without a JSON library:
+//
+//  {
+//      "benchmark": "SuiteSparse",
+//      "version": "7.6.1",
+//      "blas": "OpenBLAS",
+//      "threads": 8,
+//      "scale": 1,
+//      "reps": 3,
+//      "results": [
+//          { "package": "CHOLMOD", "matrix": "laplace3d_30", "phase": ...
+//          ...
+//      ]
+//  }
+
+#include "ss_bench.h"
+
+//------------------------------------------------------------------------------
+// bench_add: add a result to the list
+//------------------------------------------------------------------------------
+
+int bench_add
+(
+    bench_results *R,
+    const char *package,
+    const bench_matrix *M,
+    const char *phase,
+    double time
+)
+{
+    if (R->nresults >= R->nmax)
+    {
+        int64_t nmax = 2 * R->nmax + 64 ;
+        bench_result *r = realloc (R->result, nmax * sizeof (bench_result)) ;
+        if (r == NULL) return (0) ;
+        R->result = r ;
+        R->nmax = nmax ;
+    }
+    bench_result *r = &(R->result [R->nresults++]) ;
+    memset (r, 0, sizeof (bench_result)) ;
+    strncpy (r->package, package, sizeof (r->package) - 1) ;
+    strncpy (r->matrix, M->name, sizeof (r->matrix) - 1) ;
+    strncpy (r->phase, phase, sizeof (r->phase) - 1) ;
+    r->n = (int64_t) M->A->ncol ;
+    r->nnz = ((int64_t *) M->A->p) [M->A->ncol] ;   // A is packed
+    r->time = time ;
+    printf ("%-10s %-22s %-10s n %10" PRId64 " nnz %11" PRId64
+        " time %12.6f sec\n", r->package, r->matrix, r->phase, r->n, r->nnz,
+        r->time) ;
+    return (1) ;
+}
+
+//------------------------------------------------------------------------------
+// bench_results_free: free the list of results
+//------------------------------------------------------------------------------
+
+void bench_results_free (bench_results *R)
+{
+    free (R->result) ;
+    memset (R, 0, sizeof (bench_results)) ;
+}
+
+//------------------------------------------------------------------------------
+// bench_json_write: write the results to a JSON file
+//------------------------------------------------------------------------------
+
+int bench_json_write            // returns 1 if successful, 0 otherwise
+(
+    const char *filename,
+    const bench_results *R,
+    int scale,
+    int reps
+)
+{
+    FILE *f = fopen (filename, "w") ;
+    if (f == NULL) return (0) ;
+    fprintf (f, "{\n") ;
+    fprintf (f, "    \"benchmark\": \"SuiteSparse\",\n") ;
+    fprintf (f, "    \"version\": \"%d.%d.%d\",\n", SUITESPARSE_MAIN_VERSION,
+        SUITESPARSE_SUB_VERSION, SUITESPARSE_SUBSUB_VERSION) ;
+    fprintf (f, "    \"blas\": \"%s\",\n", SuiteSparse_BLAS_library ( )) ;
+    fprintf (f, "    \"threads\": %d,\n", SUITESPARSE_OPENMP_MAX_THREADS) ;
+    fprintf (f, "    \"scale\": %d,\n", scale) ;
+    fprintf (f, "    \"reps\": %d,\n", reps) ;
+    fprintf (f, "    \"results\": [\n") ;
+    for (int64_t k = 0 ; k < R->nresults ; k++)
+    {
+        const bench_result *r = &(R->result [k]) ;
+        fprintf (f, "        { \"package\": \"%s\", \"matrix\": \"%s\", "
+            "\"phase\": \"%s\", \"n\": %" PRId64 ", \"nnz\": %" PRId64 ", "
+            "\"time\": %.6e }%s\n", r->package, r->matrix, r->phase, r->n,
+            r->nnz, r->time, (k < R->nresults - 1) ? "," : "") ;
+    }
+    fprintf (f, "    ]\n") ;
+    fprintf (f, "}\n") ;
+    return (fclose (f) == 0) ;
+}
+
+//------------------------------------------------------------------------------
+// json_string, json_number: get a value from one line of the JSON file
+//------------------------------------------------------------------------------
+
+static int json_string (const char *line, const char *key, char *s, size_t len)
+{
+    char pattern [64] ;
+    snprintf (pattern, sizeof (pattern), "\"%s\": \"", key) ;
+    const char *p = strstr (line, pattern) ;
+    if (p == NULL) return (0) ;
+    p += strlen (pattern) ;
+    size_t k = 0 ;
+    while (p [k] != '\0' && p [k] != '"' && k < len-1)
+    {
+        s [k] = p [k] ;
+        k++ ;
+    }
+    s [k] = '\0' ;
+    return (p [k] == '"') ;
+}
+
+static int json_number (const char *line, const char *key, double *x)
+{
+    char pattern [64] ;
+    snprintf (pattern, sizeof (pattern), "\"%s\": ", key) ;
+    const char *p = strstr (line, pattern) ;
+    if (p == NULL) return (0) ;
+    return (sscanf (p + strlen (pattern), "%lg", x) == 1) ;
+}
+
+//------------------------------------------------------------------------------
+// bench_json_read: read the results written by bench_json_write
+//------------------------------------------------------------------------------
+
+int bench_json_read             // returns 1 if successful, 0 otherwise
+(
+    const char *filename,
+    bench_results *R
+)
+{
+    memset (R, 0, sizeof (bench_results)) ;
+    FILE *f = fopen (filename, "r") ;
+    if (f == NULL) return (0) ;
+    char line [1024] ;
+    int ok = 1 ;
+    while (ok && fgets (line, sizeof (line), f) != NULL)
+    {
+        if (strstr (line, "\"package\":") == NULL) continue ;
+        bench_result r ;
+        memset (&r, 0, sizeof (bench_result)) ;
+        double n = 0, nnz = 0 ;
+        ok = json_string (line, "package", r.package, sizeof (r.package)) &&
+             json_string (line, "matrix", r.matrix, sizeof (r.matrix)) &&
+             json_string (line, "phase", r.phase, sizeof (r.phase)) &&
+             json_number (line, "n", &n) &&
+             json_number (line, "nnz", &nnz) &&
+             json_number (line, "time", &(r.time)) ;
+        if (!ok) break ;
+        r.n = (int64_t) n ;
+        r.nnz = (int64_t) nnz ;
+        if (R->nresults >= R->nmax)
+        {
+            int64_t nmax = 2 * R->nmax + 64 ;
+            bench_result *p = realloc (R->result, nmax * sizeof (bench_result));
+            if (p == NULL) { ok = 0 ; break ; }
+            R->result = p ;
+            R->nmax = nmax ;
+        }
+        R->result [R->nresults++] = r ;
+    }
+    fclose (f) ;
+    if (!ok) bench_results_free (R) ;
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+// bench_compare: compare results with a baseline
+//------------------------------------------------------------------------------
+
+int64_t bench_compare
+(
+    const bench_results *R,
+    const bench_results *Baseline,
+    double tol,
+    double tmin
+)
+{
+    int64_t nslower = 0, nfaster = 0, ncompared = 0 ;
+    printf ("\n%-10s %-22s %-10s %12s %12s %8s\n", "package", "matrix",
+        "phase", "baseline", "current", "ratio") ;
+    for (int64_t k = 0 ; k < R->nresults ; k++)
+    {
+        const bench_result *r = &(R->result [k]) ;
+
+        // find the same package, matrix, and phase in the baseline
+        const bench_result *b = NULL ;
+        for (int64_t j = 0 ; j < Baseline->nresults && b == NULL ; j++)
+        {
+            const bench_result *s = &(Baseline->result [j]) ;
+            if (strcmp (r->package, s->package) == 0 &&
+                strcmp (r->matrix, s->matrix) == 0 &&
+                strcmp (r->phase, s->phase) == 0)
+            {
+                b = s ;
+            }
+        }
+        if (b == NULL)
+        {
+            printf ("%-10s %-22s %-10s %12s %12.6f\n", r->package, r->matrix,
+                r->phase, "(none)", r->time) ;
+            continue ;
+        }
+
+        // compare the times, unless both are too small to be reliable
+        double ratio = (b->time > 0) ? (r->time / b->time) : 1 ;
+        const char *note = "" ;
+        if (BENCH_MAX (r->time, b->time) >= tmin)
+        {
+            ncompared++ ;
+            if (ratio > 1 + tol)
+            {
+                nslower++ ;
+                note = "  SLOWER" ;
+            }
+            else if (ratio < 1 / (1 + tol))
+            {
+                nfaster++ ;
+                note = "  faster" ;
+            }
+        }
+        printf ("%-10s %-22s %-10s %12.6f %12.6f %8.3f%s\n", r->package,
+            r->matrix, r->phase, b->time, r->time, ratio, note) ;
+    }
+    printf ("\ncompared: %" PRId64 ", slower: %" PRId64 ", faster: %" PRId64
+        " (tolerance %g%%, times below %g sec ignored)\n", ncompared,
+        nslower, nfaster, 100 * tol, tmin) ;
+    return (nslower) ;
+}
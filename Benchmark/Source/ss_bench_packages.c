@@ -0,0 +1,496 @@
+//------------------------------------------------------------------------------
+// SuiteSparse/Benchmark/Source/ss_bench_packages.c: benchmark each package
+//------------------------------------------------------------------------------
+
+// Copyright (c) 2023-2024, Timothy A. Davis, All Rights Reserved.
+// SPDX-License-Identifier: BSD-3-clause
+
+//------------------------------------------------------------------------------
+
+// Each method below times the phases of one package, with default parameters,
+// on one generated matrix:
+//
+//  AMD         order                       (square matrices)
+//  CHOLMOD     symbolic, numeric, solve    (SPD; symbolic includes ordering)
+//  UMFPACK     symbolic, numeric, solve    (SPD and unsymmetric)
+//  KLU         symbolic, numeric, refactor, solve  (SPD and unsymmetric)
+//  SPQR        symbolic, numeric, solve    (least-squares; solve is Q'*b
+//                                          followed by a solve with R)
+//  ParU        symbolic, numeric, solve    (SPD and unsymmetric)
+//  GraphBLAS   build, mxm                  (graphs; mxm is C<A>=A*A)
+//  LAGraph     bfs, pagerank, tricount     (graphs)
+//
+// The right-hand side of each solve is all ones.  Each phase is repeated reps
+// times, and the best time is kept.
+
+#include "ss_bench.h"
+
+#if ! defined ( NO_AMD )
+#include "amd.h"
+#endif
+#if ! defined ( NO_UMFPACK )
+#include "umfpack.h"
+#endif
+#if ! defined ( NO_KLU )
+#include "klu.h"
+#endif
+#if ! defined ( NO_SPQR )
+#include "SuiteSparseQR_C.h"
+#endif
+#if ! defined ( NO_PARU )
+#include "ParU_C.h"
+#endif
+#if ! defined ( NO_GRAPHBLAS )
+#include "GraphBLAS.h"
+#endif
+#if ! defined ( NO_LAGRAPH )
+#include "LAGraph.h"
+#endif
+
+// the best time of each phase, before any run
+#define BENCH_INF (INFINITY)
+
+// dense vector of all ones, of size n
+static double *bench_ones (int64_t n)
+{
+    double *b = malloc (BENCH_MAX (n, 1) * sizeof (double)) ;
+    if (b != NULL) for (int64_t i = 0 ; i < n ; i++) b [i] = 1 ;
+    return (b) ;
+}
+
+//------------------------------------------------------------------------------
+// AMD
+//------------------------------------------------------------------------------
+
+#if ! defined ( NO_AMD )
+
+static int bench_amd (bench_results *R, const bench_matrix *M, int reps,
+    cholmod_common *cc)
+{
+    if (M->kind == BENCH_LSQ) return (1) ;
+    cholmod_sparse *A = M->A ;
+    int64_t n = (int64_t) A->ncol ;
+    int64_t *P = malloc (BENCH_MAX (n, 1) * sizeof (int64_t)) ;
+    if (P == NULL) return (0) ;
+    double t_order = BENCH_INF ;
+    int ok = 1 ;
+    for (int rep = 0 ; ok && rep < reps ; rep++)
+    {
+        int result ;
+        BENCH_TIME (t_order, result = amd_l_order (n, (int64_t *) A->p,
+            (int64_t *) A->i, P, NULL, NULL)) ;
+        ok = (result == AMD_OK || result == AMD_OK_BUT_JUMBLED) ;
+    }
+    free (P) ;
+    return (ok && bench_add (R, "AMD", M, "order", t_order)) ;
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// CHOLMOD
+//------------------------------------------------------------------------------
+
+static int bench_cholmod (bench_results *R, const bench_matrix *M, int reps,
+    cholmod_common *cc)
+{
+    if (M->kind != BENCH_SPD) return (1) ;
+    // C = tril (A), with stype -1
+    cholmod_sparse *C = cholmod_l_copy (M->A, -1, 1, cc) ;
+    cholmod_dense *B = cholmod_l_ones (M->A->nrow, 1, CHOLMOD_REAL, cc) ;
+    double t_symbolic = BENCH_INF, t_numeric = BENCH_INF, t_solve = BENCH_INF ;
+    int ok = (C != NULL && B != NULL) ;
+    for (int rep = 0 ; ok && rep < reps ; rep++)
+    {
+        cholmod_factor *L = NULL ;
+        cholmod_dense *X = NULL ;
+        BENCH_TIME (t_symbolic, L = cholmod_l_analyze (C, cc)) ;
+        ok = (L != NULL) ;
+        if (ok) BENCH_TIME (t_numeric, ok = cholmod_l_factorize (C, L, cc)) ;
+        ok = ok && (cc->status == CHOLMOD_OK) ;
+        if (ok) BENCH_TIME (t_solve, X = cholmod_l_solve (CHOLMOD_A, L, B, cc));
+        ok = ok && (X != NULL) ;
+        cholmod_l_free_dense (&X, cc) ;
+        cholmod_l_free_factor (&L, cc) ;
+    }
+    cholmod_l_free_sparse (&C, cc) ;
+    cholmod_l_free_dense (&B, cc) ;
+    return (ok &&
+        bench_add (R, "CHOLMOD", M, "symbolic", t_symbolic) &&
+        bench_add (R, "CHOLMOD", M, "numeric", t_numeric) &&
+        bench_add (R, "CHOLMOD", M, "solve", t_solve)) ;
+}
+
+//------------------------------------------------------------------------------
+// UMFPACK
+//------------------------------------------------------------------------------
+
+#if ! defined ( NO_UMFPACK )
+
+static int bench_umfpack (bench_results *R, const bench_matrix *M, int reps,
+    cholmod_common *cc)
+{
+    if (M->kind != BENCH_SPD && M->kind != BENCH_UNSYM) return (1) ;
+    cholmod_sparse *A = M->A ;
+    int64_t n = (int64_t) A->ncol ;
+    int64_t *Ap = (int64_t *) A->p ;
+    int64_t *Ai = (int64_t *) A->i ;
+    double  *Ax = (double  *) A->x ;
+    double Control [UMFPACK_CONTROL], Info [UMFPACK_INFO] ;
+    umfpack_dl_defaults (Control) ;
+    double *b = bench_ones (n) ;
+    double *x = bench_ones (n) ;
+    double t_symbolic = BENCH_INF, t_numeric = BENCH_INF, t_solve = BENCH_INF ;
+    int ok = (b != NULL && x != NULL) ;
+    for (int rep = 0 ; ok && rep < reps ; rep++)
+    {
+        void *Symbolic = NULL, *Numeric = NULL ;
+        int status ;
+        BENCH_TIME (t_symbolic, status = umfpack_dl_symbolic (n, n, Ap, Ai, Ax,
+            &Symbolic, Control, Info)) ;
+        ok = (status == UMFPACK_OK) ;
+        if (ok) BENCH_TIME (t_numeric, status = umfpack_dl_numeric (Ap, Ai, Ax,
+            Symbolic, &Numeric, Control, Info)) ;
+        ok = ok && (status == UMFPACK_OK) ;
+        if (ok) BENCH_TIME (t_solve, status = umfpack_dl_solve (UMFPACK_A, Ap,
+            Ai, Ax, x, b, Numeric, Control, Info)) ;
+        ok = ok && (status == UMFPACK_OK) ;
+        umfpack_dl_free_numeric (&Numeric) ;
+        umfpack_dl_free_symbolic (&Symbolic) ;
+    }
+    free (b) ;
+    free (x) ;
+    return (ok &&
+        bench_add (R, "UMFPACK", M, "symbolic", t_symbolic) &&
+        bench_add (R, "UMFPACK", M, "numeric", t_numeric) &&
+        bench_add (R, "UMFPACK", M, "solve", t_solve)) ;
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// KLU
+//------------------------------------------------------------------------------
+
+#if ! defined ( NO_KLU )
+
+static int bench_klu (bench_results *R, const bench_matrix *M, int reps,
+    cholmod_common *cc)
+{
+    if (M->kind != BENCH_SPD && M->kind != BENCH_UNSYM) return (1) ;
+    cholmod_sparse *A = M->A ;
+    int64_t n = (int64_t) A->ncol ;
+    int64_t *Ap = (int64_t *) A->p ;
+    int64_t *Ai = (int64_t *) A->i ;
+    double  *Ax = (double  *) A->x ;
+    klu_l_common Common ;
+    klu_l_defaults (&Common) ;
+    double *b = bench_ones (n) ;
+    double t_symbolic = BENCH_INF, t_numeric = BENCH_INF, t_solve = BENCH_INF ;
+    double t_refactor = BENCH_INF ;
+    int ok = (b != NULL) ;
+    for (int rep = 0 ; ok && rep < reps ; rep++)
+    {
+        klu_l_symbolic *Symbolic = NULL ;
+        klu_l_numeric *Numeric = NULL ;
+        BENCH_TIME (t_symbolic, Symbolic = klu_l_analyze (n, Ap, Ai, &Common)) ;
+        ok = (Symbolic != NULL) ;
+        if (ok) BENCH_TIME (t_numeric, Numeric = klu_l_factor (Ap, Ai, Ax,
+            Symbolic, &Common)) ;
+        ok = ok && (Numeric != NULL) ;
+        if (ok) BENCH_TIME (t_refactor, ok = klu_l_refactor (Ap, Ai, Ax,
+            Symbolic, Numeric, &Common)) ;
+        for (int64_t i = 0 ; i < n ; i++) b [i] = 1 ;
+        if (ok) BENCH_TIME (t_solve, ok = klu_l_solve (Symbolic, Numeric, n, 1,
+            b, &Common)) ;
+        klu_l_free_numeric (&Numeric, &Common) ;
+        klu_l_free_symbolic (&Symbolic, &Common) ;
+    }
+    free (b) ;
+    return (ok &&
+        bench_add (R, "KLU", M, "symbolic", t_symbolic) &&
+        bench_add (R, "KLU", M, "numeric", t_numeric) &&
+        bench_add (R, "KLU", M, "refactor", t_refactor) &&
+        bench_add (R, "KLU", M, "solve", t_solve)) ;
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// SPQR
+//------------------------------------------------------------------------------
+
+#if ! defined ( NO_SPQR )
+
+static int bench_spqr (bench_results *R, const bench_matrix *M, int reps,
+    cholmod_common *cc)
+{
+    if (M->kind != BENCH_LSQ) return (1) ;
+    cholmod_sparse *A = M->A ;
+    cholmod_dense *B = cholmod_l_ones (A->nrow, 1, CHOLMOD_REAL, cc) ;
+    double t_symbolic = BENCH_INF, t_numeric = BENCH_INF, t_solve = BENCH_INF ;
+    int ok = (B != NULL) ;
+    for (int rep = 0 ; ok && rep < reps ; rep++)
+    {
+        SuiteSparseQR_C_factorization *QR = NULL ;
+        cholmod_dense *Y = NULL, *X = NULL ;
+        BENCH_TIME (t_symbolic, QR = SuiteSparseQR_C_symbolic
+            (SPQR_ORDERING_DEFAULT, 1, A, cc)) ;
+        ok = (QR != NULL) ;
+        if (ok) BENCH_TIME (t_numeric, ok = SuiteSparseQR_C_numeric
+            (SPQR_DEFAULT_TOL, A, QR, cc)) ;
+        if (ok)
+        {
+            // x = R \ (Q'*b)
+            BENCH_TIME (t_solve,
+                Y = SuiteSparseQR_C_qmult (SPQR_QTX, QR, B, cc) ;
+                X = (Y == NULL) ? NULL :
+                    SuiteSparseQR_C_solve (SPQR_RETX_EQUALS_B, QR, Y, cc)) ;
+            ok = (X != NULL) ;
+        }
+        cholmod_l_free_dense (&X, cc) ;
+        cholmod_l_free_dense (&Y, cc) ;
+        SuiteSparseQR_C_free (&QR, cc) ;
+    }
+    cholmod_l_free_dense (&B, cc) ;
+    return (ok &&
+        bench_add (R, "SPQR", M, "symbolic", t_symbolic) &&
+        bench_add (R, "SPQR", M, "numeric", t_numeric) &&
+        bench_add (R, "SPQR", M, "solve", t_solve)) ;
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// ParU
+//------------------------------------------------------------------------------
+
+#if ! defined ( NO_PARU )
+
+static int bench_paru (bench_results *R, const bench_matrix *M, int reps,
+    cholmod_common *cc)
+{
+    if (M->kind != BENCH_SPD && M->kind != BENCH_UNSYM) return (1) ;
+    cholmod_sparse *A = M->A ;
+    int64_t n = (int64_t) A->ncol ;
+    ParU_C_Control Control ;
+    ParU_C_Init_Control (&Control) ;
+    double *b = bench_ones (n) ;
+    double *x = bench_ones (n) ;
+    double t_symbolic = BENCH_INF, t_numeric = BENCH_INF, t_solve = BENCH_INF ;
+    int ok = (b != NULL && x != NULL) ;
+    for (int rep = 0 ; ok && rep < reps ; rep++)
+    {
+        ParU_C_Symbolic *Sym = NULL ;
+        ParU_C_Numeric *Num = NULL ;
+        ParU_Ret info ;
+        BENCH_TIME (t_symbolic, info = ParU_C_Analyze (A, &Sym, &Control)) ;
+        ok = (info == PARU_SUCCESS) ;
+        if (ok) BENCH_TIME (t_numeric, info = ParU_C_Factorize (A, Sym, &Num,
+            &Control)) ;
+        ok = ok && (info == PARU_SUCCESS) ;
+        if (ok) BENCH_TIME (t_solve, info = ParU_C_Solve_Axb (Sym, Num, b, x,
+            &Control)) ;
+        ok = ok && (info == PARU_SUCCESS) ;
+        if (Num != NULL) ParU_C_Freenum (&Num, &Control) ;
+        if (Sym != NULL) ParU_C_Freesym (&Sym, &Control) ;
+    }
+    free (b) ;
+    free (x) ;
+    return (ok &&
+        bench_add (R, "ParU", M, "symbolic", t_symbolic) &&
+        bench_add (R, "ParU", M, "numeric", t_numeric) &&
+        bench_add (R, "ParU", M, "solve", t_solve)) ;
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// GraphBLAS and LAGraph
+//------------------------------------------------------------------------------
+
+#if ! defined ( NO_GRAPHBLAS )
+
+// bench_grb_matrix: build a GraphBLAS matrix from the tuples of A
+static GrB_Info bench_grb_matrix (GrB_Matrix *G, const cholmod_sparse *A)
+{
+    int64_t n = (int64_t) A->ncol ;
+    int64_t *Ap = (int64_t *) A->p ;
+    int64_t *Ai = (int64_t *) A->i ;
+    double  *Ax = (double  *) A->x ;
+    int64_t nz = Ap [n] ;
+    GrB_Index *Gi = malloc (BENCH_MAX (nz, 1) * sizeof (GrB_Index)) ;
+    GrB_Index *Gj = malloc (BENCH_MAX (nz, 1) * sizeof (GrB_Index)) ;
+    GrB_Info info = GrB_OUT_OF_MEMORY ;
+    (*G) = NULL ;
+    if (Gi != NULL && Gj != NULL)
+    {
+        for (int64_t j = 0 ; j < n ; j++)
+        {
+            for (int64_t p = Ap [j] ; p < Ap [j+1] ; p++)
+            {
+                Gi [p] = Ai [p] ;
+                Gj [p] = j ;
+            }
+        }
+        info = GrB_Matrix_new (G, GrB_FP64, A->nrow, n) ;
+        if (info == GrB_SUCCESS)
+        {
+            info = GrB_Matrix_build_FP64 (*G, Gi, Gj, Ax, nz, GrB_PLUS_FP64) ;
+        }
+        if (info == GrB_SUCCESS) info = GrB_Matrix_wait (*G, GrB_MATERIALIZE) ;
+        if (info != GrB_SUCCESS) GrB_Matrix_free (G) ;
+    }
+    free (Gi) ;
+    free (Gj) ;
+    return (info) ;
+}
+
+static int bench_graphblas (bench_results *R, const bench_matrix *M, int reps,
+    cholmod_common *cc)
+{
+    if (M->kind != BENCH_GRAPH) return (1) ;
+    GrB_Index n = M->A->ncol ;
+    double t_build = BENCH_INF, t_mxm = BENCH_INF ;
+    int ok = 1 ;
+    for (int rep = 0 ; ok && rep < reps ; rep++)
+    {
+        GrB_Matrix A = NULL, C = NULL ;
+        GrB_Info info ;
+        BENCH_TIME (t_build, info = bench_grb_matrix (&A, M->A)) ;
+        ok = (info == GrB_SUCCESS) ;
+        if (ok) ok = (GrB_Matrix_new (&C, GrB_FP64, n, n) == GrB_SUCCESS) ;
+        // C<A> = A*A, with a structural mask (as in triangle counting)
+        if (ok) BENCH_TIME (t_mxm,
+            info = GrB_mxm (C, A, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, A,
+                GrB_DESC_S) ;
+            if (info == GrB_SUCCESS) info = GrB_Matrix_wait (C,
+                GrB_MATERIALIZE)) ;
+        ok = ok && (info == GrB_SUCCESS) ;
+        GrB_Matrix_free (&A) ;
+        GrB_Matrix_free (&C) ;
+    }
+    return (ok &&
+        bench_add (R, "GraphBLAS", M, "build", t_build) &&
+        bench_add (R, "GraphBLAS", M, "mxm", t_mxm)) ;
+}
+
+#endif
+
+#if ! defined ( NO_GRAPHBLAS ) && ! defined ( NO_LAGRAPH )
+
+static int bench_lagraph (bench_results *R, const bench_matrix *M, int reps,
+    cholmod_common *cc)
+{
+    if (M->kind != BENCH_GRAPH) return (1) ;
+    char msg [LAGRAPH_MSG_LEN] ;
+    GrB_Matrix A = NULL ;
+    LAGraph_Graph G = NULL ;
+    int ok = (bench_grb_matrix (&A, M->A) == GrB_SUCCESS) &&
+        (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg) ==
+            GrB_SUCCESS) &&
+        (LAGraph_Cached_OutDegree (G, msg) == GrB_SUCCESS) &&
+        (LAGraph_Cached_NSelfEdges (G, msg) == GrB_SUCCESS) ;
+    double t_bfs = BENCH_INF, t_pagerank = BENCH_INF, t_tricount = BENCH_INF ;
+    for (int rep = 0 ; ok && rep < reps ; rep++)
+    {
+        GrB_Vector level = NULL, parent = NULL, centrality = NULL ;
+        uint64_t ntriangles = 0 ;
+        int iters = 0, status ;
+        // node 0 has the highest expected degree in an R-MAT graph
+        BENCH_TIME (t_bfs, status = LAGr_BreadthFirstSearch (&level, &parent,
+            G, 0, msg)) ;
+        ok = (status == GrB_SUCCESS) ;
+        if (ok) BENCH_TIME (t_pagerank, status = LAGr_PageRank (&centrality,
+            &iters, G, 0.85, 1e-4, 100, msg)) ;
+        ok = ok && (status == GrB_SUCCESS ||
+            status == LAGRAPH_CONVERGENCE_FAILURE) ;
+        if (ok) BENCH_TIME (t_tricount, status = LAGraph_TriangleCount
+            (&ntriangles, G, msg)) ;
+        ok = ok && (status == GrB_SUCCESS) ;
+        GrB_Vector_free (&level) ;
+        GrB_Vector_free (&parent) ;
+        GrB_Vector_free (&centrality) ;
+    }
+    GrB_Matrix_free (&A) ;
+    LAGraph_Delete (&G, msg) ;
+    return (ok &&
+        bench_add (R, "LAGraph", M, "bfs", t_bfs) &&
+        bench_add (R, "LAGraph", M, "pagerank", t_pagerank) &&
+        bench_add (R, "LAGraph", M, "tricount", t_tricount)) ;
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// list of packages
+//------------------------------------------------------------------------------
+
+const bench_package bench_packages [ ] =
+{
+    #if ! defined ( NO_AMD )
+    { "AMD",        bench_amd },
+    #else
+    { "AMD",        NULL },
+    #endif
+    { "CHOLMOD",    bench_cholmod },
+    #if ! defined ( NO_UMFPACK )
+    { "UMFPACK",    bench_umfpack },
+    #else
+    { "UMFPACK",    NULL },
+    #endif
+    #if ! defined ( NO_KLU )
+    { "KLU",        bench_klu },
+    #else
+    { "KLU",        NULL },
+    #endif
+    #if ! defined ( NO_SPQR )
+    { "SPQR",       bench_spqr },
+    #else
+    { "SPQR",       NULL },
+    #endif
+    #if ! defined ( NO_PARU )
+    { "ParU",       bench_paru },
+    #else
+    { "ParU",       NULL },
+    #endif
+    #if ! defined ( NO_GRAPHBLAS )
+    { "GraphBLAS",  bench_graphblas },
+    #else
+    { "GraphBLAS",  NULL },
+    #endif
+    #if ! defined ( NO_GRAPHBLAS ) && ! defined ( NO_LAGRAPH )
+    { "LAGraph",    bench_lagraph },
+    #else
+    { "LAGraph",    NULL },
+    #endif
+} ;
+
+const int bench_npackages = sizeof (bench_packages) / sizeof (bench_package) ;
+
+//------------------------------------------------------------------------------
+// bench_start, bench_finish: start and finish the packages
+//------------------------------------------------------------------------------
+
+int bench_start (cholmod_common *cc)
+{
+    if (!cholmod_l_start (cc)) return (0) ;
+    #if ! defined ( NO_GRAPHBLAS ) && ! defined ( NO_LAGRAPH )
+    char msg [LAGRAPH_MSG_LEN] ;
+    if (LAGraph_Init (msg) != GrB_SUCCESS) return (0) ;
+    #elif ! defined ( NO_GRAPHBLAS )
+    if (GrB_init (GrB_NONBLOCKING) != GrB_SUCCESS) return (0) ;
+    #endif
+    return (1) ;
+}
+
+void bench_finish (cholmod_common *cc)
+{
+    #if ! defined ( NO_GRAPHBLAS ) && ! defined ( NO_LAGRAPH )
+    char msg [LAGRAPH_MSG_LEN] ;
+    LAGraph_Finalize (msg) ;
+    #elif ! defined ( NO_GRAPHBLAS )
+    GrB_finalize ( ) ;
+    #endif
+    cholmod_l_finish (cc) ;
+}
@@ -24,7 +24,8 @@ end
 
 i = sprintf ('-I../Include -I../../SuiteSparse_config') ;
 cmd = sprintf ('mex -O %s -output camd %s camd_mex.c %s', d, i, ...
-    '../../SuiteSparse_config/SuiteSparse_config.c') ;
+    ['../../SuiteSparse_config/SuiteSparse_config.c ' ...
+    '../../SuiteSparse_config/SuiteSparse_memstats.c']) ;
 files = {'camd_l_order', 'camd_l_dump', 'camd_l_postorder', ...
     'camd_l_aat', 'camd_l2', 'camd_l1', 'camd_l_defaults', 'camd_l_control', ...
     'camd_l_info', 'camd_l_valid', 'camd_l_preprocess' } ;
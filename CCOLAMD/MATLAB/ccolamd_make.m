@@ -21,7 +21,8 @@ if (~verLessThan ('matlab', '8.3.0'))
     d = ['-silent ' d] ;
 end
 
-src = '../Source/ccolamd_l.c ../../SuiteSparse_config/SuiteSparse_config.c' ;
+src = ['../Source/ccolamd_l.c ../../SuiteSparse_config/SuiteSparse_config.c ' ...
+    '../../SuiteSparse_config/SuiteSparse_memstats.c'] ;
 cmd = sprintf ( ...
     'mex -O %s -I../../SuiteSparse_config -I../Include -output ', d) ;
 s = [cmd 'ccolamd ccolamdmex.c ' src] ;
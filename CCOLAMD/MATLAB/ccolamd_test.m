@@ -25,7 +25,9 @@ csymamd_default_knobs = [10 1 0] ;
     end
     cmd = sprintf ( ...
         'mex -O %s -I../../SuiteSparse_config -I../Include ', d) ;
-    src = '../Source/ccolamd_l.c ../../SuiteSparse_config/SuiteSparse_config.c' ;
+    src = ['../Source/ccolamd_l.c ' ...
+        '../../SuiteSparse_config/SuiteSparse_config.c ' ...
+        '../../SuiteSparse_config/SuiteSparse_memstats.c'] ;
     if (~(ispc || ismac))
         % for POSIX timing routine
         src = [src ' -lrt'] ;
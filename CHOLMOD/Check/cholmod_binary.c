@@ -0,0 +1,196 @@
+//------------------------------------------------------------------------------
+// CHOLMOD/Check/cholmod_binary: read/write a sparse matrix in a binary file
+//------------------------------------------------------------------------------
+
+// CHOLMOD/Check Module.  Copyright (C) 2005-2023, Timothy A. Davis
+// All Rights Reserved.
+// SPDX-License-Identifier: LGPL-2.1+
+
+//------------------------------------------------------------------------------
+
+// Write a sparse matrix to a binary file, or read it back, using the
+// SuiteSparse_csc container in SuiteSparse_config.  The file holds the
+// matrix exactly as it is in CHOLMOD (dimensions, pattern, values, stype,
+// and sortedness), and is much faster to read and write than a Matrix Market
+// file.  It can also be read by any other package or application that uses
+// SuiteSparse_csc_read.
+//
+// An unpacked or zomplex matrix is written as a packed complex matrix.  The
+// matrix read back is always packed, and has the integer type of the CHOLMOD
+// method used to read it (int32_t for cholmod_read_binary, int64_t for
+// cholmod_l_read_binary), regardless of the integer type used to write it.
+
+#ifndef NCHECK
+
+#include "cholmod_internal.h"
+
+//------------------------------------------------------------------------------
+// csc_error: report an error from SuiteSparse_csc
+//------------------------------------------------------------------------------
+
+static void csc_error (int status, const char *file, int line,
+    cholmod_common *Common)
+{
+    switch (status)
+    {
+        case SUITESPARSE_CSC_OUT_OF_MEMORY:
+            CHOLMOD(error) (CHOLMOD_OUT_OF_MEMORY, file, line,
+                "out of memory", Common) ;
+            break ;
+        case SUITESPARSE_CSC_IO_ERROR:
+            CHOLMOD(error) (CHOLMOD_INVALID, file, line,
+                "unable to open, read, or write file", Common) ;
+            break ;
+        case SUITESPARSE_CSC_UNSUPPORTED:
+            CHOLMOD(error) (CHOLMOD_INVALID, file, line,
+                "file version or byte order not supported", Common) ;
+            break ;
+        case SUITESPARSE_CSC_NO_LZ4:
+            CHOLMOD(error) (CHOLMOD_INVALID, file, line,
+                "file is compressed with LZ4, which is not available", Common) ;
+            break ;
+        default:
+            CHOLMOD(error) (CHOLMOD_INVALID, file, line,
+                "invalid matrix or file", Common) ;
+            break ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// cholmod_write_binary
+//------------------------------------------------------------------------------
+
+int CHOLMOD(write_binary)   // returns TRUE if successful, FALSE otherwise
+(
+    // input:
+    const char *filename,   // name of file to write
+    cholmod_sparse *A,      // matrix to write
+    int compression,        // SUITESPARSE_CSC_NONE or SUITESPARSE_CSC_LZ4
+    cholmod_common *Common
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    RETURN_IF_NULL_COMMON (FALSE) ;
+    RETURN_IF_NULL (filename, FALSE) ;
+    RETURN_IF_SPARSE_MATRIX_INVALID (A, FALSE) ;
+    Common->status = CHOLMOD_OK ;
+
+    //--------------------------------------------------------------------------
+    // pack the matrix, and convert it to complex if zomplex
+    //--------------------------------------------------------------------------
+
+    cholmod_sparse *C = NULL ;
+    if (!A->packed || A->xtype == CHOLMOD_ZOMPLEX)
+    {
+        C = CHOLMOD(copy) (A, A->stype, (A->xtype == CHOLMOD_PATTERN) ? 0 : 1,
+            Common) ;
+        if (C != NULL && C->xtype == CHOLMOD_ZOMPLEX)
+        {
+            CHOLMOD(sparse_xtype) (CHOLMOD_COMPLEX + C->dtype, C, Common) ;
+        }
+        if (Common->status < CHOLMOD_OK)
+        {
+            CHOLMOD(free_sparse) (&C, Common) ;
+            return (FALSE) ;
+        }
+        C->sorted = A->sorted ;
+        A = C ;
+    }
+
+    //--------------------------------------------------------------------------
+    // write the file
+    //--------------------------------------------------------------------------
+
+    Int *Ap = (Int *) A->p ;
+    SuiteSparse_csc S ;
+    S.nrow  = (int64_t) A->nrow ;
+    S.ncol  = (int64_t) A->ncol ;
+    S.nnz   = (int64_t) Ap [A->ncol] ;
+    S.isize = sizeof (Int) ;
+    S.xtype = A->xtype ;
+    S.dtype = (A->dtype == CHOLMOD_SINGLE) ?
+        SUITESPARSE_CSC_SINGLE : SUITESPARSE_CSC_DOUBLE ;
+    S.stype = A->stype ;
+    S.sorted = A->sorted ;
+    S.p = A->p ;
+    S.i = A->i ;
+    S.x = A->x ;
+    int status = SuiteSparse_csc_write (filename, &S, compression) ;
+    CHOLMOD(free_sparse) (&C, Common) ;
+    if (status != SUITESPARSE_CSC_OK)
+    {
+        csc_error (status, __FILE__, __LINE__, Common) ;
+        return (FALSE) ;
+    }
+    return (TRUE) ;
+}
+
+//------------------------------------------------------------------------------
+// cholmod_read_binary
+//------------------------------------------------------------------------------
+
+cholmod_sparse *CHOLMOD(read_binary)    // returns new sparse matrix
+(
+    // input:
+    const char *filename,   // name of file to read
+    cholmod_common *Common
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    RETURN_IF_NULL_COMMON (NULL) ;
+    RETURN_IF_NULL (filename, NULL) ;
+    Common->status = CHOLMOD_OK ;
+
+    //--------------------------------------------------------------------------
+    // get the matrix properties from the file header
+    //--------------------------------------------------------------------------
+
+    SuiteSparse_csc S ;
+    int status = SuiteSparse_csc_info (filename, &S) ;
+    if (status == SUITESPARSE_CSC_OK &&
+        (S.nrow > Int_max || S.ncol >= Int_max || S.nnz > Int_max ||
+        (S.stype != 0 && S.nrow != S.ncol)))
+    {
+        // matrix too large for this version of CHOLMOD, or invalid stype
+        status = SUITESPARSE_CSC_INVALID ;
+    }
+    if (status != SUITESPARSE_CSC_OK)
+    {
+        csc_error (status, __FILE__, __LINE__, Common) ;
+        return (NULL) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the matrix and read the file into it
+    //--------------------------------------------------------------------------
+
+    int dtype = (S.dtype == SUITESPARSE_CSC_SINGLE) ?
+        CHOLMOD_SINGLE : CHOLMOD_DOUBLE ;
+    cholmod_sparse *A = CHOLMOD(allocate_sparse) (S.nrow, S.ncol, S.nnz,
+        S.sorted, TRUE, S.stype, S.xtype + dtype, Common) ;
+    if (Common->status < CHOLMOD_OK)
+    {
+        return (NULL) ;
+    }
+    S.p = A->p ;
+    S.i = A->i ;
+    S.x = A->x ;
+    status = SuiteSparse_csc_read (filename, sizeof (Int), &S) ;
+    if (status != SUITESPARSE_CSC_OK || S.nrow != (int64_t) A->nrow)
+    {
+        CHOLMOD(free_sparse) (&A, Common) ;
+        csc_error (status, __FILE__, __LINE__, Common) ;
+        return (NULL) ;
+    }
+    return (A) ;
+}
+
+#endif
@@ -325,7 +325,8 @@ static int check_common
         P3 (""ID"\n", nmethods) ;
         amd_backup = (nmethods > 1) || (nmethods == 1 &&
             (Common->method [0].ordering == CHOLMOD_METIS ||
-             Common->method [0].ordering == CHOLMOD_NESDIS)) ;
+             Common->method [0].ordering == CHOLMOD_NESDIS ||
+             Common->method [0].ordering == CHOLMOD_MONGOOSE)) ;
     }
     else
     {
@@ -388,7 +389,10 @@ static int check_common
                 break ;
 
             case CHOLMOD_NESDIS:
-                P3 ("%s", "CHOLMOD nested dissection\n") ;
+            case CHOLMOD_MONGOOSE:
+                P3 ("%s", (ordering == CHOLMOD_NESDIS) ?
+                    "CHOLMOD nested dissection\n" :
+                    "CHOLMOD nested dissection, with Mongoose\n") ;
 
                 P3 ("        nd_small: # nodes in uncut subgraph: "ID"\n",
                         (Int) (Common->method [i].nd_small)) ;
@@ -423,7 +427,8 @@ static int check_common
             }
         }
 
-        if (ordering == CHOLMOD_COLAMD || ordering == CHOLMOD_NESDIS)
+        if (ordering == CHOLMOD_COLAMD || ordering == CHOLMOD_NESDIS ||
+            ordering == CHOLMOD_MONGOOSE)
         {
             if (Common->method [i].prune_dense2 < 0)
             {
@@ -1586,8 +1591,13 @@ static int check_factor
         case CHOLMOD_COLAMD:    P4 ("%s", "AMD for A, COLAMD for A*A'") ;break ;
         #ifndef NPARTITION
         case CHOLMOD_METIS:     P4 ("%s", "METIS NodeND") ;              break ;
+        #endif
+        #ifndef NNESDIS
         case CHOLMOD_NESDIS:    P4 ("%s", "CHOLMOD nested dissection") ; break ;
         #endif
+        #ifndef NMONGOOSE
+        case CHOLMOD_MONGOOSE:  P4 ("%s", "Mongoose nested dissection") ;break ;
+        #endif
         default:                ERR ("unknown ordering") ;
     }
 
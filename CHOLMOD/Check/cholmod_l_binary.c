@@ -0,0 +1,13 @@
+//------------------------------------------------------------------------------
+// CHOLMOD/Check/cholmod_l_binary.c: int64_t version of cholmod_binary
+//------------------------------------------------------------------------------
+
+// CHOLMOD/Check Module.  Copyright (C) 2005-2023, Timothy A. Davis
+// All Rights Reserved.
+// SPDX-License-Identifier: LGPL-2.1+
+
+//------------------------------------------------------------------------------
+
+#define CHOLMOD_INT64
+#include "cholmod_binary.c"
+
@@ -35,6 +35,8 @@
 //      NESDIS:     nested dissection using METIS_ComputeVertexSeparator,
 //                  typically followed by a constrained minimum degree
 //                  (CAMD for the symmetric case, CCOLAMD for the AA' case).
+//      MONGOOSE:   NESDIS, but with node separators found by Mongoose
+//                  instead of METIS.
 //
 // Multiple ordering options can be tried (up to 9 of them), and the best one
 // is selected (the one that gives the smallest number of nonzeros in the
@@ -372,6 +374,7 @@ int CHOLMOD(analyze_ordering)
         CHOLMOD(free_factor) (&L, Common) ;                     \
     }                                                           \
     ASSERT (CHOLMOD(dump_work) (TRUE, TRUE, 0, 0, Common)) ;    \
+    SuiteSparse_trace_end ("CHOLMOD", trace_phase, 0, 0) ;      \
     return (L) ;                                                \
 }
 
@@ -467,6 +470,7 @@ cholmod_factor *CHOLMOD(analyze_p2)
         amd_backup = (nmethods > 1) || (nmethods == 1 &&
             (Common->method [0].ordering == CHOLMOD_METIS ||
              Common->method [0].ordering == CHOLMOD_NESDIS ||
+             Common->method [0].ordering == CHOLMOD_MONGOOSE ||
             (Common->method [0].ordering == CHOLMOD_GIVEN &&
                 UserPerm == NULL))) ;
     }
@@ -499,6 +503,8 @@ cholmod_factor *CHOLMOD(analyze_p2)
         return (NULL) ;     // out of memory
     }
     ASSERT (CHOLMOD(dump_work) (TRUE, TRUE, 0, 0, Common)) ;
+    const char *trace_phase = "ordering" ;
+    SuiteSparse_trace_begin ("CHOLMOD", trace_phase) ;
 
     // ensure that subsequent routines, called by cholmod_analyze, do not
     // reallocate any workspace.  This is set back to FALSE in the
@@ -678,7 +684,26 @@ cholmod_factor *CHOLMOD(analyze_p2)
             // (METIS_ComputeVertexSeparator).  In contrast to METIS_NodeND,
             // it calls CAMD or CCOLAMD on the whole graph, instead of MMD
             // on just the leaves.
-            #ifndef NPARTITION
+            #ifndef NNESDIS
+            // workspace: Flag (nrow), Head (nrow+1), Iwork (2*nrow)
+            Common->called_nd = TRUE ;
+            CHOLMOD(nested_dissection) (A, fset, fsize, Perm, CParent, Cmember,
+                    Common) ;
+            #else
+            Common->status = CHOLMOD_NOT_INSTALLED ;
+            #endif
+
+        }
+        else if (ordering == CHOLMOD_MONGOOSE)
+        {
+
+            //------------------------------------------------------------------
+            // use CHOLMOD's nested dissection, with Mongoose as the bisector
+            //------------------------------------------------------------------
+
+            // cholmod_nested_dissection uses Mongoose instead of METIS when
+            // the ordering of the current method is CHOLMOD_MONGOOSE.
+            #ifndef NMONGOOSE
             // workspace: Flag (nrow), Head (nrow+1), Iwork (2*nrow)
             Common->called_nd = TRUE ;
             CHOLMOD(nested_dissection) (A, fset, fsize, Perm, CParent, Cmember,
@@ -784,6 +809,10 @@ cholmod_factor *CHOLMOD(analyze_p2)
     // turn error printing back on ]
     Common->try_catch = FALSE ;
 
+    SuiteSparse_trace_end ("CHOLMOD", trace_phase, 0, 0) ;
+    trace_phase = "symbolic" ;
+    SuiteSparse_trace_begin ("CHOLMOD", trace_phase) ;
+
     //--------------------------------------------------------------------------
     // return if no ordering method succeeded
     //--------------------------------------------------------------------------
@@ -156,6 +156,7 @@ int CHOLMOD(factorize_p)
     {
         return (FALSE) ;
     }
+    SuiteSparse_trace_begin ("CHOLMOD", "numeric") ;
 
     S  = NULL ;
     F  = NULL ;
@@ -414,6 +415,11 @@ int CHOLMOD(factorize_p)
     CHOLMOD(free_sparse) (&A1, Common) ;
     CHOLMOD(free_sparse) (&A2, Common) ;
     Common->status = MAX (Common->status, status) ;
+    size_t e = (L->dtype == CHOLMOD_SINGLE) ? sizeof (float) : sizeof (double) ;
+    size_t ex = e * ((L->xtype == CHOLMOD_PATTERN) ? 0 :
+                    ((L->xtype == CHOLMOD_REAL) ? 1 : 2)) ;
+    SuiteSparse_trace_end ("CHOLMOD", "numeric", MAX (Common->fl, 0),
+        (double) (L->xsize) * (double) ex) ;
     return (Common->status >= CHOLMOD_OK) ;
 }
 #endif
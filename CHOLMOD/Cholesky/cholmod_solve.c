@@ -179,7 +179,7 @@ cholmod_dense *CHOLMOD(solve)   // returns solution X
 // NOTE: If Bset is present and L is supernodal, it is converted to simplicial
 // on output.
 
-int CHOLMOD(solve2)         // returns TRUE on success, FALSE on failure
+static int solve2           // returns TRUE on success, FALSE on failure
 (
     // input:
     int sys,                        // system to solve
@@ -828,5 +828,32 @@ int CHOLMOD(solve2)         // returns TRUE on success, FALSE on failure
     DEBUG (CHOLMOD(dump_dense) (X, "X result", Common)) ;
     return (Common->status == CHOLMOD_OK) ;
 }
+
+//------------------------------------------------------------------------------
+// cholmod_solve2: solve a linear system, traced as the "solve" phase
+//------------------------------------------------------------------------------
+
+int CHOLMOD(solve2)         // returns TRUE on success, FALSE on failure
+(
+    // input:
+    int sys,                        // system to solve
+    cholmod_factor *L,              // factorization to use
+    cholmod_dense *B,               // right-hand-side
+    cholmod_sparse *Bset,
+    // output:
+    cholmod_dense **X_Handle,       // solution, allocated if need be
+    cholmod_sparse **Xset_Handle,
+    // workspace:
+    cholmod_dense **Y_Handle,       // workspace, or NULL
+    cholmod_dense **E_Handle,       // workspace, or NULL
+    cholmod_common *Common
+)
+{
+    SuiteSparse_trace_begin ("CHOLMOD", "solve") ;
+    int ok = solve2 (sys, L, B, Bset, X_Handle, Xset_Handle, Y_Handle,
+        E_Handle, Common) ;
+    SuiteSparse_trace_end ("CHOLMOD", "solve", 0, 0) ;
+    return (ok) ;
+}
 #endif
 
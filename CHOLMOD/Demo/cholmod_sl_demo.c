@@ -686,6 +686,7 @@ for (int overall_trials = 0 ; overall_trials <= 1 ; overall_trials++)
             if (ordering == CHOLMOD_AMD)         printf ("AMD     ") ;
             if (ordering == CHOLMOD_METIS)       printf ("METIS   ") ;
             if (ordering == CHOLMOD_NESDIS)      printf ("NESDIS  ") ;
+            if (ordering == CHOLMOD_MONGOOSE)    printf ("Mongoose") ;
             if (xlnz > 0)
             {
                 printf ("fl/lnz %10.1f", fl / xlnz) ;
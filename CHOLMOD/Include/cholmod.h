@@ -328,6 +328,8 @@ int cholmod_l_version (int version [3]) ;
 // -DNPARTITION     do not include the Partition module.
 // -DNCAMD          do not include the interfaces to CAMD,
 //                  CCOLAMD, CSYMAND in Partition module.
+// -DNMONGOOSE      do not include the interface to Mongoose in the
+//                  Partition module.
 // -DNMATRIXOPS     do not include the MatrixOps module.
 // -DNMODIFY        do not include the Modify module.
 // -DNSUPERNODAL    do not include the Supernodal module.
@@ -343,16 +345,17 @@ int cholmod_l_version (int version [3]) ;
 //      #define NCHOLESKY
 //      #define NCAMD
 //      #define NPARTITION
+//      #define NMONGOOSE
 //      #define NMATRIXOPS
 //      #define NMODIFY
 //      #define NSUPERNODAL
 //      #define NPRINT
 //      #define NGPL
 
-// The NGPL option disables the MatrixOps, Modify, and Supernodal modules.  The
-//  existence of this #define here, and its use in these 3 modules, does not
-//  affect the license itself; see CHOLMOD/Doc/License.txt for your actual
-//  license.
+// The NGPL option disables the MatrixOps, Modify, and Supernodal modules,
+//  and the interface to Mongoose (which is GPL-licensed).  The existence of
+//  this #define here, and its use in these modules, does not affect the
+//  license itself; see CHOLMOD/Doc/License.txt for your actual license.
 
 #ifdef NGPL
     #undef  NMATRIXOPS
@@ -361,6 +364,18 @@ int cholmod_l_version (int version [3]) ;
     #define NMODIFY
     #undef  NSUPERNODAL
     #define NSUPERNODAL
+    #undef  NMONGOOSE
+    #define NMONGOOSE
+#endif
+
+// CHOLMOD's nested dissection (cholmod_nested_dissection, cholmod_bisect, and
+//  the CHOLMOD_NESDIS and CHOLMOD_MONGOOSE orderings) requires a graph
+//  bisector: METIS (in the Partition module) or Mongoose.  NNESDIS is defined
+//  if neither is available.
+
+#if defined (NPARTITION) && defined (NMONGOOSE)
+    #undef  NNESDIS
+    #define NNESDIS
 #endif
 
 //==============================================================================
@@ -652,6 +667,11 @@ typedef struct cholmod_common_struct
             #define CHOLMOD_NESDIS      4 /* CHOLMOD's nested dissection      */
             #define CHOLMOD_COLAMD      5 /* AMD for A, COLAMD for AA' or A'A */
             #define CHOLMOD_POSTORDERED 6 /* natural then postordered         */
+            #define CHOLMOD_MONGOOSE    7 /* nested dissection, with Mongoose */
+
+            // CHOLMOD_MONGOOSE is CHOLMOD's nested dissection, with the same
+            // nd_* parameters as CHOLMOD_NESDIS, but with the node separators
+            // found by Mongoose instead of METIS.
 
         size_t other_3 [4] ;    // unused, for future expansion
 
@@ -782,7 +802,7 @@ typedef struct cholmod_common_struct
     double SPQR_grain ;     // task size is >= max (total flops / grain)
     double SPQR_small ;     // task size is >= small
     int SPQR_shrink ;       // controls stack realloc method
-    int SPQR_nthreads ;     // number of TBB threads, 0 = auto
+    int SPQR_nthreads ;     // number of OpenMP threads, 0 = auto
 
     // statistics:
     double SPQR_flopcount ;         // flop count for SPQR
@@ -2173,6 +2193,10 @@ int cholmod_l_realloc_multiple (size_t, int, int, void **, void **, void **,
 //
 // cholmod_write_dense      write a dense matrix to a Matrix Market file.
 //
+// cholmod_write_binary     write a sparse matrix to a binary file.
+//
+// cholmod_read_binary      read a sparse matrix from a binary file.
+//
 // cholmod_print_common and cholmod_check_common are the only two routines that
 // you may call after calling cholmod_finish.
 //
@@ -2556,6 +2580,41 @@ int cholmod_write_dense     // CHOLMOD_MM_UNSYMMETRIC or _RECTANGULAR, or
 int cholmod_l_write_dense (FILE *, cholmod_dense *, const char *,
     cholmod_common *) ;
 
+//------------------------------------------------------------------------------
+// cholmod_write_binary: write a sparse matrix to a binary file
+//------------------------------------------------------------------------------
+
+// The file is written with SuiteSparse_csc_write (see SuiteSparse_config.h),
+// and can be read by cholmod_read_binary, cholmod_l_read_binary, or
+// SuiteSparse_csc_read.  An unpacked or zomplex matrix is written as a packed
+// complex matrix.
+
+int cholmod_write_binary    // returns TRUE if successful, FALSE otherwise
+(
+    // input:
+    const char *filename,   // name of file to write
+    cholmod_sparse *A,      // matrix to write
+    int compression,        // SUITESPARSE_CSC_NONE or SUITESPARSE_CSC_LZ4
+    cholmod_common *Common
+) ;
+int cholmod_l_write_binary (const char *, cholmod_sparse *, int,
+    cholmod_common *) ;
+
+//------------------------------------------------------------------------------
+// cholmod_read_binary: read a sparse matrix from a binary file
+//------------------------------------------------------------------------------
+
+// Reads a file written by cholmod_write_binary or SuiteSparse_csc_write.  The
+// matrix is returned packed, with the dtype held in the file.
+
+cholmod_sparse *cholmod_read_binary     // returns new sparse matrix
+(
+    // input:
+    const char *filename,   // name of file to read
+    cholmod_common *Common
+) ;
+cholmod_sparse *cholmod_l_read_binary (const char *, cholmod_common *) ;
+
 #endif
 
 //==============================================================================
@@ -3626,13 +3685,18 @@ int cholmod_l_rowdel_mark (size_t, cholmod_sparse *, double *, int64_t *,
 // cholmod_camd         interface to CAMD ordering
 //
 // These functions require METIS:
-// cholmod_nested_dissection    CHOLMOD nested dissection ordering
 // cholmod_metis                METIS nested dissection ordering (METIS_NodeND)
-// cholmod_bisect               graph partitioner (currently based on METIS)
 // cholmod_metis_bisector       direct interface to METIS_ComputeVertexSeparator
 //
+// These functions require METIS or Mongoose:
+// cholmod_nested_dissection    CHOLMOD nested dissection ordering
+// cholmod_bisect               graph partitioner (METIS or Mongoose)
+//
+// This function requires Mongoose:
+// cholmod_mongoose_bisector    interface to Mongoose's vertex separator
+//
 // Requires the Utility and Cholesky modules, and three packages: METIS, CAMD,
-// and CCOLAMD.  Optionally used by the Cholesky module.
+// and CCOLAMD.  Mongoose is optional.  Optionally used by the Cholesky module.
 
 #ifndef NCAMD
 
@@ -3704,6 +3768,9 @@ int cholmod_l_camd (cholmod_sparse *, int64_t *, size_t, int64_t *, int64_t *,
 
 // These routines still exist if CHOLMOD is compiled with -DNPARTITION,
 // but they return Common->status = CHOLMOD_NOT_INSTALLED in that case.
+// cholmod_nested_dissection, cholmod_bisect, and cholmod_collapse_septree
+// are still available with -DNPARTITION if Mongoose is used (see NNESDIS),
+// and cholmod_mongoose_bisector is not installed with -DNMONGOOSE.
 
 #if 1
 
@@ -3714,7 +3781,9 @@ int cholmod_l_camd (cholmod_sparse *, int64_t *, size_t, int64_t *, int64_t *,
 // Order A, AA', or A(:,f)*A(:,f)' using CHOLMOD's nested dissection method
 // (METIS's node bisector applied recursively to compute the separator tree
 // and constraint sets, followed by CCOLAMD using the constraints).  Usually
-// finds better orderings than METIS_NodeND, but takes longer.
+// finds better orderings than METIS_NodeND, but takes longer.  Mongoose's
+// node bisector is used instead of METIS if the ordering of the current method
+// (Common->method [Common->current].ordering) is CHOLMOD_MONGOOSE.
 
 int64_t cholmod_nested_dissection  // returns # of components, or -1 if error
 (
@@ -3801,6 +3870,26 @@ int64_t cholmod_metis_bisector      // returns separator size
 int64_t cholmod_l_metis_bisector (cholmod_sparse *, int64_t *, int64_t *,
     int64_t *, cholmod_common *) ;
 
+//------------------------------------------------------------------------------
+// cholmod_mongoose_bisector
+//------------------------------------------------------------------------------
+
+// Find a set of nodes that bisects the graph of A or AA' (interface to
+// Mongoose's vertex separator, which uses up to Common->nthreads_max threads).
+
+int64_t cholmod_mongoose_bisector   // returns separator size
+(
+    // input:
+    cholmod_sparse *A,  // matrix to bisect
+    int32_t *Anw,       // size A->nrow, node weights, can be NULL,
+                        // which means the graph is unweighted.
+    // output:
+    int32_t *Partition, // size A->nrow
+    cholmod_common *Common
+) ;
+int64_t cholmod_l_mongoose_bisector (cholmod_sparse *, int64_t *, int64_t *,
+    cholmod_common *) ;
+
 //------------------------------------------------------------------------------
 // cholmod_collapse_septree
 //------------------------------------------------------------------------------
@@ -68,6 +68,9 @@ end
  % using the 64-bit BLAS
 flags = [flags ' -DBLAS64'] ;
 
+% the MATLAB interface does not compile the C++ Mongoose library
+flags = [flags ' -DNMONGOOSE'] ;
+
 if (~(ispc || ismac))
     % for POSIX timing routine
     lapack = [lapack ' -lrt'] ;
@@ -75,7 +78,11 @@ end
 
  %------------------------------------------------------------------------------
 
-config_src = { '../../SuiteSparse_config/SuiteSparse_config' } ;
+config_src = { ...
+    '../../SuiteSparse_config/SuiteSparse_config', ...
+    '../../SuiteSparse_config/SuiteSparse_memstats', ...
+    '../../SuiteSparse_config/SuiteSparse_trace', ...
+    '../../SuiteSparse_config/SuiteSparse_memory' } ;
 
 ordering_src = { ...
     '../../AMD/Source/amd_l1', ...
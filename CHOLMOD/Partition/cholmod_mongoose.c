@@ -0,0 +1,248 @@
+//------------------------------------------------------------------------------
+// CHOLMOD/Partition/cholmod_mongoose: CHOLMOD interface to Mongoose
+//------------------------------------------------------------------------------
+
+// CHOLMOD/Partition Module.  Copyright (C) 2005-2023, University of Florida.
+// All Rights Reserved.  Author: Timothy A. Davis.
+// SPDX-License-Identifier: LGPL-2.1+
+
+//------------------------------------------------------------------------------
+
+// cholmod_mongoose_bisector:
+//
+//      Wrapper for mongoose_vertex_separator, which finds an edge cut of the
+//      graph with Mongoose (multilevel coarsening, QP and FM refinement) and
+//      then a minimum vertex cover of the cut edges.  This is the node
+//      bisector of cholmod_nested_dissection for the CHOLMOD_MONGOOSE
+//      ordering.  Mongoose coarsens the graph in parallel, with up to
+//      Common->nthreads_max OpenMP threads.
+//
+// Mongoose itself is licensed under the GPL, so this interface is disabled if
+// CHOLMOD is compiled with -DNGPL or -DNMONGOOSE.
+//
+// workspace: several size-nz and size-n temporary arrays.  Uses no workspace
+// in Common.
+//
+// Supports any xtype (pattern, real, complex, or zomplex) and any dtype.
+
+#include "cholmod_internal.h"
+
+#ifndef NMONGOOSE
+#include "Mongoose_C.h"
+#endif
+
+//------------------------------------------------------------------------------
+// cholmod_mongoose_bisector
+//------------------------------------------------------------------------------
+
+// Finds a set of nodes that bisects the graph of A or AA'.
+//
+// The input matrix A must be square, symmetric (with both upper and lower
+// parts present) and with no diagonal entries.  These conditions are NOT
+// checked.
+
+int64_t CHOLMOD(mongoose_bisector)  // returns separator size
+(
+    // input:
+    cholmod_sparse *A,  // matrix to bisect
+    Int *Anw,           // size A->nrow, node weights, can be NULL,
+                        // which means the graph is unweighted.
+    // output:
+    Int *Partition,     // size A->nrow
+    cholmod_common *Common
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+#ifndef NMONGOOSE
+
+    Int *Ap, *Ai ;
+    int64_t *Mp, *Mi, *Mnw, *Mpart ;
+    Int n, nleft, nright, j, p, csep, total_weight, lightest, nz ;
+
+    RETURN_IF_NULL_COMMON (EMPTY) ;
+    RETURN_IF_NULL (A, EMPTY) ;
+    RETURN_IF_NULL (Partition, EMPTY) ;
+    RETURN_IF_XTYPE_INVALID (A, CHOLMOD_PATTERN, CHOLMOD_ZOMPLEX, EMPTY) ;
+    if (A->stype || A->nrow != A->ncol)
+    {
+        // A must be square, with both upper and lower parts present
+        ERROR (CHOLMOD_INVALID, "matrix must be square, symmetric,"
+                " and with both upper/lower parts present") ;
+        return (EMPTY) ;
+    }
+    Common->status = CHOLMOD_OK ;
+
+    //--------------------------------------------------------------------------
+    // quick return
+    //--------------------------------------------------------------------------
+
+    n = A->nrow ;
+    if (n == 0)
+    {
+        return (0) ;
+    }
+    size_t n1 = A->nrow + 1 ;
+
+    //--------------------------------------------------------------------------
+    // get inputs
+    //--------------------------------------------------------------------------
+
+    Ap = A->p ;
+    Ai = A->i ;
+    nz = Ap [n] ;
+
+    int nthreads = Common->nthreads_max ;
+    if (nthreads <= 0)
+    {
+        nthreads = SUITESPARSE_OPENMP_MAX_THREADS ;
+    }
+
+    //--------------------------------------------------------------------------
+    // copy Int to int64_t, if necessary
+    //--------------------------------------------------------------------------
+
+    if (sizeof (Int) == sizeof (int64_t))
+    {
+        Mi    = (int64_t *) Ai ;
+        Mp    = (int64_t *) Ap ;
+        Mnw   = (int64_t *) Anw ;
+        Mpart = (int64_t *) Partition ;
+    }
+    else
+    {
+        Mi    = CHOLMOD(malloc) (nz, sizeof (int64_t), Common) ;
+        Mp    = CHOLMOD(malloc) (n1, sizeof (int64_t), Common) ;
+        Mnw   = Anw ? (CHOLMOD(malloc) (n,  sizeof (int64_t), Common)) : NULL ;
+        Mpart = CHOLMOD(malloc) (n,  sizeof (int64_t), Common) ;
+        if (Common->status < CHOLMOD_OK)
+        {
+            CHOLMOD(free) (nz, sizeof (int64_t), Mi,    Common) ;
+            CHOLMOD(free) (n1, sizeof (int64_t), Mp,    Common) ;
+            CHOLMOD(free) (n,  sizeof (int64_t), Mnw,   Common) ;
+            CHOLMOD(free) (n,  sizeof (int64_t), Mpart, Common) ;
+            return (EMPTY) ;
+        }
+        for (p = 0 ; p < nz ; p++)
+        {
+            Mi [p] = (int64_t) Ai [p] ;
+        }
+        for (j = 0 ; j <= n ; j++)
+        {
+            Mp [j] = (int64_t) Ap [j] ;
+        }
+        if (Anw != NULL)
+        {
+            for (j = 0 ; j < n ; j++)
+            {
+                Mnw [j] = (int64_t) Anw [j] ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // partition the graph
+    //--------------------------------------------------------------------------
+
+    csep = (Int) mongoose_vertex_separator (n, Mp, Mi, Mnw, nthreads, Mpart) ;
+    PRINT1 (("Mongoose csep "ID"\n", csep)) ;
+
+    //--------------------------------------------------------------------------
+    // copy the results back from int64_t, if required, and free workspace
+    //--------------------------------------------------------------------------
+
+    if (sizeof (Int) != sizeof (int64_t))
+    {
+        if (csep >= 0)
+        {
+            for (j = 0 ; j < n ; j++)
+            {
+                Partition [j] = (Int) Mpart [j] ;
+            }
+        }
+        CHOLMOD(free) (nz, sizeof (int64_t), Mi,    Common) ;
+        CHOLMOD(free) (n1, sizeof (int64_t), Mp,    Common) ;
+        CHOLMOD(free) (n,  sizeof (int64_t), Mnw,   Common) ;
+        CHOLMOD(free) (n,  sizeof (int64_t), Mpart, Common) ;
+    }
+
+    if (csep < 0)
+    {
+        // Mongoose fails only if it runs out of memory
+        ERROR (CHOLMOD_OUT_OF_MEMORY, "out of memory") ;
+        return (EMPTY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // ensure a reasonable separator
+    //--------------------------------------------------------------------------
+
+    // As in cholmod_metis_bisector: if the separator is empty (the graph is
+    // unconnected), the lightest node is placed in the separator, and if
+    // either the left or right part is empty, all nodes are placed in the
+    // separator.
+
+    if (csep == 0)
+    {
+        // The separator is empty, select lightest node as separator.  If
+        // ties, select the highest numbered node.
+        lightest = n-1 ;
+        if (Anw != NULL)
+        {
+            lightest = 0 ;
+            for (j = 0 ; j < n ; j++)
+            {
+                if (Anw [j] <= Anw [lightest])
+                {
+                    lightest = j ;
+                }
+            }
+        }
+        PRINT1 (("Force "ID" as sep\n", lightest)) ;
+        Partition [lightest] = 2 ;
+        csep = (Anw ? (Anw [lightest]) : 1) ;
+    }
+
+    // determine the node weights in the left and right part of the graph
+    nleft = 0 ;
+    nright = 0 ;
+    for (j = 0 ; j < n ; j++)
+    {
+        if (Partition [j] == 0)
+        {
+            nleft += (Anw ? (Anw [j]) : 1) ;
+        }
+        else if (Partition [j] == 1)
+        {
+            nright += (Anw ? (Anw [j]) : 1) ;
+        }
+    }
+
+    total_weight = nleft + nright + csep ;
+
+    if (csep < total_weight && (nleft == 0 || nright == 0))
+    {
+        // left or right is empty; put all nodes in the separator
+        PRINT1 (("Force all in sep\n")) ;
+        csep = total_weight ;
+        for (j = 0 ; j < n ; j++)
+        {
+            Partition [j] = 2 ;
+        }
+    }
+
+    ASSERT (CHOLMOD(dump_partition) (n, Ap, Ai, Anw, Partition, csep, Common)) ;
+
+    //--------------------------------------------------------------------------
+    // return the sum of the weights of nodes in the separator
+    //--------------------------------------------------------------------------
+
+    return (csep) ;
+#else
+    Common->status = CHOLMOD_NOT_INSTALLED ;
+    return (EMPTY) ;
+#endif
+}
@@ -13,15 +13,17 @@
 // cholmod_bisect:
 //
 //      Finds a set of nodes that partitions the graph into two parts.
-//      Compresses the graph first.  Requires METIS.
+//      Compresses the graph first.  Requires METIS or Mongoose.
 //
 // cholmod_nested_dissection:
 //
 //      Nested dissection, using its own compression and connected-commponents
-//      algorithms, an external graph partitioner (METIS), and a constrained
-//      minimum degree ordering algorithm (CCOLAMD or CSYMAMD).  Typically
-//      gives better orderings than METIS_NodeND (about 5% to 10% fewer
-//      nonzeros in L).
+//      algorithms, an external graph partitioner (METIS or Mongoose), and a
+//      constrained minimum degree ordering algorithm (CCOLAMD or CSYMAMD).
+//      Typically gives better orderings than METIS_NodeND (about 5% to 10%
+//      fewer nonzeros in L).  Mongoose is used as the partitioner if the
+//      ordering of the current method (Common->method [Common->current]) is
+//      CHOLMOD_MONGOOSE, or if METIS is not available.
 //
 // cholmod_collapse_septree:
 //
@@ -29,6 +31,7 @@
 //
 // This file contains several routines private to this file:
 //
+//      bisector        find a node separator with METIS or Mongoose
 //      partition       compress and partition a graph
 //      clear_flag      clear Common->Flag, but do not modify negative entries
 //      find_components find the connected components of a graph
@@ -37,7 +40,43 @@
 
 #include "cholmod_internal.h"
 
-#ifndef NPARTITION
+#ifndef NNESDIS
+
+//------------------------------------------------------------------------------
+// bisector
+//------------------------------------------------------------------------------
+
+// Find a node separator of the graph C, with METIS or Mongoose.  Returns the
+// size of the separator, or -1 if failure.
+
+static int64_t bisector
+(
+    cholmod_sparse *C,
+    Int Cnw [ ],
+    Int Cew [ ],
+    Int Part [ ],
+    cholmod_common *Common
+)
+{
+    #if defined (NMONGOOSE)
+    bool use_mongoose = false ;
+    #elif defined (NPARTITION)
+    bool use_mongoose = true ;
+    #else
+    bool use_mongoose = (Common->current >= 0 &&
+        Common->current < CHOLMOD_MAXMETHODS &&
+        Common->method [Common->current].ordering == CHOLMOD_MONGOOSE) ;
+    #endif
+
+    if (use_mongoose)
+    {
+        return (CHOLMOD(mongoose_bisector) (C, Cnw, Part, Common)) ;
+    }
+    else
+    {
+        return (CHOLMOD(metis_bisector) (C, Cnw, Cew, Part, Common)) ;
+    }
+}
 
 //------------------------------------------------------------------------------
 // partition
@@ -60,7 +99,7 @@
 // the nodes.  It is guaranteed to be between 1 and the total weight of all
 // the nodes.  If it is of size less than the total weight, then both the left
 // and right parts are guaranteed to be non-empty (this guarantee depends on
-// cholmod_metis_bisector).
+// cholmod_metis_bisector and cholmod_mongoose_bisector).
 
 static int64_t partition    // size of separator or -1 if failure
 (
@@ -369,8 +408,7 @@ static int64_t partition    // size of separator or -1 if failure
         // no pruning done at all.  Do not create the compressed graph
         //----------------------------------------------------------------------
 
-        // FUTURE WORK: could call CHACO, SCOTCH, ... here too
-        csep = CHOLMOD(metis_bisector) (C, Cnw, Cew, Part, Common) ;
+        csep = bisector (C, Cnw, Cew, Part, Common) ;
 
     }
     else if (nodes_pruned == n-1)
@@ -482,8 +520,7 @@ static int64_t partition    // size of separator or -1 if failure
         // find the separator of the compressed graph
         //----------------------------------------------------------------------
 
-        // FUTURE WORK: could call CHACO, SCOTCH, ... here too
-        csep = CHOLMOD(metis_bisector) (C, Cnw, Cew, Part, Common) ;
+        csep = bisector (C, Cnw, Cew, Part, Common) ;
 
         if (csep < 0)
         {
@@ -847,7 +884,7 @@ int64_t CHOLMOD(bisect) // returns # of nodes in separator
     // check inputs
     //--------------------------------------------------------------------------
 
-#ifndef NPARTITION
+#ifndef NNESDIS
 
     Int *Bp, *Bi, *Hash, *Cmap, *Bnw, *Bew, *Iwork ;
     cholmod_sparse *B ;
@@ -1050,7 +1087,7 @@ int64_t CHOLMOD(nested_dissection) // returns # of components, or -1 if error
     // check inputs
     //--------------------------------------------------------------------------
 
-#ifndef NPARTITION
+#ifndef NNESDIS
 
     double prune_dense, nd_oksep ;
     Int *Bp, *Bi, *Bnz, *Cstack, *Imap, *Map, *Flag, *Head, *Next, *Bnw, *Iwork,
@@ -1298,6 +1335,16 @@ int64_t CHOLMOD(nested_dissection) // returns # of components, or -1 if error
     // while Cstack is not empty, do:
     //--------------------------------------------------------------------------
 
+    // This loop is sequential.  The two parts of each separator could be
+    // ordered in parallel, but the components are all carved out of B in
+    // place (Bi and Bnz are pruned as each subgraph is built), and share the
+    // Flag and mark of Common, the Imap, Map, and Hash workspace, C, Cew, and
+    // the Cstack.  Each task would need its own copy of the subgraph, its own
+    // workspace, and its own cholmod_common for METIS, and the components
+    // would have to be renumbered when the tasks are merged.  Use
+    // CHOLMOD_MONGOOSE (cholmod_mongoose.c) for a nested dissection whose
+    // partitioning step runs in parallel.
+
     while (top >= 0)
     {
 
@@ -1973,7 +2020,7 @@ int64_t CHOLMOD(collapse_septree)
     // check inputs
     //--------------------------------------------------------------------------
 
-#ifndef NPARTITION
+#ifndef NNESDIS
 
     Int *First, *Count, *Csubtree, *W, *Map ;
     Int c, j, k, nc, sepsize, total_weight, parent, nc_new, first ;
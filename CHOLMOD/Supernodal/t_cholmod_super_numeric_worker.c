@@ -760,6 +760,11 @@ static int TEMPLATE (cholmod_super_numeric_worker)
             {
                 // GPU not installed, or not used
 
+                // set the BLAS threads for the syrk/herk and gemm below
+                int blas_saved ;
+                SUITESPARSE_BLAS_THREADS (((double) ndrow1) * ndcol *
+                    (ndrow1 + 2 * ndrow3), 1, blas_saved) ;
+
                 #ifdef BLAS_TIMER
                 Common->CHOLMOD_CPU_SYRK_CALLS++ ;
                 tstart = SUITESPARSE_TIME ;
@@ -882,6 +887,9 @@ static int TEMPLATE (cholmod_super_numeric_worker)
                     #endif
                 }
 
+                // put back the BLAS threads of the user application
+                SUITESPARSE_BLAS_THREADS_RESTORE (blas_saved) ;
+
                 //--------------------------------------------------------------
                 // construct relative map to assemble d into s
                 //--------------------------------------------------------------
@@ -1014,6 +1022,9 @@ static int TEMPLATE (cholmod_super_numeric_worker)
             #if (defined (CHOLMOD_HAS_CUDA) && defined (DOUBLE))
             supernodeUsedGPU = 0;
             #endif
+            int blas_saved ;
+            SUITESPARSE_BLAS_THREADS (((double) nscol2) * nscol2 * nscol2 / 3,
+                1, blas_saved) ;
             #ifdef BLAS_TIMER
             Common->CHOLMOD_CPU_POTRF_CALLS++ ;
             tstart = SUITESPARSE_TIME ;
@@ -1055,6 +1066,8 @@ static int TEMPLATE (cholmod_super_numeric_worker)
                 nscol2, 0, 0,               // N, 0, 0
                 nsrow,  0, 0) ;             // LDA, 0, 0
             #endif
+
+            SUITESPARSE_BLAS_THREADS_RESTORE (blas_saved) ;
         }
 
         //----------------------------------------------------------------------
@@ -1166,6 +1179,9 @@ static int TEMPLATE (cholmod_super_numeric_worker)
                         (nsrow2, nscol2, nsrow, psx, Lx, Common, gpu_p))
                 #endif
             {
+                int blas_saved ;
+                SUITESPARSE_BLAS_THREADS (((double) nsrow2) * nscol2 * nscol2,
+                    1, blas_saved) ;
                 #ifdef BLAS_TIMER
                 Common->CHOLMOD_CPU_TRSM_CALLS++ ;
                 tstart = SUITESPARSE_TIME ;
@@ -1215,6 +1231,8 @@ static int TEMPLATE (cholmod_super_numeric_worker)
                     nsrow2, nscol2, 0,          // M, N
                     nsrow,  nsrow,  0) ;        // LDA, LDB
                 #endif
+
+                SUITESPARSE_BLAS_THREADS_RESTORE (blas_saved) ;
             }
 
             CHECK_FOR_BLAS_INTEGER_OVERFLOW ;
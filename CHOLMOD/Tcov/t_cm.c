@@ -986,6 +986,14 @@ double do_matrix (cholmod_sparse *A)
             err = test_solver (A) ;                             // RAND reset
             MAXERR (maxerr, err, 1) ;
 
+            printf ("test_solver (3d)\n") ;
+            cm->nmethods = 1 ;
+            cm->method [0].ordering = CHOLMOD_MONGOOSE ;
+            cm->method [0].nd_small = 4 ;       // bisect the small test matrices
+            err = test_solver (A) ;                             // RAND reset
+            MAXERR (maxerr, err, 1) ;
+            cm->method [0].nd_small = 200 ;
+
             printf ("test_solver (4)\n") ;
             cm->nmethods = 1 ;
             cm->method[0].ordering = CHOLMOD_METIS ;
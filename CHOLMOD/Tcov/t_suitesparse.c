@@ -174,6 +174,350 @@ static double div_test (double xr, double xi, double yr, double yi,
     return (maxerr) ;
 }
 
+//------------------------------------------------------------------------------
+// memstats_test
+//------------------------------------------------------------------------------
+
+#define MEMSTATS_NBLOCKS 500
+
+static void memstats_test (void)
+{
+    printf ("\n---------------------memstats_test:\n") ;
+    SuiteSparse_memstats stats ;
+    int ok ;
+
+    OK (!SuiteSparse_memstats_enable (99)) ;
+    OK (SuiteSparse_memstats_enable (SUITESPARSE_MEMSTATS_ON)) ;
+    OK (SuiteSparse_memstats_mode ( ) == SUITESPARSE_MEMSTATS_ON) ;
+
+    //--------------------------------------------------------------------------
+    // one thread, nested phases, and a call site
+    //--------------------------------------------------------------------------
+
+    void *p1 = SuiteSparse_malloc (100, 1) ;             // in no phase
+    SuiteSparse_trace_begin ("Tcov", "outer") ;
+    void *p2 = SuiteSparse_calloc (50, 4) ;             // 200 bytes in outer
+    SuiteSparse_trace_begin ("Tcov", "inner") ;
+    int line = __LINE__ ;
+    void *p3 = SuiteSparse_malloc_site (10, 8, __FILE__, line) ;
+    p3 = SuiteSparse_realloc_site (20, 10, 8, p3, &ok, __FILE__, line) ;
+    OK (ok) ;                                           // 160 bytes in inner
+    SuiteSparse_trace_end ("Tcov", "inner", 0, 0) ;
+    SuiteSparse_trace_end ("Tcov", "outer", 0, 0) ;
+    OKP (p1) ;
+    OKP (p2) ;
+    OKP (p3) ;
+
+    OK (SuiteSparse_memstats_get (NULL, NULL, &stats)) ;
+    OK (stats.live_bytes == 460 && stats.peak_bytes == 460) ;
+    OK (stats.total_bytes == 540) ;
+    OK (stats.nmalloc == 3 && stats.nrealloc == 1 && stats.nfree == 0) ;
+    OK (stats.hist [6] == 2 && stats.hist [7] == 2) ;
+
+    OK (SuiteSparse_memstats_get ("Tcov", NULL, &stats)) ;
+    OK (stats.live_bytes == 360 && stats.nmalloc == 2) ;
+
+    OK (SuiteSparse_memstats_get ("Tcov", "outer", &stats)) ;
+    OK (stats.live_bytes == 200 && stats.peak_bytes == 200) ;
+
+    OK (SuiteSparse_memstats_get ("Tcov", "inner", &stats)) ;
+    OK (stats.live_bytes == 160 && stats.peak_bytes == 160) ;
+    OK (stats.total_bytes == 240) ;
+    OK (stats.nmalloc == 1 && stats.nrealloc == 1) ;
+
+    OK (SuiteSparse_memstats_site (0, &stats)) ;
+    OK (strcmp (stats.file, __FILE__) == 0 && stats.line == line) ;
+    OK (stats.live_bytes == 160 && stats.nmalloc == 1 && stats.nrealloc == 1) ;
+    OK (!SuiteSparse_memstats_site (1, &stats)) ;
+
+    OK (!SuiteSparse_memstats_get ("Tcov", "nosuchphase", &stats)) ;
+    OK (!SuiteSparse_memstats_get ("nosuchpackage", NULL, &stats)) ;
+    OK (!SuiteSparse_memstats_phase (-1, &stats)) ;
+    OK (!SuiteSparse_memstats_get (NULL, NULL, NULL)) ;
+    SuiteSparse_memstats_print (stdout) ;
+
+    SuiteSparse_free (p1) ;
+    SuiteSparse_free (p2) ;
+    SuiteSparse_free (p3) ;
+
+    OK (SuiteSparse_memstats_get (NULL, NULL, &stats)) ;
+    OK (stats.live_bytes == 0 && stats.peak_bytes == 460) ;
+    OK (stats.nfree == 3) ;
+    OK (SuiteSparse_memstats_site (0, &stats)) ;
+    OK (stats.live_bytes == 0 && stats.nfree == 1) ;
+
+    // the peaks drop to the live bytes, and the counts to zero
+    SuiteSparse_memstats_reset ( ) ;
+    for (int k = 0 ; SuiteSparse_memstats_phase (k, &stats) ; k++)
+    {
+        OK (stats.live_bytes == 0 && stats.peak_bytes == 0) ;
+        OK (stats.nmalloc == 0 && stats.nrealloc == 0 && stats.nfree == 0) ;
+    }
+    OK (SuiteSparse_memstats_get (NULL, NULL, &stats)) ;
+    OK (stats.live_bytes == 0 && stats.peak_bytes == 0) ;
+    OK (stats.nmalloc == 0 && stats.total_bytes == 0) ;
+
+    //--------------------------------------------------------------------------
+    // several OpenMP threads, each in its own phase
+    //--------------------------------------------------------------------------
+
+    // Each thread allocates blocks of 1 to MEMSTATS_NBLOCKS bytes, and frees
+    // them once all threads have allocated theirs, so the peak of the phase
+    // is the total of all blocks.
+
+    int nthreads = 1 ;
+    #pragma omp parallel num_threads (4)
+    {
+        void *q [MEMSTATS_NBLOCKS] ;
+        #pragma omp master
+        {
+            nthreads = SUITESPARSE_OPENMP_GET_NUM_THREADS ;
+        }
+        SuiteSparse_trace_begin ("Tcov", "threads") ;
+        for (int k = 0 ; k < MEMSTATS_NBLOCKS ; k++)
+        {
+            q [k] = SuiteSparse_malloc (k+1, 1) ;
+        }
+        #pragma omp barrier
+        for (int k = 0 ; k < MEMSTATS_NBLOCKS ; k++)
+        {
+            SuiteSparse_free (q [k]) ;
+        }
+        SuiteSparse_trace_end ("Tcov", "threads", 0, 0) ;
+    }
+    printf ("memstats threads: %d\n", nthreads) ;
+
+    int64_t n = MEMSTATS_NBLOCKS ;
+    int64_t bytes = nthreads * (n * (n+1)) / 2 ;
+    OK (SuiteSparse_memstats_get ("Tcov", "threads", &stats)) ;
+    OK (stats.live_bytes == 0) ;
+    OK (stats.peak_bytes == bytes && stats.total_bytes == bytes) ;
+    OK (stats.nmalloc == nthreads * n && stats.nfree == nthreads * n) ;
+    OK (SuiteSparse_memstats_get (NULL, NULL, &stats)) ;
+    OK (stats.live_bytes == 0 && stats.peak_bytes == bytes) ;
+    OK (stats.nmalloc == stats.nfree) ;
+
+    //--------------------------------------------------------------------------
+    // stop the accounting; the counters are kept
+    //--------------------------------------------------------------------------
+
+    OK (SuiteSparse_memstats_enable (SUITESPARSE_MEMSTATS_OFF)) ;
+    OK (SuiteSparse_memstats_mode ( ) == SUITESPARSE_MEMSTATS_OFF) ;
+    p1 = SuiteSparse_malloc (100, 1) ;
+    SuiteSparse_free (p1) ;
+    OK (SuiteSparse_memstats_get (NULL, NULL, &stats)) ;
+    OK (stats.nmalloc == nthreads * n && stats.live_bytes == 0) ;
+}
+
+//------------------------------------------------------------------------------
+// trace_test
+//------------------------------------------------------------------------------
+
+#define TRACE_MAXEVENTS 64
+
+static SuiteSparse_trace_event trace_events [TRACE_MAXEVENTS] ;
+static int trace_nevents = 0 ;
+
+static void trace_record (const SuiteSparse_trace_event *event, void *userdata)
+{
+    OK (userdata == (void *) trace_events) ;
+    #pragma omp critical (trace_record)
+    {
+        if (trace_nevents < TRACE_MAXEVENTS)
+        {
+            trace_events [trace_nevents++] = (*event) ;
+        }
+    }
+}
+
+// json_value: skip a JSON value in s, or return NULL if it is not valid
+static const char *json_value (const char *s) ;
+
+static const char *json_space (const char *s)
+{
+    while (*s == ' ' || *s == '\n' || *s == '\r' || *s == '\t') s++ ;
+    return (s) ;
+}
+
+static const char *json_string (const char *s)
+{
+    if (*s++ != '"') return (NULL) ;
+    for ( ; *s != '"' ; s++)
+    {
+        if ((unsigned char) (*s) < ' ') return (NULL) ;
+        if (*s == '\\' && strchr ("\"\\/bfnrtu", *(++s)) == NULL) return (NULL);
+    }
+    return (s+1) ;
+}
+
+static const char *json_value (const char *s)
+{
+    s = json_space (s) ;
+    if (*s == '"')
+    {
+        return (json_string (s)) ;
+    }
+    else if (*s == '{' || *s == '[')
+    {
+        char close = (*s == '{') ? '}' : ']' ;
+        s = json_space (s+1) ;
+        if (*s == close) return (s+1) ;
+        while (s != NULL)
+        {
+            if (close == '}')
+            {
+                s = json_string (json_space (s)) ;
+                if (s == NULL) return (NULL) ;
+                s = json_space (s) ;
+                if (*s++ != ':') return (NULL) ;
+            }
+            s = json_value (s) ;
+            if (s == NULL) return (NULL) ;
+            s = json_space (s) ;
+            if (*s == close) return (s+1) ;
+            if (*s++ != ',') return (NULL) ;
+        }
+        return (NULL) ;
+    }
+    else
+    {
+        char *end ;
+        (void) strtod (s, &end) ;
+        return ((end == s) ? NULL : end) ;
+    }
+}
+
+static void trace_test (void)
+{
+    printf ("\n---------------------trace_test:\n") ;
+
+    //--------------------------------------------------------------------------
+    // a user trace function, with nested events
+    //--------------------------------------------------------------------------
+
+    trace_nevents = 0 ;
+    SuiteSparse_trace_func_set (trace_record, trace_events) ;
+    SuiteSparse_trace_begin ("Tcov", "outer") ;
+    SuiteSparse_trace_begin ("Tcov", "inner") ;
+    SuiteSparse_trace_end ("Tcov", "inner", 10, 20) ;
+    SuiteSparse_trace_end ("Tcov", "outer", 30, 40) ;
+    OK (trace_nevents == 4) ;
+    const char *names [4] = { "outer", "inner", "inner", "outer" } ;
+    for (int k = 0 ; k < 4 ; k++)
+    {
+        SuiteSparse_trace_event *e = &trace_events [k] ;
+        OK (e->kind == ((k < 2) ? SUITESPARSE_TRACE_BEGIN :
+            SUITESPARSE_TRACE_END)) ;
+        OK (strcmp (e->package, "Tcov") == 0) ;
+        OK (strcmp (e->phase, names [k]) == 0) ;
+        OK (e->thread == trace_events [0].thread) ;
+        OK (k == 0 || e->time >= trace_events [k-1].time) ;
+    }
+    OK (trace_events [2].flops == 10 && trace_events [2].bytes == 20) ;
+    OK (trace_events [3].flops == 30 && trace_events [3].bytes == 40) ;
+
+    // no events are passed on once the trace function is cleared
+    SuiteSparse_trace_func_set (NULL, NULL) ;
+    SuiteSparse_trace_begin ("Tcov", "none") ;
+    SuiteSparse_trace_end ("Tcov", "none", 0, 0) ;
+    OK (trace_nevents == 4) ;
+
+    //--------------------------------------------------------------------------
+    // the JSON writer, with events from several threads
+    //--------------------------------------------------------------------------
+
+    const char *filename = "trace_test.json" ;
+    OK (!SuiteSparse_trace_json_open (NULL)) ;
+    OK (SuiteSparse_trace_json_open (filename)) ;
+    SuiteSparse_trace_begin ("Tcov", "outer") ;
+    int nthreads = 1 ;
+    #pragma omp parallel num_threads (4)
+    {
+        #pragma omp master
+        {
+            nthreads = SUITESPARSE_OPENMP_GET_NUM_THREADS ;
+        }
+        SuiteSparse_trace_begin ("Tcov", "thread \"quoted\"") ;
+        SuiteSparse_trace_begin ("Tcov", "inner") ;
+        SuiteSparse_trace_end ("Tcov", "inner", 1, 2) ;
+        SuiteSparse_trace_end ("Tcov", "thread \"quoted\"", 0, 0) ;
+    }
+    SuiteSparse_trace_end ("Tcov", "outer", 0, 0) ;
+    SuiteSparse_trace_json_close ( ) ;
+
+    // events after the file is closed are not written
+    SuiteSparse_trace_begin ("Tcov", "none") ;
+    SuiteSparse_trace_end ("Tcov", "none", 0, 0) ;
+
+    //--------------------------------------------------------------------------
+    // read back the file
+    //--------------------------------------------------------------------------
+
+    FILE *f = fopen (filename, "r") ;
+    OKP (f) ;
+    char text [16384] ;
+    size_t len = fread (text, 1, sizeof (text) - 1, f) ;
+    fclose (f) ;
+    remove (filename) ;
+    OK (len > 0 && len < sizeof (text) - 1) ;
+    text [len] = '\0' ;
+
+    // the file is a single valid JSON array
+    const char *end = json_value (text) ;
+    OKP (end) ;
+    OK (text [0] == '[' && *json_space (end) == '\0') ;
+
+    // each thread has matching begin and end events, properly nested
+    int nevents = 2 + 4 * nthreads ;
+    int depth [64] ;
+    char stack [64][4][32] ;
+    memset (depth, 0, sizeof (depth)) ;
+    int nb = 0, ne = 0 ;
+    for (char *s = strstr (text, "{\"name\":") ; s != NULL ;
+        s = strstr (s+1, "{\"name\":"))
+    {
+        char name [32], ph [2] ;
+        int tid = -1 ;
+        // the name is written first, as a JSON string
+        const char *nend = json_string (s + 8) ;
+        OKP (nend) ;
+        size_t nlen = (size_t) (nend - (s + 8)) ;
+        OK (nlen < sizeof (name)) ;
+        memcpy (name, s + 8, nlen) ;
+        name [nlen] = '\0' ;
+        char *p = strstr (s, "\"ph\":\"") ;
+        OKP (p) ;
+        ph [0] = p [6] ;
+        ph [1] = '\0' ;
+        p = strstr (s, "\"tid\":") ;
+        OKP (p) ;
+        OK (sscanf (p + 6, "%d", &tid) == 1) ;
+        OK (tid >= 0 && tid < 64) ;
+        if (ph [0] == 'B')
+        {
+            OK (depth [tid] < 4) ;
+            strcpy (stack [tid][depth [tid]++], name) ;
+            nb++ ;
+        }
+        else
+        {
+            OK (ph [0] == 'E') ;
+            OK (depth [tid] > 0) ;
+            OK (strcmp (stack [tid][--depth [tid]], name) == 0) ;
+            OKP (strstr (s, "\"args\":{\"flops\":")) ;
+            ne++ ;
+        }
+    }
+    printf ("trace: %d threads, %d begin, %d end events\n", nthreads, nb, ne) ;
+    OK (nb == nevents / 2 && ne == nevents / 2) ;
+    for (int t = 0 ; t < 64 ; t++)
+    {
+        OK (depth [t] == 0) ;
+    }
+    OK (strstr (text, "\"none\"") == NULL) ;
+    OKP (strstr (text, "\"thread \\\"quoted\\\"\"")) ;
+}
+
 //------------------------------------------------------------------------------
 // suitesparse_tests
 //------------------------------------------------------------------------------
@@ -251,6 +595,18 @@ double suitesparse_tests (void)
     }
     SuiteSparse_config_free (p) ;
 
+    //--------------------------------------------------------------------------
+    // memory accounting
+    //--------------------------------------------------------------------------
+
+    memstats_test ( ) ;
+
+    //--------------------------------------------------------------------------
+    // tracing
+    //--------------------------------------------------------------------------
+
+    trace_test ( ) ;
+
     //--------------------------------------------------------------------------
     // return results
     //--------------------------------------------------------------------------
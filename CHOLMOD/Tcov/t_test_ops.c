@@ -328,6 +328,58 @@ double test_ops (cholmod_sparse *A)
 //  printf ("got_sparse3\n") ;
     CHOLMOD(free_sparse) (&C, cm) ;
 
+    // binary file, with no compression (i = 0) and with LZ4 (i = 1)
+    for (i = 0 ; i <= 1 ; i++)
+    {
+        ok = CHOLMOD(write_binary) ("temp4.bin", A, (int) i, cm) ;
+        C = CHOLMOD(read_binary) ("temp4.bin", cm) ;
+        if (ok && C != NULL)
+        {
+            OK (C->stype == A->stype && C->sorted == A->sorted) ;
+            OK (C->dtype == A->dtype) ;
+            if (A->packed && A->xtype != CHOLMOD_ZOMPLEX)
+            {
+                check_equality (A, C, A->xtype) ;
+            }
+            else
+            {
+                // A is written as a packed complex matrix
+                E = CHOLMOD(copy) (A, A->stype, 1, cm) ;
+                if (E != NULL && E->xtype == CHOLMOD_ZOMPLEX)
+                {
+                    CHOLMOD(sparse_xtype) (CHOLMOD_COMPLEX + DTYPE, E, cm) ;
+                }
+                if (E != NULL)
+                {
+                    check_equality (E, C, E->xtype) ;
+                }
+                CHOLMOD(free_sparse) (&E, cm) ;
+            }
+        }
+        CHOLMOD(free_sparse) (&C, cm) ;
+    }
+
+    // binary file of a matrix with no entries, and of a 0-by-0 matrix
+    for (i = 0 ; i <= 1 ; i++)
+    {
+        E = CHOLMOD(spzeros) (i ? 0 : nrow, i ? 0 : ncol, 0,
+            CHOLMOD_REAL + DTYPE, cm) ;
+        ok = CHOLMOD(write_binary) ("temp4.bin", E, 1, cm) ;
+        C = CHOLMOD(read_binary) ("temp4.bin", cm) ;
+        if (ok && C == NULL)
+        {
+            // only fails if out of memory
+            OK (cm->status == CHOLMOD_OUT_OF_MEMORY) ;
+        }
+        else if (ok)
+        {
+            OK (C->nrow == E->nrow && C->ncol == E->ncol) ;
+            OK (CHOLMOD(nnz) (C, cm) == 0) ;
+        }
+        CHOLMOD(free_sparse) (&C, cm) ;
+        CHOLMOD(free_sparse) (&E, cm) ;
+    }
+
     for (i = 0 ; i <= 1 ; i++)
     {
 
@@ -824,7 +876,7 @@ double test_ops (cholmod_sparse *A)
     if (A != NULL && A->nrow == A->ncol)
     {
         int64_t nc, nc_new ;
-        Int cnz, csep, save2 ;
+        Int cnz, csep, save2, save4 ;
         Int *Cnw, *Cew, *Cmember, *CParent, *Perm ;
         double save1 ;
 
@@ -873,6 +925,13 @@ double test_ops (cholmod_sparse *A)
         {
             OK (csep == check_partition (C, Partition)) ;
         }
+
+        // try the interface to Mongoose (fails if compiled with -DNMONGOOSE)
+        csep = CHOLMOD(mongoose_bisector) (C, Cnw, Partition, cm) ;
+        if (csep != EMPTY)
+        {
+            OK (csep == check_partition (C, Partition)) ;
+        }
         CHOLMOD(free) (nrow, sizeof (Int), Cnw, cm) ;
         CHOLMOD(free) (cnz, sizeof (Int), Cew, cm) ;
 
@@ -888,6 +947,17 @@ double test_ops (cholmod_sparse *A)
         cm->method [cm->current].nd_small = 1 ;
         cm->method [cm->current].nd_oksep = 1.0 ;
 
+        // nested dissection with Mongoose as the bisector
+        save4 = cm->method [cm->current].ordering ;
+        cm->method [cm->current].ordering = CHOLMOD_MONGOOSE ;
+        nc = CHOLMOD(nested_dissection) (A, NULL, 0, Perm, CParent, Cmember,
+                cm);
+        if (nc > 0)
+        {
+            OK (CHOLMOD(check_perm) (Perm, n, n, cm)) ;
+        }
+        cm->method [cm->current].ordering = save4 ;
+
         nc = CHOLMOD(nested_dissection) (A, NULL, 0, Perm, CParent, Cmember,
                 cm);
         if (nc > 0)
@@ -1100,6 +1100,10 @@ static int super_sym_to_super_num
     double *Lx = CHOLMOD(malloc) (xs, ex, Common) ;
     RETURN_IF_ERROR ((FALSE)) ;
 
+    // spread the pages of Lx across the memory of all threads
+    SuiteSparse_memory_advise (Lx, xs * ex,
+        SUITESPARSE_MEMORY_INTERLEAVE | SUITESPARSE_MEMORY_HUGEPAGE) ;
+
     //--------------------------------------------------------------------------
     // finalize L and return result
     //--------------------------------------------------------------------------
@@ -24,7 +24,8 @@ if (~verLessThan ('matlab', '8.3.0'))
     d = ['-silent ' d] ;
 end
 
-src = '../Source/colamd_l.c ../../SuiteSparse_config/SuiteSparse_config.c' ;
+src = ['../Source/colamd_l.c ../../SuiteSparse_config/SuiteSparse_config.c ' ...
+    '../../SuiteSparse_config/SuiteSparse_memstats.c'] ;
 cmd = sprintf ( ...
     'mex -O %s -I../../SuiteSparse_config -I../Include -output ', d) ;
 s = [cmd 'colamd2mex colamdmex.c ' src] ;
@@ -32,7 +32,9 @@ help colamd_test
     end
     cmd = sprintf (...
         'mex -O %s -I../../SuiteSparse_config -I../Include ', d) ;
-    src = '../Source/colamd_l.c ../../SuiteSparse_config/SuiteSparse_config.c' ;
+    src = ['../Source/colamd_l.c ' ...
+        '../../SuiteSparse_config/SuiteSparse_config.c ' ...
+        '../../SuiteSparse_config/SuiteSparse_memstats.c'] ;
     if (~(ispc || ismac))
         % for POSIX timing routine
         src = [src ' -lrt'] ;
@@ -47,7 +47,7 @@ if (with_cholmod)
     include = [include ' -I' metis_path '/include'] ;
     include = [include ' -I' metis_path '/GKlib'] ;
     include = [include ' -I' metis_path '/libmetis'] ;
-    include = ['-DNSUPERNODAL -DNMODIFY -DNMATRIXOPS -DNCHECK ' include] ;
+    include = ['-DNSUPERNODAL -DNMODIFY -DNMATRIXOPS -DNCHECK -DNMONGOOSE ' include] ;
 else
     fprintf ('without CHOLMOD, CAMD, CCOLAMD, and METIS\n') ;
     include = ['-DNCHOLMOD ' include] ;
@@ -56,7 +56,11 @@ end
 % do not attempt to compile CHOLMOD with large file support (not needed)
 include = [include ' -DNLARGEFILE'] ;
 
-suitesparse_src = { '../../SuiteSparse_config/SuiteSparse_config' } ;
+suitesparse_src = { ...
+    '../../SuiteSparse_config/SuiteSparse_config', ...
+    '../../SuiteSparse_config/SuiteSparse_memstats', ...
+    '../../SuiteSparse_config/SuiteSparse_trace', ...
+    '../../SuiteSparse_config/SuiteSparse_memory' } ;
 
 amd_src = { ...
     '../../AMD/Source/amd_l1', ...
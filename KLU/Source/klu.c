@@ -164,6 +164,11 @@ size_t KLU_kernel_factor            /* 0 if failure, size of LU if OK */
         return (lusize) ;
     }
 
+    /* the LU factors of a block are computed and used by a single thread, so
+     * only huge pages are requested */
+    SuiteSparse_memory_advise (LU, lusize * sizeof (Unit),
+        SUITESPARSE_MEMORY_HUGEPAGE) ;
+
     /* ---------------------------------------------------------------------- */
     /* factorize */
     /* ---------------------------------------------------------------------- */
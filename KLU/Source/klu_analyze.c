@@ -341,6 +341,7 @@ static KLU_symbolic *order_and_analyze  /* returns NULL if error, or a valid
     /* ---------------------------------------------------------------------- */
 
     Common->work = 0 ;
+    SuiteSparse_trace_begin ("KLU", "ordering") ;
 
     if (do_btf)
     {
@@ -351,6 +352,7 @@ static KLU_symbolic *order_and_analyze  /* returns NULL if error, or a valid
             KLU_free (Pbtf, n, sizeof (Int), Common) ;
             KLU_free (Qbtf, n, sizeof (Int), Common) ;
             KLU_free_symbolic (&Symbolic, Common) ;
+            SuiteSparse_trace_end ("KLU", "ordering", 0, 0) ;
             return (NULL) ;
         }
 
@@ -420,6 +422,7 @@ static KLU_symbolic *order_and_analyze  /* returns NULL if error, or a valid
             ordering, P, Q, Lnz, Pblk, Cp, Ci, Cilen, Pinv, Symbolic, Common) ;
         PRINTF (("analyze_worker done\n")) ;
     }
+    SuiteSparse_trace_end ("KLU", "ordering", 0, 0) ;
 
     /* ---------------------------------------------------------------------- */
     /* free all workspace */
@@ -483,6 +486,10 @@ KLU_symbolic *KLU_analyze       /* returns NULL if error, or a valid
     else
     {
         /* order with P and Q */
-        return (order_and_analyze (n, Ap, Ai, Common)) ;
+        KLU_symbolic *Symbolic ;
+        SuiteSparse_trace_begin ("KLU", "symbolic") ;
+        Symbolic = order_and_analyze (n, Ap, Ai, Common) ;
+        SuiteSparse_trace_end ("KLU", "symbolic", 0, 0) ;
+        return (Symbolic) ;
     }
 }
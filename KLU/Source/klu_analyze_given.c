@@ -164,6 +164,7 @@ KLU_symbolic *KLU_analyze_given     /* returns NULL if error, or a valid
     {
         return (NULL) ;
     }
+    SuiteSparse_trace_begin ("KLU", "symbolic") ;
     P = Symbolic->P ;
     Q = Symbolic->Q ;
     R = Symbolic->R ;
@@ -233,6 +234,7 @@ KLU_symbolic *KLU_analyze_given     /* returns NULL if error, or a valid
             }
             KLU_free_symbolic (&Symbolic, Common) ;
             Common->status = KLU_OUT_OF_MEMORY ;
+            SuiteSparse_trace_end ("KLU", "symbolic", 0, 0) ;
             return (NULL) ;
         }
 
@@ -371,5 +373,6 @@ KLU_symbolic *KLU_analyze_given     /* returns NULL if error, or a valid
     Symbolic->unz = EMPTY ;
     Symbolic->nzoff = nzoff ;
 
+    SuiteSparse_trace_end ("KLU", "symbolic", 0, 0) ;
     return (Symbolic) ;
 }
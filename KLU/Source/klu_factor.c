@@ -518,7 +518,11 @@ KLU_numeric *KLU_factor         /* returns NULL if error, or a valid
     /* factorize the blocks */
     /* ---------------------------------------------------------------------- */
 
+    SuiteSparse_trace_begin ("KLU", "numeric") ;
     factor2 (Ap, Ai, (Entry *) Ax, Symbolic, Numeric, Common) ;
+    SuiteSparse_trace_end ("KLU", "numeric", 0,
+        (Common->status == KLU_OK) ?
+        ((double) Numeric->lnz + Numeric->unz) * sizeof (Entry) : 0) ;
 
     /* ---------------------------------------------------------------------- */
     /* return or free the Numeric object */
@@ -787,6 +787,8 @@ size_t KLU_kernel   /* final size of LU on output */
                 return (lusize) ;
             }
             lusize = newlusize ;
+            SuiteSparse_memory_advise (LU, lusize * sizeof (Unit),
+                SUITESPARSE_MEMORY_HUGEPAGE) ;
             PRINTF (("inc LU to %d done\n", lusize)) ;
         }
 
@@ -125,6 +125,7 @@ int KLU_refactor        /* returns TRUE if successful, FALSE otherwise */
             return (FALSE) ;
         }
     }
+    SuiteSparse_trace_begin ("KLU", "numeric") ;
 
     /* ---------------------------------------------------------------------- */
     /* clear workspace X */
@@ -262,6 +263,7 @@ int KLU_refactor        /* returns TRUE if successful, FALSE otherwise */
                         if (Common->halt_if_singular)
                         {
                             /* do not continue the factorization */
+                            SuiteSparse_trace_end ("KLU", "numeric", 0, 0) ;
                             return (FALSE) ;
                         }
                     }
@@ -406,6 +408,7 @@ int KLU_refactor        /* returns TRUE if successful, FALSE otherwise */
                         if (Common->halt_if_singular)
                         {
                             /* do not continue the factorization */
+                            SuiteSparse_trace_end ("KLU", "numeric", 0, 0) ;
                             return (FALSE) ;
                         }
                     }
@@ -476,5 +479,6 @@ int KLU_refactor        /* returns TRUE if successful, FALSE otherwise */
     }
 #endif
 
+    SuiteSparse_trace_end ("KLU", "numeric", 0, 0) ;
     return (TRUE) ;
 }
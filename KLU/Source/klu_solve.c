@@ -54,6 +54,7 @@ int KLU_solve
         return (FALSE) ;
     }
     Common->status = KLU_OK ;
+    SuiteSparse_trace_begin ("KLU", "solve") ;
 
     /* ---------------------------------------------------------------------- */
     /* get the contents of the Symbolic object */
@@ -398,5 +399,6 @@ int KLU_solve
 
         Bz  += d*4 ;
     }
+    SuiteSparse_trace_end ("KLU", "solve", 0, 0) ;
     return (TRUE) ;
 }
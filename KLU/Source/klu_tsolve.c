@@ -59,6 +59,7 @@ int KLU_tsolve
         return (FALSE) ;
     }
     Common->status = KLU_OK ;
+    SuiteSparse_trace_begin ("KLU", "solve") ;
 
     /* ---------------------------------------------------------------------- */
     /* get the contents of the Symbolic object */
@@ -467,5 +468,6 @@ int KLU_tsolve
 
         Bz  += d*4 ;
     }
+    SuiteSparse_trace_end ("KLU", "solve", 0, 0) ;
     return (TRUE) ;
 }
@@ -110,6 +110,13 @@ struct EdgeCut_Options
     double soft_split_tolerance; /* The allowable soft split tolerance.      */
     /* Cuts within this tolerance are treated   */
     /* equally.                                 */
+    double kway_imbalance_tolerance; /* kway_cut: no part may weigh more
+                                        than (1 + tol) W / k.       */
+
+    /** Parallelism **********************************************************/
+    Int num_threads; /* # of OpenMP threads to use for coarsening. 1 (the
+                        default) uses the serial algorithms; 0 uses
+                        the default number of OpenMP threads.        */
 
     /* Constructor & Destructor */
     static EdgeCut_Options *create();
@@ -190,6 +197,36 @@ struct EdgeCut
 EdgeCut *edge_cut(const Graph *);
 EdgeCut *edge_cut(const Graph *, const EdgeCut_Options *);
 
+struct KWayCut
+{
+    Int *part;           /** Part (0 to k-1) of each vertex  */
+    Int n;               /** # vertices                      */
+    Int k;               /** # parts                         */
+
+    /** Cut Cost Metrics *****************************************************/
+    double cut_cost;     /** Sum of edge weights in cut set    */
+    Int cut_size;        /** Number of edges in cut set        */
+    double *part_weight; /** Sum of vertex weights of each part */
+    double imbalance;    /** Degree to which the partitioning
+                             is imbalanced, and this is
+                             computed as (max part_weight)k/W - 1. */
+
+    // destructor (no constructor)
+    ~KWayCut();
+};
+
+/**
+ * Partition a Graph into k parts.
+ *
+ * The graph is coarsened once, an initial k-way partition of the coarsest
+ * graph is found by recursive bisection, and the partition is then refined
+ * by k-way Fidducia-Mattheyes as it is projected back to the input graph.
+ * No part weighs more than (1 + options->kway_imbalance_tolerance) W / k,
+ * unless the vertex weights make this impossible.
+ */
+KWayCut *kway_cut(const Graph *, Int k);
+KWayCut *kway_cut(const Graph *, Int k, const EdgeCut_Options *);
+
 /* Version information */
 int major_version();
 int minor_version();
@@ -0,0 +1,54 @@
+/* ========================================================================== */
+/* === Include/Mongoose_C.h ================================================= */
+/* ========================================================================== */
+
+/* -----------------------------------------------------------------------------
+ * Mongoose Graph Partitioning Library, Copyright (C) 2017-2023,
+ * Scott P. Kolodziej, Nuri S. Yeralan, Timothy A. Davis, William W. Hager
+ * Mongoose is licensed under Version 3 of the GNU General Public License.
+ * Mongoose is also available under other licenses; contact authors for details.
+ * SPDX-License-Identifier: GPL-3.0-only
+ * -------------------------------------------------------------------------- */
+
+/**
+ * C interface to Mongoose.
+ *
+ * mongoose_vertex_separator finds a vertex separator of a graph, for use by
+ * nested dissection orderings (CHOLMOD's CHOLMOD_MONGOOSE ordering, for
+ * example). Mongoose first finds an edge cut of the graph, and the separator
+ * is then a minimum vertex cover of the cut edges, found by the Hopcroft-Karp
+ * matching algorithm and Konig's theorem.
+ */
+
+#ifndef MONGOOSE_C_H
+#define MONGOOSE_C_H
+
+#include "SuiteSparse_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int64_t mongoose_vertex_separator   /* returns separator weight, or -1 if
+                                       out of memory */
+(
+    /* input, not modified: */
+    int64_t n,              /* # of vertices                                */
+    const int64_t *Gp,      /* size n+1, column pointers                    */
+    const int64_t *Gi,      /* size Gp [n], row indices.  The graph must be
+                               symmetric, with no self edges.               */
+    const int64_t *Gw,      /* size n, vertex weights (each > 0), or NULL
+                               if all vertices have weight one.             */
+    int num_threads,        /* # of OpenMP threads for coarsening: 1 uses
+                               the serial algorithms, 0 the OpenMP default. */
+    /* output: */
+    int64_t *Part           /* size n.  Part [j] is 0 or 1 if vertex j is
+                               in the left or right part of the graph, and
+                               2 if it is in the separator.                 */
+) ;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -52,6 +52,14 @@ struct EdgeCut_Options
     double soft_split_tolerance; /* The allowable soft split tolerance.      */
                                /* Cuts within this tolerance are treated   */
                                /* equally.                                 */
+    double kway_imbalance_tolerance; /* kway_cut: no part may weigh more
+                                        than (1 + tol) W / k.       */
+
+    /** Parallelism **********************************************************/
+    Int num_threads; /* # of OpenMP threads for coarsening and
+                        refinement. 1 (the default) uses the serial
+                        algorithms; 0 uses the default number of
+                        OpenMP threads.                              */
 
     /* Constructor & Destructor */
     static EdgeCut_Options *create();
@@ -0,0 +1,61 @@
+/* ========================================================================== */
+/* === Include/Mongoose_ImproveKWayFM.hpp =================================== */
+/* ========================================================================== */
+
+/* -----------------------------------------------------------------------------
+ * Mongoose Graph Partitioning Library, Copyright (C) 2017-2023,
+ * Scott P. Kolodziej, Nuri S. Yeralan, Timothy A. Davis, William W. Hager
+ * Mongoose is licensed under Version 3 of the GNU General Public License.
+ * Mongoose is also available under other licenses; contact authors for details.
+ * SPDX-License-Identifier: GPL-3.0-only
+ * -------------------------------------------------------------------------- */
+
+// #pragma once
+#ifndef MONGOOSE_IMPROVEKWAYFM_HPP
+#define MONGOOSE_IMPROVEKWAYFM_HPP
+
+#include "Mongoose_EdgeCutOptions.hpp"
+#include "Mongoose_EdgeCutProblem.hpp"
+#include "Mongoose_Internal.hpp"
+
+namespace Mongoose
+{
+
+/* Workspace for k-way refinement, sized for the finest graph. */
+class KWayFM
+{
+public:
+    Int n; /** max # vertices                                     */
+    Int k; /** # parts                                            */
+
+    /** Gain Heap ************************************************************/
+    Int *heap;      /** Max heap of vertices, organized by key          */
+    Int *heapIndex; /** Position of a vertex in the heap, or -1 if the
+                        vertex is not in the heap, or -2 if it is locked */
+    double *key;    /** Gain of the best move of each vertex            */
+    Int heapSize;   /** Size of the heap                                */
+
+    /** Move Log *************************************************************/
+    Int *moves;    /** Vertices moved during an FM pass, in order        */
+    Int *moveFrom; /** Part each moved vertex came from                  */
+
+    /** Connectivity *********************************************************/
+    Int *where;    /** Position of a part in touched, or -1 (size k)     */
+    Int *touched;  /** Parts adjacent to the current vertex (size k)     */
+    double *conn;  /** Edge weight from the current vertex to each
+                       touched part (size k)                             */
+
+    /* Constructor & Destructor */
+    static KWayFM *create(Int n, Int k);
+    ~KWayFM();
+};
+
+void balanceKWayCut(EdgeCutProblem *graph, Int *part, double *partWeight,
+                    double maxWeight, KWayFM *ws);
+void improveKWayCutUsingFM(EdgeCutProblem *graph, const EdgeCut_Options *options,
+                           Int *part, double *partWeight, double maxWeight,
+                           KWayFM *ws);
+
+} // end namespace Mongoose
+
+#endif
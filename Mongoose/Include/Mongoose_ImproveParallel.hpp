@@ -0,0 +1,47 @@
+/* ========================================================================== */
+/* === Include/Mongoose_ImproveParallel.hpp ================================= */
+/* ========================================================================== */
+
+/* -----------------------------------------------------------------------------
+ * Mongoose Graph Partitioning Library, Copyright (C) 2017-2023,
+ * Scott P. Kolodziej, Nuri S. Yeralan, Timothy A. Davis, William W. Hager
+ * Mongoose is licensed under Version 3 of the GNU General Public License.
+ * Mongoose is also available under other licenses; contact authors for details.
+ * SPDX-License-Identifier: GPL-3.0-only
+ * -------------------------------------------------------------------------- */
+
+/**
+ * Parallel boundary refinement
+ *
+ * The serial FM refinement moves one vertex at a time, keeping the boundary
+ * heaps up to date after each move. On large graphs, improveCutInParallel
+ * first makes rounds of moves in parallel: each round moves boundary vertices
+ * with positive gain, all from the same part, as long as the balance does not
+ * get worse than the soft split tolerance (or the current imbalance, if that
+ * is larger). Since all the vertices move in the same direction, the cut is
+ * reduced by at least the sum of their gains. The gains are then recomputed
+ * in parallel, and the boundary heaps rebuilt once at the end. The vertices
+ * are split into fixed-size blocks, so the moves do not depend on the number
+ * of threads.
+ */
+
+// #pragma once
+#ifndef MONGOOSE_IMPROVEPARALLEL_HPP
+#define MONGOOSE_IMPROVEPARALLEL_HPP
+
+#include "Mongoose_EdgeCutOptions.hpp"
+#include "Mongoose_EdgeCutProblem.hpp"
+#include "Mongoose_Internal.hpp"
+
+namespace Mongoose
+{
+
+int getRefineThreads(const EdgeCutProblem *, const EdgeCut_Options *);
+bool improveCutInParallel(EdgeCutProblem *, const EdgeCut_Options *,
+                          int nthreads);
+bool swapInParallel(EdgeCutProblem *, const EdgeCut_Options *,
+                    const double *x, int nthreads);
+
+} // end namespace Mongoose
+
+#endif
@@ -0,0 +1,47 @@
+/* ========================================================================== */
+/* === Include/Mongoose_KWayCut.hpp ========================================= */
+/* ========================================================================== */
+
+/* -----------------------------------------------------------------------------
+ * Mongoose Graph Partitioning Library, Copyright (C) 2017-2023,
+ * Scott P. Kolodziej, Nuri S. Yeralan, Timothy A. Davis, William W. Hager
+ * Mongoose is licensed under Version 3 of the GNU General Public License.
+ * Mongoose is also available under other licenses; contact authors for details.
+ * SPDX-License-Identifier: GPL-3.0-only
+ * -------------------------------------------------------------------------- */
+
+// #pragma once
+#ifndef MONGOOSE_KWAYCUT_HPP
+#define MONGOOSE_KWAYCUT_HPP
+
+#include "Mongoose_Graph.hpp"
+#include "Mongoose_EdgeCutOptions.hpp"
+#include "Mongoose_EdgeCutProblem.hpp"
+
+namespace Mongoose
+{
+
+struct KWayCut
+{
+    Int *part;           /** Part (0 to k-1) of each vertex  */
+    Int n;               /** # vertices                      */
+    Int k;               /** # parts                         */
+
+    /** Cut Cost Metrics *****************************************************/
+    double cut_cost;     /** Sum of edge weights in cut set    */
+    Int cut_size;        /** Number of edges in cut set        */
+    double *part_weight; /** Sum of vertex weights of each part */
+    double imbalance;    /** Degree to which the partitioning
+                             is imbalanced, and this is
+                             computed as (max part_weight)k/W - 1. */
+
+    // destructor (no constructor)
+    ~KWayCut();
+};
+
+KWayCut *kway_cut(const Graph *, Int k);
+KWayCut *kway_cut(const Graph *, Int k, const EdgeCut_Options *);
+
+} // end namespace Mongoose
+
+#endif
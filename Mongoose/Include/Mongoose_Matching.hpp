@@ -25,6 +25,7 @@ void match(EdgeCutProblem *, const EdgeCut_Options *);
 
 void matching_Random(EdgeCutProblem *, const EdgeCut_Options *);
 void matching_HEM(EdgeCutProblem *, const EdgeCut_Options *);
+void matching_Handshake(EdgeCutProblem *, const EdgeCut_Options *);
 void matching_SR(EdgeCutProblem *, const EdgeCut_Options *);
 void matching_SRdeg(EdgeCutProblem *, const EdgeCut_Options *);
 void matching_Cleanup(EdgeCutProblem *, const EdgeCut_Options *);
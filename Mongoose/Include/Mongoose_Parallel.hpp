@@ -0,0 +1,41 @@
+/* ========================================================================== */
+/* === Include/Mongoose_Parallel.hpp ======================================== */
+/* ========================================================================== */
+
+/* -----------------------------------------------------------------------------
+ * Mongoose Graph Partitioning Library, Copyright (C) 2017-2023,
+ * Scott P. Kolodziej, Nuri S. Yeralan, Timothy A. Davis, William W. Hager
+ * Mongoose is licensed under Version 3 of the GNU General Public License.
+ * Mongoose is also available under other licenses; contact authors for details.
+ * SPDX-License-Identifier: GPL-3.0-only
+ * -------------------------------------------------------------------------- */
+
+/**
+ * Thread control for the OpenMP parallel parts of Mongoose
+ *
+ * If options->num_threads is not 1, the parallel algorithms are used. Their
+ * results do not depend on the number of threads, which is chosen according to
+ * the work to be done (at most options->num_threads, or the default number of
+ * OpenMP threads if options->num_threads is zero). If Mongoose is compiled
+ * without OpenMP, the parallel algorithms are run with a single thread.
+ */
+
+// #pragma once
+#ifndef MONGOOSE_PARALLEL_HPP
+#define MONGOOSE_PARALLEL_HPP
+
+#include "Mongoose_EdgeCutOptions.hpp"
+#include "Mongoose_Internal.hpp"
+
+/* Minimum amount of work (edges scanned) given to each thread */
+#define MONGOOSE_PARALLEL_CHUNK 16384
+
+namespace Mongoose
+{
+
+bool useParallel(const EdgeCut_Options *options);
+int getNumThreads(const EdgeCut_Options *options, double work);
+
+} // end namespace Mongoose
+
+#endif
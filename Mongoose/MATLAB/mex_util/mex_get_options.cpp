@@ -58,6 +58,10 @@ EdgeCut_Options *mex_get_options
     /** Final Partition Target Metrics ***************************************/
     MEX_STRUCT_READDOUBLE(target_split);
     MEX_STRUCT_READDOUBLE(soft_split_tolerance);
+    MEX_STRUCT_READDOUBLE(kway_imbalance_tolerance);
+
+    /** Parallelism **********************************************************/
+    MEX_STRUCT_READINT(num_threads);
 
     return returner;
 }
@@ -50,6 +50,10 @@ mxArray *mex_put_options
     /** Final Partition Target Metrics ***************************************/
     MEX_STRUCT_PUT(target_split);
     MEX_STRUCT_PUT(soft_split_tolerance);
+    MEX_STRUCT_PUT(kway_imbalance_tolerance);
+
+    /** Parallelism **********************************************************/
+    MEX_STRUCT_PUT(num_threads);
 
     return returner;
 }
@@ -54,10 +54,12 @@ lib = strrep (lib, '/', filesep) ;
 %-------------------------------------------------------------------------------
 
 config_src = {
-    '../../SuiteSparse_config/SuiteSparse_config' };
+    '../../SuiteSparse_config/SuiteSparse_config', ...
+    '../../SuiteSparse_config/SuiteSparse_memstats' };
 
 mongoose_src = {
     '../Source/Mongoose_BoundaryHeap', ...
+    '../Source/Mongoose_C', ...
     '../Source/Mongoose_Coarsening', ...
     '../Source/Mongoose_CSparse', ...
     '../Source/Mongoose_EdgeCut', ...
@@ -66,9 +68,13 @@ mongoose_src = {
     '../Source/Mongoose_Graph', ...
     '../Source/Mongoose_GuessCut', ...
     '../Source/Mongoose_ImproveFM', ...
+    '../Source/Mongoose_ImproveKWayFM', ...
+    '../Source/Mongoose_ImproveParallel', ...
     '../Source/Mongoose_ImproveQP', ...
+    '../Source/Mongoose_KWayCut', ...
     '../Source/Mongoose_Logger', ...
     '../Source/Mongoose_Matching', ...
+    '../Source/Mongoose_Parallel', ...
     '../Source/Mongoose_QPBoundary', ...
     '../Source/Mongoose_QPDelta', ...
     '../Source/Mongoose_QPGradProj', ...
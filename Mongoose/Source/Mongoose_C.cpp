@@ -0,0 +1,340 @@
+/* ========================================================================== */
+/* === Source/Mongoose_C.cpp ================================================ */
+/* ========================================================================== */
+
+/* -----------------------------------------------------------------------------
+ * Mongoose Graph Partitioning Library, Copyright (C) 2017-2023,
+ * Scott P. Kolodziej, Nuri S. Yeralan, Timothy A. Davis, William W. Hager
+ * Mongoose is licensed under Version 3 of the GNU General Public License.
+ * Mongoose is also available under other licenses; contact authors for details.
+ * SPDX-License-Identifier: GPL-3.0-only
+ * -------------------------------------------------------------------------- */
+
+/**
+ * C interface to Mongoose: vertex separators from edge cuts.
+ *
+ * The cut edges of an edge cut form a bipartite graph between the boundary
+ * vertices of the two parts, and any vertex cover of it is a vertex separator
+ * of the whole graph. By Konig's theorem, a maximum matching of the bipartite
+ * graph (found here with the Hopcroft-Karp algorithm) gives a cover with the
+ * fewest vertices. For weighted graphs, the lighter of that cover and the
+ * boundary of either part is used.
+ */
+
+#include "Mongoose_C.h"
+#include "Mongoose_EdgeCut.hpp"
+#include "Mongoose_Internal.hpp"
+
+namespace Mongoose
+{
+
+//-----------------------------------------------------------------------------
+// Find a maximum matching of the cut edges by the Hopcroft-Karp algorithm.
+// Vertices on side false are the "left" vertices from which the augmenting
+// paths start. On output, match[v] is the vertex matched to v, or -1.
+//-----------------------------------------------------------------------------
+static void matchCutEdges(Int n, const Int *Gp, const Int *Gi, const bool *side,
+                          Int *match, Int *dist, Int *queue, Int *stack,
+                          Int *next)
+{
+    const Int unreached = n + 1;
+
+    for (Int v = 0; v < n; v++)
+        match[v] = -1;
+
+    /* Greedy initial matching. */
+    for (Int v = 0; v < n; v++)
+    {
+        if (side[v])
+            continue;
+        for (Int p = Gp[v]; p < Gp[v + 1]; p++)
+        {
+            Int u = Gi[p];
+            if (side[u] && match[u] == -1)
+            {
+                match[u] = v;
+                match[v] = u;
+                break;
+            }
+        }
+    }
+
+    while (true)
+    {
+        /* Breadth-first search from the free left vertices, layering the
+         * left vertices by the length of the shortest alternating path. */
+        Int head = 0, tail = 0;
+        for (Int v = 0; v < n; v++)
+        {
+            dist[v] = unreached;
+            if (!side[v] && match[v] == -1)
+            {
+                dist[v]       = 0;
+                queue[tail++] = v;
+            }
+        }
+
+        bool found = false;
+        while (head < tail)
+        {
+            Int v = queue[head++];
+            for (Int p = Gp[v]; p < Gp[v + 1]; p++)
+            {
+                Int u = Gi[p];
+                if (!side[u])
+                    continue;
+                Int w = match[u];
+                if (w == -1)
+                {
+                    found = true;
+                }
+                else if (dist[w] == unreached)
+                {
+                    dist[w]       = dist[v] + 1;
+                    queue[tail++] = w;
+                }
+            }
+        }
+
+        if (!found)
+            break;
+
+        /* Find vertex-disjoint shortest augmenting paths by depth-first
+         * search along the layers. next[v] is the edge of v to try next. */
+        for (Int v = 0; v < n; v++)
+            next[v] = Gp[v];
+
+        for (Int root = 0; root < n; root++)
+        {
+            if (side[root] || match[root] != -1)
+                continue;
+
+            Int top    = 0;
+            stack[0]   = root;
+            while (top >= 0)
+            {
+                Int v        = stack[top];
+                bool advance = false;
+                for (; next[v] < Gp[v + 1]; next[v]++)
+                {
+                    Int u = Gi[next[v]];
+                    if (!side[u])
+                        continue;
+                    Int w = match[u];
+                    if (w == -1)
+                    {
+                        /* Augment along the path on the stack. */
+                        for (Int k = top; k >= 0; k--)
+                        {
+                            Int x    = stack[k];
+                            Int y    = Gi[next[x]];
+                            match[x] = y;
+                            match[y] = x;
+                        }
+                        top = -1;
+                        break;
+                    }
+                    if (dist[w] == dist[v] + 1)
+                    {
+                        stack[++top] = w;
+                        advance      = true;
+                        break;
+                    }
+                }
+
+                if (top >= 0 && !advance)
+                {
+                    /* Dead end: no augmenting path goes through v. */
+                    dist[v] = unreached;
+                    top--;
+                    if (top >= 0)
+                        next[stack[top]]++;
+                }
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Turn an edge cut into a vertex separator. On output, Part[v] is 0 or 1
+// according to side[v], or 2 if v is in the separator. Returns the weight of
+// the separator, or -1 if out of memory.
+//-----------------------------------------------------------------------------
+static Int coverCutEdges(Int n, const Int *Gp, const Int *Gi, const Int *Gw,
+                         const bool *side, Int *Part)
+{
+    size_t ns  = static_cast<size_t>(n);
+    Int *match = (Int *)SuiteSparse_malloc(ns, sizeof(Int));
+    Int *dist  = (Int *)SuiteSparse_malloc(ns, sizeof(Int));
+    Int *queue = (Int *)SuiteSparse_malloc(ns, sizeof(Int));
+    Int *stack = (Int *)SuiteSparse_malloc(ns, sizeof(Int));
+    Int *next  = (Int *)SuiteSparse_malloc(ns, sizeof(Int));
+
+    if (!match || !dist || !queue || !stack || !next)
+    {
+        SuiteSparse_free(match);
+        SuiteSparse_free(dist);
+        SuiteSparse_free(queue);
+        SuiteSparse_free(stack);
+        SuiteSparse_free(next);
+        return -1;
+    }
+
+    matchCutEdges(n, Gp, Gi, side, match, dist, queue, stack, next);
+
+    /* Mark the vertices reachable by alternating paths from the free left
+     * vertices (dist is reused as the mark). Konig's cover is the unmarked
+     * left boundary and the marked right boundary. */
+    Int head = 0, tail = 0;
+    for (Int v = 0; v < n; v++)
+    {
+        dist[v] = (!side[v] && match[v] == -1);
+        if (dist[v])
+            queue[tail++] = v;
+    }
+    while (head < tail)
+    {
+        Int v = queue[head++];
+        for (Int p = Gp[v]; p < Gp[v + 1]; p++)
+        {
+            Int u = Gi[p];
+            if (side[u] && !dist[u])
+            {
+                /* u is matched, or the matching would not be maximum. */
+                Int w   = match[u];
+                dist[u] = 1;
+                if (w >= 0 && !dist[w])
+                {
+                    dist[w]       = 1;
+                    queue[tail++] = w;
+                }
+            }
+        }
+    }
+
+    /* Weigh the Konig cover and the boundary of each part. */
+    Int coverWeight = 0, leftWeight = 0, rightWeight = 0;
+    for (Int v = 0; v < n; v++)
+    {
+        bool boundary = false;
+        for (Int p = Gp[v]; p < Gp[v + 1] && !boundary; p++)
+            boundary = (side[Gi[p]] != side[v]);
+        Int vw = (Gw) ? Gw[v] : 1;
+
+        /* next[v] is 1 if v is in the cover, 0 otherwise. */
+        next[v] = boundary && (side[v] == (dist[v] != 0));
+        if (next[v])
+            coverWeight += vw;
+        if (boundary && side[v])
+            rightWeight += vw;
+        else if (boundary)
+            leftWeight += vw;
+
+        /* stack[v] is 1 if v is on the boundary, 0 otherwise. */
+        stack[v] = boundary;
+    }
+
+    Int sepWeight = coverWeight;
+    int choice    = 0;
+    if (leftWeight < sepWeight)
+    {
+        sepWeight = leftWeight;
+        choice    = 1;
+    }
+    if (rightWeight < sepWeight)
+    {
+        sepWeight = rightWeight;
+        choice    = 2;
+    }
+
+    for (Int v = 0; v < n; v++)
+    {
+        bool inSep = (choice == 0)   ? (next[v] != 0)
+                     : (choice == 1) ? (stack[v] && !side[v])
+                                     : (stack[v] && side[v]);
+        Part[v] = (inSep) ? 2 : (side[v] ? 1 : 0);
+    }
+
+    SuiteSparse_free(match);
+    SuiteSparse_free(dist);
+    SuiteSparse_free(queue);
+    SuiteSparse_free(stack);
+    SuiteSparse_free(next);
+
+    return sepWeight;
+}
+
+} // end namespace Mongoose
+
+using namespace Mongoose;
+
+int64_t mongoose_vertex_separator(int64_t n, const int64_t *Gp,
+                                  const int64_t *Gi, const int64_t *Gw,
+                                  int num_threads, int64_t *Part)
+{
+    if (n < 0 || !Gp || !Gi || !Part)
+        return -1;
+
+    size_t ns  = static_cast<size_t>(n);
+    bool *side = (bool *)SuiteSparse_malloc(ns, sizeof(bool));
+    double *w  = (Gw) ? (double *)SuiteSparse_malloc(ns, sizeof(double)) : NULL;
+
+    if (!side || (Gw && !w))
+    {
+        SuiteSparse_free(side);
+        SuiteSparse_free(w);
+        return -1;
+    }
+
+    double W = 0.0;
+    for (Int v = 0; v < n; v++)
+    {
+        double vw = (Gw) ? static_cast<double>(Gw[v]) : 1;
+        if (w)
+            w[v] = vw;
+        W += vw;
+    }
+
+    bool ok = true;
+    if (Gp[n] == 0)
+    {
+        /* There are no edges to cut, so split the vertices by weight. */
+        double W0 = 0.0;
+        for (Int v = 0; v < n; v++)
+        {
+            side[v] = (W0 >= W / 2);
+            W0 += (w) ? w[v] : 1;
+        }
+    }
+    else
+    {
+        EdgeCut_Options *options = EdgeCut_Options::create();
+        Graph *G = Graph::create(n, Gp[n], const_cast<Int *>(Gp),
+                                 const_cast<Int *>(Gi), NULL, w);
+        EdgeCut *cut = NULL;
+        if (options && G)
+        {
+            options->num_threads = num_threads;
+            cut                  = edge_cut(G, options);
+        }
+
+        ok = (cut != NULL);
+        if (ok)
+        {
+            for (Int v = 0; v < n; v++)
+                side[v] = cut->partition[v];
+            cut->~EdgeCut();
+        }
+        if (G)
+            G->~Graph();
+        if (options)
+            options->~EdgeCut_Options();
+    }
+
+    Int sepWeight = (ok) ? coverCutEdges(n, Gp, Gi, Gw, side, Part) : -1;
+
+    SuiteSparse_free(side);
+    SuiteSparse_free(w);
+
+    return sepWeight;
+}
@@ -17,44 +17,294 @@
  * done to reduce the size of the graph while maintaining its overall structure.
  * Given a matching of vertices with other vertices (e.g. heavy edge matching,
  * random, etc.), coarsening constructs the new, coarsened graph.
+ *
+ * If options->num_threads is not 1, the coarse graph is constructed in
+ * parallel, giving the same graph as the serial construction.
  */
 
 #include "Mongoose_Coarsening.hpp"
 #include "Mongoose_Debug.hpp"
 #include "Mongoose_Internal.hpp"
 #include "Mongoose_Logger.hpp"
+#include "Mongoose_Parallel.hpp"
+
+#include <algorithm>
 
 namespace Mongoose
 {
 
+/* Hash of a coarse vertex, for the hash tables of coarsen_parallel */
+static inline Int coarsenHash(Int vertex, Int hmask)
+{
+    return (Int)(((uint64_t)vertex * 0x9E3779B97F4A7C15ULL) >> 32) & hmask;
+}
+
 /**
- * @brief Coarsen a Graph given a previously calculated matching
- *
- * Given a Graph @p G, coarsen returns a new Graph that is coarsened according
- * to the matching given by G->matching, G->matchmap, and G->invmatchmap.
- * G->matching must be built such that matching[a] = b+1 and matching[b] = a+1
- * if vertices a and b are matched. G->matchmap is a mapping from fine to coarse
- * vertices, so matchmap[a] = matchmap[b] = c if vertices a and b are matched
- * and mapped to vertex c in the coarse graph. Likewise, G->invmatchmap is
- * one possible inverse of G->matchmap, so invmatchmap[c] = a or
- * invmatchmap[c] = b if a coarsened vertex c represents the matching of
- * vertices a and b in the refined graph.
+ * @brief Construct the columns of a coarse graph in parallel
  *
- * @code
- * Graph coarsened_graph = coarsen(large_graph, options);
- * @endcode
+ * The coarse vertices are split into one contiguous block per thread, with
+ * roughly equal numbers of fine edges. Each thread builds the columns of its
+ * block in its own bucket, a part of a workspace as large as the fine graph,
+ * using a small hash table (sized by the largest column in its block) in
+ * place of the O(cn) hash table of the serial code. The buckets are then
+ * copied into place. Each column is built exactly as in the serial code, so
+ * the coarse graph is the same.
  *
- * @param graph Graph to be coarsened
- * @param options Option struct specifying if debug checks should be done
- * @return A coarsened version of G
- * @note Allocates memory for the coarsened graph, but frees on error.
+ * @param graph The fine graph, with its matching
+ * @param coarseGraph The coarse graph, whose columns are constructed
+ * @param nthreads The number of threads to use
+ * @return true if successful, false if out of memory (in which case
+ *         the serial code is used instead)
  */
-EdgeCutProblem *coarsen(EdgeCutProblem *graph, const EdgeCut_Options *options)
+static bool coarsen_parallel(EdgeCutProblem *graph,
+                             EdgeCutProblem *coarseGraph, int nthreads)
 {
-    (void)options; // Unused variable
+    Int cn     = graph->cn;
+    Int *Gp    = graph->p;
+    Int *Gi    = graph->i;
+    double *Gx = graph->x;
+    double *Gw = graph->w;
 
-    Logger::tic(CoarseningTiming);
+    Int *matchmap    = graph->matchmap;
+    Int *invmatchmap = graph->invmatchmap;
+
+    Int *Cp       = coarseGraph->p;
+    Int *Ci       = coarseGraph->i;
+    double *Cx    = coarseGraph->x;
+    double *Cw    = coarseGraph->w;
+    double *gains = coarseGraph->vertexGains;
+
+    /* Find the number of fine edges of each coarse vertex, and their
+     * cumulative sum in Cp, which bounds the size of each column. */
+    Cp[0] = 0;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (Int k = 0; k < cn; k++)
+    {
+        Int v0     = invmatchmap[k];
+        Int v1     = graph->getMatch(v0);
+        Int degree = Gp[v0 + 1] - Gp[v0];
+        if (v1 != v0)
+        {
+            degree += Gp[v1 + 1] - Gp[v1];
+            Int v2 = graph->getMatch(v1);
+            if (v2 != v0)
+                degree += Gp[v2 + 1] - Gp[v2];
+        }
+        Cp[k + 1] = degree;
+    }
+    for (Int k = 0; k < cn; k++)
+    {
+        Cp[k + 1] += Cp[k];
+    }
+    Int bound = Cp[cn];
+
+    /* Block [t..t+1]-1 are the coarse vertices of thread t, whose bucket
+     * starts at Boff [t] in Bi and Bx and has Bnz [t] entries. Hsize [t] is
+     * the size of its hash table. */
+    size_t nt  = static_cast<size_t>(nthreads);
+    Int *Block = (Int *)SuiteSparse_malloc(4 * nt + 1, sizeof(Int));
+    Int *Bi = (Int *)SuiteSparse_malloc(static_cast<size_t>(bound) + 1,
+                                        sizeof(Int));
+    double *Bx = (double *)SuiteSparse_malloc(static_cast<size_t>(bound) + 1,
+                                              sizeof(double));
+    if (!Block || !Bi || !Bx)
+    {
+        SuiteSparse_free(Block);
+        SuiteSparse_free(Bi);
+        SuiteSparse_free(Bx);
+        return false;
+    }
+    Int *Boff  = Block + nt + 1;
+    Int *Bnz   = Boff + nt;
+    Int *Hsize = Bnz + nt;
+
+    /* Split the coarse vertices into blocks of about equal bounds. */
+    Block[0] = 0;
+    for (int t = 1; t < nthreads; t++)
+    {
+        /* Block [t] is the first k with Cp [k] >= t*bound/nthreads */
+        double target = ((double)bound * t) / nthreads;
+        Int lo = Block[t - 1], hi = cn;
+        while (lo < hi)
+        {
+            Int mid = lo + (hi - lo) / 2;
+            if ((double)Cp[mid] < target)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        Block[t] = lo;
+    }
+    Block[nthreads] = cn;
+
+    /* The hash table of each block holds twice its largest column, rounded
+     * up to a power of two. */
+    for (int t = 0; t < nthreads; t++)
+    {
+        Int maxdeg = 1;
+        for (Int k = Block[t]; k < Block[t + 1]; k++)
+        {
+            maxdeg = std::max(maxdeg, Cp[k + 1] - Cp[k]);
+        }
+        Int hsize = 16;
+        while (hsize < 2 * maxdeg)
+            hsize *= 2;
+        Hsize[t] = hsize;
+        Boff[t]  = Cp[Block[t]];
+    }
+
+    /* Construct the columns of each block in its bucket. Cp [k] is set to
+     * the start of column k in its bucket. */
+    bool ok = true;
+    #pragma omp parallel for num_threads(nthreads) schedule(static, 1) \
+        reduction(&& : ok)
+    for (int t = 0; t < nthreads; t++)
+    {
+        Int *Ti    = Bi + Boff[t];
+        double *Tx = Bx + Boff[t];
+        Int hsize  = Hsize[t];
+        Int hmask  = hsize - 1;
+        Bnz[t]     = 0;
+
+        /* Hkey [h] is a coarse vertex or -1, and Hpos [h] its position in
+         * the bucket. */
+        Int *Hkey
+            = (Int *)SuiteSparse_malloc(static_cast<size_t>(2 * hsize), sizeof(Int));
+        if (!Hkey)
+        {
+            ok = false;
+            continue;
+        }
+        Int *Hpos = Hkey + hsize;
+        for (Int h = 0; h < hsize; h++)
+            Hkey[h] = -1;
+
+        Int munch = 0;
+        for (Int k = Block[t]; k < Block[t + 1]; k++)
+        {
+            /* Load up the inverse matching */
+            Int v[3] = { -1, -1, -1 };
+            v[0]     = invmatchmap[k];
+            v[1]     = graph->getMatch(v[0]);
+            if (v[0] == v[1])
+            {
+                v[1] = -1;
+            }
+            else
+            {
+                v[2] = graph->getMatch(v[1]);
+                if (v[0] == v[2])
+                {
+                    v[2] = -1;
+                }
+            }
+
+            Int ps = Cp[k] = munch; /* The munch start for this column */
+
+            double vertexWeight   = 0.0;
+            double sumEdgeWeights = 0.0;
+            for (Int i = 0; i < 3 && v[i] != -1; i++)
+            {
+                /* Read the matched vertex and accumulate the vertex weight. */
+                Int vertex = v[i];
+                vertexWeight += (Gw) ? Gw[vertex] : 1;
+
+                for (Int p = Gp[vertex]; p < Gp[vertex + 1]; p++)
+                {
+                    Int toCoarsened = matchmap[Gi[p]];
+                    if (toCoarsened == k)
+                        continue; /* Delete self-edges */
+
+                    /* Read the edge weight and accumulate the sum of edge
+                     * weights. */
+                    double edgeWeight = (Gx) ? Gx[p] : 1;
+                    sumEdgeWeights += edgeWeight;
+
+                    /* Check the hash table before scattering. */
+                    Int h = coarsenHash(toCoarsened, hmask);
+                    while (Hkey[h] != -1 && Hkey[h] != toCoarsened)
+                        h = (h + 1) & hmask;
+
+                    if (Hkey[h] == -1) /* Hasn't been seen yet this column */
+                    {
+                        Hkey[h]   = toCoarsened;
+                        Hpos[h]   = munch;
+                        Ti[munch] = toCoarsened;
+                        Tx[munch] = edgeWeight;
+                        munch++;
+                    }
+                    /* If the entry already exists, sum the edge weights. */
+                    else
+                    {
+                        Tx[Hpos[h]] += edgeWeight;
+                    }
+                }
+            }
+
+            /* Clear the hash table, in the reverse order of insertion so that
+             * the probe sequence of each entry is intact when it is removed.
+             */
+            for (Int q = munch - 1; q >= ps; q--)
+            {
+                Int h = coarsenHash(Ti[q], hmask);
+                while (Hkey[h] != Ti[q])
+                    h = (h + 1) & hmask;
+                Hkey[h] = -1;
+            }
+
+            /* Save the vertex weight and initialize the gain for k. */
+            Cw[k]    = vertexWeight;
+            gains[k] = -sumEdgeWeights;
+        }
+        Bnz[t] = munch;
+        SuiteSparse_free(Hkey);
+    }
+
+    if (ok)
+    {
+        /* Find where each bucket goes in Ci and Cx. */
+        Int munch = 0;
+        for (int t = 0; t < nthreads; t++)
+        {
+            Int nz  = Bnz[t];
+            Bnz[t]  = munch;
+            munch  += nz;
+        }
+        Cp[cn] = munch;
+
+        /* Copy each bucket into place. */
+        #pragma omp parallel for num_threads(nthreads) schedule(static, 1)
+        for (int t = 0; t < nthreads; t++)
+        {
+            Int start = Bnz[t];
+            Int nz    = ((t + 1 < nthreads) ? Bnz[t + 1] : munch) - start;
+            for (Int k = Block[t]; k < Block[t + 1]; k++)
+            {
+                Cp[k] += start;
+            }
+            for (Int q = 0; q < nz; q++)
+            {
+                Ci[start + q] = Bi[Boff[t] + q];
+                Cx[start + q] = Bx[Boff[t] + q];
+            }
+        }
+    }
 
+    SuiteSparse_free(Block);
+    SuiteSparse_free(Bi);
+    SuiteSparse_free(Bx);
+    return ok;
+}
+
+/**
+ * @brief Construct the columns of a coarse graph
+ *
+ * @param graph The fine graph, with its matching
+ * @param coarseGraph The coarse graph, whose columns are constructed
+ * @return true if successful, false if out of memory
+ */
+static bool coarsen_serial(EdgeCutProblem *graph, EdgeCutProblem *coarseGraph)
+{
     Int cn     = graph->cn;
     Int *Gp    = graph->p;
     Int *Gi    = graph->i;
@@ -64,31 +314,18 @@ EdgeCutProblem *coarsen(EdgeCutProblem *graph, const EdgeCut_Options *options)
     Int *matchmap    = graph->matchmap;
     Int *invmatchmap = graph->invmatchmap;
 
-    /* Build the coarse graph */
-    EdgeCutProblem *coarseGraph = EdgeCutProblem::create(graph);
-    if (!coarseGraph)
-        return NULL;
-
     Int *Cp       = coarseGraph->p;
     Int *Ci       = coarseGraph->i;
     double *Cx    = coarseGraph->x;
     double *Cw    = coarseGraph->w;
     double *gains = coarseGraph->vertexGains;
     Int munch     = 0;
-    double X      = 0.0;
-
-    /* edge and vertex weights always appear in a coarse graph */
-    ASSERT(Cx != NULL);
-    ASSERT(Cw != NULL);
 
     /* Hashtable stores column pointer values. */
     Int *htable
         = (Int *)SuiteSparse_malloc(static_cast<size_t>(cn), sizeof(Int));
     if (!htable)
-    {
-        coarseGraph->~EdgeCutProblem();
-        return NULL;
-    }
+        return false;
     for (Int i = 0; i < cn; i++)
         htable[i] = -1;
 
@@ -154,28 +391,93 @@ EdgeCutProblem *coarsen(EdgeCutProblem *graph, const EdgeCut_Options *options)
         /* Save the vertex weight. */
         Cw[k] = vertexWeight;
 
-        /* Save the sum of edge weights and initialize the gain for k. */
-        X += sumEdgeWeights;
+        /* Initialize the gain for k. */
         gains[k] = -sumEdgeWeights;
     }
 
     /* Set the last column pointer */
-    Cp[cn]          = munch;
-    coarseGraph->nz = munch;
+    Cp[cn] = munch;
+
+    /* Cleanup resources */
+    SuiteSparse_free(htable);
+
+    return true;
+}
+
+/**
+ * @brief Coarsen a Graph given a previously calculated matching
+ *
+ * Given a Graph @p G, coarsen returns a new Graph that is coarsened according
+ * to the matching given by G->matching, G->matchmap, and G->invmatchmap.
+ * G->matching must be built such that matching[a] = b+1 and matching[b] = a+1
+ * if vertices a and b are matched. G->matchmap is a mapping from fine to coarse
+ * vertices, so matchmap[a] = matchmap[b] = c if vertices a and b are matched
+ * and mapped to vertex c in the coarse graph. Likewise, G->invmatchmap is
+ * one possible inverse of G->matchmap, so invmatchmap[c] = a or
+ * invmatchmap[c] = b if a coarsened vertex c represents the matching of
+ * vertices a and b in the refined graph.
+ *
+ * @code
+ * Graph coarsened_graph = coarsen(large_graph, options);
+ * @endcode
+ *
+ * @param graph Graph to be coarsened
+ * @param options Option struct specifying if debug checks should be done,
+ *        and the number of threads to use
+ * @return A coarsened version of G
+ * @note Allocates memory for the coarsened graph, but frees on error.
+ */
+EdgeCutProblem *coarsen(EdgeCutProblem *graph, const EdgeCut_Options *options)
+{
+    Logger::tic(CoarseningTiming);
+
+    Int cn = graph->cn;
+
+    /* Build the coarse graph */
+    EdgeCutProblem *coarseGraph = EdgeCutProblem::create(graph);
+    if (!coarseGraph)
+        return NULL;
+
+    Int *Cp       = coarseGraph->p;
+    double *gains = coarseGraph->vertexGains;
+    double X      = 0.0;
+
+    /* edge and vertex weights always appear in a coarse graph */
+    ASSERT(coarseGraph->x != NULL);
+    ASSERT(coarseGraph->w != NULL);
+
+    /* Construct the columns, in parallel if requested. If the parallel
+     * construction runs out of memory, use the serial one instead. */
+    int nthreads = useParallel(options)
+                       ? getNumThreads(options, (double)graph->nz)
+                       : 1;
+    bool ok = (nthreads > 1) && coarsen_parallel(graph, coarseGraph, nthreads);
+    if (!ok)
+        ok = coarsen_serial(graph, coarseGraph);
+    if (!ok)
+    {
+        coarseGraph->~EdgeCutProblem();
+        return NULL;
+    }
+
+    /* Save the number of edges. */
+    coarseGraph->nz = Cp[cn];
 
     /* Save the sum of edge weights on the graph. */
+    for (Int k = 0; k < cn; k++)
+    {
+        X -= gains[k];
+    }
     coarseGraph->X = X;
     coarseGraph->H = 2.0 * X;
 
     coarseGraph->worstCaseRatio = graph->worstCaseRatio;
 
-    /* Cleanup resources */
-    SuiteSparse_free(htable);
-
 #ifndef NDEBUG
     /* If we want to do expensive checks, make sure we didn't break
      * the problem into multiple connected components. */
-    double W = 0.0;
+    double *Cw = coarseGraph->w;
+    double W   = 0.0;
     for (Int k = 0; k < cn; k++)
     {
         W += Cw[k];
@@ -232,6 +232,19 @@ bool optionsAreValid(const EdgeCut_Options *options)
         return (false);
     }
 
+    if (options->kway_imbalance_tolerance < 0)
+    {
+        LogError("Fatal Error: options->kway_imbalance_tolerance cannot be less "
+                 "than zero.");
+        return (false);
+    }
+
+    if (options->num_threads < 0)
+    {
+        LogError("Fatal Error: options->num_threads cannot be less than zero.");
+        return (false);
+    }
+
     return (true);
 }
 
@@ -46,6 +46,9 @@ EdgeCut_Options *EdgeCut_Options::create()
 
         ret->target_split        = 0.5;
         ret->soft_split_tolerance = 0;
+        ret->kway_imbalance_tolerance = 0.03;
+
+        ret->num_threads = 1;
     }
 
     return ret;
@@ -13,6 +13,7 @@
 #include "Mongoose_ImproveFM.hpp"
 #include "Mongoose_BoundaryHeap.hpp"
 #include "Mongoose_Debug.hpp"
+#include "Mongoose_ImproveParallel.hpp"
 #include "Mongoose_Internal.hpp"
 #include "Mongoose_Logger.hpp"
 
@@ -29,6 +30,14 @@ void improveCutUsingFM(EdgeCutProblem *graph, const EdgeCut_Options *options)
     if (!options->use_FM)
         return;
 
+    /* On large graphs, make most of the moves in parallel first. The serial
+     * passes below then only polish the cut. */
+    int nthreads = getRefineThreads(graph, options);
+    if (nthreads > 1)
+    {
+        improveCutInParallel(graph, options, nthreads);
+    }
+
     double heuCost = INFINITY;
     for (Int i = 0;
          i < options->FM_max_num_refinements && graph->heuCost < heuCost; i++)
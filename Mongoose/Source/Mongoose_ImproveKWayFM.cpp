@@ -0,0 +1,435 @@
+/* ========================================================================== */
+/* === Source/Mongoose_ImproveKWayFM.cpp ==================================== */
+/* ========================================================================== */
+
+/* -----------------------------------------------------------------------------
+ * Mongoose Graph Partitioning Library, Copyright (C) 2017-2023,
+ * Scott P. Kolodziej, Nuri S. Yeralan, Timothy A. Davis, William W. Hager
+ * Mongoose is licensed under Version 3 of the GNU General Public License.
+ * Mongoose is also available under other licenses; contact authors for details.
+ * SPDX-License-Identifier: GPL-3.0-only
+ * -------------------------------------------------------------------------- */
+
+/**
+ * Refinement of a k-way partition.
+ *
+ * This generalizes the Fidducia-Mattheyes refinement of ImproveFM to k parts.
+ * Each boundary vertex is keyed by the gain of its best move: the reduction
+ * in cut cost from moving it to the adjacent part it is most connected to,
+ * among those parts that can take its weight without exceeding maxWeight.
+ * The balance constraint is a hard one, so no penalty is needed: a move that
+ * would overload a part is never made.
+ */
+
+#include "Mongoose_ImproveKWayFM.hpp"
+#include "Mongoose_Debug.hpp"
+#include "Mongoose_Internal.hpp"
+#include "Mongoose_Logger.hpp"
+
+namespace Mongoose
+{
+
+KWayFM *KWayFM::create(Int n, Int k)
+{
+    KWayFM *ws = (KWayFM *)SuiteSparse_calloc(1, sizeof(KWayFM));
+    if (!ws)
+        return NULL;
+
+    size_t N = static_cast<size_t>(n);
+    size_t K = static_cast<size_t>(k);
+
+    ws->n         = n;
+    ws->k         = k;
+    ws->heap      = (Int *)SuiteSparse_malloc(N, sizeof(Int));
+    ws->heapIndex = (Int *)SuiteSparse_malloc(N, sizeof(Int));
+    ws->key       = (double *)SuiteSparse_malloc(N, sizeof(double));
+    ws->heapSize  = 0;
+    ws->moves     = (Int *)SuiteSparse_malloc(N, sizeof(Int));
+    ws->moveFrom  = (Int *)SuiteSparse_malloc(N, sizeof(Int));
+    ws->where     = (Int *)SuiteSparse_malloc(K, sizeof(Int));
+    ws->touched   = (Int *)SuiteSparse_malloc(K, sizeof(Int));
+    ws->conn      = (double *)SuiteSparse_malloc(K, sizeof(double));
+
+    if (!ws->heap || !ws->heapIndex || !ws->key || !ws->moves || !ws->moveFrom
+        || !ws->where || !ws->touched || !ws->conn)
+    {
+        ws->~KWayFM();
+        return NULL;
+    }
+
+    for (Int v = 0; v < n; v++)
+        ws->heapIndex[v] = -1;
+    for (Int t = 0; t < k; t++)
+        ws->where[t] = -1;
+
+    return ws;
+}
+
+KWayFM::~KWayFM()
+{
+    heap      = (Int *)SuiteSparse_free(heap);
+    heapIndex = (Int *)SuiteSparse_free(heapIndex);
+    key       = (double *)SuiteSparse_free(key);
+    moves     = (Int *)SuiteSparse_free(moves);
+    moveFrom  = (Int *)SuiteSparse_free(moveFrom);
+    where     = (Int *)SuiteSparse_free(where);
+    touched   = (Int *)SuiteSparse_free(touched);
+    conn      = (double *)SuiteSparse_free(conn);
+
+    SuiteSparse_free(this);
+}
+
+//-----------------------------------------------------------------------------
+// Max heap of vertices, keyed by the gain of their best move
+//-----------------------------------------------------------------------------
+static void kwayHeapifyUp(KWayFM *ws, Int position)
+{
+    Int *heap      = ws->heap;
+    Int *heapIndex = ws->heapIndex;
+    double *key    = ws->key;
+
+    Int v     = heap[position];
+    double kv = key[v];
+    while (position > 0)
+    {
+        Int parent = (position - 1) / 2;
+        Int u      = heap[parent];
+        if (key[u] >= kv)
+            break;
+        heap[position] = u;
+        heapIndex[u]   = position;
+        position       = parent;
+    }
+    heap[position] = v;
+    heapIndex[v]   = position;
+}
+
+static void kwayHeapifyDown(KWayFM *ws, Int position)
+{
+    Int *heap      = ws->heap;
+    Int *heapIndex = ws->heapIndex;
+    double *key    = ws->key;
+    Int size       = ws->heapSize;
+
+    Int v     = heap[position];
+    double kv = key[v];
+    while (true)
+    {
+        Int child = 2 * position + 1;
+        if (child >= size)
+            break;
+        if (child + 1 < size && key[heap[child + 1]] > key[heap[child]])
+            child++;
+        if (key[heap[child]] <= kv)
+            break;
+        heap[position]            = heap[child];
+        heapIndex[heap[position]] = position;
+        position                  = child;
+    }
+    heap[position] = v;
+    heapIndex[v]   = position;
+}
+
+/* Insert a vertex into the heap, or update its key if it is already there. */
+static void kwayHeapPut(KWayFM *ws, Int v, double gain)
+{
+    ASSERT(ws->heapIndex[v] != -2);
+
+    ws->key[v]   = gain;
+    Int position = ws->heapIndex[v];
+    if (position < 0)
+    {
+        position           = ws->heapSize++;
+        ws->heap[position] = v;
+        kwayHeapifyUp(ws, position);
+    }
+    else
+    {
+        kwayHeapifyUp(ws, position);
+        kwayHeapifyDown(ws, ws->heapIndex[v]);
+    }
+}
+
+static void kwayHeapRemove(KWayFM *ws, Int v)
+{
+    Int position     = ws->heapIndex[v];
+    ws->heapIndex[v] = -1;
+    Int last         = ws->heap[--ws->heapSize];
+    if (last != v)
+    {
+        ws->heap[position]   = last;
+        ws->heapIndex[last]  = position;
+        kwayHeapifyUp(ws, position);
+        kwayHeapifyDown(ws, ws->heapIndex[last]);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Find the best move of a vertex. The target is the adjacent part with the
+// largest gain that can take the weight of the vertex, with ties going to the
+// lighter part. Returns -1 if there is no such part (in particular, if the
+// vertex is not on the boundary).
+//-----------------------------------------------------------------------------
+static Int kwayBestMove(EdgeCutProblem *graph, const Int *part,
+                        const double *partWeight, double maxWeight, KWayFM *ws,
+                        Int vertex, double *out_gain)
+{
+    Int *Gp         = graph->p;
+    Int *Gi         = graph->i;
+    double *Gx      = graph->x;
+    double *Gw      = graph->w;
+    Int *where      = ws->where;
+    Int *touched    = ws->touched;
+    double *conn    = ws->conn;
+
+    Int vp          = part[vertex];
+    double vw       = (Gw) ? Gw[vertex] : 1;
+    double internal = 0.0;
+    Int ntouched    = 0;
+    for (Int p = Gp[vertex]; p < Gp[vertex + 1]; p++)
+    {
+        Int t     = part[Gi[p]];
+        double ew = (Gx) ? Gx[p] : 1;
+        if (t == vp)
+        {
+            internal += ew;
+            continue;
+        }
+        if (where[t] < 0)
+        {
+            where[t]          = ntouched;
+            touched[ntouched] = t;
+            conn[ntouched]    = 0.0;
+            ntouched++;
+        }
+        conn[where[t]] += ew;
+    }
+
+    Int target      = -1;
+    double bestGain = -INFINITY;
+    for (Int j = 0; j < ntouched; j++)
+    {
+        Int t    = touched[j];
+        where[t] = -1;
+        if (partWeight[t] + vw > maxWeight)
+            continue;
+
+        double gain = conn[j] - internal;
+        if (gain > bestGain
+            || (gain == bestGain && partWeight[t] < partWeight[target]))
+        {
+            target   = t;
+            bestGain = gain;
+        }
+    }
+
+    *out_gain = bestGain;
+    return target;
+}
+
+static inline void kwayMove(EdgeCutProblem *graph, Int *part,
+                            double *partWeight, Int vertex, Int target)
+{
+    double vw = (graph->w) ? graph->w[vertex] : 1;
+    partWeight[part[vertex]] -= vw;
+    partWeight[target] += vw;
+    part[vertex] = target;
+}
+
+//-----------------------------------------------------------------------------
+// Move vertices out of parts that weigh more than maxWeight. Boundary
+// vertices are moved first, best gain first. If that does not suffice, the
+// remaining excess is moved to the lightest parts, regardless of the cut.
+//-----------------------------------------------------------------------------
+void balanceKWayCut(EdgeCutProblem *graph, Int *part, double *partWeight,
+                    double maxWeight, KWayFM *ws)
+{
+    Int n          = graph->n;
+    Int *Gp        = graph->p;
+    Int *Gi        = graph->i;
+    double *Gw     = graph->w;
+    Int k          = ws->k;
+    Int *heapIndex = ws->heapIndex;
+
+    for (Int v = 0; v < n; v++)
+    {
+        if (partWeight[part[v]] <= maxWeight)
+            continue;
+
+        double gain;
+        if (kwayBestMove(graph, part, partWeight, maxWeight, ws, v, &gain) >= 0)
+            kwayHeapPut(ws, v, gain);
+    }
+
+    while (ws->heapSize > 0)
+    {
+        Int v      = ws->heap[0];
+        double key = ws->key[v];
+        kwayHeapRemove(ws, v);
+        if (partWeight[part[v]] <= maxWeight)
+            continue;
+
+        double gain;
+        Int target
+            = kwayBestMove(graph, part, partWeight, maxWeight, ws, v, &gain);
+        if (target < 0)
+            continue;
+        if (gain < key)
+        {
+            /* The part weights changed since v was keyed, so try later. */
+            kwayHeapPut(ws, v, gain);
+            continue;
+        }
+
+        kwayMove(graph, part, partWeight, v, target);
+
+        /* Update the neighbors that are still in overweight parts. */
+        for (Int p = Gp[v]; p < Gp[v + 1]; p++)
+        {
+            Int u = Gi[p];
+            Int t = -1;
+            if (partWeight[part[u]] > maxWeight)
+                t = kwayBestMove(graph, part, partWeight, maxWeight, ws, u,
+                                 &gain);
+
+            if (t >= 0)
+                kwayHeapPut(ws, u, gain);
+            else if (heapIndex[u] >= 0)
+                kwayHeapRemove(ws, u);
+        }
+    }
+
+    for (Int v = 0; v < n; v++)
+    {
+        Int vp = part[v];
+        if (partWeight[vp] <= maxWeight)
+            continue;
+
+        Int lightest = (vp == 0) ? 1 : 0;
+        for (Int t = 0; t < k; t++)
+        {
+            if (t != vp && partWeight[t] < partWeight[lightest])
+                lightest = t;
+        }
+
+        double vw = (Gw) ? Gw[v] : 1;
+        if (partWeight[lightest] + vw <= maxWeight)
+            kwayMove(graph, part, partWeight, v, lightest);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Make one pass of k-way Fidducia-Mattheyes moves. Each vertex moves at most
+// once. Up to FM_search_depth moves without improvement are made to escape
+// local minima, after which the moves past the best cut are undone.
+// Returns the change in cut cost (zero or negative).
+//-----------------------------------------------------------------------------
+static double kwayFMPass(EdgeCutProblem *graph, const EdgeCut_Options *options,
+                         Int *part, double *partWeight, double maxWeight,
+                         KWayFM *ws)
+{
+    Int n          = graph->n;
+    Int *Gp        = graph->p;
+    Int *Gi        = graph->i;
+    Int *heapIndex = ws->heapIndex;
+    Int *moves     = ws->moves;
+    Int *moveFrom  = ws->moveFrom;
+
+    for (Int v = 0; v < n; v++)
+    {
+        double gain;
+        if (kwayBestMove(graph, part, partWeight, maxWeight, ws, v, &gain) >= 0)
+            kwayHeapPut(ws, v, gain);
+    }
+
+    double delta = 0.0, bestDelta = 0.0;
+    Int nmoves = 0, bestMoves = 0, unproductive = 0;
+    while (ws->heapSize > 0 && unproductive < options->FM_search_depth)
+    {
+        Int v      = ws->heap[0];
+        double key = ws->key[v];
+        kwayHeapRemove(ws, v);
+
+        double gain;
+        Int target
+            = kwayBestMove(graph, part, partWeight, maxWeight, ws, v, &gain);
+        if (target < 0)
+            continue;
+        if (gain < key)
+        {
+            kwayHeapPut(ws, v, gain);
+            continue;
+        }
+
+        /* Make the move and lock the vertex. */
+        moveFrom[nmoves] = part[v];
+        moves[nmoves++]  = v;
+        kwayMove(graph, part, partWeight, v, target);
+        heapIndex[v] = -2;
+        delta -= gain;
+
+        if (delta < bestDelta)
+        {
+            bestDelta    = delta;
+            bestMoves    = nmoves;
+            unproductive = 0;
+        }
+        else
+        {
+            unproductive++;
+        }
+
+        /* Update the gains of the unlocked neighbors. */
+        for (Int p = Gp[v]; p < Gp[v + 1]; p++)
+        {
+            Int u = Gi[p];
+            if (heapIndex[u] == -2)
+                continue;
+
+            Int t
+                = kwayBestMove(graph, part, partWeight, maxWeight, ws, u, &gain);
+            if (t >= 0)
+                kwayHeapPut(ws, u, gain);
+            else if (heapIndex[u] >= 0)
+                kwayHeapRemove(ws, u);
+        }
+    }
+
+    /* Undo all moves past the best cut. */
+    for (Int j = nmoves - 1; j >= bestMoves; j--)
+    {
+        kwayMove(graph, part, partWeight, moves[j], moveFrom[j]);
+    }
+
+    /* Unlock the moved vertices and empty the heap. */
+    for (Int j = 0; j < nmoves; j++)
+        heapIndex[moves[j]] = -1;
+    for (Int j = 0; j < ws->heapSize; j++)
+        heapIndex[ws->heap[j]] = -1;
+    ws->heapSize = 0;
+
+    return bestDelta;
+}
+
+//-----------------------------------------------------------------------------
+// Wrapper for k-way Fidducia-Mattheyes cut improvement.
+//-----------------------------------------------------------------------------
+void improveKWayCutUsingFM(EdgeCutProblem *graph, const EdgeCut_Options *options,
+                           Int *part, double *partWeight, double maxWeight,
+                           KWayFM *ws)
+{
+    if (!options->use_FM)
+        return;
+
+    Logger::tic(FMTiming);
+
+    for (Int i = 0; i < options->FM_max_num_refinements; i++)
+    {
+        if (kwayFMPass(graph, options, part, partWeight, maxWeight, ws) >= 0)
+            break;
+    }
+
+    Logger::toc(FMTiming);
+}
+
+} // end namespace Mongoose
@@ -0,0 +1,397 @@
+/* ========================================================================== */
+/* === Source/Mongoose_ImproveParallel.cpp ================================== */
+/* ========================================================================== */
+
+/* -----------------------------------------------------------------------------
+ * Mongoose Graph Partitioning Library, Copyright (C) 2017-2023,
+ * Scott P. Kolodziej, Nuri S. Yeralan, Timothy A. Davis, William W. Hager
+ * Mongoose is licensed under Version 3 of the GNU General Public License.
+ * Mongoose is also available under other licenses; contact authors for details.
+ * SPDX-License-Identifier: GPL-3.0-only
+ * -------------------------------------------------------------------------- */
+
+#include "Mongoose_ImproveParallel.hpp"
+#include "Mongoose_BoundaryHeap.hpp"
+#include "Mongoose_Debug.hpp"
+#include "Mongoose_ImproveFM.hpp"
+#include "Mongoose_Internal.hpp"
+#include "Mongoose_Parallel.hpp"
+
+#include <algorithm>
+
+/* Vertices are handled in blocks of this size, so that the moves and the
+ * floating-point sums do not depend on the number of threads. */
+#define MONGOOSE_REFINE_BLOCK 4096
+
+namespace Mongoose
+{
+
+/* Workspace for the parallel refinement */
+struct RefineWork
+{
+    Int nblocks;
+    bool *flip;           /* size n: flip [v] if v is to change parts     */
+    unsigned char *dirty; /* size n: the gain of v must be recomputed     */
+    double *blockSum;     /* size nblocks                                 */
+    Int *blockCount;      /* size 2*nblocks                               */
+};
+
+static bool createWork(RefineWork *work, Int n)
+{
+    size_t ns     = static_cast<size_t>(n);
+    work->nblocks = (n + MONGOOSE_REFINE_BLOCK - 1) / MONGOOSE_REFINE_BLOCK;
+    size_t nb     = static_cast<size_t>(work->nblocks) + 1;
+    work->flip    = (bool *)SuiteSparse_calloc(ns, sizeof(bool));
+    work->dirty   = (unsigned char *)SuiteSparse_calloc(ns, sizeof(unsigned char));
+    work->blockSum   = (double *)SuiteSparse_malloc(nb, sizeof(double));
+    work->blockCount = (Int *)SuiteSparse_malloc(2 * nb, sizeof(Int));
+    return (work->flip && work->dirty && work->blockSum && work->blockCount);
+}
+
+static void freeWork(RefineWork *work)
+{
+    SuiteSparse_free(work->flip);
+    SuiteSparse_free(work->dirty);
+    SuiteSparse_free(work->blockSum);
+    SuiteSparse_free(work->blockCount);
+}
+
+//-----------------------------------------------------------------------------
+// Recompute the imbalance and heuristic cost from the cut cost and weights
+//-----------------------------------------------------------------------------
+static void updateCost(EdgeCutProblem *graph, const EdgeCut_Options *options)
+{
+    graph->imbalance = options->target_split
+                       - std::min(graph->W0, graph->W1) / graph->W;
+    double absImbalance = fabs(graph->imbalance);
+    graph->heuCost      = graph->cutCost
+                     + (absImbalance > options->soft_split_tolerance
+                            ? absImbalance * graph->H
+                            : 0.0);
+}
+
+//-----------------------------------------------------------------------------
+// Swap the part of each vertex v with flip [v] true, and clear flip. The
+// gains and external degrees of the swapped vertices and their neighbors are
+// recomputed, and the cut cost and part weights are updated. The boundary
+// heaps are not; see loadBoundary.
+//-----------------------------------------------------------------------------
+static void swapFlagged(EdgeCutProblem *graph, const EdgeCut_Options *options,
+                        RefineWork *work, int nthreads)
+{
+    Int n               = graph->n;
+    Int *Gp             = graph->p;
+    Int *Gi             = graph->i;
+    double *Gw          = graph->w;
+    bool *partition     = graph->partition;
+    double *gains       = graph->vertexGains;
+    Int *externalDegree = graph->externalDegree;
+    Int nblocks         = work->nblocks;
+    bool *flip          = work->flip;
+    unsigned char *dirty = work->dirty;
+    double *blockSum    = work->blockSum;
+
+    /* Swap the flagged vertices, and mark them and their neighbors. The
+     * weight moved into part 1 by each block is kept in blockSum. */
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (Int b = 0; b < nblocks; b++)
+    {
+        Int vlast    = std::min(n, (b + 1) * MONGOOSE_REFINE_BLOCK);
+        double moved = 0.0;
+        for (Int v = b * MONGOOSE_REFINE_BLOCK; v < vlast; v++)
+        {
+            if (!flip[v])
+                continue;
+            partition[v] = !partition[v];
+            double vw    = (Gw) ? Gw[v] : 1;
+            moved += (partition[v]) ? vw : -vw;
+            #pragma omp atomic write
+            dirty[v] = 1;
+            for (Int p = Gp[v]; p < Gp[v + 1]; p++)
+            {
+                Int u = Gi[p];
+                #pragma omp atomic write
+                dirty[u] = 1;
+            }
+        }
+        blockSum[b] = moved;
+    }
+
+    double moved = 0.0;
+    for (Int b = 0; b < nblocks; b++)
+    {
+        moved += blockSum[b];
+    }
+    graph->W0 -= moved;
+    graph->W1 += moved;
+
+    /* Recompute the gains of the marked vertices. The cut cost counts each
+     * cut edge from both sides, so a vertex adds (gain + its total edge
+     * weight) / 2 to it, and the change is half the change in its gain. */
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (Int b = 0; b < nblocks; b++)
+    {
+        Int vlast    = std::min(n, (b + 1) * MONGOOSE_REFINE_BLOCK);
+        double delta = 0.0;
+        for (Int v = b * MONGOOSE_REFINE_BLOCK; v < vlast; v++)
+        {
+            if (!dirty[v])
+                continue;
+            dirty[v] = 0;
+            flip[v]  = false;
+
+            double gain;
+            Int exD;
+            calculateGain(graph, options, v, &gain, &exD);
+            delta += gain - gains[v];
+            gains[v]          = gain;
+            externalDegree[v] = exD;
+        }
+        blockSum[b] = delta;
+    }
+
+    double delta = 0.0;
+    for (Int b = 0; b < nblocks; b++)
+    {
+        delta += blockSum[b];
+    }
+    graph->cutCost += delta / 2;
+    updateCost(graph, options);
+}
+
+//-----------------------------------------------------------------------------
+// Rebuild the boundary heaps from the external degrees
+//-----------------------------------------------------------------------------
+static void loadBoundary(EdgeCutProblem *graph, RefineWork *work, int nthreads)
+{
+    Int n               = graph->n;
+    bool *partition     = graph->partition;
+    double *gains       = graph->vertexGains;
+    Int *externalDegree = graph->externalDegree;
+    Int *bhIndex        = graph->bhIndex;
+    Int nblocks         = work->nblocks;
+    Int *count          = work->blockCount;
+
+    /* Count the boundary vertices of each part in each block. */
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (Int b = 0; b < nblocks; b++)
+    {
+        Int vlast = std::min(n, (b + 1) * MONGOOSE_REFINE_BLOCK);
+        Int c[2]  = { 0, 0 };
+        for (Int v = b * MONGOOSE_REFINE_BLOCK; v < vlast; v++)
+        {
+            bhIndex[v] = 0;
+            if (externalDegree[v] > 0)
+                c[partition[v]]++;
+        }
+        count[2 * b]     = c[0];
+        count[2 * b + 1] = c[1];
+    }
+
+    Int size[2] = { 0, 0 };
+    for (Int b = 0; b < nblocks; b++)
+    {
+        for (Int h = 0; h < 2; h++)
+        {
+            Int c            = count[2 * b + h];
+            count[2 * b + h] = size[h];
+            size[h] += c;
+        }
+    }
+
+    /* Place the boundary vertices in the heaps, in order. */
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (Int b = 0; b < nblocks; b++)
+    {
+        Int vlast  = std::min(n, (b + 1) * MONGOOSE_REFINE_BLOCK);
+        Int pos[2] = { count[2 * b], count[2 * b + 1] };
+        for (Int v = b * MONGOOSE_REFINE_BLOCK; v < vlast; v++)
+        {
+            if (externalDegree[v] > 0)
+            {
+                Int h                  = partition[v];
+                graph->bhHeap[h][pos[h]] = v;
+                graph->BH_putIndex(v, pos[h]);
+                pos[h]++;
+            }
+        }
+    }
+
+    /* Restore the heap property, from the bottom up. */
+    for (Int h = 0; h < 2; h++)
+    {
+        Int *heap        = graph->bhHeap[h];
+        graph->bhSize[h] = size[h];
+        for (Int k = size[h] / 2 - 1; k >= 0; k--)
+        {
+            Int v = heap[k];
+            heapifyDown(graph, heap, size[h], gains, v, k, gains[v]);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// The largest weight that may be moved out of part h, so that the imbalance
+// stays within max (tol, |imbalance|) throughout.
+//-----------------------------------------------------------------------------
+static double moveBudget(const EdgeCutProblem *graph,
+                         const EdgeCut_Options *options, Int h)
+{
+    double W  = graph->W;
+    double Wh = (h) ? graph->W1 : graph->W0;
+    double Wo = (h) ? graph->W0 : graph->W1;
+    double a  = std::max(options->soft_split_tolerance, fabs(graph->imbalance));
+    double lo = (options->target_split - a) * W;
+    double hi = (options->target_split + a) * W;
+
+    /* While part h is the heavier one, the lighter part Wo + d grows and
+     * must stay below hi; after that, Wh - d shrinks and must stay above
+     * lo. */
+    double half = (Wh - Wo) / 2;
+    if (half > 0 && Wo + half > hi)
+        return std::max(0.0, hi - Wo);
+    return std::max(0.0, Wh - lo);
+}
+
+//-----------------------------------------------------------------------------
+// Returns the number of threads for the parallel refinement, or 1 if the
+// serial refinement is to be used
+//-----------------------------------------------------------------------------
+int getRefineThreads(const EdgeCutProblem *graph,
+                     const EdgeCut_Options *options)
+{
+    return useParallel(options) ? getNumThreads(options, (double)graph->nz)
+                                : 1;
+}
+
+//-----------------------------------------------------------------------------
+// Improve the cut with rounds of parallel moves. Returns false if out of
+// memory, in which case the cut is unchanged.
+//-----------------------------------------------------------------------------
+bool improveCutInParallel(EdgeCutProblem *graph, const EdgeCut_Options *options,
+                          int nthreads)
+{
+    Int n               = graph->n;
+    double *Gw          = graph->w;
+    bool *partition     = graph->partition;
+    double *gains       = graph->vertexGains;
+    Int *externalDegree = graph->externalDegree;
+
+    RefineWork work;
+    if (!createWork(&work, n))
+    {
+        freeWork(&work);
+        return false;
+    }
+    Int nblocks      = work.nblocks;
+    bool *flip       = work.flip;
+    double *blockSum = work.blockSum;
+
+    /* Alternate the direction of the moves, until a move in either direction
+     * fails to reduce the cut. */
+    Int idle      = 0;
+    Int maxRounds = 2 * options->FM_max_num_refinements;
+    for (Int round = 0; round < maxRounds && idle < 2; round++)
+    {
+        bool h        = (round % 2 == 1);
+        double budget = moveBudget(graph, options, h);
+
+        /* The candidates are the boundary vertices of part h whose move
+         * reduces the cut. Find their weight in each block. */
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (Int b = 0; b < nblocks; b++)
+        {
+            Int vlast  = std::min(n, (b + 1) * MONGOOSE_REFINE_BLOCK);
+            double cw  = 0.0;
+            for (Int v = b * MONGOOSE_REFINE_BLOCK; v < vlast; v++)
+            {
+                if (partition[v] == h && externalDegree[v] > 0 && gains[v] > 0)
+                    cw += (Gw) ? Gw[v] : 1;
+            }
+            blockSum[b] = cw;
+        }
+
+        double total = 0.0;
+        for (Int b = 0; b < nblocks; b++)
+        {
+            double cw   = blockSum[b];
+            blockSum[b] = total;
+            total += cw;
+        }
+
+        /* Flag the candidates, in order, until the budget is used up. */
+        Int nflip = 0;
+        if (total > 0)
+        {
+            #pragma omp parallel for num_threads(nthreads) schedule(static) \
+                reduction(+ : nflip)
+            for (Int b = 0; b < nblocks; b++)
+            {
+                Int vlast   = std::min(n, (b + 1) * MONGOOSE_REFINE_BLOCK);
+                double used = blockSum[b];
+                for (Int v = b * MONGOOSE_REFINE_BLOCK; v < vlast; v++)
+                {
+                    if (partition[v] == h && externalDegree[v] > 0
+                        && gains[v] > 0)
+                    {
+                        double vw = (Gw) ? Gw[v] : 1;
+                        used += vw;
+                        if (used <= budget)
+                        {
+                            flip[v] = true;
+                            nflip++;
+                        }
+                    }
+                }
+            }
+        }
+
+        if (nflip == 0)
+        {
+            idle++;
+            continue;
+        }
+        idle = 0;
+
+        swapFlagged(graph, options, &work, nthreads);
+    }
+
+    loadBoundary(graph, &work, nthreads);
+
+    freeWork(&work);
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Move each vertex k to part (x [k] > 0.5), in parallel, and update the cut
+// cost and the boundary heaps. Returns false if out of memory, in which case
+// the cut is unchanged.
+//-----------------------------------------------------------------------------
+bool swapInParallel(EdgeCutProblem *graph, const EdgeCut_Options *options,
+                    const double *x, int nthreads)
+{
+    Int n           = graph->n;
+    bool *partition = graph->partition;
+
+    RefineWork work;
+    if (!createWork(&work, n))
+    {
+        freeWork(&work);
+        return false;
+    }
+    bool *flip = work.flip;
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (Int k = 0; k < n; k++)
+    {
+        flip[k] = ((x[k] > 0.5) != partition[k]);
+    }
+
+    swapFlagged(graph, options, &work, nthreads);
+    loadBoundary(graph, &work, nthreads);
+
+    freeWork(&work);
+    return true;
+}
+
+} // end namespace Mongoose
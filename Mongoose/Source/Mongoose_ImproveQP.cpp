@@ -14,6 +14,7 @@
 #include "Mongoose_BoundaryHeap.hpp"
 #include "Mongoose_Debug.hpp"
 #include "Mongoose_ImproveFM.hpp"
+#include "Mongoose_ImproveParallel.hpp"
 #include "Mongoose_Internal.hpp"
 #include "Mongoose_Logger.hpp"
 #include "Mongoose_QPBoundary.hpp"
@@ -66,6 +67,8 @@ bool improveCutUsingQP(EdgeCutProblem *graph, const EdgeCut_Options *options, bo
     double *D       = QP->D;
     double *guess   = QP->x;
     bool *partition = graph->partition;
+    int nthreads    = getRefineThreads(graph, options);
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
     for (Int k = 0; k < n; k++)
     {
         if (isInitial)
@@ -116,6 +119,15 @@ bool improveCutUsingQP(EdgeCutProblem *graph, const EdgeCut_Options *options, bo
     QPGradProj(graph, options, QP);
     QPBoundary(graph, options, QP);
 
+    /* On large graphs, do the recommended swaps in parallel. */
+    if (nthreads > 1 && swapInParallel(graph, options, guess, nthreads))
+    {
+        QP->~QPDelta();
+        SuiteSparse_free(QP);
+        Logger::toc(QPTiming);
+        return true;
+    }
+
     /* Use the CutCost to keep track of impacts to the cut cost. */
     CutCost cost;
     cost.cutCost   = graph->cutCost;
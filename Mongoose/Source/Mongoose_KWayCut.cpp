@@ -0,0 +1,366 @@
+/* ========================================================================== */
+/* === Source/Mongoose_KWayCut.cpp ========================================== */
+/* ========================================================================== */
+
+/* -----------------------------------------------------------------------------
+ * Mongoose Graph Partitioning Library, Copyright (C) 2017-2023,
+ * Scott P. Kolodziej, Nuri S. Yeralan, Timothy A. Davis, William W. Hager
+ * Mongoose is licensed under Version 3 of the GNU General Public License.
+ * Mongoose is also available under other licenses; contact authors for details.
+ * SPDX-License-Identifier: GPL-3.0-only
+ * -------------------------------------------------------------------------- */
+
+/**
+ * Direct k-way partitioning.
+ *
+ * Rather than recursively bisecting the input graph, which coarsens every
+ * subgraph from scratch, the graph is coarsened once until it has about
+ * MONGOOSE_KWAY_COARSEN_FACTOR vertices per part. The coarsest graph is
+ * partitioned by recursive bisection with edge_cut (and thus with the QP and
+ * FM refinement of the 2-way code), and the k-way partition is then projected
+ * back through the levels, balanced, and improved with k-way FM at each one.
+ */
+
+#include "Mongoose_KWayCut.hpp"
+#include "Mongoose_Coarsening.hpp"
+#include "Mongoose_EdgeCut.hpp"
+#include "Mongoose_ImproveKWayFM.hpp"
+#include "Mongoose_Internal.hpp"
+#include "Mongoose_Logger.hpp"
+#include "Mongoose_Matching.hpp"
+#include "Mongoose_Random.hpp"
+
+#include <algorithm>
+
+#define MONGOOSE_KWAY_COARSEN_FACTOR 100
+
+namespace Mongoose
+{
+
+bool optionsAreValid(const EdgeCut_Options *options);
+
+KWayCut::~KWayCut()
+{
+    SuiteSparse_free(part);
+    SuiteSparse_free(part_weight);
+    SuiteSparse_free(this);
+}
+
+KWayCut *kway_cut(const Graph *graph, Int k)
+{
+    // use default options if not present
+    EdgeCut_Options *options = EdgeCut_Options::create();
+
+    if (!options)
+        return NULL;
+
+    KWayCut *result = kway_cut(graph, k, options);
+
+    options->~EdgeCut_Options();
+
+    return (result);
+}
+
+//-----------------------------------------------------------------------------
+// Partition the subgraph induced by vertices[0..nv-1] into parts firstPart to
+// firstPart+k-1 by recursive bisection. The vertices array is permuted, and
+// local (of size graph->n) must be -1 on input and is restored on output.
+//-----------------------------------------------------------------------------
+static bool bisectKWay(EdgeCutProblem *graph, EdgeCut_Options *options,
+                       Int *part, Int *vertices, Int nv, Int k, Int firstPart,
+                       Int *local)
+{
+    if (k == 1 || nv <= 1)
+    {
+        for (Int j = 0; j < nv; j++)
+            part[vertices[j]] = firstPart;
+        return true;
+    }
+
+    Int *Gp    = graph->p;
+    Int *Gi    = graph->i;
+    double *Gx = graph->x;
+    double *Gw = graph->w;
+    Int k0     = k / 2;
+
+    /* Extract the subgraph induced by the vertices. */
+    for (Int j = 0; j < nv; j++)
+        local[vertices[j]] = j;
+
+    Int snz = 0;
+    for (Int j = 0; j < nv; j++)
+    {
+        Int v = vertices[j];
+        for (Int p = Gp[v]; p < Gp[v + 1]; p++)
+        {
+            if (local[Gi[p]] >= 0)
+                snz++;
+        }
+    }
+
+    size_t nvs  = static_cast<size_t>(nv);
+    size_t snzs = static_cast<size_t>(std::max(snz, (Int)1));
+    Int *Sp     = (Int *)SuiteSparse_malloc(nvs + 1, sizeof(Int));
+    Int *Si     = (Int *)SuiteSparse_malloc(snzs, sizeof(Int));
+    double *Sx  = (double *)SuiteSparse_malloc(snzs, sizeof(double));
+    double *Sw  = (double *)SuiteSparse_malloc(nvs, sizeof(double));
+    bool *side  = (bool *)SuiteSparse_malloc(nvs, sizeof(bool));
+    bool ok     = (Sp && Si && Sx && Sw && side);
+
+    double W = 0.0;
+    if (ok)
+    {
+        snz = 0;
+        for (Int j = 0; j < nv; j++)
+        {
+            Int v = vertices[j];
+            Sp[j] = snz;
+            Sw[j] = (Gw) ? Gw[v] : 1;
+            W += Sw[j];
+            for (Int p = Gp[v]; p < Gp[v + 1]; p++)
+            {
+                Int u = local[Gi[p]];
+                if (u >= 0)
+                {
+                    Si[snz] = u;
+                    Sx[snz] = (Gx) ? Gx[p] : 1;
+                    snz++;
+                }
+            }
+        }
+        Sp[nv] = snz;
+    }
+
+    for (Int j = 0; j < nv; j++)
+        local[vertices[j]] = -1;
+
+    double target = W * static_cast<double>(k0) / static_cast<double>(k);
+    if (ok && snz == 0)
+    {
+        /* There are no edges to cut, so split the vertices by weight. */
+        double W0 = 0.0;
+        for (Int j = 0; j < nv; j++)
+        {
+            side[j] = (W0 < target);
+            W0 += Sw[j];
+        }
+    }
+    else if (ok)
+    {
+        Graph *S = Graph::create(nv, snz, Sp, Si, Sx, Sw);
+        options->target_split = static_cast<double>(k0) / static_cast<double>(k);
+        EdgeCut *cut = (S) ? edge_cut(S, options) : NULL;
+        if (S)
+            S->~Graph();
+
+        ok = (cut != NULL);
+        if (ok)
+        {
+            for (Int j = 0; j < nv; j++)
+                side[j] = cut->partition[j];
+            cut->~EdgeCut();
+        }
+    }
+
+    /* The lighter side gets the k0 parts, and goes first in vertices. */
+    Int n0 = 0;
+    if (ok)
+    {
+        double Wtrue = 0.0;
+        for (Int j = 0; j < nv; j++)
+        {
+            if (side[j])
+                Wtrue += Sw[j];
+        }
+        bool lighter = (Wtrue <= W - Wtrue);
+
+        Int *scratch = Sp;
+        for (Int j = 0; j < nv; j++)
+        {
+            if (side[j] == lighter)
+                scratch[n0++] = vertices[j];
+        }
+        Int n1 = n0;
+        for (Int j = 0; j < nv; j++)
+        {
+            if (side[j] != lighter)
+                scratch[n1++] = vertices[j];
+        }
+        for (Int j = 0; j < nv; j++)
+            vertices[j] = scratch[j];
+    }
+
+    SuiteSparse_free(Sp);
+    SuiteSparse_free(Si);
+    SuiteSparse_free(Sx);
+    SuiteSparse_free(Sw);
+    SuiteSparse_free(side);
+
+    return (ok
+            && bisectKWay(graph, options, part, vertices, n0, k0, firstPart,
+                          local)
+            && bisectKWay(graph, options, part, vertices + n0, nv - n0, k - k0,
+                          firstPart + k0, local));
+}
+
+KWayCut *kway_cut(const Graph *graph, Int k, const EdgeCut_Options *options)
+{
+    // Check inputs
+    if (!optionsAreValid(options))
+        return NULL;
+
+    setRandomSeed(options->random_seed);
+
+    if (!graph)
+        return NULL;
+
+    if (k < 1)
+    {
+        LogError("Fatal Error: k cannot be less than one.");
+        return NULL;
+    }
+
+    // Create an EdgeCutProblem to hold the coarsening hierarchy
+    EdgeCutProblem *problem = EdgeCutProblem::create(graph);
+
+    if (!problem)
+        return NULL;
+
+    problem->initialize(options);
+
+    Int n                  = problem->n;
+    size_t ns              = static_cast<size_t>(n);
+    Int *part              = (Int *)SuiteSparse_malloc(ns, sizeof(Int));
+    Int *finePart          = (Int *)SuiteSparse_malloc(ns, sizeof(Int));
+    double *partWeight     = (double *)SuiteSparse_calloc(
+        static_cast<size_t>(k), sizeof(double));
+    KWayFM *ws             = KWayFM::create(n, k);
+    EdgeCut_Options *bisectOptions = EdgeCut_Options::create();
+    bool ok = (part && finePart && partWeight && ws && bisectOptions);
+
+    /* Coarsen until the graph has few vertices per part. */
+    EdgeCutProblem *current = problem;
+    Int limit = std::max(options->coarsen_limit, MONGOOSE_KWAY_COARSEN_FACTOR * k);
+    while (ok && current->n >= limit)
+    {
+        match(current, options);
+        EdgeCutProblem *next = coarsen(current, options);
+        if (!next)
+        {
+            ok = false;
+            break;
+        }
+
+        /* Stop early if matching no longer shrinks the graph appreciably. */
+        bool stalled = (next->n > 0.95 * current->n);
+        current      = next;
+        if (stalled)
+            break;
+    }
+
+    /* Partition the coarsest graph by recursive bisection. The move log of
+     * the refinement workspace is not needed yet, so it holds the map from
+     * vertices to subgraph vertices. */
+    if (ok)
+    {
+        Int cn = current->n;
+        for (Int v = 0; v < cn; v++)
+        {
+            finePart[v] = v;
+            ws->moves[v] = -1;
+        }
+
+        *bisectOptions = *options;
+        ok = bisectKWay(current, bisectOptions, part, finePart, cn, k, 0,
+                        ws->moves);
+    }
+
+    /* Balance and refine at each level on the way back up. */
+    double maxWeight
+        = (1 + options->kway_imbalance_tolerance) * problem->W / k;
+    if (ok)
+    {
+        double *Cw = current->w;
+        for (Int v = 0; v < current->n; v++)
+            partWeight[part[v]] += (Cw) ? Cw[v] : 1;
+
+        balanceKWayCut(current, part, partWeight, maxWeight, ws);
+        improveKWayCutUsingFM(current, options, part, partWeight, maxWeight, ws);
+
+        while (current->parent != NULL)
+        {
+            EdgeCutProblem *P = current->parent;
+            Int *matchmap     = P->matchmap;
+            for (Int v = 0; v < P->n; v++)
+                finePart[v] = part[matchmap[v]];
+            std::swap(part, finePart);
+
+            current->~EdgeCutProblem();
+            current = P;
+
+            balanceKWayCut(current, part, partWeight, maxWeight, ws);
+            improveKWayCutUsingFM(current, options, part, partWeight,
+                                  maxWeight, ws);
+        }
+    }
+
+    /* On failure, unwind the stack. */
+    while (current != problem)
+    {
+        EdgeCutProblem *next = current->parent;
+        current->~EdgeCutProblem();
+        current = next;
+    }
+
+    SuiteSparse_free(finePart);
+    if (ws)
+        ws->~KWayFM();
+    if (bisectOptions)
+        bisectOptions->~EdgeCut_Options();
+
+    KWayCut *result
+        = (ok) ? (KWayCut *)SuiteSparse_malloc(1, sizeof(KWayCut)) : NULL;
+
+    if (!result)
+    {
+        SuiteSparse_free(part);
+        SuiteSparse_free(partWeight);
+        problem->~EdgeCutProblem();
+        return NULL;
+    }
+
+    /* Compute the cut metrics. Each edge is seen from both of its ends. */
+    Int *Gp        = problem->p;
+    Int *Gi        = problem->i;
+    double *Gx     = problem->x;
+    double cutCost = 0.0;
+    Int cutSize    = 0;
+    for (Int v = 0; v < n; v++)
+    {
+        for (Int p = Gp[v]; p < Gp[v + 1]; p++)
+        {
+            if (part[Gi[p]] != part[v])
+            {
+                cutCost += (Gx) ? Gx[p] : 1;
+                cutSize++;
+            }
+        }
+    }
+    double heaviest = 0.0;
+    for (Int t = 0; t < k; t++)
+        heaviest = std::max(heaviest, partWeight[t]);
+
+    result->part        = part;
+    result->n           = n;
+    result->k           = k;
+    result->cut_cost    = cutCost / 2;
+    result->cut_size    = cutSize / 2;
+    result->part_weight = partWeight;
+    result->imbalance   = (n > 0) ? heaviest * k / problem->W - 1 : 0;
+
+    problem->~EdgeCutProblem();
+
+    return result;
+}
+
+} // end namespace Mongoose
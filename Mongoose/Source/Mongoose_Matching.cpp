@@ -17,12 +17,17 @@
  * which vertices are combined together into supervertices. This can be done
  * using a number of different strategies, including Heavy Edge Matching and
  * Community/Brotherly (similar to 2-hop) Matching.
+ *
+ * If options->num_threads is not 1 and the graph is large enough to be split
+ * among several threads, heavy edge matching starts with a few rounds of
+ * parallel handshake matching (see matching_Handshake below).
  */
 
 #include "Mongoose_Matching.hpp"
 #include "Mongoose_Debug.hpp"
 #include "Mongoose_Internal.hpp"
 #include "Mongoose_Logger.hpp"
+#include "Mongoose_Parallel.hpp"
 
 namespace Mongoose
 {
@@ -33,6 +38,11 @@ namespace Mongoose
 void match(EdgeCutProblem *graph, const EdgeCut_Options *options)
 {
     Logger::tic(MatchingTiming);
+
+    /* Graphs too small to be split among threads are matched serially. */
+    bool handshake = useParallel(options)
+                     && getNumThreads(options, (double)graph->nz) > 1;
+
     switch (options->matching_strategy)
     {
     case Random:
@@ -40,15 +50,21 @@ void match(EdgeCutProblem *graph, const EdgeCut_Options *options)
         break;
 
     case HEM:
+        if (handshake)
+            matching_Handshake(graph, options);
         matching_HEM(graph, options);
         break;
 
     case HEMSR:
+        if (handshake)
+            matching_Handshake(graph, options);
         matching_HEM(graph, options);
         matching_SR(graph, options);
         break;
 
     case HEMSRdeg:
+        if (handshake)
+            matching_Handshake(graph, options);
         matching_HEM(graph, options);
         matching_SRdeg(graph, options);
         break;
@@ -455,4 +471,124 @@ void matching_HEM(EdgeCutProblem *graph, const EdgeCut_Options *options)
 #endif
 }
 
+//-----------------------------------------------------------------------------
+// Ties between edges of equal weight are broken by a hash of their endpoints,
+// so that all edges are totally ordered and both endpoints of an edge agree
+// on its rank.
+//-----------------------------------------------------------------------------
+static inline uint64_t handshakeKey(Int a, Int b, Int seed)
+{
+    uint64_t lo = (uint64_t)((a < b) ? a : b);
+    uint64_t hi = (uint64_t)((a < b) ? b : a);
+    uint64_t z  = (hi << 32) ^ lo ^ ((uint64_t)seed * 0x9E3779B97F4A7C15ULL);
+    z           = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z           = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return (z ^ (z >> 31));
+}
+
+//-----------------------------------------------------------------------------
+// This is a parallel handshake matching, used as the first pass of heavy edge
+// matching when options->num_threads is not 1.
+//
+// In each round, every unmatched vertex points to its heaviest unmatched
+// neighbor, and pairs of vertices that point to each other are matched. Every
+// round matches at least the heaviest remaining edge, and the matching found
+// is locally dominant, as is the one found by matching_HEM. The rounds are
+// synchronous, so the result does not depend on the number of threads. The
+// few vertices left after MONGOOSE_HANDSHAKE_ROUNDS rounds are matched by
+// matching_HEM, which is always called next.
+//-----------------------------------------------------------------------------
+#define MONGOOSE_HANDSHAKE_ROUNDS 8
+
+void matching_Handshake(EdgeCutProblem *graph, const EdgeCut_Options *options)
+{
+    Int n         = graph->n;
+    Int *Gp       = graph->p;
+    Int *Gi       = graph->i;
+    double *Gx    = graph->x;
+    Int *matching = graph->matching;
+    Int seed      = options->random_seed;
+
+    /* If out of memory, leave the matching to matching_HEM. */
+    Int *proposal = (Int *)SuiteSparse_malloc(static_cast<size_t>(n), sizeof(Int));
+    if (!proposal)
+        return;
+
+    int nthreads = getNumThreads(options, (double)graph->nz);
+    (void)nthreads; // Unused variable if compiled without OpenMP
+
+    for (Int round = 0; round < MONGOOSE_HANDSHAKE_ROUNDS; round++)
+    {
+        /* Each unmatched vertex proposes to its heaviest unmatched neighbor. */
+        Int nproposals = 0;
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic, 1024) \
+            reduction(+ : nproposals)
+        for (Int k = 0; k < n; k++)
+        {
+            proposal[k] = -1;
+            if (matching[k] > 0)
+                continue;
+
+            Int heaviestNeighbor  = -1;
+            double heaviestWeight = -1.0;
+            uint64_t heaviestKey  = 0;
+            for (Int p = Gp[k]; p < Gp[k + 1]; p++)
+            {
+                Int neighbor = Gi[p];
+
+                /* Consider only unmatched neighbors */
+                if (neighbor == k || matching[neighbor] > 0)
+                    continue;
+
+                /* Keep track of the heaviest. */
+                double x     = (Gx) ? Gx[p] : 1;
+                uint64_t key = handshakeKey(k, neighbor, seed);
+                if (x > heaviestWeight
+                    || (x == heaviestWeight && key > heaviestKey))
+                {
+                    heaviestWeight   = x;
+                    heaviestKey      = key;
+                    heaviestNeighbor = neighbor;
+                }
+            }
+            proposal[k] = heaviestNeighbor;
+            if (heaviestNeighbor != -1)
+                nproposals++;
+        }
+
+        if (nproposals == 0)
+            break;
+
+        /* Match the pairs of vertices that proposed to each other. */
+        Int nmatched = 0;
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(+ : nmatched)
+        for (Int k = 0; k < n; k++)
+        {
+            Int neighbor = proposal[k];
+            if (neighbor != -1 && proposal[neighbor] == k)
+            {
+                matching[k] = neighbor + 1;
+                nmatched++;
+            }
+        }
+
+        /* Edge weights that are not symmetric can stall the handshake. */
+        if (nmatched == 0)
+            break;
+    }
+
+    /* Number the new coarse vertices in the order of their first vertex. */
+    for (Int k = 0; k < n; k++)
+    {
+        Int neighbor = matching[k] - 1;
+        if (neighbor > k)
+        {
+            graph->createMatch(k, neighbor, MatchType_Standard);
+        }
+    }
+
+    SuiteSparse_free(proposal);
+}
+
 } // end namespace Mongoose
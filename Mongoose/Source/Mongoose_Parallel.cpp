@@ -0,0 +1,38 @@
+/* ========================================================================== */
+/* === Source/Mongoose_Parallel.cpp ========================================= */
+/* ========================================================================== */
+
+/* -----------------------------------------------------------------------------
+ * Mongoose Graph Partitioning Library, Copyright (C) 2017-2023,
+ * Scott P. Kolodziej, Nuri S. Yeralan, Timothy A. Davis, William W. Hager
+ * Mongoose is licensed under Version 3 of the GNU General Public License.
+ * Mongoose is also available under other licenses; contact authors for details.
+ * SPDX-License-Identifier: GPL-3.0-only
+ * -------------------------------------------------------------------------- */
+
+#include "Mongoose_Parallel.hpp"
+
+namespace Mongoose
+{
+
+//-----------------------------------------------------------------------------
+// Returns true if the parallel algorithms are to be used
+//-----------------------------------------------------------------------------
+bool useParallel(const EdgeCut_Options *options)
+{
+    return (options->num_threads != 1);
+}
+
+//-----------------------------------------------------------------------------
+// Returns the number of threads to use for the given amount of work
+//-----------------------------------------------------------------------------
+int getNumThreads(const EdgeCut_Options *options, double work)
+{
+    double nthreads = (options->num_threads > 0)
+                          ? (double)options->num_threads
+                          : (double)SUITESPARSE_OPENMP_MAX_THREADS;
+    nthreads = std::fmin(nthreads, std::floor(work / MONGOOSE_PARALLEL_CHUNK));
+    return (nthreads < 1) ? 1 : (int)nthreads;
+}
+
+} // end namespace Mongoose
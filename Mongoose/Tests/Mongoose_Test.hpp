@@ -38,4 +38,11 @@ int runReferenceTest(const std::string &inputFile);
 
 #include "Mongoose_Logger.hpp"
 
+// Graphs shared by the unit tests (see Mongoose_Test_Graphs.cpp)
+namespace Mongoose
+{
+class Graph;
+}
+Mongoose::Graph *create_grid(int64_t nx);
+
 #endif
@@ -0,0 +1,38 @@
+//------------------------------------------------------------------------------
+// Mongoose/Tests/Mongoose_Test_Graphs.cpp
+//------------------------------------------------------------------------------
+
+// Mongoose Graph Partitioning Library, Copyright (C) 2017-2023,
+// Scott P. Kolodziej, Nuri S. Yeralan, Timothy A. Davis, William W. Hager
+// Mongoose is licensed under Version 3 of the GNU General Public License.
+// Mongoose is also available under other licenses; contact authors for details.
+// SPDX-License-Identifier: GPL-3.0-only
+
+//------------------------------------------------------------------------------
+
+#include "Mongoose_Test.hpp"
+#include "Mongoose_Internal.hpp"
+#include "Mongoose_Graph.hpp"
+
+using namespace Mongoose;
+
+/* Create the graph of an nx-by-nx grid, large enough to use several threads */
+Graph *create_grid(Int nx)
+{
+    Int n  = nx * nx;
+    Graph *G = Graph::create(n, 4 * nx * (nx - 1));
+    if (!G)
+        return NULL;
+    Int nz = 0;
+    for (Int k = 0; k < n; k++)
+    {
+        Int i = k % nx, j = k / nx;
+        G->p[k] = nz;
+        if (j > 0)      G->i[nz++] = k - nx;
+        if (i > 0)      G->i[nz++] = k - 1;
+        if (i < nx - 1) G->i[nz++] = k + 1;
+        if (j < nx - 1) G->i[nz++] = k + nx;
+    }
+    G->p[n] = nz;
+    return G;
+}
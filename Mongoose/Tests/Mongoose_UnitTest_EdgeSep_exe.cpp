@@ -110,6 +110,60 @@ int main(int argn, char** argv)
     assert(result == NULL);
     O->soft_split_tolerance = 0.01;
 
+    // Test with invalid num_threads
+    O->num_threads = -1;
+    result = edge_cut(G, O);
+    assert(result == NULL);
+    O->num_threads = 1;
+
+    // Test with parallel matching, coarsening, and refinement: the cut must
+    // not depend on the number of threads, and must be about as good as the
+    // serial one
+    Graph *grid = create_grid(200);
+    O->coarsen_limit = 64;
+    O->target_split = 0.5;
+    EdgeCut *serial = edge_cut(grid, O);
+    assert(serial->partition != NULL);
+    for (int strategy = HEM; strategy <= HEMSRdeg; strategy++)
+    {
+        O->matching_strategy = (MatchingStrategy) strategy;
+        O->num_threads = 2;
+        EdgeCut *result2 = edge_cut(grid, O);
+        O->num_threads = 4;
+        EdgeCut *result4 = edge_cut(grid, O);
+        assert(result2->partition != NULL && result4->partition != NULL);
+        for (Int k = 0; k < grid->n; k++)
+        {
+            assert(result2->partition[k] == result4->partition[k]);
+        }
+        assert(result2->cut_cost == result4->cut_cost);
+        assert(result2->cut_cost <= 2 * serial->cut_cost);
+
+        // The cut cost and size kept by the parallel refinement must match
+        // the partition
+        Int cutSize = 0;
+        for (Int k = 0; k < grid->n; k++)
+        {
+            for (Int p = grid->p[k]; p < grid->p[k + 1]; p++)
+            {
+                if (result4->partition[k] != result4->partition[grid->i[p]])
+                    cutSize++;
+            }
+        }
+        assert(result4->cut_size == cutSize / 2);
+        assert(result4->cut_cost == (double)(cutSize / 2));
+        LogTest("parallel cut: " << result4->cut_cost
+                << " serial cut: " << serial->cut_cost);
+        result2->~EdgeCut();
+        result4->~EdgeCut();
+    }
+    serial->~EdgeCut();
+    grid->~Graph();
+    O->matching_strategy = HEMSR;
+    O->num_threads = 1;
+    O->target_split = 0.4;
+    O->coarsen_limit = 50;
+
     // Test with no QP
     O->use_QP_gradproj = false;
     result = edge_cut(G, O);
@@ -0,0 +1,210 @@
+//------------------------------------------------------------------------------
+// Mongoose/Tests/Mongoose_UnitTest_KWay_exe.cpp
+//------------------------------------------------------------------------------
+
+// Mongoose Graph Partitioning Library, Copyright (C) 2017-2023,
+// Scott P. Kolodziej, Nuri S. Yeralan, Timothy A. Davis, William W. Hager
+// Mongoose is licensed under Version 3 of the GNU General Public License.
+// Mongoose is also available under other licenses; contact authors for details.
+// SPDX-License-Identifier: GPL-3.0-only
+
+//------------------------------------------------------------------------------
+
+
+#define LOG_ERROR 1
+#define LOG_WARN 1
+#define LOG_INFO 0
+#define LOG_TEST 1
+
+#include "Mongoose_Test.hpp"
+#include "Mongoose_Internal.hpp"
+#include "Mongoose_IO.hpp"
+#include "Mongoose_KWayCut.hpp"
+
+#include <algorithm>
+
+using namespace Mongoose;
+
+/* Custom memory management functions allow for memory testing. */
+int AllowedMallocs;
+
+void *myMalloc(size_t size)
+{
+    if(AllowedMallocs <= 0) return NULL;
+    AllowedMallocs--;
+    return malloc(size);
+}
+
+void *myCalloc(size_t count, size_t size)
+{
+    if(AllowedMallocs <= 0) return NULL;
+    AllowedMallocs--;
+    return calloc(count, size);
+}
+
+void *myRealloc(void *ptr, size_t newSize)
+{
+    if(AllowedMallocs <= 0) return NULL;
+    AllowedMallocs--;
+    return realloc(ptr, newSize);
+}
+
+void myFree(void *ptr)
+{
+    if(ptr != NULL) free(ptr);
+}
+
+/* Check the part vector and the cut metrics of a k-way cut */
+void check_kway_cut(const Graph *G, const KWayCut *result, Int k)
+{
+    assert(result != NULL);
+    assert(result->n == G->n);
+    assert(result->k == k);
+
+    double *partWeight = (double *)calloc(k, sizeof(double));
+    double W = 0;
+    for (Int v = 0; v < G->n; v++)
+    {
+        Int t = result->part[v];
+        assert(t >= 0 && t < k);
+        double vw = (G->w) ? G->w[v] : 1;
+        partWeight[t] += vw;
+        W += vw;
+    }
+
+    double heaviest = 0;
+    for (Int t = 0; t < k; t++)
+    {
+        assert(partWeight[t] == result->part_weight[t]);
+        heaviest = std::max(heaviest, partWeight[t]);
+    }
+    assert(fabs(result->imbalance - (heaviest * k / W - 1)) < 1e-12);
+
+    double cutCost = 0;
+    Int cutSize = 0;
+    for (Int v = 0; v < G->n; v++)
+    {
+        for (Int p = G->p[v]; p < G->p[v + 1]; p++)
+        {
+            if (result->part[G->i[p]] != result->part[v])
+            {
+                cutCost += (G->x) ? G->x[p] : 1;
+                cutSize++;
+            }
+        }
+    }
+    assert(result->cut_cost == cutCost / 2);
+    assert(result->cut_size == cutSize / 2);
+
+    free(partWeight);
+}
+
+int main(int argn, char** argv)
+{
+    (void)argn; // Unused variable
+    (void)argv; // Unused variable
+
+    SuiteSparse_start();
+
+    // Set Logger to report all messages and turn off timing info
+    Logger::setDebugLevel(All);
+    Logger::setTimingFlag(false);
+
+    // Test with NULL graph
+    KWayCut *result = kway_cut(NULL, 4);
+    assert(result == NULL);
+
+    Graph *G = read_graph("../Matrix/bcspwr02.mtx");
+
+    // Test with no options struct
+    result = kway_cut(G, 4);
+    check_kway_cut(G, result, 4);
+    result->~KWayCut();
+
+    // Test with NULL options struct
+    EdgeCut_Options *O = NULL;
+    result = kway_cut(G, 4, O);
+    assert(result == NULL);
+
+    O = EdgeCut_Options::create();
+
+    // Test with invalid k
+    result = kway_cut(G, 0, O);
+    assert(result == NULL);
+
+    // Test with invalid kway_imbalance_tolerance
+    O->kway_imbalance_tolerance = -1;
+    result = kway_cut(G, 4, O);
+    assert(result == NULL);
+    O->kway_imbalance_tolerance = 0.03;
+
+    // Test with one part, and with more parts than vertices
+    result = kway_cut(G, 1, O);
+    check_kway_cut(G, result, 1);
+    assert(result->cut_cost == 0);
+    result->~KWayCut();
+
+    result = kway_cut(G, G->n + 3, O);
+    check_kway_cut(G, result, G->n + 3);
+    result->~KWayCut();
+    G->~Graph();
+
+    // Test on a grid, where the balance constraint can always be met
+    Graph *grid = create_grid(64);
+    Int ks[] = { 2, 3, 7, 16 };
+    for (Int j = 0; j < 4; j++)
+    {
+        Int k = ks[j];
+        result = kway_cut(grid, k, O);
+        check_kway_cut(grid, result, k);
+        assert(result->imbalance <= O->kway_imbalance_tolerance + 1e-12);
+        LogTest("k = " << k << ": cut " << result->cut_cost
+                << ", imbalance " << result->imbalance);
+        result->~KWayCut();
+    }
+
+    // Test with no FM
+    O->use_FM = false;
+    result = kway_cut(grid, 8, O);
+    check_kway_cut(grid, result, 8);
+    result->~KWayCut();
+    O->use_FM = true;
+
+    // Test with a weighted graph: vertex weights grow along the grid
+    grid->w = (double *)malloc(grid->n * sizeof(double));
+    grid->x = (double *)malloc(grid->nz * sizeof(double));
+    for (Int v = 0; v < grid->n; v++)
+        grid->w[v] = 1 + (v % 5);
+    for (Int p = 0; p < grid->nz; p++)
+        grid->x[p] = 1 + (p % 3);
+    result = kway_cut(grid, 5, O);
+    check_kway_cut(grid, result, 5);
+    assert(result->imbalance <= O->kway_imbalance_tolerance + 1e-12);
+    result->~KWayCut();
+
+    // Simulate running out of memory at every allocation
+    SuiteSparse_config_malloc_func_set (myMalloc) ;
+    SuiteSparse_config_calloc_func_set (myCalloc) ;
+    SuiteSparse_config_realloc_func_set (myRealloc) ;
+    SuiteSparse_config_free_func_set (myFree) ;
+
+    result = NULL;
+    for (int tries = 0; !result; tries++)
+    {
+        AllowedMallocs = tries;
+        result = kway_cut(grid, 6, O);
+    }
+    check_kway_cut(grid, result, 6);
+    result->~KWayCut();
+
+    free(grid->w);
+    free(grid->x);
+    grid->w = NULL;
+    grid->x = NULL;
+    grid->~Graph();
+    O->~EdgeCut_Options();
+
+    SuiteSparse_finish();
+
+    return 0;
+}
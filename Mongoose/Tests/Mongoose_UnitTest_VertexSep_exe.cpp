@@ -0,0 +1,145 @@
+//------------------------------------------------------------------------------
+// Mongoose/Tests/Mongoose_UnitTest_VertexSep_exe.cpp
+//------------------------------------------------------------------------------
+
+// Mongoose Graph Partitioning Library, Copyright (C) 2017-2023,
+// Scott P. Kolodziej, Nuri S. Yeralan, Timothy A. Davis, William W. Hager
+// Mongoose is licensed under Version 3 of the GNU General Public License.
+// Mongoose is also available under other licenses; contact authors for details.
+// SPDX-License-Identifier: GPL-3.0-only
+
+//------------------------------------------------------------------------------
+
+
+#define LOG_ERROR 1
+#define LOG_WARN 1
+#define LOG_INFO 0
+#define LOG_TEST 1
+
+#include "Mongoose_Test.hpp"
+#include "Mongoose_Internal.hpp"
+#include "Mongoose_IO.hpp"
+#include "Mongoose_C.h"
+
+using namespace Mongoose;
+
+/* Custom memory management functions allow for memory testing. */
+int AllowedMallocs;
+
+void *myMalloc(size_t size)
+{
+    if(AllowedMallocs <= 0) return NULL;
+    AllowedMallocs--;
+    return malloc(size);
+}
+
+void *myCalloc(size_t count, size_t size)
+{
+    if(AllowedMallocs <= 0) return NULL;
+    AllowedMallocs--;
+    return calloc(count, size);
+}
+
+void *myRealloc(void *ptr, size_t newSize)
+{
+    if(AllowedMallocs <= 0) return NULL;
+    AllowedMallocs--;
+    return realloc(ptr, newSize);
+}
+
+void myFree(void *ptr)
+{
+    if(ptr != NULL) free(ptr);
+}
+
+/* Check that Part is a vertex separator of weight sep */
+void check_separator(const Graph *G, const Int *Gw, const Int *Part, Int sep)
+{
+    Int sepWeight = 0;
+    for (Int v = 0; v < G->n; v++)
+    {
+        assert(Part[v] >= 0 && Part[v] <= 2);
+        if (Part[v] == 2)
+            sepWeight += (Gw) ? Gw[v] : 1;
+        for (Int p = G->p[v]; p < G->p[v + 1]; p++)
+        {
+            Int u = G->i[p];
+            assert(Part[v] == 2 || Part[u] == 2 || Part[u] == Part[v]);
+        }
+    }
+    assert(sepWeight == sep);
+}
+
+int main(int argn, char** argv)
+{
+    (void)argn; // Unused variable
+    (void)argv; // Unused variable
+
+    SuiteSparse_start();
+
+    // Set Logger to report all messages and turn off timing info
+    Logger::setDebugLevel(All);
+    Logger::setTimingFlag(false);
+
+    // Test with NULL and invalid inputs
+    Int Part[4];
+    Int Gp0[1] = { 0 };
+    assert(mongoose_vertex_separator(1, NULL, Gp0, NULL, 1, Part) == -1);
+    assert(mongoose_vertex_separator(-1, Gp0, Gp0, NULL, 1, Part) == -1);
+    assert(mongoose_vertex_separator(0, Gp0, Gp0, NULL, 1, NULL) == -1);
+
+    // Test with an empty graph and with a graph with no edges
+    assert(mongoose_vertex_separator(0, Gp0, Gp0, NULL, 1, Part) == 0);
+    Int Gp4[5] = { 0, 0, 0, 0, 0 };
+    assert(mongoose_vertex_separator(4, Gp4, Gp0, NULL, 1, Part) == 0);
+    assert(Part[0] == 0 && Part[1] == 0 && Part[2] == 1 && Part[3] == 1);
+
+    // Test on a grid, where the best separator is a row or column
+    Graph *grid = create_grid(32);
+    Int *GridPart = (Int *)malloc(grid->n * sizeof(Int));
+    Int sep = mongoose_vertex_separator(grid->n, grid->p, grid->i, NULL, 1,
+                                        GridPart);
+    check_separator(grid, NULL, GridPart, sep);
+    LogTest("grid separator: " << sep);
+    assert(sep >= 32 && sep <= 40);
+
+    // Test with vertex weights and more than one thread
+    Int *Gw = (Int *)malloc(grid->n * sizeof(Int));
+    for (Int v = 0; v < grid->n; v++)
+        Gw[v] = 1 + (v % 3);
+    sep = mongoose_vertex_separator(grid->n, grid->p, grid->i, Gw, 0,
+                                    GridPart);
+    check_separator(grid, Gw, GridPart, sep);
+
+    // Test on a graph from a file
+    Graph *G = read_graph("../Matrix/bcspwr02.mtx");
+    Int *GPart = (Int *)malloc(G->n * sizeof(Int));
+    sep = mongoose_vertex_separator(G->n, G->p, G->i, NULL, 1, GPart);
+    check_separator(G, NULL, GPart, sep);
+    assert(sep > 0 && sep < G->n);
+
+    // Simulate running out of memory at every allocation
+    SuiteSparse_config_malloc_func_set (myMalloc) ;
+    SuiteSparse_config_calloc_func_set (myCalloc) ;
+    SuiteSparse_config_realloc_func_set (myRealloc) ;
+    SuiteSparse_config_free_func_set (myFree) ;
+
+    sep = -1;
+    for (int tries = 0; sep < 0; tries++)
+    {
+        AllowedMallocs = tries;
+        sep = mongoose_vertex_separator(grid->n, grid->p, grid->i, Gw, 1,
+                                        GridPart);
+    }
+    check_separator(grid, Gw, GridPart, sep);
+
+    free(GPart);
+    free(GridPart);
+    free(Gw);
+    G->~Graph();
+    grid->~Graph();
+
+    SuiteSparse_finish();
+
+    return 0;
+}
@@ -109,6 +109,9 @@ int main(int argc, char **argv)
         std::cout << std::scientific << std::setprecision(1)
             << "ParU: factorization was successful in " << my_time_fac
             << " seconds.\n";
+        std::cout << "ParU: peak arena usage " << Num->arena_peak
+            << " bytes (contribution blocks " << Num->arena_cb_peak
+            << " bytes) in " << Num->arena_nchunks << " chunks.\n";
     }
 
     //~~~~~~~~~~~~~~~~~~~Test the results ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -208,6 +211,41 @@ int main(int argc, char **argv)
 
         free(B);
         free(X);
+
+        //~~~~~~~~~~~~~~~~~~~Refactorize with new values~~~~~~~~~~~~~~~~~~~~~~~
+        // same pattern, different values: reuse the pivots of Num
+        double *Ax = (double *)A->x;
+        int64_t anz = ((int64_t *)A->p)[A->ncol];
+        for (int64_t p = 0; p < anz; p++) Ax[p] *= 1 + 1e-3 * (p % 7);
+        std::cout << "\n--------- ParU_Refactorize:\n";
+        double my_start_time_refac = omp_get_wtime();
+        info = ParU_Refactorize(A, Sym, &Num, &Control);
+        double my_time_refac = omp_get_wtime() - my_start_time_refac;
+        if (info != PARU_SUCCESS)
+        {
+            std::cout << "ParU: refactorization was NOT successful.\n";
+            cholmod_l_free_sparse(&A, cc);
+            cholmod_l_finish(cc);
+            ParU_Freesym(&Sym, &Control);
+            return info;
+        }
+        std::cout << std::scientific << std::setprecision(1)
+            << "ParU: refactorization was successful in " << my_time_refac
+            << " seconds.\n";
+        b = (double *)malloc(m * sizeof(double));
+        xx = (double *)malloc(m * sizeof(double));
+        for (int64_t i = 0; i < m; ++i) b[i] = i + 1;
+        info = ParU_Solve(Sym, Num, b, xx, &Control);
+        if (info == PARU_SUCCESS)
+        {
+            info = ParU_Residual(A, xx, b, m, resid, anorm, xnorm, &Control);
+        }
+        rresid = (anorm == 0 || xnorm == 0 ) ? 0 : (resid/(anorm*xnorm));
+        std::cout << std::scientific << std::setprecision(2)
+            << "Refactorize: relative residual is |" << rresid
+            << "| and rcond is " << Num->rcond << "." << std::endl;
+        free(b);
+        free(xx);
     }
 #endif
 
@@ -223,6 +223,8 @@ struct ParU_Symbolic
 struct ParU_Control
 {
     int64_t mem_chunk = PARU_MEM_CHUNK ;  // chunk size for memset and memcpy
+    int64_t mem_arena = 1;  // if 0, each front and contribution block is
+                            // allocated on its own instead of in arenas
 
     // Symbolic controls
     int64_t umfpack_ordering = UMFPACK_ORDERING_METIS;
@@ -293,10 +295,20 @@ struct ParU_Numeric
     //   matrix S
     ParU_Factors *partial_Us;   // size nf   size(Us)= fp*colCount[f]
     ParU_Factors *partial_LUs;  // size nf   size(LUs)= rowCount[f]*fp
+    void *front_chunks;  // arena chunks holding partial_Us and partial_LUs
+
+    // statistics of the arenas of the fronts and contribution blocks
+    int64_t arena_peak;     // peak memory held by all arenas, in bytes
+    int64_t arena_cb_peak;  // peak memory held for contribution blocks
+    int64_t arena_nchunks;  // number of chunks allocated by the arenas
+    int64_t arena_ncompact; // number of contribution blocks compacted
 
     int64_t max_row_count;  // maximum number of rows/cols for all the fronts
     int64_t max_col_count;  // it is initalized after factorization
 
+    int64_t nrefact;  // number of ParU_Refactorize calls that reused the
+                      // pivots of this factorization; 0 after ParU_Factorize
+
     double rcond;
     double min_udiag;
     double max_udiag;
@@ -339,6 +351,50 @@ ParU_Ret ParU_Factorize(
     // control:
     ParU_Control *Control);
 
+//------------------------------------------------------------------------------
+// ParU_Refactorize: Numeric refactorization of a matrix with the same pattern
+// as the one factorized by a prior ParU_Factorize with the same ParU_Symbolic.
+// The fronts, the pivot sequence and the task schedule of *Num_handle are
+// reused and its factors are overwritten in place, so no pivot search and no
+// allocation of the fronts is done.  If a frozen pivot fails the threshold
+// test (piv_toler, or diag_toler for the symmetric strategy), or if the new
+// values do not fit the old pattern, *Num_handle is freed and ParU_Factorize
+// is called instead.  If *Num_handle is NULL this is the same as
+// ParU_Factorize.  Other errors (PARU_INVALID, PARU_OUT_OF_MEMORY,
+// PARU_TOO_LARGE, or PARU_SINGULAR for a zero row of A) are returned to the
+// caller and *Num_handle is freed, as in ParU_Factorize.  On success,
+// (*Num_handle)->nrefact is incremented if the old pivots were reused.
+//------------------------------------------------------------------------------
+
+ParU_Ret ParU_Refactorize(
+    // input:
+    cholmod_sparse *A, ParU_Symbolic *Sym,
+    // input/output:
+    ParU_Numeric **Num_handle,
+    // control:
+    ParU_Control *Control);
+
+//------------------------------------------------------------------------------
+// ParU_Autotune: pick Control->trivial, Control->worthwhile_dgemm and
+// Control->worthwhile_trsm for this machine.  If A and Sym are NULL, the
+// BLAS kernels are timed on dense blocks of the size of typical fronts.  If A
+// and Sym (from ParU_Analyze) are given, A is factorized a few times with
+// candidate values of each threshold and the fastest ones are kept.  Only the
+// three thresholds of Control are modified.  ParU_Save_Tuning and
+// ParU_Load_Tuning write and read them as a text profile, so the tuning can
+// be done once per machine.
+//------------------------------------------------------------------------------
+
+ParU_Ret ParU_Autotune(
+    // input:
+    cholmod_sparse *A, ParU_Symbolic *Sym,   // both NULL, or both given
+    // input/output:
+    ParU_Control *Control);
+
+ParU_Ret ParU_Save_Tuning(const char *filename, ParU_Control *Control);
+
+ParU_Ret ParU_Load_Tuning(const char *filename, ParU_Control *Control);
+
 //------------------------------------------------------------------------------
 //--------------------- Solve routines -----------------------------------------
 //------------------------------------------------------------------------------
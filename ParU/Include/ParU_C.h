@@ -24,6 +24,8 @@
 typedef struct ParU_C_Control_struct
 {
     int64_t mem_chunk;  // chunk size for memset and memcpy
+    int64_t mem_arena;  // if 0, each front and contribution block is
+                        // allocated on its own instead of in arenas
 
     // Symbolic controls
     int64_t umfpack_ordering;
@@ -124,6 +126,35 @@ ParU_Ret ParU_C_Factorize(
         // control:
         ParU_C_Control *Control);
 
+//------------------------------------------------------------------------------
+// ParU_C_Refactorize: Numeric refactorization of a matrix with the same
+// pattern as a prior ParU_C_Factorize, reusing its pivot sequence.  Falls back
+// to ParU_C_Factorize if a frozen pivot is not acceptable.
+//------------------------------------------------------------------------------
+
+ParU_Ret ParU_C_Refactorize(
+        // input:
+        cholmod_sparse *A, ParU_C_Symbolic *Sym,
+        // input/output:
+        ParU_C_Numeric **Num_handle,
+        // control:
+        ParU_C_Control *Control);
+
+//------------------------------------------------------------------------------
+// ParU_C_Autotune: pick trivial, worthwhile_dgemm and worthwhile_trsm for
+// this machine; see ParU_Autotune.  A and Sym are both NULL, or both given.
+//------------------------------------------------------------------------------
+
+ParU_Ret ParU_C_Autotune(
+        // input:
+        cholmod_sparse *A, ParU_C_Symbolic *Sym,
+        // input/output:
+        ParU_C_Control *Control);
+
+ParU_Ret ParU_C_Save_Tuning(const char *filename, ParU_C_Control *Control);
+
+ParU_Ret ParU_C_Load_Tuning(const char *filename, ParU_C_Control *Control);
+
 //------------------------------------------------------------------------------
 //--------------------- Solve routines -----------------------------------------
 //------------------------------------------------------------------------------
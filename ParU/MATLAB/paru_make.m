@@ -58,7 +58,7 @@ include = [include ' -I../../CHOLMOD/SuiteSparse_metis/include '] ;
 include = [include ' -I../../CHOLMOD/Supernodal '] ;
 
 % use all of CHOLMOD except for the Modify module
-flags = [flags ' -DNMODIFY -DBLAS64' ] ;
+flags = [flags ' -DNMODIFY -DNMONGOOSE -DBLAS64' ] ;
 
 if (ispc)
     % MSVC does not define ssize_t
@@ -67,6 +67,9 @@ end
 
 suitesparse_src = { ...
     '../../SuiteSparse_config/SuiteSparse_config', ...
+    '../../SuiteSparse_config/SuiteSparse_memstats', ...
+    '../../SuiteSparse_config/SuiteSparse_trace', ...
+    '../../SuiteSparse_config/SuiteSparse_memory', ...
     '../../AMD/Source/amd_l1', ...
     '../../AMD/Source/amd_l2', ...
     '../../AMD/Source/amd_l_aat', ...
@@ -79,6 +79,7 @@ ParU_Ret ParU_Analyze(cholmod_sparse *A, ParU_Symbolic **S_handle,
 {
     DEBUGLEVEL(0);
     PARU_DEFINE_PRLEVEL;
+    paru_trace trace("symbolic");
 #ifndef NTIME
     double start_time = PARU_OPENMP_GET_WTIME;
 #endif
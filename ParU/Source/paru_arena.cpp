@@ -0,0 +1,511 @@
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////// paru_arena.cpp //////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+// ParU, Copyright (c) 2022, Mohsen Aznaveh and Timothy A. Davis,
+// All Rights Reserved.
+// SPDX-License-Identifier: GNU GPL 3.0
+
+/*! @brief  arenas for the fronts and the contribution blocks
+ *
+ *  Each thread of the factorization has two arenas, so the allocator is not
+ *  called for each front and each contribution block.  An arena hands out
+ *  memory from its current chunk by bumping an offset; only the thread that
+ *  owns the arena allocates from it.
+ *
+ *  All the chunks of the arenas have the same size, which comes from the
+ *  bounds of the symbolic analysis (Fm and Cm).  A chunk whose contribution
+ *  blocks are all gone is not freed, but put in a pool shared by all the
+ *  arenas, and the next chunk of any arena, for fronts or for contribution
+ *  blocks, is taken from the pool.  So the space freed by the contribution
+ *  blocks after their assembly is reused for the fronts that follow, and the
+ *  heap is not fragmented by the blocks of every size that come and go.  The
+ *  pool is freed at the end of the factorization.
+ *
+ *  Front arena: the pivotal part (partial_LUs) and the U part (partial_Us) of
+ *  each front live until ParU_Freenum.  Every chunk used for fronts is linked
+ *  into Num->front_chunks, and ParU_Freenum frees the whole list.  A front
+ *  that does not fit in the rest of the current chunk starts a new chunk if
+ *  it is smaller than a thirty-second of a chunk (so that little of the
+ *  chunk is left unused), and gets a chunk of its own otherwise.
+ *
+ *  Contribution block arena: a contribution block is freed by whichever
+ *  thread assembles the last of it, in any order.  Each chunk counts the
+ *  blocks still in use, plus one while it is the current chunk of its arena.
+ *  The thread that drops the count to zero returns the chunk to the pool, and
+ *  the owner reuses its current chunk from the start when all of its blocks
+ *  are gone.  A contribution block larger than a sixteenth of a chunk gets a
+ *  chunk of its own, freed with the block.  Such a block is also copied
+ *  without its assembled rows once half of them are gone (see
+ *  paru_arena_cb_compact), so most of its memory is given back long before its
+ *  last row is assembled.
+ *
+ *  With Control->mem_arena == 0 there are no arenas: each front and each
+ *  contribution block gets a chunk of its own, and no block is compacted.
+ *
+ * @author Aznaveh
+ *
+ */
+
+#include <algorithm>
+
+#include "paru_internal.hpp"
+
+#define PARU_ARENA_ALIGN 64
+#define PARU_ARENA_MIN_CHUNK (4 * 1024)
+// a chunk is held by any of its blocks still in use, so the chunks are kept
+// small: only small blocks benefit from sharing one anyway
+#define PARU_ARENA_MAX_CHUNK (128 * 1024)
+
+static size_t paru_arena_round(size_t size)
+{
+    return (size + PARU_ARENA_ALIGN - 1) / PARU_ARENA_ALIGN * PARU_ARENA_ALIGN;
+}
+
+static size_t paru_arena_clamp(double bytes)
+{
+    if (bytes < PARU_ARENA_MIN_CHUNK) return PARU_ARENA_MIN_CHUNK;
+    if (bytes > PARU_ARENA_MAX_CHUNK) return PARU_ARENA_MAX_CHUNK;
+    return paru_arena_round((size_t)bytes);
+}
+
+//------------------------------------------------------------------------------
+// paru_arena_new_chunk: take a chunk from the pool, or allocate one
+//------------------------------------------------------------------------------
+
+static paru_arena_chunk *paru_arena_new_chunk(size_t size, bool cb,
+                                              paru_arena_stats *stats)
+{
+    paru_arena_chunk *chunk = NULL;
+    if (size == stats->chunk_size)
+    {
+        #pragma omp critical (paru_arena)
+        {
+            chunk = stats->pool;
+            if (chunk != NULL)
+            {
+                stats->pool = chunk->next;
+                if (cb)
+                {
+                    stats->cb_bytes += chunk->tot_size;
+                    stats->cb_peak = std::max(stats->cb_peak, stats->cb_bytes);
+                }
+            }
+        }
+    }
+
+    if (chunk == NULL)
+    {
+        size_t header = paru_arena_round(sizeof(paru_arena_chunk));
+        // over-allocate so that the header and the data can be aligned
+        size_t tot_size = header + size + PARU_ARENA_ALIGN;
+        void *p = paru_alloc(1, tot_size);
+        if (p == NULL) return NULL;
+        // a chunk is first touched by the thread that owns the arena, which
+        // also factorizes its fronts, so only huge pages are requested
+        SuiteSparse_memory_advise(p, tot_size, SUITESPARSE_MEMORY_HUGEPAGE);
+        size_t pad = (PARU_ARENA_ALIGN - (size_t)p % PARU_ARENA_ALIGN)
+            % PARU_ARENA_ALIGN;
+        chunk = reinterpret_cast<paru_arena_chunk*>(static_cast<char*>(p) +
+                                                    pad);
+        chunk->base = p;
+        chunk->tot_size = tot_size;
+        chunk->size = size;
+
+        #pragma omp critical (paru_arena)
+        {
+            stats->bytes += tot_size;
+            stats->peak = std::max(stats->peak, stats->bytes);
+            if (cb)
+            {
+                stats->cb_bytes += tot_size;
+                stats->cb_peak = std::max(stats->cb_peak, stats->cb_bytes);
+            }
+            stats->nchunks++;
+        }
+    }
+
+    chunk->next = NULL;
+    // the front chunks are freed by ParU_Freenum, after Work is gone
+    chunk->stats = cb ? stats : NULL;
+    chunk->used = 0;
+    chunk->live = 1;
+    return chunk;
+}
+
+//------------------------------------------------------------------------------
+// paru_arena_free_chunk: return a chunk to the pool, or free it
+//------------------------------------------------------------------------------
+
+static void paru_arena_free_chunk(paru_arena_chunk *chunk)
+{
+    paru_arena_stats *stats = chunk->stats;
+    if (stats != NULL)
+    {
+        // a chunk of contribution blocks
+        bool pool = (chunk->size == stats->chunk_size);
+        #pragma omp critical (paru_arena)
+        {
+            stats->cb_bytes -= chunk->tot_size;
+            if (pool)
+            {
+                chunk->next = stats->pool;
+                stats->pool = chunk;
+            }
+            else
+            {
+                stats->bytes -= chunk->tot_size;
+            }
+        }
+        if (pool) return;
+    }
+    paru_free(1, chunk->tot_size, chunk->base);
+}
+
+static void *paru_arena_data(paru_arena_chunk *chunk, size_t offset)
+{
+    return static_cast<char*>(static_cast<void*>(chunk)) +
+           paru_arena_round(sizeof(paru_arena_chunk)) + offset;
+}
+
+//------------------------------------------------------------------------------
+// paru_arena_init: one front and one contribution block arena per thread
+//------------------------------------------------------------------------------
+
+ParU_Ret paru_arena_init(paru_work *Work, ParU_Numeric *Num)
+{
+    DEBUGLEVEL(0);
+    ParU_Symbolic *Sym = Work->Sym;
+    int64_t nf = Sym->nf;
+    int64_t *Super = Sym->Super;
+    int64_t *Fm = Sym->Fm;
+    int64_t *Cm = Sym->Cm;
+    int64_t narenas = std::max((int64_t)Num->Control->paru_max_threads,
+                               (int64_t)1);
+    if (Num->Control->mem_arena == 0) narenas = 0;
+
+    Num->front_chunks = NULL;
+    Num->arena_peak = 0;
+    Num->arena_cb_peak = 0;
+    Num->arena_nchunks = 0;
+    Num->arena_ncompact = 0;
+    Work->narenas = narenas;
+    Work->front_arena = NULL;
+    Work->cb_arena = NULL;
+    Work->arena_stats = {0, 0, 0, 0, 0, 0, 0, NULL};
+    if (nf == 0 || narenas == 0) return PARU_SUCCESS;
+
+    Work->front_arena =
+        static_cast<paru_arena*>(paru_calloc(narenas, sizeof(paru_arena)));
+    Work->cb_arena =
+        static_cast<paru_arena*>(paru_calloc(narenas, sizeof(paru_arena)));
+    if (Work->front_arena == NULL || Work->cb_arena == NULL)
+    {
+        return PARU_OUT_OF_MEMORY;
+    }
+
+    // upper bounds on the memory of the fronts and of the contribution blocks
+    double front_bytes = 0, cb_bytes = 0;
+    for (int64_t f = 0; f < nf; f++)
+    {
+        double fp = (double)(Super[f + 1] - Super[f]);
+        double fm = (double)Fm[f];
+        double fn = (double)Cm[f];
+        double cm = std::max(fm - fp, 0.0);
+        front_bytes += sizeof(double) * fp * (fm + fn);
+        cb_bytes += sizeof(paru_element) + sizeof(int64_t) * 2 * (cm + fn) +
+                    sizeof(double) * cm * fn;
+    }
+    // a chunk holds eight fronts or four contribution blocks of average size
+    Work->arena_stats.chunk_size =
+        paru_arena_clamp(std::max(front_bytes, 4 * cb_bytes) / nf);
+    PRLEVEL(1, ("%% arena chunks: " LD " bytes\n",
+                (int64_t)Work->arena_stats.chunk_size));
+    return PARU_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// paru_arena_front_alloc: zeroed memory for a front, owned by Num
+//------------------------------------------------------------------------------
+
+void *paru_arena_front_alloc(size_t n, size_t size, paru_work *Work,
+                             ParU_Numeric *Num)
+{
+    DEBUGLEVEL(0);
+    if (size == 0 || n >= (Size_max / size) || n >= INT_MAX)
+    {
+        PRLEVEL(1, ("ParU: problem too large\n"));
+        return NULL;
+    }
+    size_t bytes = paru_arena_round(std::max(n * size, (size_t)1));
+    int64_t tid = PARU_OPENMP_GET_THREAD_NUM;
+    ASSERT(Work->narenas == 0 || tid < Work->narenas);
+    paru_arena *arena = (tid < Work->narenas) ? Work->front_arena + tid : NULL;
+
+    size_t chunk_size = Work->arena_stats.chunk_size;
+
+    paru_arena_chunk *chunk = NULL;
+    void *p = NULL;
+    if (arena != NULL && arena->chunk != NULL &&
+        arena->chunk->used + bytes <= arena->chunk->size)
+    {
+        chunk = arena->chunk;
+        p = paru_arena_data(chunk, chunk->used);
+        chunk->used += bytes;
+    }
+    else
+    {
+        // a small front starts a new chunk, leaving less than bytes unused in
+        // the old one; a large front gets a chunk of its own
+        bool own = (arena == NULL || bytes > chunk_size / 32);
+        chunk = paru_arena_new_chunk(own ? bytes : chunk_size, false,
+                                     &Work->arena_stats);
+        if (chunk == NULL) return NULL;
+        #pragma omp critical (paru_arena)
+        {
+            chunk->next = static_cast<paru_arena_chunk*>(Num->front_chunks);
+            Num->front_chunks = chunk;
+        }
+        p = paru_arena_data(chunk, 0);
+        chunk->used = bytes;
+        if (!own) arena->chunk = chunk;
+    }
+    paru_memset(p, 0, n * size, Num->Control);
+    return p;
+}
+
+//------------------------------------------------------------------------------
+// paru_arena_cb_alloc: memory for a contribution block
+//------------------------------------------------------------------------------
+
+void *paru_arena_cb_alloc(size_t size, paru_work *Work,
+                          paru_arena_chunk **chunk_handle)
+{
+    DEBUGLEVEL(0);
+    *chunk_handle = NULL;
+    if (size == 0 || size >= Size_max / 2)
+    {
+        PRLEVEL(1, ("ParU: problem too large\n"));
+        return NULL;
+    }
+    size_t bytes = paru_arena_round(size);
+    int64_t tid = PARU_OPENMP_GET_THREAD_NUM;
+    ASSERT(Work->narenas == 0 || tid < Work->narenas);
+    paru_arena *arena = (tid < Work->narenas) ? Work->cb_arena + tid : NULL;
+
+    size_t chunk_size = Work->arena_stats.chunk_size;
+    if (arena == NULL || bytes > chunk_size / 16)
+    {
+        // a chunk of its own, freed with the block
+        paru_arena_chunk *chunk =
+            paru_arena_new_chunk(bytes, true, &Work->arena_stats);
+        if (chunk == NULL) return NULL;
+        chunk->used = bytes;  // live is 1 for the block itself
+        *chunk_handle = chunk;
+        return paru_arena_data(chunk, 0);
+    }
+
+    paru_arena_chunk *chunk = arena->chunk;
+    if (chunk != NULL)
+    {
+        int64_t live;
+        #pragma omp atomic read
+        live = chunk->live;
+        if (live == 1)
+        {
+            // all the blocks of the current chunk are gone; start over
+            chunk->used = 0;
+        }
+        else if (chunk->used + bytes > chunk->size)
+        {
+            // retire the current chunk; its last block will free it
+            paru_arena_cb_free(chunk);
+            chunk = arena->chunk = NULL;
+        }
+    }
+    if (chunk == NULL)
+    {
+        chunk = paru_arena_new_chunk(chunk_size, true, &Work->arena_stats);
+        if (chunk == NULL) return NULL;
+        arena->chunk = chunk;
+    }
+    void *p = paru_arena_data(chunk, chunk->used);
+    chunk->used += bytes;
+    #pragma omp atomic update
+    chunk->live++;
+    *chunk_handle = chunk;
+    return p;
+}
+
+//------------------------------------------------------------------------------
+// paru_arena_cb_free: release a block of a contribution block chunk
+//------------------------------------------------------------------------------
+
+void paru_arena_cb_free(paru_arena_chunk *chunk)
+{
+    int64_t live;
+    #pragma omp atomic capture
+    live = --(chunk->live);
+    if (live == 0) paru_arena_free_chunk(chunk);
+}
+
+//------------------------------------------------------------------------------
+// paru_arena_cb_compact: drop the assembled rows of the blocks in a heap
+//------------------------------------------------------------------------------
+
+// Most of a contribution block is assembled row by row into the fronts of its
+// ancestors, but its memory is held until its last row is gone.  At the end of
+// front f, a large block of the heap of f with half of its rows or more gone
+// is copied into a new block holding only the rows left, and the old block is
+// freed.  The new position of each row is written in its tuple; the tuples of
+// the rows that are gone are left as they are and dropped by
+// paru_update_rowDeg, since they no longer match.  A block is copied at most
+// log2(nrows) times, and each copy is at most half of the memory it releases.
+// A block is left as it is if there is no memory for the copy.
+
+void paru_arena_cb_compact(int64_t f, paru_work *Work, ParU_Numeric *Num)
+{
+    DEBUGLEVEL(0);
+    if (Work->narenas == 0) return;
+    ParU_Symbolic *Sym = Work->Sym;
+    int64_t eli = Sym->super2atree[f];
+    std::vector<int64_t> *curHeap = Work->heapList[eli];
+    if (curHeap == NULL) return;
+    paru_element **elementList = Work->elementList;
+    paru_tupleList *RowList = Work->RowList;
+    // only blocks with a chunk of their own give their memory back at once
+    size_t min_size = Work->arena_stats.chunk_size / 16;
+
+    for (int64_t e : *curHeap)
+    {
+        paru_element *el = elementList[e];
+        if (el == NULL || el->chunk == NULL || e == eli) continue;
+        int64_t mEl = el->nrows;
+        int64_t nEl = el->ncols;
+        if (2 * el->nrowsleft > mEl ||
+            sizeof(double) * mEl * nEl < min_size)
+            continue;
+
+        int64_t *el_colIndex = (int64_t *)(el + 1);
+        int64_t *el_rowIndex = el_colIndex + nEl;
+        int64_t *colRelIndex = el_rowIndex + mEl;
+        int64_t *rowRelIndex = colRelIndex + nEl;
+        double *el_Num = (double *)(rowRelIndex + mEl);
+
+        int64_t m2 = 0;
+        for (int64_t i = 0; i < mEl; i++)
+        {
+            if (el_rowIndex[i] >= 0) m2++;
+        }
+        ASSERT(m2 > 0);
+
+        size_t tot_size = sizeof(paru_element) +
+                          sizeof(int64_t) * (2 * (m2 + nEl)) +
+                          sizeof(double) * m2 * nEl;
+        paru_arena_chunk *chunk = NULL;
+        paru_element *newEl = static_cast<paru_element*>(
+            paru_arena_cb_alloc(tot_size, Work, &chunk));
+        if (newEl == NULL) return;
+        *newEl = *el;
+        newEl->nrows = m2;
+        newEl->chunk = chunk;
+
+        int64_t *new_colIndex = (int64_t *)(newEl + 1);
+        int64_t *new_rowIndex = new_colIndex + nEl;
+        int64_t *new_colRelIndex = new_rowIndex + m2;
+        int64_t *new_rowRelIndex = new_colRelIndex + nEl;
+        double *new_Num = (double *)(new_rowRelIndex + m2);
+
+        paru_memcpy(new_colIndex, el_colIndex, nEl * sizeof(int64_t),
+                    Num->Control);
+        paru_memcpy(new_colRelIndex, colRelIndex, nEl * sizeof(int64_t),
+                    Num->Control);
+        int64_t i2 = 0;
+        for (int64_t i = 0; i < mEl; i++)
+        {
+            int64_t row = el_rowIndex[i];
+            if (row < 0) continue;
+            new_rowIndex[i2] = row;
+            new_rowRelIndex[i2] = rowRelIndex[i];
+            // move the tuple of the row
+            paru_tupleList *curRowTupleList = &RowList[row];
+            paru_tuple *listRowTuples = curRowTupleList->list;
+            for (int64_t k = 0; k < curRowTupleList->numTuple; k++)
+            {
+                if (listRowTuples[k].e == e && listRowTuples[k].f == i)
+                {
+                    listRowTuples[k].f = i2;
+                    break;
+                }
+            }
+            i2++;
+        }
+        for (int64_t j = 0; j < nEl; j++)
+        {
+            if (el_colIndex[j] < 0) continue;  // column gone
+            double *sC = el_Num + mEl * j;
+            double *dC = new_Num + m2 * j;
+            i2 = 0;
+            for (int64_t i = 0; i < mEl; i++)
+            {
+                if (el_rowIndex[i] >= 0) dC[i2++] = sC[i];
+            }
+        }
+        PRLEVEL(1, ("%% compacted element " LD " from " LD " to " LD " rows\n",
+                    e, mEl, m2));
+
+        elementList[e] = newEl;
+        paru_arena_cb_free(el->chunk);
+        #pragma omp atomic update
+        Work->arena_stats.ncompact++;
+    }
+}
+
+//------------------------------------------------------------------------------
+// paru_arena_free_work: retire the arenas at the end of the factorization
+//------------------------------------------------------------------------------
+
+// The contribution blocks must be freed before; the front chunks stay in Num,
+// and the chunks left in the pool are freed.
+
+void paru_arena_free_work(paru_work *Work)
+{
+    if (Work->cb_arena != NULL)
+    {
+        for (int64_t k = 0; k < Work->narenas; k++)
+        {
+            if (Work->cb_arena[k].chunk != NULL)
+            {
+                paru_arena_cb_free(Work->cb_arena[k].chunk);
+            }
+        }
+    }
+    paru_arena_stats *stats = &Work->arena_stats;
+    while (stats->pool != NULL)
+    {
+        paru_arena_chunk *chunk = stats->pool;
+        stats->pool = chunk->next;
+        stats->bytes -= chunk->tot_size;
+        paru_free(1, chunk->tot_size, chunk->base);
+    }
+    paru_free(Work->narenas, sizeof(paru_arena), Work->cb_arena);
+    paru_free(Work->narenas, sizeof(paru_arena), Work->front_arena);
+    Work->cb_arena = NULL;
+    Work->front_arena = NULL;
+}
+
+//------------------------------------------------------------------------------
+// paru_arena_free_num: free the front chunks of Num
+//------------------------------------------------------------------------------
+
+void paru_arena_free_num(ParU_Numeric *Num)
+{
+    paru_arena_chunk *chunk = static_cast<paru_arena_chunk*>(Num->front_chunks);
+    while (chunk != NULL)
+    {
+        paru_arena_chunk *next = chunk->next;
+        paru_arena_free_chunk(chunk);
+        chunk = next;
+    }
+    Num->front_chunks = NULL;
+}
@@ -0,0 +1,433 @@
+////////////////////////////////////////////////////////////////////////////////
+//////////////////////////  ParU_Autotune //////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+// ParU, Copyright (c) 2022, Mohsen Aznaveh and Timothy A. Davis,
+// All Rights Reserved.
+// SPDX-License-Identifier: GNU GPL 3.0
+
+/*! @brief  pick the task granularity thresholds of ParU_Control for this
+ *          machine, and save or load them as a tuning profile
+ *
+ *  Control->trivial decides when paru_tasked_dgemm does a small dgemm by hand
+ *  instead of calling BLAS, and Control->worthwhile_dgemm and
+ *  Control->worthwhile_trsm decide when paru_tasked_dgemm and
+ *  paru_tasked_trsm split a BLAS call into OpenMP tasks.  ParU_Autotune has
+ *  two modes:
+ *
+ *      A and Sym NULL: the kernels are timed on dense blocks of the size of
+ *          typical fronts (a panel of panel_width columns and a contribution
+ *          block of each candidate size).  worthwhile_dgemm and
+ *          worthwhile_trsm are the smallest sizes where the tasked call is
+ *          faster than a single BLAS call.  Each time is the median of
+ *          several runs, after a warm-up run.
+ *
+ *      A and Sym given: calibration run; A is factorized with a few
+ *          candidate values of each threshold, one threshold at a time, and
+ *          the fastest factorization wins.
+ *
+ *  paru_tasked_dgemm and paru_tasked_trsm only split a call while
+ *  1 < naft < paru_max_threads, so with fewer than three threads nothing is
+ *  ever tasked and only trivial is tuned.  The number of BLAS threads of the
+ *  process is restored on return.
+ *  The profile is a small text file with one "name value" line per
+ *  threshold; lines starting with # are comments.
+ *
+ * @author Aznaveh
+ */
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include "paru_internal.hpp"
+
+#define PARU_TUNE_NTRIVIAL 8
+#define PARU_TUNE_NCAND 5
+#define PARU_TUNE_NREPS 5
+
+static const int64_t trivial_cand[PARU_TUNE_NTRIVIAL] = {1, 2,  4,  6,
+                                                         8, 12, 16, 24};
+static const int64_t dgemm_cand[PARU_TUNE_NCAND] = {128, 256, 512, 1024, 2048};
+static const int64_t trsm_cand[PARU_TUNE_NCAND] = {1024, 2048, 4096, 8192,
+                                                   16384};
+
+//------------------------------------------------------------------------------
+// paru_tune_time: median time of a kernel
+//------------------------------------------------------------------------------
+
+// The kernel is run once to warm up (page in the workspace and start the
+// thread pools of OpenMP and the BLAS), and then PARU_TUNE_NREPS times.
+
+template <typename Kernel> static double paru_tune_time(Kernel kernel)
+{
+    double t[PARU_TUNE_NREPS];
+    kernel();
+    for (int r = 0; r < PARU_TUNE_NREPS; r++)
+    {
+        double start_time = PARU_OPENMP_GET_WTIME;
+        kernel();
+        t[r] = PARU_OPENMP_GET_WTIME - start_time;
+    }
+    std::sort(t, t + PARU_TUNE_NREPS);
+    return t[PARU_TUNE_NREPS / 2];
+}
+
+//------------------------------------------------------------------------------
+// paru_tune_factorize: time of the fastest of two factorizations of A
+//------------------------------------------------------------------------------
+
+static ParU_Ret paru_tune_factorize(cholmod_sparse *A, ParU_Symbolic *Sym,
+                                    ParU_Control *Control, double *time)
+{
+    *time = -1;
+    for (int rep = 0; rep < 2; rep++)
+    {
+        ParU_Numeric *Num = NULL;
+        double start_time = PARU_OPENMP_GET_WTIME;
+        ParU_Ret info = ParU_Factorize(A, Sym, &Num, Control);
+        double t = PARU_OPENMP_GET_WTIME - start_time;
+        ParU_Freenum(&Num, Control);
+        if (info != PARU_SUCCESS) return info;
+        if (*time < 0 || t < *time) *time = t;
+    }
+    return PARU_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// paru_tune_calibrate: tune one threshold by factorizing A
+//------------------------------------------------------------------------------
+
+static ParU_Ret paru_tune_calibrate(cholmod_sparse *A, ParU_Symbolic *Sym,
+                                    ParU_Control *Control, int64_t *threshold,
+                                    const int64_t *cand, int64_t ncand)
+{
+    DEBUGLEVEL(0);
+    int64_t best = *threshold;
+    double best_time = -1;
+    for (int64_t k = 0; k < ncand; k++)
+    {
+        double t;
+        *threshold = cand[k];
+        ParU_Ret info = paru_tune_factorize(A, Sym, Control, &t);
+        if (info != PARU_SUCCESS)
+        {
+            *threshold = best;
+            return info;
+        }
+        PRLEVEL(1, ("%% threshold " LD ": %lf seconds\n", cand[k], t));
+        if (best_time < 0 || t < best_time)
+        {
+            best_time = t;
+            best = cand[k];
+        }
+    }
+    *threshold = best;
+    return PARU_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// paru_tune_small_dgemm: time of hand-coded and BLAS s-by-s-by-s dgemms
+//------------------------------------------------------------------------------
+
+// the hand-coded loop is the same as the one in paru_tasked_dgemm
+
+static int64_t paru_tune_small_dgemm(int64_t s, double *A, double *B, double *C,
+                                     double *time_loop, double *time_blas)
+{
+    const int64_t reps = std::max((int64_t)16, (int64_t)(1 << 21) / (s * s * s));
+    double alpha = -1, beta = 1;
+    int64_t blas_ok = TRUE;
+
+    *time_loop = paru_tune_time([&]() {
+        for (int64_t r = 0; r < reps; r++)
+        {
+            for (int64_t i = 0; i < s; i++)
+                for (int64_t j = 0; j < s; j++)
+                    for (int64_t k = 0; k < s; k++)
+                        C[i + j * s] -= A[i + k * s] * B[k + j * s];
+        }
+    });
+
+    *time_blas = paru_tune_time([&]() {
+        for (int64_t r = 0; r < reps; r++)
+        {
+            SUITESPARSE_BLAS_dgemm("N", "N", s, s, s, &alpha, A, s, B, s,
+                                   &beta, C, s, blas_ok);
+        }
+    });
+    return blas_ok;
+}
+
+//------------------------------------------------------------------------------
+// paru_tune_synthetic: tune the thresholds on dense blocks
+//------------------------------------------------------------------------------
+
+static ParU_Ret paru_tune_synthetic(ParU_Control *Control)
+{
+    DEBUGLEVEL(0);
+    const int32_t max_threads = Control->paru_max_threads;
+    const int64_t K = std::max(Control->panel_width, (int64_t)1);
+    const int64_t M = dgemm_cand[PARU_TUNE_NCAND - 1];
+    const int64_t N = M;
+    const int64_t Ntrsm = trsm_cand[PARU_TUNE_NCAND - 1];
+
+    // workspace, large enough for all of the benchmarks
+    int64_t sizeA = std::max(M * K, K * K);
+    int64_t sizeB = std::max(K * N, K * Ntrsm);
+    int64_t sizeC = M * N;
+    double *A = static_cast<double*>(paru_alloc(sizeA, sizeof(double)));
+    double *B = static_cast<double*>(paru_alloc(sizeB, sizeof(double)));
+    double *C = static_cast<double*>(paru_alloc(sizeC, sizeof(double)));
+    if (A == NULL || B == NULL || C == NULL)
+    {
+        paru_free(sizeA, sizeof(double), A);
+        paru_free(sizeB, sizeof(double), B);
+        paru_free(sizeC, sizeof(double), C);
+        return PARU_OUT_OF_MEMORY;
+    }
+    // any bounded values will do; the trsm benchmark only uses the strictly
+    // lower triangular part of the first K-by-K block of A
+    for (int64_t p = 0; p < sizeA; p++) A[p] = 1.0 / (double)(1 + p % 17);
+    for (int64_t p = 0; p < sizeB; p++) B[p] = 1.0 / (double)(1 + p % 13);
+    paru_memset(C, 0, sizeC * sizeof(double), Control);
+
+    int64_t blas_ok = TRUE;
+    BLAS_set_num_threads(1);
+
+    //--------------------------------------------------------------------------
+    // trivial: smallest dgemm where BLAS wins over the hand-coded loop
+    //--------------------------------------------------------------------------
+
+    int64_t trivial = trivial_cand[PARU_TUNE_NTRIVIAL - 1];
+    for (int64_t k = 0; k < PARU_TUNE_NTRIVIAL; k++)
+    {
+        double time_loop, time_blas;
+        int64_t s = trivial_cand[k];
+        blas_ok = paru_tune_small_dgemm(s, A, B, C, &time_loop, &time_blas) &&
+                  blas_ok;
+        PRLEVEL(1, ("%% small dgemm " LD ": loop %lf blas %lf\n", s, time_loop,
+                    time_blas));
+        if (time_blas < time_loop)
+        {
+            trivial = s;
+            break;
+        }
+    }
+    Control->trivial = trivial;
+
+    //--------------------------------------------------------------------------
+    // worthwhile_dgemm and worthwhile_trsm
+    //--------------------------------------------------------------------------
+
+    if (max_threads > 2)
+    {
+        // a front factorized while half of the threads are busy with others;
+        // this is where paru_tasked_dgemm and paru_tasked_trsm split the call
+        paru_work myWork = {};
+        paru_work *Work = &myWork;
+        Work->naft = std::max(2, max_threads / 2);
+        ParU_Numeric myNum = {};
+        ParU_Numeric *Num = &myNum;
+        Num->Control = Control;
+
+        // worthwhile_dgemm: the smallest s where an s-by-s-by-K dgemm split
+        // into 2-by-2 tasks (threshold s) beats one call (threshold s+1)
+        int64_t worthwhile_dgemm = dgemm_cand[PARU_TUNE_NCAND - 1];
+        for (int64_t k = 0; k < PARU_TUNE_NCAND; k++)
+        {
+            int64_t s = dgemm_cand[k];
+            auto dgemm = [&]() {
+                blas_ok = paru_tasked_dgemm(-1, s, s, K, A, s, B, K, 1, C, s,
+                                            Work, Num) && blas_ok;
+            };
+            Control->worthwhile_dgemm = s + 1;
+            double time_one = paru_tune_time(dgemm);
+            Control->worthwhile_dgemm = s;
+            double time_tasked = paru_tune_time(dgemm);
+            PRLEVEL(1, ("%% dgemm " LD ": one call %lf tasked %lf\n", s,
+                        time_one, time_tasked));
+            if (time_tasked < time_one)
+            {
+                worthwhile_dgemm = s;
+                break;
+            }
+        }
+        Control->worthwhile_dgemm = worthwhile_dgemm;
+
+        // worthwhile_trsm: the smallest n where a K-by-n trsm split into two
+        // tasks (threshold n) beats one call (threshold n+1)
+        int64_t worthwhile_trsm = trsm_cand[PARU_TUNE_NCAND - 1];
+        for (int64_t k = 0; k < PARU_TUNE_NCAND; k++)
+        {
+            int64_t n = trsm_cand[k];
+            auto trsm = [&]() {
+                blas_ok = paru_tasked_trsm(-1, K, n, 1, A, K, B, K, Work,
+                                           Num) && blas_ok;
+            };
+            Control->worthwhile_trsm = n + 1;
+            double time_one = paru_tune_time(trsm);
+            Control->worthwhile_trsm = n;
+            double time_tasked = paru_tune_time(trsm);
+            PRLEVEL(1, ("%% trsm " LD ": one call %lf tasked %lf\n", n,
+                        time_one, time_tasked));
+            if (time_tasked < time_one)
+            {
+                worthwhile_trsm = n;
+                break;
+            }
+        }
+        Control->worthwhile_trsm = worthwhile_trsm;
+    }
+
+    paru_free(sizeA, sizeof(double), A);
+    paru_free(sizeB, sizeof(double), B);
+    paru_free(sizeC, sizeof(double), C);
+    return blas_ok ? PARU_SUCCESS : PARU_TOO_LARGE;
+}
+
+//------------------------------------------------------------------------------
+// ParU_Autotune: pick trivial, worthwhile_dgemm and worthwhile_trsm
+//------------------------------------------------------------------------------
+
+ParU_Ret ParU_Autotune(cholmod_sparse *A, ParU_Symbolic *Sym,
+                       ParU_Control *user_Control)
+{
+    DEBUGLEVEL(0);
+    if (user_Control == NULL || (A == NULL) != (Sym == NULL))
+    {
+        return PARU_INVALID;
+    }
+    ParU_Control my_Control;
+    paru_check_control(user_Control, Sym, &my_Control);
+    ParU_Control *Control = &my_Control;
+
+    // ParU_Factorize and the tasked kernels change the number of BLAS
+    // threads; it is restored before returning
+    int blas_nthreads = SUITESPARSE_BLAS_get_num_threads;
+
+    ParU_Ret info;
+    if (A == NULL)
+    {
+        PRLEVEL(1, ("%% Autotune on dense blocks\n"));
+        info = paru_tune_synthetic(Control);
+    }
+    else
+    {
+        PRLEVEL(1, ("%% Autotune by factorizing A\n"));
+        // the user's Control, except for the thresholds being tuned
+        ParU_Control tune_Control = *user_Control;
+        tune_Control.trivial = Control->trivial;
+        tune_Control.worthwhile_dgemm = Control->worthwhile_dgemm;
+        tune_Control.worthwhile_trsm = Control->worthwhile_trsm;
+        info = paru_tune_calibrate(A, Sym, &tune_Control, &tune_Control.trivial,
+                                   trivial_cand, PARU_TUNE_NTRIVIAL);
+        if (info == PARU_SUCCESS && Control->paru_max_threads > 2)
+        {
+            info = paru_tune_calibrate(A, Sym, &tune_Control,
+                                       &tune_Control.worthwhile_dgemm,
+                                       dgemm_cand, PARU_TUNE_NCAND);
+        }
+        if (info == PARU_SUCCESS && Control->paru_max_threads > 2)
+        {
+            info = paru_tune_calibrate(A, Sym, &tune_Control,
+                                       &tune_Control.worthwhile_trsm,
+                                       trsm_cand, PARU_TUNE_NCAND);
+        }
+        Control->trivial = tune_Control.trivial;
+        Control->worthwhile_dgemm = tune_Control.worthwhile_dgemm;
+        Control->worthwhile_trsm = tune_Control.worthwhile_trsm;
+    }
+
+    if (blas_nthreads > 0) BLAS_set_num_threads(blas_nthreads);
+
+    if (info == PARU_SUCCESS)
+    {
+        PRLEVEL(1, ("%% tuned: trivial=" LD " worthwhile_dgemm=" LD
+                    " worthwhile_trsm=" LD "\n", Control->trivial,
+                    Control->worthwhile_dgemm, Control->worthwhile_trsm));
+        user_Control->trivial = Control->trivial;
+        user_Control->worthwhile_dgemm = Control->worthwhile_dgemm;
+        user_Control->worthwhile_trsm = Control->worthwhile_trsm;
+    }
+    return info;
+}
+
+//------------------------------------------------------------------------------
+// ParU_Save_Tuning: write the thresholds of Control to a profile
+//------------------------------------------------------------------------------
+
+ParU_Ret ParU_Save_Tuning(const char *filename, ParU_Control *Control)
+{
+    if (filename == NULL || Control == NULL)
+    {
+        return PARU_INVALID;
+    }
+    FILE *f = fopen(filename, "w");
+    if (f == NULL)
+    {
+        return PARU_INVALID;
+    }
+    bool ok = fprintf(f, "# ParU tuning profile\n") > 0 &&
+              fprintf(f, "trivial " LD "\n", Control->trivial) > 0 &&
+              fprintf(f, "worthwhile_dgemm " LD "\n",
+                      Control->worthwhile_dgemm) > 0 &&
+              fprintf(f, "worthwhile_trsm " LD "\n",
+                      Control->worthwhile_trsm) > 0;
+    ok = (fclose(f) == 0) && ok;
+    return ok ? PARU_SUCCESS : PARU_INVALID;
+}
+
+//------------------------------------------------------------------------------
+// ParU_Load_Tuning: read the thresholds of a profile into Control
+//------------------------------------------------------------------------------
+
+// Unknown names are skipped, so that a profile can hold more entries in the
+// future.  Control is left unchanged if the profile is not valid.
+
+ParU_Ret ParU_Load_Tuning(const char *filename, ParU_Control *Control)
+{
+    if (filename == NULL || Control == NULL)
+    {
+        return PARU_INVALID;
+    }
+    FILE *f = fopen(filename, "r");
+    if (f == NULL)
+    {
+        return PARU_INVALID;
+    }
+    int64_t trivial = Control->trivial;
+    int64_t worthwhile_dgemm = Control->worthwhile_dgemm;
+    int64_t worthwhile_trsm = Control->worthwhile_trsm;
+    ParU_Ret info = PARU_SUCCESS;
+    char line[256];
+    while (info == PARU_SUCCESS && fgets(line, sizeof(line), f) != NULL)
+    {
+        char name[64];
+        long long value;
+        if (line[0] == '#' || line[0] == '\n') continue;
+        if (sscanf(line, "%63s %lld", name, &value) != 2 || value < 0)
+        {
+            info = PARU_INVALID;
+        }
+        else if (strcmp(name, "trivial") == 0)
+        {
+            trivial = (int64_t)value;
+        }
+        else if (strcmp(name, "worthwhile_dgemm") == 0)
+        {
+            worthwhile_dgemm = (int64_t)value;
+        }
+        else if (strcmp(name, "worthwhile_trsm") == 0)
+        {
+            worthwhile_trsm = (int64_t)value;
+        }
+    }
+    fclose(f);
+    if (info == PARU_SUCCESS)
+    {
+        Control->trivial = trivial;
+        Control->worthwhile_dgemm = worthwhile_dgemm;
+        Control->worthwhile_trsm = worthwhile_trsm;
+    }
+    return info;
+}
@@ -34,6 +34,7 @@ ParU_Ret ParU_C_Version (int ver [3], char date [128])
 ParU_Ret ParU_C_Init_Control (ParU_C_Control *Control_C)
 {
     Control_C->mem_chunk = PARU_MEM_CHUNK ;  // chunk size for memset and memcpy
+    Control_C->mem_arena = 1;
 
     Control_C->umfpack_ordering =  UMFPACK_ORDERING_METIS;
     Control_C->umfpack_strategy = 
@@ -63,6 +64,7 @@ ParU_Ret ParU_C_Init_Control (ParU_C_Control *Control_C)
 void paru_cp_control (ParU_Control *Control, ParU_C_Control *Control_C)
 {
     Control->mem_chunk = Control_C->mem_chunk;
+    Control->mem_arena = Control_C->mem_arena;
 
     Control->umfpack_ordering = Control_C->umfpack_ordering;
     Control->umfpack_strategy = Control_C->umfpack_strategy;
@@ -156,6 +158,87 @@ ParU_Ret ParU_C_Factorize (
     return info;
 }
 
+//------------------------------------------------------------------------------
+// ParU_C_Refactorize: Numeric refactorization reusing the pivot sequence of
+// a prior ParU_C_Factorize; see ParU_Refactorize.
+//------------------------------------------------------------------------------
+
+ParU_Ret ParU_C_Refactorize (
+        // input:
+        cholmod_sparse *A, ParU_C_Symbolic *Sym_C,
+        // input/output:
+        ParU_C_Numeric **Num_handle_C,
+        // control:
+    ParU_C_Control *Control_C)
+{
+    if (Num_handle_C == NULL || *Num_handle_C == NULL)
+    {
+        return ParU_C_Factorize (A, Sym_C, Num_handle_C, Control_C);
+    }
+    ParU_Control Control;
+    paru_cp_control (&Control, Control_C);
+    ParU_Symbolic *Sym = static_cast<ParU_Symbolic*>(Sym_C->sym_handle);
+    ParU_C_Numeric *Num_C = *Num_handle_C;
+    ParU_Numeric *Num = static_cast<ParU_Numeric*>(Num_C->num_handle);
+
+    ParU_Ret info;
+    info = ParU_Refactorize(A, Sym, &Num, &Control);
+    // Num may have been reallocated by a full factorization
+    Num_C->num_handle = static_cast<void*>(Num);
+    if (info != PARU_SUCCESS)
+        return info;
+    Num_C->rcond = Num->rcond;
+    return info;
+}
+
+//------------------------------------------------------------------------------
+// ParU_C_Autotune: pick the task granularity thresholds; see ParU_Autotune.
+//------------------------------------------------------------------------------
+
+ParU_Ret ParU_C_Autotune (
+        // input:
+        cholmod_sparse *A, ParU_C_Symbolic *Sym_C,
+        // input/output:
+        ParU_C_Control *Control_C)
+{
+    if (Control_C == NULL) return PARU_INVALID;
+    ParU_Control Control;
+    paru_cp_control (&Control, Control_C);
+    ParU_Symbolic *Sym = (Sym_C == NULL) ? NULL :
+        static_cast<ParU_Symbolic*>(Sym_C->sym_handle);
+    ParU_Ret info;
+    info = ParU_Autotune(A, Sym, &Control);
+    if (info != PARU_SUCCESS)
+        return info;
+    Control_C->trivial = Control.trivial;
+    Control_C->worthwhile_dgemm = Control.worthwhile_dgemm;
+    Control_C->worthwhile_trsm = Control.worthwhile_trsm;
+    return info;
+}
+
+ParU_Ret ParU_C_Save_Tuning (const char *filename, ParU_C_Control *Control_C)
+{
+    if (Control_C == NULL) return PARU_INVALID;
+    ParU_Control Control;
+    paru_cp_control (&Control, Control_C);
+    return ParU_Save_Tuning(filename, &Control);
+}
+
+ParU_Ret ParU_C_Load_Tuning (const char *filename, ParU_C_Control *Control_C)
+{
+    if (Control_C == NULL) return PARU_INVALID;
+    ParU_Control Control;
+    paru_cp_control (&Control, Control_C);
+    ParU_Ret info;
+    info = ParU_Load_Tuning(filename, &Control);
+    if (info != PARU_SUCCESS)
+        return info;
+    Control_C->trivial = Control.trivial;
+    Control_C->worthwhile_dgemm = Control.worthwhile_dgemm;
+    Control_C->worthwhile_trsm = Control.worthwhile_trsm;
+    return info;
+}
+
 //------------------------------------------------------------------------------
 //--------------------- Solve routines -----------------------------------------
 //------------------------------------------------------------------------------
@@ -21,7 +21,8 @@
  * @author Aznaveh
  *  */
 #include "paru_internal.hpp"
-paru_element *paru_create_element(int64_t nrows, int64_t ncols)
+paru_element *paru_create_element(int64_t nrows, int64_t ncols,
+                                  paru_work *Work)
 {
     DEBUGLEVEL(0);
 
@@ -30,8 +31,16 @@ paru_element *paru_create_element(int64_t nrows, int64_t ncols)
     size_t tot_size = sizeof(paru_element) +
                       sizeof(int64_t) * (2 * (nrows + ncols)) +
                       sizeof(double) * nrows * ncols;
-    curEl = static_cast<paru_element*>(paru_alloc(1, tot_size));
+    // contribution blocks come from the arena of this thread; the original
+    // rows (Work is NULL) are allocated one by one
+    paru_arena_chunk *chunk = NULL;
+    if (Work != NULL)
+        curEl = static_cast<paru_element*>(
+            paru_arena_cb_alloc(tot_size, Work, &chunk));
+    else
+        curEl = static_cast<paru_element*>(paru_alloc(1, tot_size));
     if (curEl == NULL) return NULL;  // do not do error checking
+    curEl->chunk = chunk;
 
     PRLEVEL(1, (" with size of " LD " in %p\n", tot_size, curEl));
 
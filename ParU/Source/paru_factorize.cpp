@@ -185,6 +185,58 @@ ParU_Ret paru_exec_tasks(int64_t t, int64_t *task_num_child, int64_t &chain_task
     return myInfo;
 }
 
+//------------------------------------------------------------------------------
+// paru_check_control: copy the user Control and fix any invalid entries
+//------------------------------------------------------------------------------
+
+void paru_check_control(ParU_Control *user_Control, ParU_Symbolic *Sym,
+                        ParU_Control *Control)
+{
+    ParU_Control &my_Control = *Control;
+    my_Control = *user_Control;
+    int64_t panel_width = my_Control.panel_width;
+    if (panel_width < 0 || (Sym != NULL && panel_width > Sym->m))
+        my_Control.panel_width = 32;
+    int64_t paru_strategy = my_Control.paru_strategy;
+    // at this point the strategy should be known, unless there is no
+    // matrix yet (Sym is NULL when called from ParU_Autotune)
+    if (Sym != NULL)
+    {
+        // if the user didnot decide I
+        if (paru_strategy == PARU_STRATEGY_AUTO)  // user didn't specify
+            // so I use the same strategy as umfpack
+            my_Control.paru_strategy = Sym->strategy;
+        else if (paru_strategy != PARU_STRATEGY_SYMMETRIC &&
+                 paru_strategy != PARU_STRATEGY_UNSYMMETRIC)
+            // user input is not correct so I go to default
+            my_Control.paru_strategy = Sym->strategy;
+        // else user already picked symmetric or unsymmetric
+        // and it has been copied over
+    }
+
+    double piv_toler = my_Control.piv_toler;
+    if (piv_toler > 1 || piv_toler < 0) my_Control.piv_toler = .1;
+    double diag_toler = my_Control.diag_toler;
+    if (diag_toler > 1 || diag_toler < 0) my_Control.diag_toler = .001;
+    int64_t trivial = my_Control.trivial;
+    if (trivial < 0) my_Control.trivial = 4;
+    int64_t worthwhile_dgemm = my_Control.worthwhile_dgemm;
+    if (worthwhile_dgemm < 0) my_Control.worthwhile_dgemm = 512;
+    int64_t worthwhile_trsm = my_Control.worthwhile_trsm;
+    if (worthwhile_trsm < 0) my_Control.worthwhile_trsm = 4096;
+    int32_t max_threads = PARU_OPENMP_MAX_THREADS;
+    if (my_Control.paru_max_threads > 0)
+        my_Control.paru_max_threads =
+            std::min(max_threads, my_Control.paru_max_threads);
+    else
+        my_Control.paru_max_threads = max_threads;
+
+    int64_t scale = my_Control.scale;
+    if (scale != 0 && scale != 1) my_Control.scale = 1;
+    int64_t mem_arena = my_Control.mem_arena;
+    if (mem_arena != 0 && mem_arena != 1) my_Control.mem_arena = 1;
+}
+
 //------------------------------------------------------------------------------
 // ParU_Factorize: factorize a sparse matrix A
 //------------------------------------------------------------------------------
@@ -193,6 +245,7 @@ ParU_Ret ParU_Factorize(cholmod_sparse *A, ParU_Symbolic *Sym,
                         ParU_Numeric **Num_handle, ParU_Control *user_Control)
 {
     PARU_DEFINE_PRLEVEL;
+    paru_trace trace("numeric");
 #ifndef NTIME
     double my_start_time = PARU_OPENMP_GET_WTIME;
 #endif
@@ -215,44 +268,8 @@ ParU_Ret ParU_Factorize(cholmod_sparse *A, ParU_Symbolic *Sym,
 
     ParU_Ret info;
     // populate my_Control with tested values of Control
-    ParU_Control my_Control = *user_Control;
-    {
-        int64_t panel_width = my_Control.panel_width;
-        if (panel_width < 0 || panel_width > Sym->m)
-            my_Control.panel_width = 32;
-        int64_t paru_strategy = my_Control.paru_strategy;
-        // at this point the strategy should be known
-        // if the user didnot decide I
-        if (paru_strategy == PARU_STRATEGY_AUTO)  // user didn't specify
-            // so I use the same strategy as umfpack
-            my_Control.paru_strategy = Sym->strategy;
-        else if (paru_strategy != PARU_STRATEGY_SYMMETRIC &&
-                 paru_strategy != PARU_STRATEGY_UNSYMMETRIC)
-            // user input is not correct so I go to default
-            my_Control.paru_strategy = Sym->strategy;
-        // else user already picked symmetric or unsymmetric
-        // and it has been copied over
-
-        double piv_toler = my_Control.piv_toler;
-        if (piv_toler > 1 || piv_toler < 0) my_Control.piv_toler = .1;
-        double diag_toler = my_Control.diag_toler;
-        if (diag_toler > 1 || diag_toler < 0) my_Control.diag_toler = .001;
-        int64_t trivial = my_Control.trivial;
-        if (trivial < 0) my_Control.trivial = 4;
-        int64_t worthwhile_dgemm = my_Control.worthwhile_dgemm;
-        if (worthwhile_dgemm < 0) my_Control.worthwhile_dgemm = 512;
-        int64_t worthwhile_trsm = my_Control.worthwhile_trsm;
-        if (worthwhile_trsm < 0) my_Control.worthwhile_trsm = 4096;
-        int32_t max_threads = PARU_OPENMP_MAX_THREADS;
-        if (my_Control.paru_max_threads > 0)
-            my_Control.paru_max_threads =
-                std::min(max_threads, my_Control.paru_max_threads);
-        else
-            my_Control.paru_max_threads = max_threads;
-
-        int64_t scale = my_Control.scale;
-        if (scale != 0 && scale != 1) my_Control.scale = 1;
-    }
+    ParU_Control my_Control;
+    paru_check_control(user_Control, Sym, &my_Control);
     ParU_Control *Control = &my_Control;
 
     paru_work myWork;
@@ -457,6 +474,10 @@ ParU_Ret ParU_Factorize(cholmod_sparse *A, ParU_Symbolic *Sym,
 
     PRLEVEL(1, ("finalize permutation\n"));
     info = paru_finalize_perm(Sym, Num);  // to form the final permutation
+    Num->arena_peak = Work->arena_stats.peak;
+    Num->arena_cb_peak = Work->arena_stats.cb_peak;
+    Num->arena_nchunks = Work->arena_stats.nchunks;
+    Num->arena_ncompact = Work->arena_stats.ncompact;
     paru_free_work(Sym, Work);   // free the work DS
     Num->Control = NULL;
 
@@ -346,7 +346,8 @@ ParU_Ret paru_front(int64_t f,  // front need to be assembled
         /**** 5 ** assemble U part         Row by Row                      ****/
 
         // consider a parallel calloc
-        double *uPart = static_cast<double*>(paru_calloc(fp * colCount, sizeof(double)));
+        double *uPart = static_cast<double*>(
+            paru_arena_front_alloc(fp * colCount, sizeof(double), Work, Num));
         if (uPart == NULL)
         {
             PRLEVEL(1, ("ParU: out of memory when tried to"
@@ -401,7 +402,9 @@ ParU_Ret paru_front(int64_t f,  // front need to be assembled
                 // int64_t *el_rowIndex = rowIndex_pointer (el);
                 int64_t *el_rowIndex = (int64_t *)(el + 1) + nEl;
 
-                if (el_rowIndex[curRowIndex] < 0) continue;
+                if (curRowIndex >= el->nrows ||
+                    el_rowIndex[curRowIndex] != curFsRow)
+                    continue;
 
                 int64_t mEl = el->nrows;
                 // int64_t *rowRelIndex = relRowInd (el);
@@ -487,7 +490,7 @@ ParU_Ret paru_front(int64_t f,  // front need to be assembled
         {
             // allocating an un-initialized part of memory
             curEl = elementList[eli] =
-                paru_create_element(rowCount - fp, colCount);
+                paru_create_element(rowCount - fp, colCount, Work);
 
             // While insided the DGEMM BETA == 0
             if (curEl == NULL)
@@ -602,6 +605,9 @@ ParU_Ret paru_front(int64_t f,  // front need to be assembled
             }
         }
 
+        // give back the memory of the rows assembled from the prior blocks
+        paru_arena_cb_compact(f, Work, Num);
+
 #ifndef NDEBUG /* chekcing if isRowInFront is correct */
         rowMark = rowMarkp[eli];
         // int64_t *Sleft = Sym->Sleft;
@@ -47,6 +47,9 @@ ParU_Ret paru_init_rowFronts(paru_work *Work,
     paru_element **elementList = Work->elementList = NULL;
     Work->lacList = NULL;
     Work->task_num_child = NULL;
+    Work->narenas = 0;
+    Work->front_arena = NULL;
+    Work->cb_arena = NULL;
     std::vector<int64_t> **heapList = Work->heapList = NULL;
     int64_t *row_degree_bound = Work->row_degree_bound = NULL;
    
@@ -67,6 +70,7 @@ ParU_Ret paru_init_rowFronts(paru_work *Work,
     m = Num->m = Sym->m - Sym->n1;
     nf = Num->nf = Sym->nf;
     Num->res = PARU_SUCCESS;
+    Num->nrefact = 0;
     Num->Control = Control;
 
     Num->frowCount = NULL;
@@ -81,6 +85,7 @@ ParU_Ret paru_init_rowFronts(paru_work *Work,
     Num->Rs = NULL;
     Num->Ps = NULL;
     Num->Pfin = NULL;
+    ParU_Ret arena_info = paru_arena_init(Work, Num);
 
     if (nf != 0)
     {
@@ -164,6 +169,7 @@ ParU_Ret paru_init_rowFronts(paru_work *Work,
           Num->frowList == NULL || Num->fcolList == NULL || heapList == NULL ||
           Num->partial_Us == NULL || Num->partial_LUs == NULL ||
           Work->time_stamp == NULL || Work->task_num_child == NULL ||
+          arena_info != PARU_SUCCESS ||
           (Sym->strategy == PARU_STRATEGY_SYMMETRIC &&
            (Diag_map == NULL || inv_Diag_map == NULL)))) ||
 
@@ -436,7 +442,7 @@ ParU_Ret paru_init_rowFronts(paru_work *Work,
         row_degree_bound[row] = ncols;  // Initialzing row degree
 
         paru_element *curEl = elementList[e] =
-            paru_create_element(nrows, ncols);
+            paru_create_element(nrows, ncols, NULL);
         if (curEl == NULL)
         {  // out of memory
             PRLEVEL(1, ("ParU: Out of memory: curEl\n"));
@@ -91,35 +91,22 @@ static int print_level = -1;
     #define PARU_DEFINE_PRLEVEL
 #endif
 
+// BLAS thread control: see SUITESPARSE_BLAS_set_num_threads in
+// SuiteSparse_config.h
 #if ( defined ( BLAS_Intel10_64ilp ) || defined ( BLAS_Intel10_64lp ) )
 
     extern "C"
     {
-        void MKL_Set_Num_Threads (int n) ;
-        void MKL_Set_Num_Threads_Local (int n) ;
         void MKL_Set_Dynamic (int flag);
     }
-    #define mkl_set_num_threads         MKL_Set_Num_Threads
-    #define mkl_set_num_threads_local   MKL_Set_Num_Threads_Local
+    #define mkl_set_num_threads_local(n) \
+        SUITESPARSE_BLAS_set_num_threads_local(n)
     #define mkl_set_dynamic             MKL_Set_Dynamic
-    #define BLAS_set_num_threads(n) mkl_set_num_threads(n)
-
-#elif ( defined ( BLAS_OpenBLAS ) )
-
-    // OpenBLAS
-    extern "C"
-    {
-        void openblas_set_num_threads (int n) ;
-    }
-    #define BLAS_set_num_threads(n) openblas_set_num_threads(n)
-
-#else
-
-    // Generic BLAS
-    #define BLAS_set_num_threads(n)
 
 #endif
 
+#define BLAS_set_num_threads(n) SUITESPARSE_BLAS_set_num_threads(n)
+
 // These libraries are included in Suitesparse_config
 //#include <stdlib.h>
 //#include <math.h>
@@ -145,6 +132,18 @@ static int print_level = -1;
 
 #define Size_max ((size_t)(-1))  // the largest value of size_t
 
+// marks a phase of ParU for SuiteSparse_trace; the phase ends when the
+// object goes out of scope, on any return path
+struct paru_trace
+{
+    const char *phase;
+    explicit paru_trace(const char *p) : phase(p)
+    {
+        SuiteSparse_trace_begin("ParU", phase);
+    }
+    ~paru_trace() { SuiteSparse_trace_end("ParU", phase, 0, 0); }
+};
+
 // internal data structures
 struct heaps_info
 {
@@ -171,6 +170,37 @@ struct paru_tupleList
 // =============================================================================
 //                  An element, contribution block
 // =============================================================================
+// arenas for the fronts and the contribution blocks; see paru_arena.cpp
+struct paru_arena_chunk;
+struct paru_arena_stats
+{
+    int64_t bytes;     // memory held by all arenas
+    int64_t peak;      // peak of bytes
+    int64_t cb_bytes;  // memory held by the contribution block arenas
+    int64_t cb_peak;   // peak of cb_bytes
+    int64_t nchunks;   // number of chunks allocated
+    int64_t ncompact;  // number of contribution blocks compacted
+    size_t chunk_size;        // size of the data of a standard chunk
+    paru_arena_chunk *pool;   // empty standard chunks, reused by all arenas
+};
+
+struct paru_arena_chunk
+{
+    void *base;                // pointer returned by paru_alloc
+    paru_arena_chunk *next;    // next chunk in Num->front_chunks
+    paru_arena_stats *stats;   // NULL for the chunks of the fronts
+    size_t tot_size;           // size of the whole allocation
+    size_t size;               // size of the data part
+    size_t used;               // part of the data handed out so far
+    int64_t live;              // blocks in use, +1 while current in its arena
+    // followed in memory by the data, aligned
+};
+
+struct paru_arena
+{
+    paru_arena_chunk *chunk;  // current chunk, or NULL
+};
+
 struct paru_element
 {
     int64_t
@@ -188,6 +218,7 @@ struct paru_element
     int64_t nzr_pc;  // number of zero rows in pivotal column of current front
 
     size_t size_allocated;
+    paru_arena_chunk *chunk;  // arena chunk holding the element, or NULL
     // followed in memory by:
     //   int64_t
     //   col [0..ncols-1],  column indices of this element
@@ -256,6 +287,12 @@ struct paru_work
 
     int64_t naft;  // number of actvie frontal tasks
     int64_t resq;  // number of remainig ready tasks in the queue
+
+    // one front arena and one contribution block arena per thread
+    int64_t narenas;               // number of arenas of each kind
+    paru_arena *front_arena;       // size narenas
+    paru_arena *cb_arena;          // size narenas
+    paru_arena_stats arena_stats;  // memory and chunk pool of the arenas
 };
 
 //------------------------------------------------------------------------------
@@ -374,7 +411,8 @@ ParU_Ret paru_factorize_full_summed(int64_t f, int64_t start_fac,
                                     std::vector<int64_t> &pivotal_elements,
                                     paru_work *Work, ParU_Numeric *Num);
 
-paru_element *paru_create_element(int64_t nrows, int64_t ncols);
+paru_element *paru_create_element(int64_t nrows, int64_t ncols,
+                                  paru_work *Work);
 
 void paru_assemble_row_2U(int64_t e, int64_t f, int64_t sR, int64_t dR,
                           std::vector<int64_t> &colHash, paru_work *Work,
@@ -454,6 +492,31 @@ int64_t paru_find_hash(int64_t key, std::vector<int64_t> &colHash,
 
 ParU_Ret paru_finalize_perm(ParU_Symbolic *Sym, ParU_Numeric *Num) ;
 
+void paru_check_control(ParU_Control *user_Control, ParU_Symbolic *Sym,
+                        ParU_Control *Control);
+
+// arenas of the fronts and the contribution blocks
+ParU_Ret paru_arena_init(paru_work *Work, ParU_Numeric *Num);
+void *paru_arena_front_alloc(size_t n, size_t size, paru_work *Work,
+                             ParU_Numeric *Num);
+void *paru_arena_cb_alloc(size_t size, paru_work *Work,
+                          paru_arena_chunk **chunk_handle);
+void paru_arena_cb_free(paru_arena_chunk *chunk);
+void paru_arena_cb_compact(int64_t f, paru_work *Work, ParU_Numeric *Num);
+void paru_arena_free_work(paru_work *Work);
+void paru_arena_free_num(ParU_Numeric *Num);
+
+// triangular solves of the fronts, in parallel over the tasks
+void paru_lsolve_front(int64_t f, ParU_Symbolic *Sym, ParU_Numeric *Num,
+                       double *X, int64_t m, int64_t nrhs, double *work,
+                       bool atomic, int64_t *blas_ok);
+void paru_usolve_front(int64_t f, ParU_Symbolic *Sym, ParU_Numeric *Num,
+                       double *X, int64_t m, int64_t nrhs, double *work,
+                       bool atomic, int64_t *blas_ok);
+ParU_Ret paru_solve_fronts(ParU_Symbolic *Sym, ParU_Numeric *Num, double *X,
+                           int64_t m, int64_t nrhs, bool lower,
+                           ParU_Control *Control);
+
 // permutation stuff for the solver
 int64_t paru_apply_inv_perm(const int64_t *P, const double *s, const double *b, double *x, int64_t m) ;
 int64_t paru_apply_inv_perm(const int64_t *P, const double *s, const double *B, double *X, int64_t m, int64_t n) ;
@@ -35,17 +35,93 @@
  *           while it needs space for each thread doing this computation.
  *           I guess using this way can have a good performance.
  *
+ *     With more than one thread the fronts are solved task by task, in
+ *     parallel where the tasks do not depend on each other; see
+ *     paru_solve_fronts.  The updates of the rows of later fronts are then
+ *     done atomically.
+ *
  * @author Aznaveh
  * */
 #include "paru_internal.hpp"
 
+//------------------------------------------------------------------------------
+// paru_lsolve_front: X = L\X for the pivotal block of front f
+//------------------------------------------------------------------------------
+
+void paru_lsolve_front(int64_t f, ParU_Symbolic *Sym, ParU_Numeric *Num,
+                       double *X, int64_t m, int64_t nrhs, double *work,
+                       bool atomic, int64_t *blas_ok)
+{
+    DEBUGLEVEL(0);
+    int64_t ok = TRUE;
+    int64_t n1 = Sym->n1;
+    int64_t *Ps = Num->Ps;
+    int64_t *Super = Sym->Super;
+    int64_t rowCount = Num->frowCount[f];
+    int64_t *frowList = Num->frowList[f];
+    int64_t col1 = Super[f];
+    int64_t col2 = Super[f + 1];
+    int64_t fp = col2 - col1;
+    double *A = Num->partial_LUs[f].p;
+    double alpha = 1;
+    double beta = 0;
+
+    PRLEVEL(2, ("%% lsolve f=" LD " fp=" LD " rowCount=" LD "\n", f, fp,
+                rowCount));
+    if (nrhs == 1)
+    {
+        SUITESPARSE_BLAS_dtrsv("L", "N", "U", fp, A, rowCount, X + n1 + col1,
+                               1, ok);
+        if (rowCount > fp)
+        {
+            SUITESPARSE_BLAS_dgemv("N", rowCount - fp, fp, &alpha, A + fp,
+                                   rowCount, X + n1 + col1, 1, &beta, work, 1,
+                                   ok);
+        }
+    }
+    else
+    {
+        SUITESPARSE_BLAS_dtrsm("L", "L", "N", "U", fp, nrhs, &alpha, A,
+                               rowCount, X + n1 + col1, m, ok);
+        if (rowCount > fp)
+        {
+            SUITESPARSE_BLAS_dgemm("N", "N", rowCount - fp, nrhs, fp, &alpha,
+                                   A + fp, rowCount, X + n1 + col1, m, &beta,
+                                   work, rowCount - fp, ok);
+        }
+    }
+
+    // the rows below the pivotal block are pivotal in an ancestor of f
+    for (int64_t i = fp; i < rowCount; i++)
+    {
+        int64_t r = Ps[frowList[i]] + n1;
+        for (int64_t l = 0; l < nrhs; l++)
+        {
+            double w = work[i - fp + l * (rowCount - fp)];
+            if (atomic)
+            {
+                #pragma omp atomic update
+                X[l * m + r] -= w;
+            }
+            else
+            {
+                X[l * m + r] -= w;
+            }
+        }
+    }
+
+    if (!ok)
+    {
+        #pragma omp atomic write
+        *blas_ok = FALSE;
+    }
+}
+
 ParU_Ret ParU_Lsolve(ParU_Symbolic *Sym, ParU_Numeric *Num, double *x, ParU_Control *Control)
 {
     DEBUGLEVEL(0);
     if (!x) return PARU_INVALID;
     PARU_DEFINE_PRLEVEL;
-    int64_t nf = Sym->nf;
-    int64_t blas_ok = TRUE;
 #ifndef NDEBUG
     int64_t m = Sym->m;
     PRLEVEL(1, ("%%inside lsolve x is:\n%%"));
@@ -99,85 +175,7 @@ ParU_Ret ParU_Lsolve(ParU_Symbolic *Sym, ParU_Numeric *Num, double *x, ParU_Cont
     PRLEVEL(1, (" \n"));
 #endif
 
-    BLAS_set_num_threads(control_nthreads (Control)) ;
-
-    // gather scatter space for dgemm
-    double *work = static_cast<double*>(paru_alloc((Num->max_row_count), sizeof(double)));
-    if (work == NULL)
-    {
-        PRLEVEL(1, ("ParU: out of memory lsolve\n"));
-        return PARU_OUT_OF_MEMORY;
-    }
-
-    ParU_Factors *LUs = Num->partial_LUs;
-    int64_t *Super = Sym->Super;
-
-    for (int64_t f = 0; f < nf; f++)
-    {
-        int64_t rowCount = Num->frowCount[f];
-        int64_t *frowList = Num->frowList[f];
-        int64_t col1 = Super[f];
-        int64_t col2 = Super[f + 1];
-        int64_t fp = col2 - col1;
-        double *A = LUs[f].p;
-        double *X = x + col1 + n1;
-
-        PRLEVEL(2, ("%% Working on DTRSV\n"));
-        SUITESPARSE_BLAS_dtrsv("L", "N", "U", fp, A, rowCount, X, 1, blas_ok);
-        PRLEVEL(2, ("%% DTRSV is just finished\n"));
-
-#ifndef NDEBUG
-        PR = 2;
-        PRLEVEL(PR, ("%% LUs:\n%%"));
-        for (int64_t r = 0; r < rowCount; r++)
-        {
-            PRLEVEL(PR, ("%% " LD "\t", frowList[r]));
-            for (int64_t c = col1; c < col2; c++)
-                PRLEVEL(PR, (" %2.5lf\t", A[(c - col1) * rowCount + r]));
-            PRLEVEL(PR, ("\n"));
-        }
-
-        PRLEVEL(PR, ("%% lda = " LD "\n%%", rowCount));
-        PRLEVEL(PR, ("%% during lsolve x [" LD "-" LD ")is:\n%%", col1, col2));
-        // for (int64_t k = col1; k < col2; k++)
-        int64_t m = Sym->m;
-        for (int64_t k = 0; k < m; k++)
-        {
-            PRLEVEL(PR, (" %.2lf, ", x[k]));
-        }
-        PRLEVEL(PR, (" \n"));
-#endif
-
-        if (rowCount > fp)
-        {
-            PRLEVEL(2, ("%% lsolve: Working on DGEMV\n%%"));
-            PRLEVEL(2, ("fp=" LD "  rowCount=" LD "\n", fp, rowCount));
-            double alpha = 1;
-            double beta = 0;
-            SUITESPARSE_BLAS_dgemv("N", rowCount - fp, fp, &alpha, A + fp,
-                                   rowCount, x + n1 + col1, 1, &beta, work, 1,
-                                   blas_ok);
-        }
-
-        // don't use parallel loop if using dgemv
-        // pragma omp parallel for
-        for (int64_t i = fp; i < rowCount; i++)
-        {
-            // alternative to dgemv; do not need work if using this
-            // computing the inner product
-            // double i_prod = 0.0;  // inner product
-            // for (int64_t j = col1; j < col2; j++)
-            //{
-            //    i_prod += A[(j - col1) * rowCount + i] * x[j + n1];
-            //}
-
-            double i_prod = work[i - fp];
-            int64_t r = Ps[frowList[i]] + n1;
-            PRLEVEL(2, ("i_prod[" LD "]=%lf  work=%lf r=" LD "\n", i, i_prod,
-                        work[i - fp], r));
-            x[r] -= i_prod;
-        }
-    }
+    ParU_Ret info = paru_solve_fronts(Sym, Num, x, Sym->m, 1, true, Control);
 #ifndef NTIME
     double time = PARU_OPENMP_GET_WTIME;
     time -= start_time;
@@ -191,8 +189,7 @@ ParU_Ret ParU_Lsolve(ParU_Symbolic *Sym, ParU_Numeric *Num, double *x, ParU_Cont
     }
     PRLEVEL(1, (" \n"));
 #endif
-    paru_free(Num->max_row_count, sizeof(double), work);
-    return (blas_ok ? PARU_SUCCESS : PARU_TOO_LARGE);
+    return info;
 }
 
 //////////////// ParU_Lsolve ///multiple right hand side mRHS///////////////////
@@ -204,8 +201,6 @@ ParU_Ret ParU_Lsolve( ParU_Symbolic *Sym, ParU_Numeric *Num,
     PARU_DEFINE_PRLEVEL;
     if (!X) return PARU_INVALID;
     int64_t m = Sym->m;
-    int64_t nf = Sym->nf;
-    int64_t blas_ok = TRUE;
 
 #ifndef NDEBUG
     PR = 2;
@@ -278,92 +273,7 @@ ParU_Ret ParU_Lsolve( ParU_Symbolic *Sym, ParU_Numeric *Num,
     PRLEVEL(PR, (" \n"));
 #endif
 
-    BLAS_set_num_threads(control_nthreads (Control)) ;
-
-    // gather scatter space for dgemm
-    double *work =
-        static_cast<double*>(paru_alloc((Num->max_row_count * nrhs), sizeof(double)));
-    if (work == NULL)
-    {
-        PRLEVEL(1, ("ParU: out of memory lsolve\n"));
-        return PARU_OUT_OF_MEMORY;
-    }
-
-    ParU_Factors *LUs = Num->partial_LUs;
-    int64_t *Super = Sym->Super;
-
-    for (int64_t f = 0; f < nf; f++)
-    {
-        int64_t rowCount = Num->frowCount[f];
-        int64_t *frowList = Num->frowList[f];
-        int64_t col1 = Super[f];
-        int64_t col2 = Super[f + 1];
-        int64_t fp = col2 - col1;
-        double *A = LUs[f].p;
-        PRLEVEL(2, ("%% mRHS Working on DTRSM f=" LD "\n", f));
-        double alpha = 1;
-        SUITESPARSE_BLAS_dtrsm("L", "L", "N", "U", fp, nrhs, &alpha, A, rowCount,
-                               X + n1 + col1, m, blas_ok);
-        PRLEVEL(2, ("%% mRHS DTRSM is just finished f=" LD "\n", f));
-#ifndef NDEBUG
-        PR = 2;
-        PRLEVEL(PR, ("%% LUs:\n%%"));
-        for (int64_t r = 0; r < rowCount; r++)
-        {
-            PRLEVEL(PR, ("%% " LD "\t", frowList[r]));
-            for (int64_t c = col1; c < col2; c++)
-                PRLEVEL(PR, (" %2.5lf\t", A[(c - col1) * rowCount + r]));
-            PRLEVEL(PR, ("\n"));
-        }
-
-        PRLEVEL(PR, ("%% lda = " LD "\n%%", rowCount));
-        PR = 1;
-        PRLEVEL(PR,
-                ("%% during lsolve X f=" LD "[" LD "-" LD ")is:\n%%", f, col1, col2));
-        for (int64_t k = 0; k < m; k++)
-        {
-            PRLEVEL(1, ("%%"));
-            for (int64_t l = 0; l < nrhs; l++)
-            {
-                PRLEVEL(1, (" %.2lf, ", X[l * m + k]));
-            }
-            PRLEVEL(1, (" \n"));
-        }
-        PRLEVEL(1, (" \n"));
-#endif
-
-        if (rowCount > fp)
-        {
-            PRLEVEL(2, ("%% mRHS lsolve: Working on DGEMM\n%%"));
-            PRLEVEL(2, ("fp=" LD "  rowCount=" LD "\n", fp, rowCount));
-            double beta = 0;
-            SUITESPARSE_BLAS_dgemm("N", "N", rowCount - fp, nrhs, fp, &alpha,
-                                   A + fp, rowCount, X + n1 + col1, m, &beta,
-                                   work, rowCount - fp, blas_ok);
-        }
-
-        // don't use parallel loop if using dgemm
-        // pragma omp parallel for
-        for (int64_t i = fp; i < rowCount; i++)
-        {
-            // alternative to dgemm; do not need work if using this
-            // computing the inner product
-            // double i_prod[nrhs] = {0.0};  // inner product
-            // for (int64_t j = col1; j < col2; j++)
-            //{
-            //    for (int64_t l = 0; l < nrhs; l++)
-            //        i_prod[l] += A[(j - col1) * rowCount + i] * X[l*m +j+n1];
-            //}
-
-            // double* i_prod = work+i-fp;
-            int64_t r = Ps[frowList[i]] + n1;
-            for (int64_t l = 0; l < nrhs; l++)
-            {
-                X[l * m + r] -= work[i - fp + l * (rowCount - fp)];
-                // X[l*m+r] -= i_prod[l];
-            }
-        }
-    }
+    ParU_Ret info = paru_solve_fronts(Sym, Num, X, m, nrhs, true, Control);
 #ifndef NTIME
     double time = PARU_OPENMP_GET_WTIME;
     time -= start_time;
@@ -382,6 +292,5 @@ ParU_Ret ParU_Lsolve( ParU_Symbolic *Sym, ParU_Numeric *Num,
     }
     PRLEVEL(1, (" \n"));
 #endif
-    paru_free(Num->max_row_count * nrhs, sizeof(double), work);
-    return (blas_ok ? PARU_SUCCESS : PARU_TOO_LARGE);
+    return info;
 }
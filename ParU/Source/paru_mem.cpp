@@ -410,6 +410,13 @@ void paru_free_el(int64_t e, paru_element **elementList)
     DEBUGLEVEL(0);
     paru_element *el = elementList[e];
     if (el == NULL) return;
+    elementList[e] = NULL;
+    if (el->chunk != NULL)
+    {
+        // a contribution block in an arena
+        paru_arena_cb_free(el->chunk);
+        return;
+    }
 #ifndef NDEBUG
     int64_t nrows = el->nrows, ncols = el->ncols;
     PRLEVEL(1, ("%%Free the element e =" LD "\t", e));
@@ -422,7 +429,6 @@ void paru_free_el(int64_t e, paru_element **elementList)
 #else
     paru_free(1, 0, el);
 #endif
-    elementList[e] = NULL;
 }
 
 ParU_Ret paru_free_work(ParU_Symbolic *Sym, paru_work *Work)
@@ -480,6 +486,8 @@ ParU_Ret paru_free_work(ParU_Symbolic *Sym, paru_work *Work)
     }
 
     paru_free(1, (m + nf + 1) * sizeof(paru_element), elementList);
+    // all contribution blocks are gone; release the arenas
+    paru_arena_free_work(Work);
 
     paru_free(m + nf, sizeof(int64_t), Work->lacList);
 
@@ -546,28 +554,9 @@ ParU_Ret ParU_Freenum(ParU_Numeric **Num_handle, ParU_Control *Control)
         if (Num->fcolList)
             paru_free(Num->fcolCount[i], sizeof(int64_t), Num->fcolList[i]);
 
-        if (Us)
-        {
-            if (Us[i].p != NULL)
-            {
-                PRLEVEL(1, ("%% Freeing Us=%p\n", Us[i].p));
-                int64_t mm = Us[i].m;
-                int64_t nn = Us[i].n;
-                paru_free(mm * nn, sizeof(double), Us[i].p);
-            }
-        }
-
-        if (LUs)
-        {
-            if (LUs[i].p != NULL)
-            {
-                PRLEVEL(1, ("%% Freeing LUs=%p\n", LUs[i].p));
-                int64_t mm = LUs[i].m;
-                int64_t nn = LUs[i].n;
-                paru_free(mm * nn, sizeof(double), LUs[i].p);
-            }
-        }
     }
+    // Us[i].p and LUs[i].p live in the arena chunks of the fronts
+    paru_arena_free_num(Num);
 
     PRLEVEL(1, ("%% Done LUs\n"));
     paru_free(1, nf * sizeof(int64_t), Num->frowCount);
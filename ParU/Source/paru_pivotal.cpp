@@ -364,7 +364,8 @@ ParU_Ret paru_pivotal(std::vector<int64_t> &pivotal_elements,
     }
 
     Num->frowList[f] = frowList ;
-    double *pivotalFront = static_cast<double*>(paru_calloc(rowCount * fp, sizeof(double)));
+    double *pivotalFront = static_cast<double*>(
+        paru_arena_front_alloc(rowCount * fp, sizeof(double), Work, Num));
 
     if (pivotalFront == NULL)
     {
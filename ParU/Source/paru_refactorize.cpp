@@ -0,0 +1,712 @@
+////////////////////////////////////////////////////////////////////////////////
+//////////////////////////  ParU_Refactorize ///////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+// ParU, Copyright (c) 2022, Mohsen Aznaveh and Timothy A. Davis,
+// All Rights Reserved.
+// SPDX-License-Identifier: GNU GPL 3.0
+
+/*! @brief  refactorize a matrix with the same pattern as a prior
+ *          factorization, reusing the pivot sequence of that factorization
+ *
+ *  ParU_Factorize chooses its pivots dynamically, so the number of rows of
+ *  each front and the pattern of the factors depend on the numerical values.
+ *  When only the values of A change (for example, in a Newton iteration) the
+ *  fronts of the old factorization can be reused as-is: the rows frowList[f],
+ *  the columns fcolList[f] and the pivot rows (the first fp rows of
+ *  frowList[f]) are all frozen, and the memory of Num->partial_LUs and
+ *  Num->partial_Us is overwritten in place.
+ *
+ *  Each entry (i,j) of S, and each entry of a contribution block, belongs to
+ *  the first front in which either its row i or its column j is pivotal:
+ *
+ *      if col j is pivotal in g and row i is not pivotal before g:
+ *          the entry goes to LUs[g], at row position of i in frowList[g]
+ *      if row i is pivotal in g, before the front of column j:
+ *          the entry goes to Us[g], at column position of j in fcolList[g]
+ *
+ *  So there is no assembly tree of elements: the original entries are
+ *  scattered to their fronts first, and then each front is factorized
+ *  without pivoting and scatters its contribution block directly to the
+ *  fronts that own its entries.  Fronts are executed with the same task tree
+ *  (Sym->task_map) as ParU_Factorize.
+ *
+ *  If a frozen pivot fails the threshold test (piv_toler, or diag_toler for
+ *  the symmetric strategy), or if the new values do not fit into the old
+ *  pattern (ParU drops rows with hard zeros from the pivotal part of a front),
+ *  Num is freed and the matrix is factorized again with ParU_Factorize.  Any
+ *  other failure (out of memory, a zero row of A, an integer overflow in the
+ *  BLAS) is returned to the caller, and Num is freed as ParU_Factorize does.
+ *
+ * @author Aznaveh
+ */
+#include <algorithm>
+
+#include "paru_internal.hpp"
+
+// internal workspace of the refactorization
+struct paru_refact_work
+{
+    int64_t *rowFront;  // size m, front where the row is pivotal
+    int64_t *rowPiv;    // size m, position of the row among the pivots
+    int64_t *colFront;  // size n, front where the column is pivotal
+    int64_t *rowSortp;  // size nf+1, pointers to rowSort for each front
+    int64_t *rowSort;   // positions of frowList[f] sorted by row index
+    double tol;         // threshold for accepting a frozen pivot
+    bool parallel;      // true if fronts may be factorized concurrently
+};
+
+//------------------------------------------------------------------------------
+// paru_refact_locate: find where entry (i,j) of S lives in the factors
+//------------------------------------------------------------------------------
+
+// position of row i in frowList[g], or -1 if the row is not in front g
+
+static int64_t paru_refact_row_pos(int64_t i, int64_t g, paru_refact_work *R,
+                                   ParU_Numeric *Num)
+{
+    int64_t *frowList = Num->frowList[g];
+    int64_t *rowSort = R->rowSort;
+    int64_t l = R->rowSortp[g];
+    int64_t r = R->rowSortp[g + 1] - 1;
+    while (l <= r)
+    {
+        int64_t mid = l + (r - l) / 2;
+        int64_t row = frowList[rowSort[mid]];
+        if (row == i) return rowSort[mid];
+        if (row < i)
+            l = mid + 1;
+        else
+            r = mid - 1;
+    }
+    return -1;
+}
+
+// returns NULL if the entry does not fit in the frozen pattern
+
+static double *paru_refact_locate(int64_t i, int64_t j, paru_refact_work *R,
+                                  ParU_Symbolic *Sym, ParU_Numeric *Num)
+{
+    int64_t gr = R->rowFront[i];
+    int64_t gc = R->colFront[j];
+    if (gc <= gr)
+    {
+        // column j is pivotal in front gc; find row i in frowList[gc]
+        int64_t k = paru_refact_row_pos(i, gc, R, Num);
+        if (k < 0) return NULL;
+        int64_t c = j - Sym->Super[gc];
+        return Num->partial_LUs[gc].p + c * Num->frowCount[gc] + k;
+    }
+    else
+    {
+        // row i is pivotal in front gr; find column j in fcolList[gr]
+        int64_t colCount = Num->fcolCount[gr];
+        if (colCount == 0) return NULL;
+        int64_t c = paru_bin_srch(Num->fcolList[gr], 0, colCount - 1, j);
+        if (c < 0) return NULL;
+        int64_t fp = Sym->Super[gr + 1] - Sym->Super[gr];
+        return Num->partial_Us[gr].p + c * fp + R->rowPiv[i];
+    }
+}
+
+//------------------------------------------------------------------------------
+// paru_refact_front: factorize front f with its frozen pivots
+//------------------------------------------------------------------------------
+
+static ParU_Ret paru_refact_front(int64_t f, paru_refact_work *R,
+                                  paru_work *Work, ParU_Numeric *Num)
+{
+    DEBUGLEVEL(0);
+    ParU_Symbolic *Sym = Work->Sym;
+    ParU_Control *Control = Num->Control;
+    int64_t *Super = Sym->Super;
+    int64_t fp = Super[f + 1] - Super[f];
+    int64_t rowCount = Num->frowCount[f];
+    int64_t colCount = Num->fcolCount[f];
+    double *F = Num->partial_LUs[f].p;
+    double *U = Num->partial_Us[f].p;
+    int64_t blas_ok = TRUE;
+
+    //--------------------------------------------------------------------------
+    // panel factorization of the pivotal block, without pivoting
+    //--------------------------------------------------------------------------
+
+    const int64_t panel_width = std::max(Control->panel_width, (int64_t)1);
+    for (int64_t j1 = 0; j1 < fp; j1 += panel_width)
+    {
+        int64_t j2 = std::min(j1 + panel_width, fp);
+        for (int64_t j = j1; j < j2; j++)
+        {
+            double *Fj = F + j * rowCount;
+            double maxval = 0;
+            for (int64_t i = j; i < rowCount; i++)
+            {
+                maxval = std::max(maxval, fabs(Fj[i]));
+            }
+            double piv = Fj[j];
+            if (piv == 0 || fabs(piv) < R->tol * maxval)
+            {
+                PRLEVEL(1, ("%% frozen pivot " LD " of front " LD " rejected"
+                            " piv=%e maxval=%e\n", j, f, piv, maxval));
+                return PARU_SINGULAR;
+            }
+            for (int64_t i = j + 1; i < rowCount; i++) Fj[i] /= piv;
+            if (j + 1 < j2 && j + 1 < rowCount)
+            {
+                double alpha = -1;
+                SUITESPARSE_BLAS_dger(rowCount - j - 1, j2 - j - 1, &alpha,
+                                      Fj + j + 1, 1, F + (j + 1) * rowCount + j,
+                                      rowCount, F + (j + 1) * rowCount + j + 1,
+                                      rowCount, blas_ok);
+            }
+        }
+        if (j2 < fp)
+        {
+            // update the rest of the pivotal columns with this panel
+            double *A1 = F + j1 * rowCount + j1;
+            double *B1 = F + j2 * rowCount + j1;
+            blas_ok = paru_tasked_trsm(f, j2 - j1, fp - j2, 1, A1, rowCount,
+                                       B1, rowCount, Work, Num) && blas_ok;
+            blas_ok = paru_tasked_dgemm(f, rowCount - j2, fp - j2, j2 - j1,
+                                        F + j1 * rowCount + j2, rowCount, B1,
+                                        rowCount, 1, F + j2 * rowCount + j2,
+                                        rowCount, Work, Num) && blas_ok;
+        }
+    }
+
+    if (colCount == 0 || U == NULL) return blas_ok ? PARU_SUCCESS : PARU_TOO_LARGE;
+
+    //--------------------------------------------------------------------------
+    // U part and the contribution block
+    //--------------------------------------------------------------------------
+
+    blas_ok = paru_tasked_trsm(f, fp, colCount, 1, F, rowCount, U, fp, Work,
+                               Num) && blas_ok;
+    int64_t cbRows = rowCount - fp;
+    if (cbRows <= 0) return blas_ok ? PARU_SUCCESS : PARU_TOO_LARGE;
+
+    double *C = static_cast<double*>(paru_alloc(cbRows * colCount, sizeof(double)));
+    int64_t *pos = static_cast<int64_t*>(paru_alloc(cbRows, sizeof(int64_t)));
+    if (C == NULL || pos == NULL)
+    {
+        PRLEVEL(1, ("ParU: out of memory in refactorize, front " LD "\n", f));
+        paru_free(cbRows * colCount, sizeof(double), C);
+        paru_free(cbRows, sizeof(int64_t), pos);
+        return PARU_OUT_OF_MEMORY;
+    }
+    blas_ok = paru_tasked_dgemm(f, cbRows, colCount, fp, F + fp, rowCount, U,
+                                fp, 0, C, cbRows, Work, Num) && blas_ok;
+
+    // scatter the contribution block to the fronts that own its entries.  The
+    // columns of the contribution block are sorted, so consecutive columns
+    // that are pivotal in the same front g share the position of each row:
+    // it is found once for the whole block of columns.  Rows pivotal before g
+    // go to the U part of their own front, whose columns are sorted as well.
+    ParU_Ret info = PARU_SUCCESS;
+    int64_t *frowList = Num->frowList[f];
+    int64_t *fcolList = Num->fcolList[f];
+    int64_t *first = Sym->first;
+    for (int64_t jj1 = 0; jj1 < colCount && info == PARU_SUCCESS;)
+    {
+        int64_t g = R->colFront[fcolList[jj1]];
+        int64_t jj2 = jj1 + 1;
+        while (jj2 < colCount && R->colFront[fcolList[jj2]] == g) jj2++;
+
+        // find the position of each row in front g, or in the U part
+        for (int64_t ii = 0; ii < cbRows; ii++)
+        {
+            int64_t i = frowList[fp + ii];
+            int64_t gr = R->rowFront[i];
+            if (gr >= g)
+            {
+                pos[ii] = (first[g] > f) ? -1 : paru_refact_row_pos(i, g, R, Num);
+            }
+            else
+            {
+                int64_t *cols = Num->fcolList[gr];
+                pos[ii] = (first[gr] > f) ? -1 :
+                    std::lower_bound(cols, cols + Num->fcolCount[gr],
+                                     fcolList[jj1]) - cols;
+            }
+        }
+
+        for (int64_t jj = jj1; jj < jj2 && info == PARU_SUCCESS; jj++)
+        {
+            int64_t j = fcolList[jj];
+            double *Cj = C + jj * cbRows;
+            int64_t rowCount_g = Num->frowCount[g];
+            double *Fg = Num->partial_LUs[g].p + (j - Super[g]) * rowCount_g;
+            for (int64_t ii = 0; ii < cbRows; ii++)
+            {
+                double x = Cj[ii];
+                int64_t i = frowList[fp + ii];
+                int64_t gr = R->rowFront[i];
+                double *target = NULL;
+                if (pos[ii] < 0)
+                {
+                    // row i is not in front g, or the front is not an ancestor
+                }
+                else if (gr >= g)
+                {
+                    target = Fg + pos[ii];
+                }
+                else
+                {
+                    // advance along the sorted columns of front gr
+                    int64_t *cols = Num->fcolList[gr];
+                    int64_t colCount_gr = Num->fcolCount[gr];
+                    int64_t k = pos[ii];
+                    while (k < colCount_gr && cols[k] < j) k++;
+                    pos[ii] = k;
+                    if (k < colCount_gr && cols[k] == j)
+                    {
+                        int64_t fp_gr = Super[gr + 1] - Super[gr];
+                        target = Num->partial_Us[gr].p + k * fp_gr + R->rowPiv[i];
+                    }
+                }
+                if (x == 0) continue;
+                if (target == NULL)
+                {
+                    PRLEVEL(1, ("%% refactorize: (" LD "," LD ") of front " LD
+                                " does not fit\n", i, j, f));
+                    info = PARU_SINGULAR;
+                    break;
+                }
+                if (R->parallel)
+                {
+                    #pragma omp atomic update
+                    *target += x;
+                }
+                else
+                {
+                    *target += x;
+                }
+            }
+        }
+        jj1 = jj2;
+    }
+    paru_free(cbRows, sizeof(int64_t), pos);
+    paru_free(cbRows * colCount, sizeof(double), C);
+    if (info != PARU_SUCCESS) return info;
+    return blas_ok ? PARU_SUCCESS : PARU_TOO_LARGE;
+}
+
+//------------------------------------------------------------------------------
+// paru_refact_exec_tasks: execute a task and its ancestors when ready
+//------------------------------------------------------------------------------
+
+static ParU_Ret paru_refact_exec_tasks(int64_t t, int64_t *task_num_child,
+                                       paru_refact_work *R, paru_work *Work,
+                                       ParU_Numeric *Num, ParU_Ret *info)
+{
+    ParU_Symbolic *Sym = Work->Sym;
+    int64_t *task_parent = Sym->task_parent;
+    int64_t *task_map = Sym->task_map;
+    ParU_Ret myInfo = PARU_SUCCESS;
+    while (t != -1)
+    {
+        ParU_Ret cur_info;
+        #pragma omp atomic read
+        cur_info = *info;
+        if (cur_info != PARU_SUCCESS) return cur_info;  // another task failed
+
+        for (int64_t f = task_map[t] + 1; f <= task_map[t + 1]; f++)
+        {
+            myInfo = paru_refact_front(f, R, Work, Num);
+            if (myInfo != PARU_SUCCESS) return myInfo;
+        }
+
+        // the last child to finish executes the parent
+        int64_t daddy = task_parent[t];
+        if (daddy == -1) break;
+        int64_t num_rem_children;
+        #pragma omp atomic capture
+        {
+            task_num_child[daddy]--;
+            num_rem_children = task_num_child[daddy];
+        }
+        if (num_rem_children != 0) break;
+        t = daddy;
+    }
+    return myInfo;
+}
+
+//------------------------------------------------------------------------------
+// ParU_Refactorize: refactorize A reusing the pivots of a prior factorization
+//------------------------------------------------------------------------------
+
+ParU_Ret ParU_Refactorize(cholmod_sparse *A, ParU_Symbolic *Sym,
+                          ParU_Numeric **Num_handle, ParU_Control *user_Control)
+{
+    DEBUGLEVEL(0);
+    if (A == NULL || Sym == NULL || Num_handle == NULL)
+    {
+        return PARU_INVALID;
+    }
+    if (A->xtype != CHOLMOD_REAL)
+    {
+        PRLEVEL(1, ("ParU: input matrix must be real\n"));
+        return PARU_INVALID;
+    }
+    if ((int64_t)A->nrow != Sym->m || (int64_t)A->ncol != Sym->n)
+    {
+        PRLEVEL(1, ("ParU: input matrix does not match the analysis\n"));
+        return PARU_INVALID;
+    }
+    ParU_Numeric *Num = *Num_handle;
+    if (Num == NULL || Num->res != PARU_SUCCESS || Num->nf != Sym->nf ||
+        Num->sym_m != Sym->m)
+    {
+        // nothing to reuse
+        ParU_Freenum(Num_handle, user_Control);
+        return ParU_Factorize(A, Sym, Num_handle, user_Control);
+    }
+
+    ParU_Control my_Control;
+    paru_check_control(user_Control, Sym, &my_Control);
+    ParU_Control *Control = &my_Control;
+
+    int64_t m = Sym->m - Sym->n1;
+    int64_t n = Sym->n - Sym->n1;
+    int64_t nf = Sym->nf;
+    int64_t n1 = Sym->n1;
+    int64_t cs1 = Sym->cs1;
+    int64_t rs1 = Sym->rs1;
+    if ((Control->scale == 1) != (Num->Rs != NULL))
+    {
+        // the scaling has changed; Rs must be reallocated
+        ParU_Freenum(Num_handle, user_Control);
+        return ParU_Factorize(A, Sym, Num_handle, user_Control);
+    }
+
+    //--------------------------------------------------------------------------
+    // reload the numerical values of S and the singletons
+    //--------------------------------------------------------------------------
+
+    int64_t *Ap = static_cast<int64_t*>(A->p);
+    int64_t *Ai = static_cast<int64_t*>(A->i);
+    double *Ax = static_cast<double*>(A->x);
+    int64_t *Sp = Sym->Sp;
+    int64_t *Sup = Sym->ustons.Sup;
+    int64_t *Slp = Sym->lstons.Slp;
+    int64_t *Qinit = Sym->Qfill;
+    int64_t *Pinv = Sym->Pinv;
+    double *Rs = Num->Rs;
+    double *Sx = Num->Sx;
+    double *Sux = Num->Sux;
+    double *Slx = Num->Slx;
+
+    int64_t *cSp = static_cast<int64_t*>(paru_alloc(m + 1, sizeof(int64_t)));
+    int64_t *cSup = (cs1 > 0) ?
+        static_cast<int64_t*>(paru_alloc(cs1 + 1, sizeof(int64_t))) : NULL;
+    int64_t *cSlp = (rs1 > 0) ?
+        static_cast<int64_t*>(paru_alloc(rs1 + 1, sizeof(int64_t))) : NULL;
+    paru_refact_work R;
+    R.rowFront = static_cast<int64_t*>(paru_alloc(m, sizeof(int64_t)));
+    R.rowPiv = static_cast<int64_t*>(paru_alloc(m, sizeof(int64_t)));
+    R.colFront = static_cast<int64_t*>(paru_alloc(n, sizeof(int64_t)));
+    R.rowSortp = static_cast<int64_t*>(paru_alloc(nf + 1, sizeof(int64_t)));
+    R.rowSort = NULL;
+    int64_t rowSort_size = 0;
+    for (int64_t f = 0; f < nf; f++) rowSort_size += Num->frowCount[f];
+    R.rowSort = static_cast<int64_t*>(paru_alloc(rowSort_size, sizeof(int64_t)));
+    int64_t *task_num_child =
+        static_cast<int64_t*>(paru_alloc(Sym->ntasks, sizeof(int64_t)));
+
+    ParU_Ret info = PARU_SUCCESS;
+    bool zero_row = false;  // a zero row of A, not a change of the pivots
+    if (cSp == NULL || (cs1 > 0 && cSup == NULL) || (rs1 > 0 && cSlp == NULL) ||
+        R.rowFront == NULL || R.rowPiv == NULL || R.colFront == NULL ||
+        R.rowSortp == NULL || (rowSort_size > 0 && R.rowSort == NULL) ||
+        (Sym->ntasks > 0 && task_num_child == NULL))
+    {
+        info = PARU_OUT_OF_MEMORY;
+    }
+
+    if (info == PARU_SUCCESS)
+    {
+        paru_memcpy(cSp, Sp, (m + 1) * sizeof(int64_t), Control);
+        if (cs1 > 0) paru_memcpy(cSup, Sup, (cs1 + 1) * sizeof(int64_t), Control);
+        if (rs1 > 0) paru_memcpy(cSlp, Slp, (rs1 + 1) * sizeof(int64_t), Control);
+
+        if (Rs)
+        {
+            paru_memset(Rs, 0, Sym->m * sizeof(double), Control);
+            for (int64_t newcol = 0; newcol < Sym->n; newcol++)
+            {
+                int64_t oldcol = Qinit[newcol];
+                for (int64_t p = Ap[oldcol]; p < Ap[oldcol + 1]; p++)
+                {
+                    int64_t oldrow = Ai[p];
+                    Rs[oldrow] = std::max(Rs[oldrow], fabs(Ax[p]));
+                }
+            }
+            for (int64_t k = 0; k < m; k++)
+            {
+                if (Rs[k] <= 0)
+                {
+                    PRLEVEL(1, ("ParU: Matrix is singular, row " LD " is zero\n", k));
+                    info = PARU_SINGULAR;
+                    zero_row = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    if (info == PARU_SUCCESS)
+    {
+        for (int64_t newcol = 0; newcol < Sym->n; newcol++)
+        {
+            int64_t oldcol = Qinit[newcol];
+            for (int64_t p = Ap[oldcol]; p < Ap[oldcol + 1]; p++)
+            {
+                int64_t oldrow = Ai[p];
+                int64_t newrow = Pinv[oldrow];
+                int64_t srow = newrow - n1;
+                int64_t scol = newcol - n1;
+                double x = (Rs == NULL) ? Ax[p] : Ax[p] / Rs[oldrow];
+                if (srow >= 0 && scol >= 0)
+                {  // it is inside S otherwise it is part of singleton
+                    Sx[cSp[srow]++] = x;
+                }
+                else if (srow < 0 && scol >= 0)
+                {  // inside the U singletons
+                    Sux[++cSup[newrow]] = x;
+                }
+                else if (newrow < cs1)
+                {  // inside U singletons CSR
+                    if (newcol == newrow)
+                        Sux[Sup[newrow]] = x;
+                    else
+                        Sux[++cSup[newrow]] = x;
+                }
+                else
+                {  // inside L singletons CSC
+                    if (newcol == newrow)
+                        Slx[Slp[newcol - cs1]] = x;
+                    else
+                        Slx[++cSlp[newcol - cs1]] = x;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // find the fronts of each row and column, and sort the rows of each front
+    //--------------------------------------------------------------------------
+
+    int64_t *Super = Sym->Super;
+    if (info == PARU_SUCCESS)
+    {
+        for (int64_t i = 0; i < m; i++) R.rowFront[i] = nf;  // not pivotal
+        int64_t p = 0;
+        for (int64_t f = 0; f < nf; f++)
+        {
+            int64_t fp = Super[f + 1] - Super[f];
+            int64_t rowCount = Num->frowCount[f];
+            int64_t *frowList = Num->frowList[f];
+            for (int64_t j = Super[f]; j < Super[f + 1]; j++) R.colFront[j] = f;
+            for (int64_t k = 0; k < fp; k++)
+            {
+                R.rowFront[frowList[k]] = f;
+                R.rowPiv[frowList[k]] = k;
+            }
+            R.rowSortp[f] = p;
+            int64_t *rowSort = R.rowSort + p;
+            for (int64_t k = 0; k < rowCount; k++) rowSort[k] = k;
+            std::sort(rowSort, rowSort + rowCount,
+                      [frowList](const int64_t &k1, const int64_t &k2) -> bool {
+                          return frowList[k1] < frowList[k2];
+                      });
+            p += rowCount;
+        }
+        R.rowSortp[nf] = p;
+        R.parallel = false;
+        R.tol = (Control->paru_strategy == PARU_STRATEGY_SYMMETRIC)
+                    ? Control->diag_toler
+                    : Control->piv_toler;
+
+        // clear the factors
+        ParU_Factors *LUs = Num->partial_LUs;
+        ParU_Factors *Us = Num->partial_Us;
+        for (int64_t f = 0; f < nf; f++)
+        {
+            paru_memset(LUs[f].p, 0, LUs[f].m * LUs[f].n * sizeof(double),
+                        Control);
+            if (Us[f].p != NULL)
+            {
+                paru_memset(Us[f].p, 0, Us[f].m * Us[f].n * sizeof(double),
+                            Control);
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // scatter the entries of S into the fronts
+    //--------------------------------------------------------------------------
+
+    if (info == PARU_SUCCESS)
+    {
+        int64_t *Sj = Sym->Sj;
+        int64_t mismatch = 0;
+        #pragma omp parallel for num_threads(Control->paru_max_threads) \
+            reduction(+:mismatch)
+        for (int64_t i = 0; i < m; i++)
+        {
+            for (int64_t p = Sp[i]; p < Sp[i + 1]; p++)
+            {
+                double *target = paru_refact_locate(i, Sj[p], &R, Sym, Num);
+                if (target != NULL)
+                    *target = Sx[p];
+                else if (Sx[p] != 0)
+                    mismatch++;
+            }
+        }
+        if (mismatch > 0)
+        {
+            PRLEVEL(1, ("%% refactorize: " LD " entries of S do not fit\n",
+                        mismatch));
+            info = PARU_SINGULAR;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // factorize the fronts using the task tree of the symbolic analysis
+    //--------------------------------------------------------------------------
+
+    paru_work myWork;
+    paru_work *Work = &myWork;
+    Work->Sym = Sym;
+    Num->Control = Control;
+    if (info == PARU_SUCCESS && nf > 0)
+    {
+        int64_t ntasks = Sym->ntasks;
+        int64_t *task_depth = Sym->task_depth;
+        paru_memcpy(task_num_child, Sym->task_num_child,
+                    ntasks * sizeof(int64_t), Control);
+        std::vector<int64_t> task_Q;
+        try
+        {
+            for (int64_t t = 0; t < ntasks; t++)
+            {
+                if (task_num_child[t] == 0) task_Q.push_back(t);
+            }
+        }
+        catch (std::bad_alloc const &)
+        {  // out of memory
+            info = PARU_OUT_OF_MEMORY;
+        }
+        std::sort(task_Q.begin(), task_Q.end(),
+                  [&task_depth](const int64_t &t1, const int64_t &t2) -> bool {
+                      return task_depth[t1] > task_depth[t2];
+                  });
+
+#if ! defined ( PARU_1TASK )
+        if (info == PARU_SUCCESS &&
+            task_Q.size() * 2 > (size_t)Control->paru_max_threads)
+        {
+            PRLEVEL(1, ("%% Parallel refactorization\n"));
+            R.parallel = true;
+            BLAS_set_num_threads(1);
+            PARU_OPENMP_SET_MAX_ACTIVE_LEVELS(4);
+            const int64_t size = (int64_t)task_Q.size();
+            #pragma omp atomic write
+            Work->naft = 0;
+            #pragma omp parallel proc_bind(spread)                             \
+            num_threads(Control->paru_max_threads)
+            #pragma omp single nowait
+            #pragma omp task untied
+            for (int64_t i = 0; i < size; i++)
+            {
+                int64_t t = task_Q[i];
+                int64_t d = task_depth[t];
+                #pragma omp task mergeable priority(d)
+                {
+                    #pragma omp atomic update
+                    Work->naft++;
+                    ParU_Ret myInfo = paru_refact_exec_tasks(
+                        t, task_num_child, &R, Work, Num, &info);
+                    if (myInfo != PARU_SUCCESS)
+                    {
+                        #pragma omp atomic write
+                        info = myInfo;
+                    }
+                    #pragma omp atomic update
+                    Work->naft--;
+                }
+            }
+        }
+        else
+#endif
+        if (info == PARU_SUCCESS)
+        {
+            PRLEVEL(1, ("%% Sequential refactorization\n"));
+            Work->naft = 1;
+            for (int64_t f = 0; f < nf && info == PARU_SUCCESS; f++)
+            {
+                info = paru_refact_front(f, &R, Work, Num);
+            }
+        }
+    }
+    Num->Control = NULL;
+
+    //--------------------------------------------------------------------------
+    // free workspace
+    //--------------------------------------------------------------------------
+
+    paru_free(m + 1, sizeof(int64_t), cSp);
+    paru_free(cs1 + 1, sizeof(int64_t), cSup);
+    paru_free(rs1 + 1, sizeof(int64_t), cSlp);
+    paru_free(m, sizeof(int64_t), R.rowFront);
+    paru_free(m, sizeof(int64_t), R.rowPiv);
+    paru_free(n, sizeof(int64_t), R.colFront);
+    paru_free(nf + 1, sizeof(int64_t), R.rowSortp);
+    paru_free(rowSort_size, sizeof(int64_t), R.rowSort);
+    paru_free(Sym->ntasks, sizeof(int64_t), task_num_child);
+
+    if (info == PARU_SINGULAR && !zero_row)
+    {
+        // a frozen pivot failed, or the values do not fit the old pattern:
+        // start over with a full factorization
+        PRLEVEL(1, ("%% refactorize failed; calling ParU_Factorize\n"));
+        ParU_Freenum(Num_handle, user_Control);
+        return ParU_Factorize(A, Sym, Num_handle, user_Control);
+    }
+    if (info != PARU_SUCCESS)
+    {
+        // out of memory, a zero row, or too large for the BLAS: the factors
+        // have been overwritten, so Num cannot be reused or solved with
+        PRLEVEL(1, ("%% refactorize failed (" LD ")\n", (int64_t)info));
+        ParU_Freenum(Num_handle, user_Control);
+        return info;
+    }
+    Num->nrefact++;
+
+    //--------------------------------------------------------------------------
+    // statistics on the diagonal of U
+    //--------------------------------------------------------------------------
+
+    double min_udiag = 1, max_udiag = -1;  // not to fail for nf ==0
+    if (nf > 0)
+    {
+        ParU_Factors *LUs = Num->partial_LUs;
+        max_udiag = min_udiag = fabs(*(LUs[0].p));
+        for (int64_t f = 0; f < nf; f++)
+        {
+            int64_t rowCount = Num->frowCount[f];
+            int64_t fp = Super[f + 1] - Super[f];
+            double *X = LUs[f].p;
+            for (int64_t i = 0; i < fp; i++)
+            {
+                double udiag = fabs(X[rowCount * i + i]);
+                min_udiag = std::min(min_udiag, udiag);
+                max_udiag = std::max(max_udiag, udiag);
+            }
+        }
+    }
+    Num->min_udiag = min_udiag;
+    Num->max_udiag = max_udiag;
+    Num->rcond = min_udiag / max_udiag;
+    return Num->res;
+}
@@ -36,6 +36,7 @@ ParU_Ret ParU_Solve(ParU_Symbolic *Sym, ParU_Numeric *Num, double *b, double *x,
     // note that the x and b parameters can be aliased
 
     DEBUGLEVEL(0);
+    paru_trace trace("solve");
     PRLEVEL(1, ("%% inside solve\n"));
     if (Sym == NULL || Num == NULL)
     {
@@ -122,6 +123,7 @@ ParU_Ret ParU_Solve(ParU_Symbolic *Sym, ParU_Numeric *Num, int64_t nrhs,
 {
     // Note: B and X can be aliased
     DEBUGLEVEL(0);
+    paru_trace trace("solve");
     PRLEVEL(1, ("%% mRHS inside Solve\n"));
     if (Sym == NULL || Num == NULL)
     {
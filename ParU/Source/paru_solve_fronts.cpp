@@ -0,0 +1,311 @@
+////////////////////////////////////////////////////////////////////////////////
+//////////////////////// paru_solve_fronts /////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+// ParU, Copyright (c) 2022, Mohsen Aznaveh and Timothy A. Davis,
+// All Rights Reserved.
+// SPDX-License-Identifier: GNU GPL 3.0
+
+/*! @brief  X = L\X or X = U\X for the fronts, with X of size m-by-nrhs.
+ *
+ *  With one thread, or if the task tree is too narrow, the fronts are solved
+ *  in order (nf-1 down to 0 for U).  Otherwise the tasks of the
+ *  factorization (Sym->task_map) are solved as OpenMP tasks.  A task of the
+ *  L solve must wait for the tasks whose fronts update rows pivotal in its
+ *  fronts; a task of the U solve must wait for the tasks owning the columns
+ *  of the U part of its fronts.  These are usually the descendants (for L)
+ *  or the ancestors (for U) in the task tree, but not always: a front whose
+ *  contribution block has no rows or no columns is not linked to the front
+ *  that owns them.  So the dependencies are taken from the structure of the
+ *  factors, and a task is started by the last task it depends on.
+ *
+ * @author Aznaveh
+ * */
+
+#include "paru_internal.hpp"
+
+typedef struct
+{
+    ParU_Symbolic *Sym;
+    ParU_Numeric *Num;
+    double *X;
+    int64_t m;
+    int64_t nrhs;
+    bool lower;
+    double *work;          // size wsize per thread
+    size_t wsize;
+    int64_t *succ_p;       // successors of task t: succ_i [succ_p [t] ...
+    int64_t *succ_i;       // ... succ_p [t+1]-1]
+    int64_t *npred;        // # of tasks that task t still waits for
+    int64_t *blas_ok;
+} paru_solve_dag;
+
+//------------------------------------------------------------------------------
+// paru_solve_nthreads: # of threads to solve with
+//------------------------------------------------------------------------------
+
+// returns 1 if the task tree is too narrow to be worth solving in parallel
+
+static int32_t paru_solve_nthreads(ParU_Symbolic *Sym, ParU_Control *Control)
+{
+#if defined ( PARU_1TASK )
+    return 1;
+#else
+    int32_t nthreads = control_nthreads(Control);
+    int64_t ntasks = Sym->ntasks;
+    if (nthreads <= 1 || ntasks <= 1) return 1;
+    int64_t nleaves = 0;
+    for (int64_t t = 0; t < ntasks; t++)
+    {
+        if (Sym->task_num_child[t] == 0) nleaves++;
+    }
+    return (nleaves * 2 > nthreads) ? nthreads : 1;
+#endif
+}
+
+//------------------------------------------------------------------------------
+// paru_solve_edges: count (pass 0) or place (pass 1) the edges of the DAG
+//------------------------------------------------------------------------------
+
+static void paru_solve_edges(int pass, int64_t *ctask, int64_t *mark,
+                             paru_solve_dag *D)
+{
+    ParU_Symbolic *Sym = D->Sym;
+    ParU_Numeric *Num = D->Num;
+    int64_t ntasks = Sym->ntasks;
+    int64_t *task_map = Sym->task_map;
+    int64_t *Super = Sym->Super;
+    int64_t *Ps = Num->Ps;
+    int64_t *succ_p = D->succ_p;
+    int64_t *npred = D->npred;
+
+    for (int64_t t = 0; t < ntasks; t++) mark[t] = -1;
+
+    for (int64_t t = 0; t < ntasks; t++)
+    {
+        for (int64_t f = task_map[t] + 1; f <= task_map[t + 1]; f++)
+        {
+            int64_t fp = Super[f + 1] - Super[f];
+            // L: t updates the rows of f below its pivots, owned by u
+            // U: t needs the columns of the U part of f, owned by u
+            int64_t *list = D->lower ? Num->frowList[f] : Num->fcolList[f];
+            int64_t start = D->lower ? fp : 0;
+            int64_t end = D->lower ? Num->frowCount[f] : Num->fcolCount[f];
+            for (int64_t k = start; k < end; k++)
+            {
+                int64_t c = D->lower ? Ps[list[k]] : list[k];
+                int64_t u = ctask[c];
+                if (u == t || mark[u] == t) continue;
+                mark[u] = t;
+                // edge from the task solved first to the one solved after it
+                int64_t src = D->lower ? t : u;
+                int64_t dst = D->lower ? u : t;
+                if (pass == 0)
+                {
+                    succ_p[src + 2]++;
+                    npred[dst]++;
+                }
+                else
+                {
+                    D->succ_i[succ_p[src + 1]++] = dst;
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// paru_solve_task: solve the fronts of task t, then start its successors
+//------------------------------------------------------------------------------
+
+static void paru_solve_task(int64_t t, paru_solve_dag *D)
+{
+    ParU_Symbolic *Sym = D->Sym;
+    int64_t *task_map = Sym->task_map;
+    double *my_work = D->work + D->wsize * PARU_OPENMP_GET_THREAD_NUM;
+    if (D->lower)
+    {
+        for (int64_t f = task_map[t] + 1; f <= task_map[t + 1]; f++)
+        {
+            paru_lsolve_front(f, Sym, D->Num, D->X, D->m, D->nrhs, my_work,
+                              true, D->blas_ok);
+        }
+    }
+    else
+    {
+        for (int64_t f = task_map[t + 1]; f > task_map[t]; f--)
+        {
+            paru_usolve_front(f, Sym, D->Num, D->X, D->m, D->nrhs, my_work,
+                              true, D->blas_ok);
+        }
+    }
+
+    #pragma omp flush
+    for (int64_t p = D->succ_p[t]; p < D->succ_p[t + 1]; p++)
+    {
+        int64_t s = D->succ_i[p];
+        int64_t num_rem_pred;
+        #pragma omp atomic capture
+        {
+            D->npred[s]--;
+            num_rem_pred = D->npred[s];
+        }
+        if (num_rem_pred == 0)
+        {
+            // the last task s waits for starts it
+            #pragma omp task
+            paru_solve_task(s, D);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// paru_solve_fronts
+//------------------------------------------------------------------------------
+
+ParU_Ret paru_solve_fronts(ParU_Symbolic *Sym, ParU_Numeric *Num, double *X,
+                           int64_t m, int64_t nrhs, bool lower,
+                           ParU_Control *Control)
+{
+    DEBUGLEVEL(0);
+    int64_t nf = Sym->nf;
+    int64_t ntasks = Sym->ntasks;
+    int64_t blas_ok = TRUE;
+    int32_t nthreads = paru_solve_nthreads(Sym, Control);
+
+    // gather scatter space for dgemm, one per thread
+    size_t wsize =
+        (lower ? Num->max_row_count : Num->max_col_count) * nrhs;
+    double *work =
+        static_cast<double*>(paru_alloc(wsize * nthreads, sizeof(double)));
+    if (work == NULL)
+    {
+        PRLEVEL(1, ("ParU: out of memory solve\n"));
+        return PARU_OUT_OF_MEMORY;
+    }
+
+    if (nthreads == 1)
+    {
+        BLAS_set_num_threads(control_nthreads(Control));
+        if (lower)
+        {
+            for (int64_t f = 0; f < nf; f++)
+            {
+                paru_lsolve_front(f, Sym, Num, X, m, nrhs, work, false,
+                                  &blas_ok);
+            }
+        }
+        else
+        {
+            for (int64_t f = nf - 1; f >= 0; --f)
+            {
+                paru_usolve_front(f, Sym, Num, X, m, nrhs, work, false,
+                                  &blas_ok);
+            }
+        }
+        paru_free(wsize, sizeof(double), work);
+        return (blas_ok ? PARU_SUCCESS : PARU_TOO_LARGE);
+    }
+
+    //--------------------------------------------------------------------------
+    // find the dependencies between the tasks
+    //--------------------------------------------------------------------------
+
+    int64_t n = Sym->Super[nf];  // # of pivots in the fronts
+    int64_t *ctask = static_cast<int64_t*>(paru_alloc(n, sizeof(int64_t)));
+    int64_t *mark = static_cast<int64_t*>(paru_alloc(ntasks, sizeof(int64_t)));
+    int64_t *npred =
+        static_cast<int64_t*>(paru_calloc(ntasks, sizeof(int64_t)));
+    int64_t *succ_p =
+        static_cast<int64_t*>(paru_calloc(ntasks + 2, sizeof(int64_t)));
+    int64_t *succ_i = NULL;
+    int64_t nedges = 0;
+    paru_solve_dag D;
+    D.Sym = Sym;
+    D.Num = Num;
+    D.X = X;
+    D.m = m;
+    D.nrhs = nrhs;
+    D.lower = lower;
+    D.work = work;
+    D.wsize = wsize;
+    D.succ_p = succ_p;
+    D.succ_i = NULL;
+    D.npred = npred;
+    D.blas_ok = &blas_ok;
+
+    ParU_Ret info = PARU_SUCCESS;
+    if (ctask == NULL || mark == NULL || npred == NULL || succ_p == NULL)
+    {
+        info = PARU_OUT_OF_MEMORY;
+    }
+    else
+    {
+        int64_t *task_map = Sym->task_map;
+        int64_t *Super = Sym->Super;
+        for (int64_t t = 0; t < ntasks; t++)
+        {
+            int64_t c1 = Super[task_map[t] + 1];
+            int64_t c2 = Super[task_map[t + 1] + 1];
+            for (int64_t c = c1; c < c2; c++)
+            {
+                ctask[c] = t;
+            }
+        }
+        // succ_p [t+2] is the # of successors of t after pass 0; succ_p [t+1]
+        // is the start of the successors of t during pass 1 and their end
+        // afterwards
+        paru_solve_edges(0, ctask, mark, &D);
+        for (int64_t t = 0; t < ntasks; t++)
+        {
+            succ_p[t + 2] += succ_p[t + 1];
+        }
+        nedges = succ_p[ntasks + 1];
+        succ_i = static_cast<int64_t*>(paru_alloc(nedges, sizeof(int64_t)));
+        if (succ_i == NULL && nedges > 0)
+        {
+            info = PARU_OUT_OF_MEMORY;
+        }
+        else
+        {
+            D.succ_i = succ_i;
+            paru_solve_edges(1, ctask, mark, &D);
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // solve the tasks, starting with those that wait for no other task
+    //--------------------------------------------------------------------------
+
+    if (info == PARU_SUCCESS)
+    {
+        PRLEVEL(1, ("%% parallel %csolve, " LD " tasks " LD " edges\n",
+                    lower ? 'l' : 'u', ntasks, nedges));
+        // npred changes once the first task runs, so the tasks to start
+        // with are listed first (in mark, no longer needed)
+        int64_t *ready = mark;
+        int64_t nready = 0;
+        for (int64_t t = 0; t < ntasks; t++)
+        {
+            if (npred[t] == 0) ready[nready++] = t;
+        }
+        BLAS_set_num_threads(1);
+        #pragma omp parallel num_threads(nthreads)
+        #pragma omp single nowait
+        for (int64_t k = 0; k < nready; k++)
+        {
+            int64_t t = ready[k];
+            #pragma omp task
+            paru_solve_task(t, &D);
+        }
+    }
+
+    paru_free(wsize * nthreads, sizeof(double), work);
+    paru_free(n, sizeof(int64_t), ctask);
+    paru_free(ntasks, sizeof(int64_t), mark);
+    paru_free(ntasks, sizeof(int64_t), npred);
+    paru_free(ntasks + 2, sizeof(int64_t), succ_p);
+    paru_free(nedges, sizeof(int64_t), succ_i);
+    if (info != PARU_SUCCESS) return info;
+    return (blas_ok ? PARU_SUCCESS : PARU_TOO_LARGE);
+}
@@ -121,7 +121,11 @@ void paru_update_rowDeg(int64_t panel_num, int64_t row_end, int64_t f,
             int64_t nEl = el->ncols;
             // int64_t *el_rowIndex = rowIndex_pointer (el);
             int64_t *el_rowIndex = (int64_t *)(el + 1) + nEl;
-            if (el_rowIndex[curRowIndex] < 0) continue;
+            // the row is gone from e, or e has been compacted since (see
+            // paru_arena_cb_compact) and the tuple is stale
+            if (curRowIndex >= el->nrows ||
+                el_rowIndex[curRowIndex] != curFsRow)
+                continue;
 
             int64_t mEl = el->nrows;
             // int64_t *rowRelIndex = relRowInd (el);
@@ -380,7 +384,9 @@ void paru_update_rowDeg(int64_t panel_num, int64_t row_end, int64_t f,
                 // int64_t *el_rowIndex = rowIndex_pointer (el);
                 int64_t *el_rowIndex = (int64_t *)(el + 1) + el->ncols;
 
-                if (el_rowIndex[curRowIndex] < 0) continue;
+                if (curRowIndex >= el->nrows ||
+                    el_rowIndex[curRowIndex] != r)
+                    continue;
 
                 listRowTuples[pdst++] = curTpl;  // keeping the tuple
 
@@ -481,7 +487,9 @@ void paru_update_rowDeg(int64_t panel_num, int64_t row_end, int64_t f,
             // int64_t *el_rowIndex = rowIndex_pointer (el);
             int64_t *el_rowIndex = (int64_t *)(el + 1) + el->ncols;
 
-            if (el_rowIndex[curRowIndex] < 0) continue;
+            if (curRowIndex >= el->nrows ||
+                el_rowIndex[curRowIndex] != r)
+                continue;
 
             listRowTuples[pdst++] = curTpl;  // keeping the tuple
 
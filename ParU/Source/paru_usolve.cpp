@@ -34,97 +34,104 @@
  *              while it needs space for each thread doing this computation.
  *              I guess using this way can have a good performance.
  *
+ *       A front only writes its own pivotal entries of x, so with more than
+ *       one thread the tasks whose fronts do not need each other's entries
+ *       are solved in parallel; see paru_solve_fronts.
+ *
  * @author Aznaveh
  * */
 
 #include "paru_internal.hpp"
 
-ParU_Ret ParU_Usolve(ParU_Symbolic *Sym, ParU_Numeric *Num,
-    double *x, ParU_Control *Control)
+//------------------------------------------------------------------------------
+// paru_usolve_front: X = U\X for the pivotal block of front f
+//------------------------------------------------------------------------------
+
+void paru_usolve_front(int64_t f, ParU_Symbolic *Sym, ParU_Numeric *Num,
+                       double *X, int64_t m, int64_t nrhs, double *work,
+                       bool atomic, int64_t *blas_ok)
 {
     DEBUGLEVEL(0);
-    // check if input is read
-    if (!x) return PARU_INVALID;
-    int64_t blas_ok = TRUE;
-    PARU_DEFINE_PRLEVEL;
-#ifndef NTIME
-    double start_time = PARU_OPENMP_GET_WTIME;
-#endif
-    int64_t nf = Sym->nf;
-
-    int64_t n1 = Sym->n1;   // row+col singletons
-    int64_t *Ps = Num->Ps;  // row permutation
-
-    ParU_Factors *LUs = Num->partial_LUs;
-    ParU_Factors *Us = Num->partial_Us;
+    int64_t ok = TRUE;
+    int64_t n1 = Sym->n1;
+    int64_t *Ps = Num->Ps;
     int64_t *Super = Sym->Super;
+    int64_t *frowList = Num->frowList[f];
+    int64_t *fcolList = Num->fcolList[f];
+    int64_t col1 = Super[f];
+    int64_t col2 = Super[f + 1];
+    int64_t fp = col2 - col1;
+    int64_t colCount = Num->fcolCount[f];
+    int64_t rowCount = Num->frowCount[f];
+    double alpha = 1;
+    double beta = 0;
 
-    BLAS_set_num_threads(control_nthreads (Control)) ;
-    double *work = static_cast<double*>(paru_alloc((Num->max_col_count), sizeof(double)));
-    if (work == NULL)
-    {
-        PRLEVEL(1, ("ParU: out of memory usolve\n"));
-        return PARU_OUT_OF_MEMORY;
-    }
-
-    for (int64_t f = nf - 1; f >= 0; --f)
+    double *A2 = Num->partial_Us[f].p;
+    if (A2 != NULL)
     {
-        int64_t *frowList = Num->frowList[f];
-        int64_t *fcolList = Num->fcolList[f];
-        int64_t col1 = Super[f];
-        int64_t col2 = Super[f + 1];
-        int64_t fp = col2 - col1;
-        int64_t colCount = Num->fcolCount[f];
-
-        // do dgemv
-        // performed on Us
-        // I am not calling BLAS_DGEMV while the column permutation is different
-
-        double *A2 = Us[f].p;
-        if (A2 != NULL)
+        PRLEVEL(2, ("%% usolve: Working on DGEMV/DGEMM f=" LD "\n%%", f));
+        double *Xg = work + fp * nrhs;  // size Xg is colCount x nrhs
+        for (int64_t j = 0; j < colCount; j++)  // gathering X in Xg
         {
-            PRLEVEL(2, ("%% usolve: Working on DGEMV\n%%"));
-
-            double *xg = &work[0] + fp;         // size Xg is colCount
-            for (int64_t j = 0; j < colCount; j++)  // gathering x in Xg
+            for (int64_t l = 0; l < nrhs; l++)
             {
-                xg[j] = x[fcolList[j] + n1];
+                Xg[l * colCount + j] = X[l * m + fcolList[j] + n1];
             }
-            double alpha = 1;
-            double beta = 0;
-            SUITESPARSE_BLAS_dgemv("N", fp, colCount, &alpha, A2, fp, xg, 1,
-                                   &beta, work, 1, blas_ok);
-
-            for (int64_t i = 0; i < fp; i++)  // scattering the back in to x
+        }
+        if (nrhs == 1)
+        {
+            SUITESPARSE_BLAS_dgemv("N", fp, colCount, &alpha, A2, fp, Xg, 1,
+                                   &beta, work, 1, ok);
+        }
+        else
+        {
+            SUITESPARSE_BLAS_dgemm("N", "N", fp, nrhs, colCount, &alpha, A2,
+                                   fp, Xg, colCount, &beta, work, fp, ok);
+        }
+        for (int64_t i = 0; i < fp; i++)  // scattering the back in to X
+        {
+            int64_t r = Ps[frowList[i]] + n1;
+            for (int64_t l = 0; l < nrhs; l++)
             {
-                int64_t r = Ps[frowList[i]] + n1;
-                x[r] -= work[i];
+                X[l * m + r] -= work[l * fp + i];
             }
-
-            // pragma omp parallel for
-            // for (int64_t i = 0; i < fp; i++)
-            //{
-            //    PRLEVEL(2, ("%% Usolve: Working on DGEMV\n"));
-            //    // computing the inner product
-            //    double i_prod = 0.0;  // innter product
-            //    for (int64_t j = 0; j < colCount; j++)
-            //    {
-            //        i_prod += A2[fp * j + i] * x[fcolList[j] + n1];
-            //    }
-            //    int64_t r = Ps[frowList[i]] + n1;
-            //    PRLEVEL(2, ("i_prod[" LD "]=%lf  r=" LD "\n", i, i_prod,  r));
-            //    x[r] -= i_prod;
-            //}
         }
+    }
 
-        int64_t rowCount = Num->frowCount[f];
+    double *A1 = Num->partial_LUs[f].p;
+    if (nrhs == 1)
+    {
+        SUITESPARSE_BLAS_dtrsv("U", "N", "N", fp, A1, rowCount, X + n1 + col1,
+                               1, ok);
+    }
+    else
+    {
+        SUITESPARSE_BLAS_dtrsm("L", "U", "N", "N", fp, nrhs, &alpha, A1,
+                               rowCount, X + n1 + col1, m, ok);
+    }
 
-        double *A1 = LUs[f].p;
-        PRLEVEL(2, ("%% Usolve: Working on DTRSV\n"));
-        SUITESPARSE_BLAS_dtrsv("U", "N", "N", fp, A1, rowCount, x + col1 + n1,
-                               1, blas_ok);
-        PRLEVEL(2, ("%% DTRSV is just finished\n"));
+    // only the pivotal entries of f are written, so atomic is not needed
+    (void) atomic;
+    if (!ok)
+    {
+        #pragma omp atomic write
+        *blas_ok = FALSE;
     }
+}
+
+ParU_Ret ParU_Usolve(ParU_Symbolic *Sym, ParU_Numeric *Num,
+    double *x, ParU_Control *Control)
+{
+    DEBUGLEVEL(0);
+    // check if input is read
+    if (!x) return PARU_INVALID;
+    PARU_DEFINE_PRLEVEL;
+#ifndef NTIME
+    double start_time = PARU_OPENMP_GET_WTIME;
+#endif
+
+    ParU_Ret info = paru_solve_fronts(Sym, Num, x, Sym->m, 1, false, Control);
+    if (info == PARU_OUT_OF_MEMORY) return info;
 
 #ifndef NDEBUG
     int64_t m = Sym->m;
@@ -175,8 +182,7 @@ ParU_Ret ParU_Usolve(ParU_Symbolic *Sym, ParU_Numeric *Num,
     }
     PRLEVEL(1, (" \n"));
 #endif
-    paru_free(Num->max_col_count, sizeof(double), work);
-    return (blas_ok ? PARU_SUCCESS : PARU_TOO_LARGE);
+    return info;
 }
 
 //////////////// ParU_Usolve ///multiple right hand side mRHS///////////////////
@@ -186,10 +192,8 @@ ParU_Ret ParU_Usolve(ParU_Symbolic *Sym, ParU_Numeric *Num,
     DEBUGLEVEL(0);
     // check if input is read
     if (!X) return PARU_INVALID;
-    int64_t blas_ok = TRUE;
     PARU_DEFINE_PRLEVEL;
     int64_t m = Sym->m;
-    int64_t nf = Sym->nf;
 #ifndef NDEBUG
     PRLEVEL(1, ("%% mRHS inside USolve X is:\n"));
     for (int64_t k = 0; k < m; k++)
@@ -206,91 +210,8 @@ ParU_Ret ParU_Usolve(ParU_Symbolic *Sym, ParU_Numeric *Num,
 #ifndef NTIME
     double start_time = PARU_OPENMP_GET_WTIME;
 #endif
-    int64_t n1 = Sym->n1;   // row+col singletons
-    int64_t *Ps = Num->Ps;  // row permutation
-
-    ParU_Factors *LUs = Num->partial_LUs;
-    ParU_Factors *Us = Num->partial_Us;
-    int64_t *Super = Sym->Super;
-
-    BLAS_set_num_threads(control_nthreads (Control)) ;
-    double *work =
-        static_cast<double*>(paru_alloc((Num->max_col_count * nrhs), sizeof(double)));
-    if (work == NULL)
-    {
-        PRLEVEL(1, ("ParU: out of memory Usolve\n"));
-        return PARU_OUT_OF_MEMORY;
-    }
-
-    for (int64_t f = nf - 1; f >= 0; --f)
-    {
-        int64_t *frowList = Num->frowList[f];
-        int64_t *fcolList = Num->fcolList[f];
-        int64_t col1 = Super[f];
-        int64_t col2 = Super[f + 1];
-        int64_t fp = col2 - col1;
-        int64_t colCount = Num->fcolCount[f];
-
-        // do dgemm
-        // performed on Us
-
-        double *A2 = Us[f].p;
-        if (A2 != NULL)
-        {
-            PRLEVEL(2, ("%% mRHS usolve: Working on DGEMM f=" LD "\n%%", f));
-            double *Xg = &work[0] + fp * nrhs;     // size Xg is colCount x nrhs
-            for (int64_t j = 0; j < colCount; j++)  // gathering X in Xg
-            {
-                for (int64_t l = 0; l < nrhs; l++)
-                {
-                    Xg[l * colCount + j] = X[l * m + fcolList[j] + n1];
-                }
-            }
-
-            double alpha = 1;
-            double beta = 0;
-            SUITESPARSE_BLAS_dgemm("N", "N", fp, nrhs, colCount, &alpha, A2, fp,
-                                   Xg, colCount, &beta, work, fp, blas_ok);
-
-            for (int64_t i = 0; i < fp; i++)  // scattering the back in to X
-            {
-                int64_t r = Ps[frowList[i]] + n1;
-                for (int64_t l = 0; l < nrhs; l++)
-                {
-                    X[l * m + r] -= work[l * fp + i];
-                }
-            }
-
-            // algternative way for dgemm
-            // pragma omp parallel for schedule(static)
-            // for (int64_t i = 0; i < fp; i++)
-            //{
-            //    // computing the inner product
-            //    double i_prod[nrhs] = {0.0};  // inner product
-            //    for (int64_t j = 0; j < colCount; j++)
-            //    {
-            //        for (int64_t l = 0; l < nrhs; l++)
-            //            i_prod[l] += A2[fp * j + i] * X[l*m + fcolList[j] +
-            //            n1];
-            //    }
-            //    int64_t r = Ps[frowList[i]] + n1;
-            //    for (int64_t l = 0; l < nrhs; l++)
-            //    {
-            //        PRLEVEL(2, ("i_prod[" LD "]=%lf  r=" LD "\nrhs", i, i_prod[i], r));
-            //        X[l*m+r] -= i_prod[l];
-            //    }
-            //}
-        }
-
-        int64_t rowCount = Num->frowCount[f];
-
-        PRLEVEL(2, ("%% mRHS Usolve: Working on DTRSM\n"));
-        double *A1 = LUs[f].p;
-        double alpha = 1;
-        SUITESPARSE_BLAS_dtrsm("L", "U", "N", "N", fp, nrhs, &alpha, A1, rowCount,
-                               X + n1 + col1, m, blas_ok);
-        PRLEVEL(2, ("%% mRHS DTRSM is just finished\n"));
-    }
+    ParU_Ret info = paru_solve_fronts(Sym, Num, X, m, nrhs, false, Control);
+    if (info == PARU_OUT_OF_MEMORY) return info;
 
     PRLEVEL(1, ("%% mRHS Usolve working on singletons \n"));
     int64_t cs1 = Sym->cs1;
@@ -339,6 +260,5 @@ ParU_Ret ParU_Usolve(ParU_Symbolic *Sym, ParU_Numeric *Num,
     }
     PRLEVEL(1, (" \n"));
 #endif
-    paru_free(Num->max_col_count * nrhs, sizeof(double), work);
-    return (blas_ok ? PARU_SUCCESS : PARU_TOO_LARGE);
+    return info;
 }
@@ -19,7 +19,10 @@
 {                                           \
     ParU_Freenum(&Num, &Control);           \
     ParU_Freesym(&Sym, &Control);           \
+    ParU_Freenum(&GNum, &GControl);         \
+    ParU_Freesym(&GSym, &GControl);         \
     cholmod_l_free_sparse(&A, cc);          \
+    cholmod_l_free_sparse(&G, cc);          \
     cholmod_l_finish(cc);                   \
     if (B  != NULL) { free(B);  B  = NULL; } \
     if (X  != NULL) { free(X);  X  = NULL; } \
@@ -31,9 +34,10 @@
 int main(int argc, char **argv)
 {
     cholmod_common Common, *cc;
-    cholmod_sparse *A;
-    ParU_Symbolic *Sym = NULL;
-    ParU_Numeric *Num = NULL ;
+    cholmod_sparse *A, *G = NULL;
+    ParU_Symbolic *Sym = NULL, *GSym = NULL ;
+    ParU_Numeric *Num = NULL, *GNum = NULL ;
+    ParU_Control GControl ;
     double *b = NULL, *B = NULL, *X = NULL, *xx = NULL, *x = NULL ;
 
     // default log10 of expected residual.  +1 means failure is expected
@@ -44,6 +48,14 @@ int main(int argc, char **argv)
     }
     printf ("expected log10 of resid: %g\n", expected_log10_resid) ;
 
+    // percentage by which the arenas must lower the peak memory of the
+    // factorization, compared with one allocation per front and block
+    int64_t expected_arena_saving = 0 ;
+    if (argc > 2)
+    {
+        expected_arena_saving = (int64_t) atoi (argv [2]) ;
+    }
+
     //~~~~~~~~~Reading the input matrix and test if the format is OK~~~~~~~~~~~~
     // start CHOLMOD
     cc = &Common;
@@ -53,6 +65,7 @@ int main(int argc, char **argv)
     ParU_Control Control;
     // puting Control lines to work
     Control.mem_chunk = 1024;
+    Control.mem_arena = -1;
     Control.umfpack_ordering = 23;
     Control.umfpack_strategy = 23;
     Control.paru_max_threads = 4;
@@ -152,6 +165,27 @@ int main(int argc, char **argv)
         TEST_PASSES ;
     }
 
+    // arena statistics, compared with one allocation per front and block
+    TEST_ASSERT (Sym->nf == 0 || Num->arena_nchunks > 0) ;
+    {
+        ParU_Control Control2 = Control ;
+        Control2.mem_arena = 0 ;
+        ParU_Numeric *Num2 = NULL ;
+        info = ParU_Factorize(A, Sym, &Num2, &Control2);
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        TEST_ASSERT (Num2->arena_ncompact == 0) ;
+        printf ("peak memory: " LD " with arenas (" LD " blocks compacted), "
+            LD " without\n", Num->arena_peak, Num->arena_ncompact,
+            Num2->arena_peak) ;
+        if (expected_arena_saving > 0)
+        {
+            TEST_ASSERT (Num->arena_ncompact > 0) ;
+            TEST_ASSERT (100 * Num->arena_peak <=
+                (100 - expected_arena_saving) * Num2->arena_peak) ;
+        }
+        ParU_Freenum(&Num2, &Control2);
+    }
+
     //~~~~~~~~~~~~~~~~~~~Test the results ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
     int64_t m = Sym->m;
@@ -194,6 +228,19 @@ int main(int argc, char **argv)
             "and rcond is %.2e.\n", resid, anorm, xnorm, Num->rcond);
     TEST_ASSERT (resid == 0 || log10 (resid) <= expected_log10_resid) ;
 
+    // the fronts are solved in order with one thread, and in parallel over
+    // the tasks with Control.paru_max_threads > 1
+    {
+        ParU_Control Control1 = Control;
+        Control1.paru_max_threads = 1;
+        info = ParU_Solve(Sym, Num, b, xx, &Control1);
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        info = ParU_Residual(A, xx, b, m, resid, anorm, xnorm, &Control1);
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        resid = (anorm == 0 || xnorm == 0 ) ? 0 : (resid/(anorm*xnorm));
+        TEST_ASSERT (resid == 0 || log10 (resid) <= expected_log10_resid) ;
+    }
+
     for (int64_t i = 0; i < m; ++i) b[i] = i + 1;
     info = paru_backward(b, resid, anorm, xnorm, NULL, Sym, Num, &Control);
     TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
@@ -247,6 +294,155 @@ int main(int argc, char **argv)
     printf("mRhs Residual is |%.2e|\n", resid);
     TEST_ASSERT (resid == 0 || log10 (resid) <= expected_log10_resid) ;
 
+    //~~~~~~~~~~~~~~~~~~~Refactorize with new values~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    info = ParU_Refactorize(NULL, Sym, &Num, &Control);  // coverage
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    TEST_ASSERT (Num->nrefact == 0) ;
+
+    // the same values: the old pivots are reused, unless entries cancelled
+    // exactly in ParU_Factorize and a row was left out of its front, so that
+    // A does not fit the old pattern and Num is a new factorization.  Either
+    // way the factors must solve the system; the fast path itself is tested
+    // on a matrix built below, where the outcome is known.
+    info = ParU_Refactorize(A, Sym, &Num, &Control);
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+
+    {
+        // the same pattern, slightly different values
+        double *Ax = (double *)A->x;
+        int64_t anz = ((int64_t *)A->p)[A->ncol];
+        for (int64_t p = 0; p < anz; p++) Ax[p] *= 1 + 1e-3 * (p % 7);
+    }
+    info = ParU_Refactorize(A, Sym, &Num, &Control);
+    if (info != PARU_SUCCESS)
+    {
+        TEST_ASSERT (expected_log10_resid == 109) ;
+        TEST_PASSES ;
+    }
+    info = ParU_Solve(Sym, Num, nrhs, B, X, &Control);
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    info = ParU_Residual(A, X, B, m, nrhs, resid, anorm, xnorm, &Control);
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    resid = (anorm == 0 || xnorm == 0 ) ? 0 : (resid/(anorm*xnorm));
+    printf("Refactorize mRhs Residual is |%.2e|\n", resid);
+    TEST_ASSERT (resid == 0 || log10 (resid) <= expected_log10_resid) ;
+
+    //~~~~~~~~~~~~~~~~~~~Refactorize a matrix with known pivots~~~~~~~~~~~~~~~~
+    // G is the 5-point stencil on an 8-by-8 grid, with unsymmetric values and
+    // a strongly dominant diagonal, so every diagonal pivot passes the
+    // threshold test and no entry cancels.  Refactorizing G with new values
+    // that keep the diagonal dominant must reuse the pivots.  With a tiny
+    // diagonal the first frozen pivot must be rejected, and ParU_Refactorize
+    // must fall back to ParU_Factorize.
+    {
+        const int64_t nx = 8, gn = nx * nx ;
+        cholmod_triplet *T = cholmod_l_allocate_triplet (gn, gn, 5 * gn, 0,
+            CHOLMOD_REAL, cc) ;
+        TEST_ASSERT (T != NULL) ;
+        int64_t *Ti = (int64_t *) T->i ;
+        int64_t *Tj = (int64_t *) T->j ;
+        double *Tx = (double *) T->x ;
+        int64_t nz = 0 ;
+        for (int64_t gx = 0 ; gx < nx ; gx++)
+        {
+            for (int64_t gy = 0 ; gy < nx ; gy++)
+            {
+                int64_t k = gx + gy * nx ;
+                Ti [nz] = k ; Tj [nz] = k ; Tx [nz++] = 16 + (k % 5) ;
+                const int64_t nbr [4] = { gx > 0    ? k - 1  : -1,
+                                          gx < nx-1 ? k + 1  : -1,
+                                          gy > 0    ? k - nx : -1,
+                                          gy < nx-1 ? k + nx : -1 } ;
+                for (int64_t e = 0 ; e < 4 ; e++)
+                {
+                    if (nbr [e] < 0) continue ;
+                    Ti [nz] = k ; Tj [nz] = nbr [e] ;
+                    Tx [nz++] = -1 - 0.25 * ((k + 3 * e) % 4) ;
+                }
+            }
+        }
+        T->nnz = nz ;
+        G = cholmod_l_triplet_to_sparse (T, nz, cc) ;
+        cholmod_l_free_triplet (&T, cc) ;
+        TEST_ASSERT (G != NULL) ;
+        double *Gx = (double *) G->x ;
+        int64_t *Gp = (int64_t *) G->p ;
+        int64_t *Gi = (int64_t *) G->i ;
+        int64_t gnz = Gp [gn] ;
+        double GB [gn * nrhs], GX [gn * nrhs] ;
+        for (int64_t p = 0 ; p < gn * nrhs ; p++) GB [p] = (double) (p % 11) ;
+
+        GControl.paru_max_threads = Control.paru_max_threads ;
+        info = ParU_Analyze (G, &GSym, &GControl) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        info = ParU_Factorize (G, GSym, &GNum, &GControl) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        TEST_ASSERT (GNum->nrefact == 0) ;
+
+        // new values, still diagonally dominant: the pivots are reused
+        for (int64_t p = 0 ; p < gnz ; p++) Gx [p] *= 1 + 0.01 * (p % 3) ;
+        ParU_Numeric *GNum_old = GNum ;
+        info = ParU_Refactorize (G, GSym, &GNum, &GControl) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        TEST_ASSERT (GNum == GNum_old && GNum->nrefact == 1) ;
+        for (int64_t p = 0 ; p < gnz ; p++) Gx [p] *= 1 - 0.02 * (p % 5) ;
+        info = ParU_Refactorize (G, GSym, &GNum, &GControl) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        TEST_ASSERT (GNum == GNum_old && GNum->nrefact == 2) ;
+
+        // the refactorized factors solve the system
+        double gresid = 0, ganorm = 0, gxnorm = 0 ;
+        info = ParU_Solve (GSym, GNum, nrhs, GB, GX, &GControl) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        info = ParU_Residual (G, GX, GB, gn, nrhs, gresid, ganorm, gxnorm,
+            &GControl) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        gresid = (ganorm == 0 || gxnorm == 0) ? 0 : (gresid/(ganorm*gxnorm)) ;
+        printf ("Refactorized grid: residual %.2e\n", gresid) ;
+        TEST_ASSERT (gresid < 1e-12) ;
+
+        // a tiny diagonal: a frozen pivot fails, and G is factorized again
+        for (int64_t j = 0 ; j < gn ; j++)
+        {
+            for (int64_t p = Gp [j] ; p < Gp [j+1] ; p++)
+            {
+                if (Gi [p] == j) Gx [p] = 1e-8 ;
+            }
+        }
+        info = ParU_Refactorize (G, GSym, &GNum, &GControl) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        TEST_ASSERT (GNum != NULL && GNum->nrefact == 0) ;
+        info = ParU_Solve (GSym, GNum, nrhs, GB, GX, &GControl) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        info = ParU_Residual (G, GX, GB, gn, nrhs, gresid, ganorm, gxnorm,
+            &GControl) ;
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        gresid = (ganorm == 0 || gxnorm == 0) ? 0 : (gresid/(ganorm*gxnorm)) ;
+        printf ("Refactorized grid after the fallback: residual %.2e\n",
+            gresid) ;
+        TEST_ASSERT (gresid < 1e-10) ;
+    }
+
+    //~~~~~~~~~~~~~~~~~~~Autotune and tuning profiles~~~~~~~~~~~~~~~~~~~~~~~~~
+    info = ParU_Autotune(A, NULL, &Control);  // coverage
+    TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    info = ParU_Autotune(A, Sym, &Control);
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    info = ParU_Save_Tuning("paru_tuning.tmp", &Control);
+    TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+    {
+        ParU_Control Control2;
+        Control2.trivial = -1;
+        info = ParU_Load_Tuning("paru_tuning.tmp", &Control2);
+        TEST_ASSERT_INFO (info == PARU_SUCCESS, info) ;
+        TEST_ASSERT (Control2.trivial == Control.trivial) ;
+        TEST_ASSERT (Control2.worthwhile_dgemm == Control.worthwhile_dgemm) ;
+        TEST_ASSERT (Control2.worthwhile_trsm == Control.worthwhile_trsm) ;
+        remove("paru_tuning.tmp");
+        info = ParU_Load_Tuning("paru_tuning.tmp", &Control2);  // coverage
+        TEST_ASSERT_INFO (info == PARU_INVALID, info) ;
+    }
+
     //~~~~~~~~~~~~~~~~~~~End computation~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
     //~~~~~~~~~~~~~~~~~~~Free Everything~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
     TEST_PASSES ;
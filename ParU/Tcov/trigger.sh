@@ -132,6 +132,6 @@ echo "========xenon1.mtx========"
 ./cov
 
 echo "========c-62.mtx========"
-./x_quick_test <$MAT_PATH/c-62.mtx
+./x_quick_test -16 15 <$MAT_PATH/c-62.mtx
 ./cov
 
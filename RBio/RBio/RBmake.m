@@ -13,6 +13,7 @@ function RBmake
 
 mexcmd = ['mex -O %s %s RBerror.c ../Source/RBio.c ' ...
     '../../SuiteSparse_config/SuiteSparse_config.c ' ...
+    '../../SuiteSparse_config/SuiteSparse_memstats.c ' ...
     '-I../../SuiteSparse_config -I../Include'] ;
 
 try
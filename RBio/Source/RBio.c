@@ -21,11 +21,13 @@
 #ifdef INT
 /* int version */
 #define Int int32_t
+#define Int_max INT32_MAX
 #define IDD "d"
 #define RB(name) RB ## name ## _i
 #else
 /* Default: long (except for Windows, which is __int64) */
 #define Int int64_t
+#define Int_max INT64_MAX
 #define IDD PRId64
 #define RB(name) RB ## name
 #endif
@@ -41,6 +43,27 @@
 #define PRIVATE static
 
 #define SLEN 4096
+
+/* The data section of a file is memory-mapped on POSIX systems, and read into
+   memory with fread otherwise, so that it can be parsed in parallel. */
+#if defined (__unix__) || defined (__APPLE__)
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#define RBIO_MMAP
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#define RB_NTHREADS omp_get_max_threads ( )
+#else
+#define RB_NTHREADS 1
+#endif
+
+#define RB_CHUNK 1024       /* # of lines parsed or printed by each task */
+#define RB_TOKLEN 64        /* longest token parsed from memory */
+#define RB_ITEMLEN 40       /* upper bound on the length of a printed value */
 #define FREE_WORK   { SuiteSparse_free (w) ; \
                       SuiteSparse_free (cp) ; }
 
@@ -120,6 +143,51 @@ PRIVATE int RB(xprint)        /* returns TRUE if OK, FALSE otherwise */
     Int *nbuf               /* number of entries written to current line */
 ) ;
 
+PRIVATE size_t RB(pformat)       /* returns # of characters printed */
+(
+    /* output */
+    char *buf,          /* buffer to print to */
+
+    /* input */
+    Int task,           /* 1: col. pointers, 2: row indices, 3: values */
+    Int first,          /* print items first to last-1 */
+    Int last,
+    Int nrow,           /* A is nrow-by-ncol */
+    Int ncol,
+    Int mkind,          /* 0:R, 1:P: 2:Csplit, 3:I, 4:Cmerged */
+    Int skind,          /* -1:rect, 0:unsym, 1:sym, 2:hermitian, 3:skew */
+    const Int *Ap,      /* size ncol+1, column pointers */
+    const Int *Ai,      /* size anz=Ap[ncol], row indices */
+    const double *Ax,   /* size anz, real values */
+    const double *Az,   /* size anz, imaginary part (may be NULL) */
+    const Int *Zp,      /* size ncol+1, column pointers for Z (may be NULL) */
+    const Int *Zi,      /* size Zp[ncol], row indices for Z */
+    const char *cfm,    /* C format to use */
+    Int nper,           /* number of items per line */
+    const Int *cp       /* size ncol+1, column pointers of A+Z */
+) ;
+
+PRIVATE int RB(pwrite)  /* TRUE if OK, FALSE on failure, -1 if out of memory */
+(
+    /* input */
+    FILE *file,         /* file to print to (already open) */
+    Int task,           /* 1: col. pointers, 2: row indices, 3: values */
+    Int nitems,         /* number of items to print */
+    Int nrow,           /* A is nrow-by-ncol */
+    Int ncol,
+    Int mkind,          /* 0:R, 1:P: 2:Csplit, 3:I, 4:Cmerged */
+    Int skind,          /* -1:rect, 0:unsym, 1:sym, 2:hermitian, 3:skew */
+    const Int *Ap,      /* size ncol+1, column pointers */
+    const Int *Ai,      /* size anz=Ap[ncol], row indices */
+    const double *Ax,   /* size anz, real values */
+    const double *Az,   /* size anz, imaginary part (may be NULL) */
+    const Int *Zp,      /* size ncol+1, column pointers for Z (may be NULL) */
+    const Int *Zi,      /* size Zp[ncol], row indices for Z */
+    const char *cfm,    /* C format to use */
+    Int nper,           /* number of items per line */
+    const Int *cp       /* size ncol+1, column pointers of A+Z */
+) ;
+
 PRIVATE void RB(fill)
 (
     char *s,            /* string to fill */
@@ -333,6 +401,39 @@ PRIVATE Int RB(xread)     /* TRUE if OK, false otherwise */
     Int slen            /* s is of size slen+1 */
 ) ;
 
+PRIVATE Int RB(pcount)
+(
+    const char *p,      /* start of the line */
+    const char *e       /* end of the line */
+) ;
+
+PRIVATE int RB(ptoken)   /* TRUE if token found, FALSE otherwise */
+(
+    /* input/output */
+    const char **c,     /* parse the next token in *c [0..e-1] and update *c */
+    /* input */
+    const char *e,      /* end of the line */
+    /* output */
+    double *x           /* value of the token */
+) ;
+
+PRIVATE int RB(pread)     /* TRUE if the matrix was read, FALSE otherwise */
+(
+    /* input */
+    FILE *file,         /* positioned just after the first line of data */
+    const char *s,      /* first line of data, already read from the file */
+    Int ncol,           /* number of column pointers is ncol+1 */
+    Int nnz,            /* number of row indices */
+    Int nx,             /* number of values (2*nx tokens if complex) */
+    Int mkind,          /* 0:R, 1:P: 2:Csplit, 3:I, 4:Cmerged */
+
+    /* output */
+    Int *Ap,            /* size ncol+1, column pointers */
+    Int *Ai,            /* size nnz, row indices */
+    double *Ax,         /* size nx or 2*nx, real values (may be NULL) */
+    double *Az          /* size nx, imaginary values (may be NULL) */
+) ;
+
 PRIVATE void RB(skipheader)
 (
     char *s,
@@ -494,6 +595,7 @@ PRIVATE int RB(read2)   /* 0: OK, < 0: error, > 0: warning */
 {
     double xr = 0, xz = 0 ;
     Int p, i, j, k, ilast, alen, llen, psrc, pdst ;
+    int fast ;
 
     /* ---------------------------------------------------------------------- */
     /* skip past the header, if reading from a file */
@@ -504,11 +606,17 @@ PRIVATE int RB(read2)   /* 0: OK, < 0: error, > 0: warning */
         RB(skipheader) (s, slen, file) ;
     }
 
+    /* ---------------------------------------------------------------------- */
+    /* read the matrix in parallel, if possible */
+    /* ---------------------------------------------------------------------- */
+
+    fast = RB(pread) (file, s, ncol, nnz, nnz, mkind, Ap, Ai, Ax, Az) ;
+
     /* ---------------------------------------------------------------------- */
     /* read the column pointers and check them */
     /* ---------------------------------------------------------------------- */
 
-    if (!RB(iread) (file, ncol+1, 1, Ap, s, slen))
+    if (!fast && !RB(iread) (file, ncol+1, 1, Ap, s, slen))
     {
         return (RBIO_CP_IOERROR) ;      /* I/O error reading column pointers */
     }
@@ -528,7 +636,7 @@ PRIVATE int RB(read2)   /* 0: OK, < 0: error, > 0: warning */
     /* read the row indices and check them */
     /* ---------------------------------------------------------------------- */
 
-    if (!RB(iread) (file, nnz, 1, Ai, s, slen))
+    if (!fast && !RB(iread) (file, nnz, 1, Ai, s, slen))
     {
         return (RBIO_ROW_IOERROR) ;       /* I/O error reading row indices */
     }
@@ -565,7 +673,7 @@ PRIVATE int RB(read2)   /* 0: OK, < 0: error, > 0: warning */
     /* read the values */
     /* ---------------------------------------------------------------------- */
 
-    if (!RB(xread) (file, nnz, mkind, Ax, Az, s, slen))
+    if (!fast && !RB(xread) (file, nnz, mkind, Ax, Az, s, slen))
     {
         return (RBIO_VALUE_IOERROR) ;     /* I/O error reading values */
     }
@@ -1318,6 +1426,439 @@ PRIVATE Int RB(xread)     /* TRUE if OK, FALSE otherwise */
 }
 
 
+/* -------------------------------------------------------------------------- */
+/* RBpcount: count the tokens in a line held in memory */
+/* -------------------------------------------------------------------------- */
+
+/* Tokens are delimited by spaces, as in RBxtoken.  A last token of white space
+   only (such as "\r\n") is not counted, since RBxtoken fails to parse it and
+   thus treats it as the end of the line. */
+
+PRIVATE Int RB(pcount)
+(
+    const char *p,      /* start of the line */
+    const char *e       /* end of the line */
+)
+{
+    Int n = 0, blank ;
+    while (p < e)
+    {
+        /* consume leading spaces, if any */
+        while (p < e && *p == ' ')
+        {
+            p++ ;
+        }
+        if (p == e) break ;
+
+        /* find where the token ends */
+        blank = TRUE ;
+        while (p < e && *p != ' ')
+        {
+            blank = blank && isspace ((unsigned char) *p) ;
+            p++ ;
+        }
+        if (!blank || p < e)
+        {
+            n++ ;
+        }
+    }
+    return (n) ;
+}
+
+
+/* -------------------------------------------------------------------------- */
+/* RBptoken: get the next token from a line held in memory */
+/* -------------------------------------------------------------------------- */
+
+/* Same as RBxtoken, except that the line is not modified and ends at e.
+   Tokens with RB_TOKLEN or more characters are not parsed. */
+
+PRIVATE int RB(ptoken)   /* TRUE if token found, FALSE otherwise */
+(
+    /* input/output */
+    const char **c,     /* parse the next token in *c [0..e-1] and update *c */
+    /* input */
+    const char *e,      /* end of the line */
+    /* output */
+    double *x           /* value of the token */
+)
+{
+    char t [RB_TOKLEN], *tend ;
+    const char *p = *c ;
+    double d = 0 ;
+    Int k = 0, digits = TRUE ;
+
+    *x = 0 ;
+
+    /* consume leading spaces, if any */
+    while (p < e && *p == ' ')
+    {
+        p++ ;
+    }
+
+    /* copy the token into t, and get its value if it is all digits */
+    while (p < e && *p != ' ')
+    {
+        if (k >= RB_TOKLEN-1)
+        {
+            return (FALSE) ;
+        }
+        digits = digits && (*p >= '0' && *p <= '9') ;
+        d = 10 * d + (*p - '0') ;
+        t [k++] = *p++ ;
+    }
+    t [k] = '\0' ;
+    *c = p ;
+
+    if (digits && k > 0 && k <= 15)
+    {
+        /* small nonnegative integer, computed exactly */
+        *x = d ;
+        return (TRUE) ;
+    }
+
+    /* parse the token as sscanf (t, "%lg", x) would */
+    *x = strtod (t, &tend) ;
+    return (tend != t) ;
+}
+
+
+/* -------------------------------------------------------------------------- */
+/* RBpread:  read the column pointers, row indices, and values in parallel */
+/* -------------------------------------------------------------------------- */
+
+/* The data section of the file is mapped (or read) into memory and split into
+   lines.  Each line is then assigned to the column pointers, row indices, or
+   numerical values, along with the position of its first token, just as
+   RBiread and RBxread would consume the tokens one at a time.  With that
+   known, all lines are parsed in parallel.
+
+   Nothing unusual is handled here: a token that cannot be parsed, a blank
+   line where data is expected, a line too long for RBreadline, the end of the
+   file, or running out of memory.  In each case FALSE is returned, the file
+   is left as it was on input, and the caller falls back to RBiread and
+   RBxread, which handle these cases or return the proper error code. */
+
+PRIVATE int RB(pread)     /* TRUE if the matrix was read, FALSE otherwise */
+(
+    /* input */
+    FILE *file,         /* positioned just after the first line of data */
+    const char *s,      /* first line of data, already read from the file */
+    Int ncol,           /* number of column pointers is ncol+1 */
+    Int nnz,            /* number of row indices */
+    Int nx,             /* number of values (2*nx tokens if complex) */
+    Int mkind,          /* 0:R, 1:P: 2:Csplit, 3:I, 4:Cmerged */
+
+    /* output */
+    Int *Ap,            /* size ncol+1, column pointers */
+    Int *Ai,            /* size nnz, row indices */
+    double *Ax,         /* size nx or 2*nx, real values (may be NULL) */
+    double *Az          /* size nx, imaginary values (may be NULL) */
+)
+{
+    char *buf = NULL, *data ;
+    size_t len, slen, *lp = NULL, *cstart = NULL ;
+    Int *lcnt = NULL, *ldst = NULL, *clines = NULL, need [3], first [3],
+        last [3], nchunks, nlines, nsec, nt, sec, got, bad, c, L, k ;
+    long pos ;
+    int mapped = FALSE, lenient ;
+
+    if (file == NULL)
+    {
+        /* stdin is read one line at a time */
+        return (FALSE) ;
+    }
+    pos = ftell (file) ;
+    slen = strlen (s) ;
+    if (pos < 0 || (size_t) pos < slen)
+    {
+        return (FALSE) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* get the data section, starting with the line in s, into memory */
+    /* ---------------------------------------------------------------------- */
+
+    data = NULL ;
+    len = 0 ;
+
+#ifdef RBIO_MMAP
+    {
+        struct stat st ;
+        int fd = fileno (file) ;
+        if (fstat (fd, &st) == 0 && S_ISREG (st.st_mode) && st.st_size > pos)
+        {
+            void *map = mmap (NULL, (size_t) st.st_size, PROT_READ,
+                MAP_PRIVATE, fd, 0) ;
+            if (map != MAP_FAILED)
+            {
+                mapped = TRUE ;
+                buf = (char *) map ;
+                data = buf + (pos - slen) ;
+                len = (size_t) st.st_size - (pos - slen) ;
+            }
+        }
+    }
+#endif
+
+    if (!mapped)
+    {
+        /* copy s and the rest of the file into memory */
+        size_t cap = MAX (2*SLEN, 1048576), n = slen, got_n ;
+        int ok = TRUE ;
+        buf = SuiteSparse_malloc (cap, sizeof (char)) ;
+        if (buf != NULL)
+        {
+            memcpy (buf, s, slen) ;
+        }
+        while (buf != NULL)
+        {
+            got_n = fread (buf + n, sizeof (char), cap - n, file) ;
+            n += got_n ;
+            if (n < cap) break ;
+            buf = SuiteSparse_realloc (2*cap, cap, sizeof (char), buf, &ok) ;
+            if (!ok)
+            {
+                SuiteSparse_free (buf) ;
+                buf = NULL ;
+            }
+            cap *= 2 ;
+        }
+        if (buf == NULL || ferror (file))
+        {
+            SuiteSparse_free (buf) ;
+            fseek (file, pos, SEEK_SET) ;
+            return (FALSE) ;
+        }
+        data = buf ;
+        len = n ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* split the data into chunks of whole lines, and count the lines */
+    /* ---------------------------------------------------------------------- */
+
+    nt = RB_NTHREADS ;
+    nchunks = MAX (1, MIN (4*nt, (Int) (len >> 20))) ;
+    cstart = SuiteSparse_malloc (nchunks+1, sizeof (size_t)) ;
+    clines = SuiteSparse_malloc (nchunks+1, sizeof (Int)) ;
+    bad = (cstart == NULL || clines == NULL) ;
+
+    if (!bad)
+    {
+        cstart [0] = 0 ;
+        for (c = 1 ; c < nchunks ; c++)
+        {
+            /* chunk c starts at the first line that starts at or after b */
+            size_t b = MAX (1, (len / nchunks) * c) ;
+            char *q = memchr (data + b - 1, '\n', len - b + 1) ;
+            cstart [c] = MAX (cstart [c-1], q ? (size_t) (q - data + 1) : len) ;
+        }
+        cstart [nchunks] = len ;
+
+        #pragma omp parallel for num_threads(nt) schedule(dynamic,1) \
+            reduction(+:bad)
+        for (c = 0 ; c < nchunks ; c++)
+        {
+            size_t p, p0 = cstart [c], pend = cstart [c+1] ;
+            Int n = 0 ;
+            for (p = p0 ; p < pend ; p++)
+            {
+                if (data [p] == '\0')
+                {
+                    /* RBreadline would truncate this line */
+                    bad++ ;
+                }
+                if (data [p] == '\n' || p+1 == pend)
+                {
+                    /* a line ends at p; RBreadline would split a long one */
+                    n++ ;
+                    bad += (p+1 - p0 > SLEN-1) ;
+                    p0 = p+1 ;
+                }
+            }
+            clines [c] = n ;
+        }
+    }
+
+    /* replace clines with the index of the first line of each chunk */
+    nlines = 0 ;
+    for (c = 0 ; !bad && c < nchunks ; c++)
+    {
+        Int n = clines [c] ;
+        clines [c] = nlines ;
+        nlines += n ;
+        bad = (nlines >= Int_max / 2) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* find the start of each line and the number of tokens it holds */
+    /* ---------------------------------------------------------------------- */
+
+    if (!bad)
+    {
+        lp   = SuiteSparse_malloc (nlines+1, sizeof (size_t)) ;
+        lcnt = SuiteSparse_malloc (nlines+1, sizeof (Int)) ;
+        ldst = SuiteSparse_malloc (nlines+1, sizeof (Int)) ;
+        bad = (lp == NULL || lcnt == NULL || ldst == NULL) ;
+    }
+
+    if (!bad)
+    {
+        #pragma omp parallel for num_threads(nt) schedule(dynamic,1)
+        for (c = 0 ; c < nchunks ; c++)
+        {
+            size_t p, p0 = cstart [c], pend = cstart [c+1] ;
+            Int l = clines [c] ;
+            for (p = p0 ; p < pend ; p++)
+            {
+                if (data [p] == '\n' || p+1 == pend)
+                {
+                    lp [l] = p0 ;
+                    lcnt [l] = RB(pcount) (data + p0, data + p + 1) ;
+                    l++ ;
+                    p0 = p+1 ;
+                }
+            }
+        }
+        lp [nlines] = len ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* assign the lines to each section, as RBiread and RBxread would */
+    /* ---------------------------------------------------------------------- */
+
+    /* the tokens of each line are kept in lcnt, and the position of its first
+       token in the output array is kept in ldst */
+    need [0] = ncol+1 ;
+    need [1] = nnz ;
+    need [2] = nx * ((mkind == 2 || mkind == 4) ? 2 : 1) ;
+    nsec = (mkind == 1) ? 2 : 3 ;
+
+    /* the first line is already in s, so it may hold no tokens at all */
+    L = 0 ;
+    lenient = TRUE ;
+    for (sec = 0 ; !bad && sec < nsec ; sec++)
+    {
+        first [sec] = L ;
+        got = 0 ;
+        while (!bad && got < need [sec])
+        {
+            if (L >= nlines || (lcnt [L] == 0 && !lenient))
+            {
+                /* end of file, or a blank line */
+                bad = TRUE ;
+                break ;
+            }
+            k = MIN (lcnt [L], need [sec] - got) ;
+            lcnt [L] = k ;
+            ldst [L] = got ;
+            got += k ;
+            L++ ;
+            lenient = FALSE ;
+        }
+        if (lenient)
+        {
+            /* nothing was read, and the line in s is discarded */
+            L++ ;
+            first [sec] = L ;
+        }
+        last [sec] = L ;
+        lenient = FALSE ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* parse each section in parallel */
+    /* ---------------------------------------------------------------------- */
+
+    for (sec = 0 ; !bad && sec < nsec ; sec++)
+    {
+        Int *A = (sec == 0) ? Ap : Ai ;
+
+        #pragma omp parallel for num_threads(nt) schedule(dynamic,RB_CHUNK) \
+            reduction(+:bad) if (last [sec] - first [sec] > RB_CHUNK)
+        for (L = first [sec] ; L < last [sec] ; L++)
+        {
+            const char *p = data + lp [L], *e = data + lp [L+1] ;
+            double x ;
+            Int t, i, g ;
+            if (e > p && e [-1] == '\n')
+            {
+                e-- ;
+            }
+            for (t = 0 ; t < lcnt [L] ; t++)
+            {
+                if (!RB(ptoken) (&p, e, &x))
+                {
+                    bad++ ;
+                    break ;
+                }
+                g = ldst [L] + t ;
+                if (sec < 2)
+                {
+                    /* column pointer or row index (convert to 0-based) */
+                    i = (Int) x ;
+                    if ((double) (i+1) != (x+1))
+                    {
+                        bad++ ;
+                        break ;
+                    }
+                    A [g] = i - 1 ;
+                }
+                else if (mkind == 2)
+                {
+                    /* split-complex: alternate between Ax and Az */
+                    if (g % 2 == 0)
+                    {
+                        Ax [g/2] = x ;
+                    }
+                    else
+                    {
+                        Az [g/2] = x ;
+                    }
+                }
+                else
+                {
+                    /* real, integer, or merged-complex */
+                    Ax [g] = x ;
+                }
+            }
+        }
+    }
+
+    if (!bad && mkind == 1)
+    {
+        /* pattern-only matrix: store the values as RBxread would */
+        for (k = 0 ; k < nx ; k++)
+        {
+            RB(put_entry) (mkind, Ax, Az, k, 1, 0) ;
+        }
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* free workspace and unmap the file */
+    /* ---------------------------------------------------------------------- */
+
+    SuiteSparse_free (lp) ;
+    SuiteSparse_free (lcnt) ;
+    SuiteSparse_free (ldst) ;
+    SuiteSparse_free (cstart) ;
+    SuiteSparse_free (clines) ;
+#ifdef RBIO_MMAP
+    if (mapped)
+    {
+        munmap (buf, (size_t) (len + (pos - slen))) ;
+    }
+#endif
+    if (!mapped)
+    {
+        SuiteSparse_free (buf) ;
+        fseek (file, pos, SEEK_SET) ;
+    }
+    return (!bad) ;
+}
+
+
 /* -------------------------------------------------------------------------- */
 /* RBread: read a Rutherford/Boeing matrix from a file */
 /* -------------------------------------------------------------------------- */
@@ -1606,7 +2147,7 @@ int RB(readraw)           /* 0: OK, < 0: error, > 0: warning */
     Int *Ap, *Ai ;
     double *Ax ;
     Int status ;
-    int ok ;
+    int ok, fast ;
     char s [SLEN+1], ptrfmt [21], indfmt [21], valfmt [21] ;
 
     /* ---------------------------------------------------------------------- */
@@ -1691,21 +2232,25 @@ int RB(readraw)           /* 0: OK, < 0: error, > 0: warning */
         RB(skipheader) (s, SLEN, file) ;        /* skip past the header */
     }
 
-    if (!RB(iread) (file, (*ncol)+1, 1, Ap, s, SLEN))
+    /* read the matrix in parallel, if possible */
+    fast = RB(pread) (file, s, *ncol, *nnz, (*mkind == 1) ? 0 : (*xsize),
+        (*mkind == 1) ? 1 : 0, Ap, Ai, Ax, NULL) ;
+
+    if (!fast && !RB(iread) (file, (*ncol)+1, 1, Ap, s, SLEN))
     {
         FREE_RAW ;
         if (filename) fclose (file) ;
         return (RBIO_CP_IOERROR) ;      /* I/O error reading column pointers */
     }
 
-    if (!RB(iread) (file, *nnz, 1, Ai, s, SLEN))
+    if (!fast && !RB(iread) (file, *nnz, 1, Ai, s, SLEN))
     {
         FREE_RAW ;
         if (filename) fclose (file) ;
         return (RBIO_ROW_IOERROR) ;     /* I/O error reading row indices */
     }
 
-    if (*mkind != 1)
+    if (!fast && *mkind != 1)
     {
         if (!RB(xread) (file, *xsize, 0, Ax, NULL, s, SLEN))
         {
@@ -1981,12 +2526,19 @@ int RB(write)         /* 0:OK, < 0: error, > 0: warning */
     /* write the column pointers (convert to 1-based) */
     /* ---------------------------------------------------------------------- */
 
-    nbuf = 0 ;
-    for (j = 0 ; ok && j <= ncol ; j++)
+    ok = RB(pwrite) (file, 1, ncol+1, nrow, ncol, mkind, skind, Ap, Ai, Ax,
+        Az, Zp, Zi, ptrcfm, ptrn, cp) ;
+    if (ok < 0)
     {
-        ok = RB(iprint) (file, ptrcfm, 1+ cp [j], ptrn, &nbuf) ;
+        /* out of memory: print the column pointers one at a time */
+        ok = TRUE ;
+        nbuf = 0 ;
+        for (j = 0 ; ok && j <= ncol ; j++)
+        {
+            ok = RB(iprint) (file, ptrcfm, 1+ cp [j], ptrn, &nbuf) ;
+        }
+        ok = ok && fprintf (file, "\n") > 0 ;
     }
-    ok = ok && fprintf (file, "\n") > 0 ;
     if (!ok)
     {
         /* file I/O error */
@@ -1999,8 +2551,14 @@ int RB(write)         /* 0:OK, < 0: error, > 0: warning */
     /* write the row indices (convert to 1-based) */
     /* ---------------------------------------------------------------------- */
 
-    ok = RB(writeTask) (file, 2, nrow, ncol, mkind, skind, Ap, Ai, Ax, Az,
-        Zp, Zi, indcfm, indn, valcfm, valn, &nnz2, w, cp) ;
+    ok = RB(pwrite) (file, 2, nnz2, nrow, ncol, mkind, skind, Ap, Ai, Ax,
+        Az, Zp, Zi, indcfm, indn, cp) ;
+    if (ok < 0)
+    {
+        /* out of memory: print the row indices one at a time */
+        ok = RB(writeTask) (file, 2, nrow, ncol, mkind, skind, Ap, Ai, Ax, Az,
+            Zp, Zi, indcfm, indn, valcfm, valn, &nnz2, w, cp) ;
+    }
     if (!ok)
     {
         /* file I/O error */
@@ -2015,8 +2573,14 @@ int RB(write)         /* 0:OK, < 0: error, > 0: warning */
 
     if (mkind != 1)
     {
-        ok = RB(writeTask) (file, 3, nrow, ncol, mkind, skind, Ap, Ai,
-            Ax, Az, Zp, Zi, indcfm, indn, valcfm, valn, &nnz2, w, cp) ;
+        ok = RB(pwrite) (file, 3, vals*nnz2, nrow, ncol, mkind, skind, Ap, Ai,
+            Ax, Az, Zp, Zi, valcfm, valn, cp) ;
+        if (ok < 0)
+        {
+            /* out of memory: print the values one at a time */
+            ok = RB(writeTask) (file, 3, nrow, ncol, mkind, skind, Ap, Ai,
+                Ax, Az, Zp, Zi, indcfm, indn, valcfm, valn, &nnz2, w, cp) ;
+        }
     }
 
     /* ---------------------------------------------------------------------- */
@@ -2390,9 +2954,7 @@ PRIVATE Int RB(format)  /* return format to use (index in F_, C_format) */
     Int *valn           /* number of entries per line */
 )
 {
-    Int i ;
-    double a, b ;
-    char s [1024] ;
+    Int c, nchunks, nt ;
 
     if (is_int)
     {
@@ -2412,35 +2974,55 @@ PRIVATE Int RB(format)  /* return format to use (index in F_, C_format) */
         /* find the required precision for a real or complex matrix */
         /* ------------------------------------------------------------------ */
 
+        /* A value that can be printed with one format can also be printed
+           with any wider one, so each chunk of x can find its own format, and
+           the widest of these is used for all numbers. */
+        nchunks = 1 + nnz / (RB_CHUNK * 64) ;
+        nt = MIN (RB_NTHREADS, nchunks) ;
         fmt = 0 ;
-        for (i = 0 ; i < nnz ; i++)
+
+        #pragma omp parallel for num_threads(nt) schedule(dynamic,1) \
+            reduction(max:fmt)
+        for (c = 0 ; c < nchunks ; c++)
         {
+            Int i, f = 0, istart, iend ;
+            double a, b ;
+            char s [1024] ;
 
-            /* determine if the matrix has huge values, tiny values, or NaN's */
-            a = ABS (x [i]) ;
-            if (a != 0)
+            istart = c * (nnz / nchunks) ;
+            iend = (c == nchunks-1) ? nnz : (istart + nnz / nchunks) ;
+            for (i = istart ; i < iend ; i++)
             {
-                if (ISNAN (a) || a < 1e-90 || a > 1e90)
+
+                /* determine if the matrix has huge values, tiny values, or
+                   NaN's */
+                a = ABS (x [i]) ;
+                if (a != 0)
                 {
-                    fmt = NFORMAT-1 ;
-                    break ;
+                    if (ISNAN (a) || a < 1e-90 || a > 1e90)
+                    {
+                        f = NFORMAT-1 ;
+                        break ;
+                    }
                 }
-            }
 
-            a = x ? x [i] : 1 ;
-            for ( ; fmt < NFORMAT-1 ; fmt++)
-            {
-                /* write the value to a string, read back in, and check,
-                 * using the kth format */
-                sprintf (s, C_format [fmt], a) ;
-                b = 0 ;
-                sscanf (s, "%lg", &b) ;
-                if (s [0] == ' ' && a == b)
+                a = x ? x [i] : 1 ;
+                for ( ; f < NFORMAT-1 ; f++)
                 {
-                    /* success, use this format (or wider) for all numbers */
-                    break ;
+                    /* write the value to a string, read back in, and check,
+                     * using the kth format */
+                    sprintf (s, C_format [f], a) ;
+                    b = 0 ;
+                    sscanf (s, "%lg", &b) ;
+                    if (s [0] == ' ' && a == b)
+                    {
+                        /* success, use this format (or wider) for all
+                           numbers in this chunk */
+                        break ;
+                    }
                 }
             }
+            fmt = MAX (fmt, f) ;
         }
 
         strncpy (valfmt, F_format [fmt], 21) ;
@@ -2673,6 +3255,251 @@ PRIVATE int RB(xprint)    /* returns TRUE if OK, FALSE otherwise */
 }
 
 
+/* -------------------------------------------------------------------------- */
+/* RBpformat: print a range of items to a buffer */
+/* -------------------------------------------------------------------------- */
+
+/* The items are the column pointers (task 1), the row indices (task 2), or the
+   numerical values (task 3, two items per entry if complex), numbered from 0
+   in the order RBwrite and RBwriteTask print them.  Items first to last-1
+   are printed to buf, each one preceded by a newline if it starts a new line,
+   just as RBiprint and RBxprint would print them.  buf must be large enough
+   to hold RB_ITEMLEN characters per item. */
+
+PRIVATE size_t RB(pformat)       /* returns # of characters printed */
+(
+    /* output */
+    char *buf,          /* buffer to print to */
+
+    /* input */
+    Int task,           /* 1: col. pointers, 2: row indices, 3: values */
+    Int first,          /* print items first to last-1 */
+    Int last,
+    Int nrow,           /* A is nrow-by-ncol */
+    Int ncol,
+    Int mkind,          /* 0:R, 1:P: 2:Csplit, 3:I, 4:Cmerged */
+    Int skind,          /* -1:rect, 0:unsym, 1:sym, 2:hermitian, 3:skew */
+    const Int *Ap,      /* size ncol+1, column pointers */
+    const Int *Ai,      /* size anz=Ap[ncol], row indices */
+    const double *Ax,   /* size anz, real values */
+    const double *Az,   /* size anz, imaginary part (may be NULL) */
+    const Int *Zp,      /* size ncol+1, column pointers for Z (may be NULL) */
+    const Int *Zi,      /* size Zp[ncol], row indices for Z */
+    const char *cfm,    /* C format to use */
+    Int nper,           /* number of items per line */
+    const Int *cp       /* size ncol+1, column pointers of A+Z */
+)
+{
+    double xr, xz ;
+    Int j, k, q, lo, hi, ipe, pa, pz, paend, pzend, ia, iz, i ;
+    char *p = buf ;
+
+    if (task == 1)
+    {
+
+        /* ------------------------------------------------------------------ */
+        /* print the column pointers (convert to 1-based) */
+        /* ------------------------------------------------------------------ */
+
+        for (k = first ; k < last ; k++)
+        {
+            if (k > 0 && k % nper == 0) *p++ = '\n' ;
+            p += sprintf (p, cfm, 1 + cp [k]) ;
+        }
+        return ((size_t) (p - buf)) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* find the column containing the first item */
+    /* ---------------------------------------------------------------------- */
+
+    /* each entry is printed as ipe items */
+    ipe = (task == 3 && (mkind == 2 || mkind == 4)) ? 2 : 1 ;
+
+    /* find the last column lo with cp [lo] <= first/ipe */
+    lo = 0 ;
+    hi = ncol ;
+    while (lo < hi)
+    {
+        j = (lo + hi + 1) / 2 ;
+        if (cp [j] <= first / ipe)
+        {
+            lo = j ;
+        }
+        else
+        {
+            hi = j - 1 ;
+        }
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* print each column, starting at column lo, as RBwriteTask does */
+    /* ---------------------------------------------------------------------- */
+
+    k = cp [lo] * ipe ;
+    for (j = lo ; k < last && j < ncol ; j++)
+    {
+
+        /* find the set union of A (:,j) and Z (:,j) */
+        pa = Ap [j] ;
+        pz = Zp ? Zp [j] : 0 ;
+        paend = Ap [j+1] ;
+        pzend = Zp ? Zp [j+1] : 0 ;
+
+        /* repeat while entries still exist in A(:,j) or Z(:,j) */
+        while (k < last)
+        {
+            /* get the next entry from A(:,j) */
+            ia = (pa < paend) ? Ai [pa] : nrow ;
+
+            /* get the next entry from Z(:,j) */
+            iz = (pz < pzend) ? Zi [pz] : nrow ;
+
+            /* exit loop if neither entry is present */
+            if (ia >= nrow && iz >= nrow) break ;
+
+            if (ia < iz)
+            {
+                /* get A (i,j) */
+                i = ia ;
+                RB(get_entry) (mkind, Ax, Az, pa, &xr, &xz) ;
+                pa++ ;
+            }
+            else if (iz < ia)
+            {
+                /* get Z (i,j) */
+                i = iz ;
+                xr = 0 ;
+                xz = 0 ;
+                pz++ ;
+            }
+            else
+            {
+                /* get A (i,j), and delete its matched Z(i,j) */
+                i = ia ;
+                RB(get_entry) (mkind, Ax, Az, pa, &xr, &xz) ;
+                pa++ ;
+                pz++ ;
+            }
+
+            if (skind <= 0 || i >= j)
+            {
+                /* print the items of the (i,j) entry with value (xr,xz) */
+                for (q = 0 ; q < ipe ; q++, k++)
+                {
+                    if (k < first || k >= last) continue ;
+                    if (k > 0 && k % nper == 0) *p++ = '\n' ;
+                    if (task == 2)
+                    {
+                        /* row index (convert to 1-based) */
+                        p += sprintf (p, cfm, 1 + i) ;
+                    }
+                    else if (mkind == 3)
+                    {
+                        /* value as an integer */
+                        p += sprintf (p, cfm, (Int) xr) ;
+                    }
+                    else
+                    {
+                        /* real or imaginary part */
+                        p += sprintf (p, cfm, (q == 0) ? xr : xz) ;
+                    }
+                }
+            }
+        }
+    }
+    return ((size_t) (p - buf)) ;
+}
+
+
+/* -------------------------------------------------------------------------- */
+/* RBpwrite: print the items of one section of the file in parallel */
+/* -------------------------------------------------------------------------- */
+
+/* The items (see RBpformat) are split into chunks of RB_CHUNK lines.  Each
+   thread prints one chunk to its own buffer, and the buffers are then written
+   to the file in order, so the file is identical to the one RBiprint and
+   RBxprint would write.  If the buffers cannot be allocated, -1 is returned
+   and nothing is written to the file. */
+
+PRIVATE int RB(pwrite)  /* TRUE if OK, FALSE on failure, -1 if out of memory */
+(
+    /* input */
+    FILE *file,         /* file to print to (already open) */
+    Int task,           /* 1: col. pointers, 2: row indices, 3: values */
+    Int nitems,         /* number of items to print */
+    Int nrow,           /* A is nrow-by-ncol */
+    Int ncol,
+    Int mkind,          /* 0:R, 1:P: 2:Csplit, 3:I, 4:Cmerged */
+    Int skind,          /* -1:rect, 0:unsym, 1:sym, 2:hermitian, 3:skew */
+    const Int *Ap,      /* size ncol+1, column pointers */
+    const Int *Ai,      /* size anz=Ap[ncol], row indices */
+    const double *Ax,   /* size anz, real values */
+    const double *Az,   /* size anz, imaginary part (may be NULL) */
+    const Int *Zp,      /* size ncol+1, column pointers for Z (may be NULL) */
+    const Int *Zi,      /* size Zp[ncol], row indices for Z */
+    const char *cfm,    /* C format to use */
+    Int nper,           /* number of items per line */
+    const Int *cp       /* size ncol+1, column pointers of A+Z */
+)
+{
+    char *buf ;
+    size_t cap, *blen ;
+    Int nchunk, nchunks, nt, c, t, nc ;
+    int ok = TRUE ;
+
+    if (!file) file = stdout ;                  /* file defaults to stdout */
+
+    /* ---------------------------------------------------------------------- */
+    /* allocate one buffer for each thread */
+    /* ---------------------------------------------------------------------- */
+
+    nchunk = RB_CHUNK * nper ;                  /* # of items in each chunk */
+    nchunks = (nitems + nchunk - 1) / nchunk ;
+    nt = MAX (1, MIN (RB_NTHREADS, nchunks)) ;
+    cap = ((size_t) nchunk) * RB_ITEMLEN ;
+    buf  = SuiteSparse_malloc (nt, cap) ;
+    blen = SuiteSparse_malloc (nt, sizeof (size_t)) ;
+    if (buf == NULL || blen == NULL)
+    {
+        SuiteSparse_free (buf) ;
+        SuiteSparse_free (blen) ;
+        return (-1) ;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* print nt chunks at a time in parallel, and write them in order */
+    /* ---------------------------------------------------------------------- */
+
+    for (c = 0 ; ok && c < nchunks ; c += nt)
+    {
+        nc = MIN (nt, nchunks - c) ;
+
+        #pragma omp parallel for num_threads(nc) schedule(static,1)
+        for (t = 0 ; t < nc ; t++)
+        {
+            Int first = (c + t) * nchunk ;
+            Int last = MIN (first + nchunk, nitems) ;
+            blen [t] = RB(pformat) (buf + t * cap, task, first, last, nrow,
+                ncol, mkind, skind, Ap, Ai, Ax, Az, Zp, Zi, cfm, nper, cp) ;
+        }
+
+        for (t = 0 ; ok && t < nc ; t++)
+        {
+            ok = (fwrite (buf + t * cap, sizeof (char), blen [t], file)
+                == blen [t]) ;
+        }
+    }
+
+    /* terminate the last line */
+    ok = ok && (fprintf (file, "\n") > 0) ;
+
+    SuiteSparse_free (buf) ;
+    SuiteSparse_free (blen) ;
+    return (ok) ;
+}
+
+
 /* -------------------------------------------------------------------------- */
 /* RBiformat: determine format for printing an integer */
 /* -------------------------------------------------------------------------- */
@@ -15,10 +15,10 @@
 int main (int argc, char **argv)
 {
     double xr, xz, xmin, xmax ;
-    double *Ax, *Az ;
+    double *Ax, *Az, *Bx ;
     int64_t nrow, ncol, mkind, skind, *Ap, *Ai, i, *Zp, *Zi, asize, mkind2,
         skind2, znz, j, p, status, njumbled, nzeros, build_upper, zero_handling,
-        fem, xsize, nelnz, nnz, kk, anz ;
+        fem, xsize, nelnz, nnz, kk, anz, *Bp, *Bi ;
     int ok ;
     char title [73], key [9], mtype [4], mtype2 [4], *filename, s [100], *As ;
 
@@ -280,6 +280,36 @@ int main (int argc, char **argv)
     }
     SuiteSparse_free (As) ;
 
+    /* the same matrix with DOS line endings and one value per line */
+    status = RBread ("matrices/m4crlf.rb", 1, 0, title, key, mtype,
+        &nrow, &ncol, &mkind, &skind, &asize, &znz,
+        &Bp, &Bi, &Bx, NULL, NULL, NULL) ;
+    ok = (status == RBIO_OK && nrow == 4 && ncol == 4) ;
+    for (j = 0 ; ok && j <= ncol ; j++)
+    {
+        ok = (Bp [j] == Ap [j]) ;
+    }
+    for (p = 0 ; ok && p < Ap [ncol] ; p++)
+    {
+        ok = (Bi [p] == Ai [p] && Bx [p] == Ax [p]) ;
+    }
+    if (!ok)
+    {
+        printf ("RBread test failure (23) "ID"\n", status) ;
+    }
+    SuiteSparse_free (Bp) ;
+    SuiteSparse_free (Bi) ;
+    SuiteSparse_free (Bx) ;
+
+    /* a blank line where the row indices should start */
+    status = RBread ("mangled/16.rb", 1, 0, title, key, mtype,
+        &nrow, &ncol, &mkind, &skind, &asize, &znz,
+        &Bp, &Bi, &Bx, NULL, NULL, NULL) ;
+    if (status != RBIO_ROW_IOERROR)
+    {
+        printf ("RBread test failure (24) "ID"\n", status) ;
+    }
+
     printf ("RBtest OK\n") ;
     SuiteSparse_finish ( ) ;
     return (0) ;
@@ -358,6 +358,9 @@ typedef struct SPEX_options
     bool check ;           // Set true if the solution to the system should be
                            // checked.  Intended for debugging only; SPEX is
                            // guaranteed to return the exact solution.
+    int nthreads ;         // Number of threads used by SPEX_Left_LU_factorize
+                           // (requires OpenMP).  <= 0: use the OpenMP
+                           // default.  The result is the same for any value.
 } SPEX_options ;
 
 // Purpose: Create SPEX_options object with default parameters
@@ -751,6 +754,19 @@ SPEX_info SPEX_cumsum
 // returned to GMP.  Instead, all allocated blocks in the list are freed,
 // and spex_gmp_allocate returns directly to wrapper.
 
+// Between SPEX_initialize and SPEX_finalize, small blocks freed by GMP are
+// kept in a pool (one per thread) and reused, rather than being returned to
+// the system each time.  SPEX_gmp_pool_stats reports how well this works.
+// Any of its outputs may be NULL.
+
+SPEX_info SPEX_gmp_pool_stats
+(
+    int64_t *nalloc,        // # of blocks allocated for GMP
+    int64_t *nreuse,        // # of those blocks taken from the pool
+    int64_t *pool_bytes,    // # of bytes currently held in the pool
+    int64_t *pool_peak      // max # of bytes held in the pool
+) ;
+
 SPEX_info SPEX_mpfr_asprintf (char **str, const char *format, ... ) ;
 
 SPEX_info SPEX_gmp_fscanf (FILE *fp, const char *format, ... ) ;
@@ -775,14 +791,18 @@ SPEX_info SPEX_mpz_mul (mpz_t a, const mpz_t b, const mpz_t c) ;
 
 #if 0
 SPEX_info SPEX_mpz_add (mpz_t a, const mpz_t b, const mpz_t c) ;
+#endif
 
 SPEX_info SPEX_mpz_addmul (mpz_t x, const mpz_t y, const mpz_t z) ;
-#endif
 
 SPEX_info SPEX_mpz_submul (mpz_t x, const mpz_t y, const mpz_t z) ;
 
 SPEX_info SPEX_mpz_divexact (mpz_t x, const mpz_t y, const mpz_t z) ;
 
+SPEX_info SPEX_mpz_fdiv_q (mpz_t q, const mpz_t n, const mpz_t d) ;
+
+SPEX_info SPEX_mpz_fdiv_r (mpz_t r, const mpz_t n, const mpz_t d) ;
+
 SPEX_info SPEX_mpz_gcd (mpz_t x, const mpz_t y, const mpz_t z) ;
 
 SPEX_info SPEX_mpz_lcm (mpz_t lcm, const mpz_t x, const mpz_t y) ;
@@ -910,6 +930,27 @@ SPEX_info SPEX_Left_LU_backslash
     const SPEX_options* option
 ) ;
 
+// SPEX_Left_LU_modular_backslash solves Ax = b like SPEX_Left_LU_backslash,
+// but with a multi-modular method instead of the REF LU factorization.  A is
+// factorized modulo a sequence of word-sized primes, one prime per thread
+// (see option->nthreads), using the column ordering of SPEX_LU_analyze.  The
+// solutions modulo each prime are combined with the Chinese remainder theorem,
+// and x is recovered by rational reconstruction and verified exactly.  If the
+// verification fails or A is singular, SPEX_Left_LU_backslash is used instead,
+// so the result is always the same as that of SPEX_Left_LU_backslash.
+SPEX_info SPEX_Left_LU_modular_backslash
+(
+    // Output
+    SPEX_matrix **X_handle,       // Final solution vector
+    // Input
+    SPEX_type type,               // Type of output desired:
+                                  // Must be SPEX_MPQ, SPEX_MPFR,
+                                  // or SPEX_FP64
+    const SPEX_matrix *A,         // Input matrix
+    const SPEX_matrix *b,         // Right hand side vector(s)
+    const SPEX_options* option
+) ;
+
 // SPEX_Left_LU_factorize performs the SPEX Left LU factorization. 
 // This factorization is done via n iterations of the sparse REF 
 // triangular solve function. The overall factorization is 
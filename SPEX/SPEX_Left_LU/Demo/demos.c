@@ -179,6 +179,16 @@ SPEX_info SPEX_process_command_line //processes the command line
             }
             option->print_level = atoi(argv[i]);
         }
+        else if ( strcmp(arg,"n") == 0 || strcmp(arg, "nthreads") == 0)
+        {
+            if (!argv[++i])
+            {
+                printf("\n****ERROR! n or nthreads must be followed by"
+                    " the number of threads\n");
+                return SPEX_INCORRECT_INPUT;
+            }
+            option->nthreads = atoi(argv[i]);
+        }
         else if ( strcmp(arg, "f") == 0 || strcmp(arg, "file") == 0)
         {
             if (!argv[++i])
@@ -52,6 +52,11 @@
 //        1: just errors and warnings: Default
 //        2: terse, with basic stats from COLAMD/AMD and SPEX and solution
 //
+// n (or nthreads). e.g., spex_lu_demo n 4, which indicates SPEX_Left_LU will
+// use 4 threads for the factorization and the multi-modular solve (requires
+// OpenMP). The default is 1, and 0 uses the OpenMP default. The result is the
+// same for any value.
+//
 //
 // If none of the above args is given, they are set to the following default:
 //
@@ -67,6 +72,7 @@
     SPEX_matrix_free(&L, option);                \
     SPEX_matrix_free(&U, option);                \
     SPEX_matrix_free(&x, option);                \
+    SPEX_matrix_free(&x2, option);               \
     SPEX_matrix_free(&b, option);                \
     SPEX_matrix_free(&rhos, option);             \
     SPEX_FREE(pinv);                             \
@@ -119,6 +125,7 @@ int main (int argc, char* argv[])
     SPEX_matrix *L = NULL;
     SPEX_matrix *U = NULL;
     SPEX_matrix *x = NULL;
+    SPEX_matrix *x2 = NULL;
     SPEX_matrix *b = NULL;
     SPEX_matrix *rhos = NULL;
     int64_t* pinv = NULL;
@@ -263,16 +270,50 @@ int main (int argc, char* argv[])
     // Create copy which is stored as my_kind and my_type:
     // SPEX_matrix_copy( &my_x, my_kind, my_type, x, option);
 
+    //--------------------------------------------------------------------------
+    // Solve the system again with the multi-modular method, which does not
+    // use the REF LU factorization, and compare the solutions.
+    //--------------------------------------------------------------------------
+
+    option->check = false;
+
+    clock_t start_modular = clock();
+
+    OK(SPEX_Left_LU_modular_backslash(&x2, SPEX_MPQ, A, b, option));
+
+    clock_t end_modular = clock();
+
+    for (int64_t k = 0; k < x->m * x->n; k++)
+    {
+        int r;
+        OK(SPEX_mpq_equal(&r, x->x.mpq[k], x2->x.mpq[k]));
+        if (r == 0)
+        {
+            printf("\n****ERROR! the modular solution differs\n");
+            FREE_WORKSPACE;
+            return 1;
+        }
+    }
+
     // Timing stats
     double t_sym = (double) (end_col-start_col)/CLOCKS_PER_SEC;
     double t_factor = (double) (end_factor - start_factor) / CLOCKS_PER_SEC;
     double t_solve =  (double) (end_solve - start_solve) / CLOCKS_PER_SEC;
+    double t_modular = (double) (end_modular - start_modular) / CLOCKS_PER_SEC;
 
     printf("\nNumber of L+U nonzeros: \t\t%"PRId64,
         (L->p[L->n]) + (U->p[U->n]) - (L->m));
     printf("\nSymbolic analysis time: \t\t%lf", t_sym);
     printf("\nSPEX Left LU Factorization time: \t%lf", t_factor);
-    printf("\nFB Substitution time: \t\t\t%lf\n\n", t_solve);
+    printf("\nFB Substitution time: \t\t\t%lf", t_solve);
+    printf("\nMulti-modular solve time: \t\t%lf\n", t_modular);
+
+    // GMP memory pool stats
+    int64_t gmp_nalloc, gmp_nreuse, gmp_pool_peak ;
+    OK(SPEX_gmp_pool_stats(&gmp_nalloc, &gmp_nreuse, NULL, &gmp_pool_peak));
+    printf("GMP blocks allocated: \t\t\t%"PRId64" (%"PRId64" from pool)",
+        gmp_nalloc, gmp_nreuse);
+    printf("\nGMP pool peak size: \t\t\t%"PRId64" bytes\n\n", gmp_pool_peak);
 
     //--------------------------------------------------------------------------
     // Free Memory
@@ -25,6 +25,7 @@
 
 #define SPEX_FREE_WORK              \
     SPEX_matrix_free(&x, NULL);     \
+    SPEX_FREE(xw);                  \
     SPEX_FREE(xi);                  \
     SPEX_FREE(h);                   \
     SPEX_FREE(pivs);                \
@@ -39,6 +40,25 @@
 
 #include "spex_left_lu_internal.h"
 
+// Copy x[j] into an entry of L or U, allocated to the size of x[j]
+static SPEX_info spex_left_lu_copy_entry
+(
+    mpz_t y,            // entry of L or U, not yet initialized
+    const mpz_t x       // x[j]
+)
+{
+    // SPEX_CHECK is not used here since SPEX_FREE_ALL frees the workspace of
+    // SPEX_Left_LU_factorize
+    size_t size ;
+    // Find the size in bits of x[j]
+    SPEX_info info = SPEX_mpz_sizeinbase(&size, x, 2);
+    // GMP manual: Allocated size should be size+2
+    if (info == SPEX_OK) info = SPEX_mpz_init2(y, size+2);
+    // Place the x value of the nonzero
+    if (info == SPEX_OK) info = SPEX_mpz_set(y, x);
+    return (info) ;
+}
+
 SPEX_info SPEX_Left_LU_factorize
 (
     // output:
@@ -90,11 +110,21 @@ SPEX_info SPEX_Left_LU_factorize
     int64_t *pivs = NULL ;
     int64_t *row_perm = NULL ;
     SPEX_matrix *x = NULL ;
+    int64_t *xw = NULL ;
 
     int64_t n = A->n ;
 
     int64_t k = 0, top, i, j, col, loc, lnz = 0, unz = 0, pivot, jnew ;
-    size_t size ;
+
+    // number of threads to use (1 by default).  The factorization is the
+    // same for any number of threads.
+    int nthreads = SPEX_OPTION_NTHREADS (option) ;
+    #ifdef _OPENMP
+    if (nthreads <= 0) nthreads = omp_get_max_threads ( ) ;
+    #else
+    nthreads = 1 ;
+    #endif
+    nthreads = SPEX_MAX (nthreads, 1) ;
 
     // Inverse pivot ordering
     pinv = (int64_t *) SPEX_malloc (n * sizeof (int64_t)) ;
@@ -119,7 +149,11 @@ SPEX_info SPEX_Left_LU_factorize
     // is used for sorting
     row_perm = (int64_t*) SPEX_malloc(n* sizeof(int64_t));
 
-    if (!pivs || !h || !xi || !row_perm || !pinv)
+    // xw holds the entries of x that fit in an int64_t during the triangular
+    // solve, so that GMP is only used for the entries that overflow.
+    xw = (int64_t*) SPEX_malloc(n* sizeof(int64_t));
+
+    if (!pivs || !h || !xi || !row_perm || !pinv || !xw)
     {
         // out of memory: free everything and return
         SPEX_FREE_ALL  ;
@@ -172,6 +206,32 @@ SPEX_info SPEX_Left_LU_factorize
     // correctly handled internally.
     int64_t estimate = 64 * SPEX_MAX (2, ceil (log2 ((double) n))) ;
 
+    // The Hadamard bound gives an upper bound instead.  Each entry of L and U
+    // is the determinant of a square submatrix of A, so it has at most
+    // hbits = sum (log2 (norm (A(:,j)))) bits, and each intermediate value of
+    // x has at most 2*hbits+1 bits.  If this is less than the estimate above,
+    // it is used instead, and then x never needs to be reallocated.
+    double hbits = 0 ;
+    for (j = 0; j < n; j++)
+    {
+        size_t size, maxbits = 0 ;
+        int64_t p, cnz = A->p[j+1] - A->p[j] ;
+        for (p = A->p[j]; p < A->p[j+1]; p++)
+        {
+            SPEX_CHECK(SPEX_mpz_sizeinbase(&size, A->x.mpz[p], 2));
+            maxbits = SPEX_MAX (maxbits, size) ;
+        }
+        if (cnz > 0)
+        {
+            // norm (A(:,j)) <= sqrt (cnz) * 2^maxbits
+            hbits += (double) maxbits + 0.5 * log2 ((double) cnz) ;
+        }
+    }
+    if (2 * hbits + 2 < (double) estimate)
+    {
+        estimate = (int64_t) ceil (2 * hbits + 2) ;
+    }
+
     // Create x, a global dense mpz_t matrix of dimension n*1. Unlike rhos, the
     // second boolean parameter is set to false to avoid initializing
     // each mpz entry of x with default size.  It is intialized below.
@@ -220,7 +280,7 @@ SPEX_info SPEX_Left_LU_factorize
             rhos,
             (const int64_t *) pinv,
             (const int64_t *) row_perm,
-            h, x)) ;
+            h, x, xw, nthreads)) ;
 
         //----------------------------------------------------------------------
         // Obtain pivot
@@ -231,45 +291,85 @@ SPEX_info SPEX_Left_LU_factorize
         //----------------------------------------------------------------------
         // Populate L and U. We iterate across all nonzeros in x
         //----------------------------------------------------------------------
+        int64_t lnz0 = lnz, unz0 = unz ;
         for (j = top; j < n; j++)
         {
             jnew = xi[j];
             // Location of x[j] in final matrix
             loc = pinv[jnew];
 
-            //------------------------------------------------------------------
             // loc <= k are rows above k, thus go to U
-            //------------------------------------------------------------------
             if (loc <= k)
             {
                 // Place the i location of the unz nonzero
-                U->i[unz] = jnew;
-                // Find the size in bits of x[j]
-                SPEX_CHECK(SPEX_mpz_sizeinbase(&size, x->x.mpz[jnew], 2));
-                // GMP manual: Allocated size should be size+2
-                SPEX_CHECK(SPEX_mpz_init2(U->x.mpz[unz], size+2));
-                // Place the x value of the unz nonzero
-                SPEX_CHECK(SPEX_mpz_set(U->x.mpz[unz], x->x.mpz[jnew]));
-                // Increment unz
-                unz++;
+                U->i[unz++] = jnew;
             }
 
-            //------------------------------------------------------------------
             // loc >= k are rows below k, thus go to L
-            //------------------------------------------------------------------
             if (loc >= k)
             {
                 // Place the i location of the lnz nonzero
-                L->i[lnz] = jnew;
-                // Set the size of x[j]
-                SPEX_CHECK(SPEX_mpz_sizeinbase(&size, x->x.mpz[jnew], 2));
-                // GMP manual: Allocated size should be size+2
-                SPEX_CHECK(SPEX_mpz_init2(L->x.mpz[lnz], size+2));
-                // Place the x value of the lnz nonzero
-                SPEX_CHECK(SPEX_mpz_set(L->x.mpz[lnz], x->x.mpz[jnew]));
-                // Increment lnz
-                lnz++;
+                L->i[lnz++] = jnew;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // Copy the values of L(:,k) and U(:,k) from x
+        //----------------------------------------------------------------------
+
+        // The entries are independent, so they are copied in parallel if
+        // there are enough of them
+        int64_t nz = (unz - unz0) + (lnz - lnz0) ;
+        int nth = (int) SPEX_MIN (nthreads, nz / SPEX_LEFT_LU_PAR_BIG) ;
+        if (nth <= 1)
+        {
+            for (i = unz0; i < unz; i++)
+            {
+                SPEX_CHECK(spex_left_lu_copy_entry(U->x.mpz[i],
+                    x->x.mpz[U->i[i]]));
+            }
+            for (i = lnz0; i < lnz; i++)
+            {
+                SPEX_CHECK(spex_left_lu_copy_entry(L->x.mpz[i],
+                    x->x.mpz[L->i[i]]));
+            }
+        }
+        else
+        {
+            SPEX_info pinfo = SPEX_OK ;
+            int64_t ucount = unz - unz0 ;
+            #pragma omp parallel num_threads(nth)
+            {
+                SPEX_info tinfo = SPEX_OK ;
+                int64_t t ;
+                #pragma omp for schedule(dynamic,16)
+                for (t = 0; t < nz; t++)
+                {
+                    if (tinfo != SPEX_OK) continue ;
+                    if (t < ucount)
+                    {
+                        int64_t pu = unz0 + t ;
+                        tinfo = spex_left_lu_copy_entry(U->x.mpz[pu],
+                            x->x.mpz[U->i[pu]]) ;
+                    }
+                    else
+                    {
+                        int64_t pl = lnz0 + t - ucount ;
+                        tinfo = spex_left_lu_copy_entry(L->x.mpz[pl],
+                            x->x.mpz[L->i[pl]]) ;
+                    }
+                }
+                if (tinfo != SPEX_OK)
+                {
+                    #pragma omp critical (SPEX_Left_LU_factorize)
+                    pinfo = tinfo ;
+                }
+                #ifdef _OPENMP
+                // free the GMP wrapper list of each worker thread
+                if (omp_get_thread_num ( ) != 0) spex_gmp_finalize ( ) ;
+                #endif
             }
+            SPEX_CHECK(pinfo);
         }
     }
 
@@ -0,0 +1,344 @@
+//------------------------------------------------------------------------------
+// SPEX_Left_LU/SPEX_Left_LU_modular_backslash: solve Ax=b by modular methods
+//------------------------------------------------------------------------------
+
+// SPEX_Left_LU: (c) 2019-2022, Chris Lourenco (US Naval Academy), Jinhao Chen,
+// Erick Moreno-Centeno, Timothy A. Davis, Texas A&M.  All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0-or-later or LGPL-3.0-or-later
+
+//------------------------------------------------------------------------------
+
+/* Purpose: This code exactly solves the linear system Ax = b with a
+ * multi-modular method, as an alternative to SPEX_Left_LU_backslash.  Instead
+ * of one factorization in growing integers, A is factorized modulo many
+ * word-sized primes, which only needs int64_t arithmetic:
+ *
+ *  (1) The column ordering is found with SPEX_LU_analyze.
+ *  (2) Ax = b is solved modulo a batch of primes, one prime per thread.
+ *  (3) The solutions are combined into x mod M with the Chinese remainder
+ *      theorem, where M is the product of the primes.
+ *  (4) After each batch, x is recovered from x mod M by rational
+ *      reconstruction, and the result is verified exactly.  If it is wrong,
+ *      more primes are used.  While M is too small, the reconstruction
+ *      usually fails at the first entry of x, so this step is cheap.
+ *
+ * Steps (2) to (4) end at the latest once M exceeds 2*H^2, where H bounds the
+ * numerators and denominators of x by Hadamard's inequality and Cramer's rule.
+ * The verification typically succeeds well before that.  If A is singular
+ * (modulo more primes than can divide a nonzero det(A)), or the reconstruction
+ * fails, SPEX_Left_LU_backslash is used instead, so the result and the error
+ * codes are the same as for SPEX_Left_LU_backslash.
+ *
+ * Input/Output arguments:
+ *
+ * X_handle:    A pointer to the solution of the linear system. The output is
+ *              allowed to be returned in either double precision, mpfr_t, or
+ *              rational mpq_t
+ *
+ * type:        Data structure of output desired. Must be either SPEX_MPQ,
+ *              SPEX_FP64, or SPEX_MPFR
+ *
+ * A:           User's input matrix. It must be populated prior to calling this
+ *              function.
+ *
+ * b:           Collection of right hand side vectors. Must be populated prior to
+ *              factorization.
+ *
+ * option:      Struct containing various command parameters. If NULL on
+ *              input, default values are used.  option->nthreads is the
+ *              number of primes handled at once.
+ */
+
+#define SPEX_FREE_WORK                  \
+    SPEX_LU_analysis_free (&S, NULL) ;  \
+    SPEX_FREE (plist) ;                 \
+    SPEX_FREE (R) ;                     \
+    SPEX_FREE (status) ;                \
+    SPEX_FREE (singular) ;              \
+    SPEX_matrix_free (&X, NULL) ;       \
+    SPEX_matrix_free (&N, NULL) ;       \
+    SPEX_matrix_free (&D, NULL) ;       \
+    SPEX_MPZ_CLEAR (M) ;                \
+    SPEX_MPZ_CLEAR (g) ;                \
+    SPEX_MPQ_CLEAR (scale) ;
+
+#define SPEX_FREE_ALL                   \
+    SPEX_FREE_WORK                      \
+    SPEX_matrix_free (&x, NULL) ;
+
+#include "spex_left_lu_internal.h"
+
+SPEX_info SPEX_Left_LU_modular_backslash
+(
+    // Output
+    SPEX_matrix **X_handle,       // Final solution vector
+    // Input
+    SPEX_type type,               // Type of output desired
+                                  // Must be SPEX_MPQ, SPEX_MPFR, or SPEX_FP64
+    const SPEX_matrix *A,         // Input matrix
+    const SPEX_matrix *b,         // Right hand side vector(s)
+    const SPEX_options* option    // Command options
+)
+{
+
+    //-------------------------------------------------------------------------
+    // check inputs
+    //-------------------------------------------------------------------------
+
+    SPEX_info info ;
+    if (!spex_initialized ( )) return (SPEX_PANIC) ;
+
+    if (X_handle == NULL)
+    {
+        return SPEX_INCORRECT_INPUT;
+    }
+    (*X_handle) = NULL;
+
+    if (type != SPEX_MPQ && type != SPEX_FP64 && type != SPEX_MPFR)
+    {
+        return SPEX_INCORRECT_INPUT;
+    }
+
+    SPEX_REQUIRE (A, SPEX_CSC,   SPEX_MPZ) ;
+    SPEX_REQUIRE (b, SPEX_DENSE, SPEX_MPZ) ;
+
+    if (A->n != A->m || A->m != b->m)
+    {
+        return SPEX_INCORRECT_INPUT;
+    }
+
+    SPEX_LU_analysis *S = NULL ;
+    uint64_t *plist = NULL ;
+    uint64_t *R = NULL ;
+    SPEX_info *status = NULL ;
+    bool *singular = NULL ;
+    SPEX_matrix *X = NULL ;
+    SPEX_matrix *N = NULL ;
+    SPEX_matrix *D = NULL ;
+    SPEX_matrix *x = NULL ;
+    mpz_t M, g ;
+    mpq_t scale ;
+    SPEX_MPZ_SET_NULL (M) ;
+    SPEX_MPZ_SET_NULL (g) ;
+    SPEX_MPQ_SET_NULL (scale) ;
+
+    int64_t i, j, n = A->n, nrhs = b->n, nx = n * nrhs ;
+
+    // number of threads to use (1 by default).  The solution is the same for
+    // any number of threads.
+    int nthreads = SPEX_OPTION_NTHREADS (option) ;
+    #ifdef _OPENMP
+    if (nthreads <= 0) nthreads = omp_get_max_threads ( ) ;
+    #else
+    nthreads = 1 ;
+    #endif
+    nthreads = SPEX_MAX (nthreads, 1) ;
+
+    //--------------------------------------------------------------------------
+    // Symbolic Analysis
+    //--------------------------------------------------------------------------
+
+    SPEX_CHECK (SPEX_LU_analyze (&S, A, option)) ;
+
+    //--------------------------------------------------------------------------
+    // bound the size of x
+    //--------------------------------------------------------------------------
+
+    // |det(A)| <= 2^hbits by Hadamard's inequality on the columns of A, and
+    // the numerators of x(:,j) = det(A_i)/det(A) (Cramer's rule, with A_i
+    // equal to A but with column i replaced by b(:,j)) are at most
+    // 2^(hbits+bbits), since each nonzero column of A has norm at least 1.
+    // Reconstruction of x is then guaranteed once M >= 2^need.
+    double hbits = 0, bbits = 0 ;
+    size_t size ;
+    for (j = 0 ; j < n ; j++)
+    {
+        int64_t cnz = A->p[j+1] - A->p[j], maxbits = 0 ;
+        for (int64_t p = A->p[j] ; p < A->p[j+1] ; p++)
+        {
+            SPEX_CHECK (SPEX_mpz_sizeinbase (&size, A->x.mpz[p], 2)) ;
+            maxbits = SPEX_MAX (maxbits, (int64_t) size) ;
+        }
+        if (cnz > 0) hbits += maxbits + 0.5 * log2 ((double) cnz) ;
+    }
+    for (i = 0 ; i < nx ; i++)
+    {
+        SPEX_CHECK (SPEX_mpz_sizeinbase (&size, b->x.mpz[i], 2)) ;
+        bbits = SPEX_MAX (bbits, (double) size) ;
+    }
+    bbits += 0.5 * log2 ((double) SPEX_MAX (n, 1)) ;
+    int64_t need = (int64_t) ceil (2 * (hbits + bbits)) + 4 ;
+
+    // At most max_bad primes of at least 2^(SPEX_LEFT_LU_PRIME_BITS-1) can
+    // divide a nonzero det(A).
+    int64_t max_bad = (int64_t) (hbits / (SPEX_LEFT_LU_PRIME_BITS - 1)) ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    int64_t batch = (int64_t) nthreads * SPEX_LEFT_LU_CRT_BATCH ;
+    plist = (uint64_t *) SPEX_malloc (batch * sizeof (uint64_t)) ;
+    R = (uint64_t *) SPEX_malloc (batch * SPEX_MAX (nx, 1) *
+        sizeof (uint64_t)) ;
+    status = (SPEX_info *) SPEX_malloc (batch * sizeof (SPEX_info)) ;
+    singular = (bool *) SPEX_malloc (batch * sizeof (bool)) ;
+    if (!plist || !R || !status || !singular)
+    {
+        SPEX_FREE_ALL ;
+        return SPEX_OUT_OF_MEMORY ;
+    }
+
+    // X = x mod M, with M = 1
+    SPEX_CHECK (SPEX_matrix_allocate (&X, SPEX_DENSE, SPEX_MPZ, n, nrhs, nx,
+        false, true, option)) ;
+    SPEX_CHECK (SPEX_matrix_allocate (&N, SPEX_DENSE, SPEX_MPZ, n, nrhs, nx,
+        false, true, option)) ;
+    SPEX_CHECK (SPEX_matrix_allocate (&D, SPEX_DENSE, SPEX_MPZ, nrhs, 1, nrhs,
+        false, true, option)) ;
+    SPEX_CHECK (SPEX_mpz_init (M)) ;
+    SPEX_CHECK (SPEX_mpz_init (g)) ;
+    SPEX_CHECK (SPEX_mpz_set_ui (M, 1)) ;
+
+    //--------------------------------------------------------------------------
+    // solve Ax=b modulo batches of primes until x is found
+    //--------------------------------------------------------------------------
+
+    uint64_t prime = ((uint64_t) 1) << SPEX_LEFT_LU_PRIME_BITS ;
+    int64_t ngood = 0, nbad = 0 ;
+    bool found = false ;
+
+    while (!found)
+    {
+        // the next batch of primes, in decreasing order
+        for (int64_t t = 0 ; t < batch ; t++)
+        {
+            prime = spex_left_lu_prev_prime (prime) ;
+            plist [t] = prime ;
+        }
+
+        // solve Ax=b modulo each prime of the batch, in parallel
+        int64_t t ;
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+        for (t = 0 ; t < batch ; t++)
+        {
+            status [t] = spex_left_lu_mod_solve (R + t*nx, &singular [t],
+                A, b, (const int64_t *) S->q, plist [t]) ;
+        }
+
+        // add the solutions to X, skipping primes that divide det(A)
+        for (t = 0 ; t < batch ; t++)
+        {
+            SPEX_CHECK (status [t]) ;
+            if (singular [t])
+            {
+                nbad++ ;
+            }
+            else
+            {
+                SPEX_CHECK (spex_left_lu_crt_update (X, M, R + t*nx,
+                    plist [t])) ;
+                ngood++ ;
+            }
+        }
+
+        // A is singular, or very likely so if no prime has worked yet
+        if (nbad > max_bad || ngood == 0)
+        {
+            break ;
+        }
+
+        // try to reconstruct x; this must succeed once M is large enough
+        SPEX_CHECK (spex_left_lu_crt_reconstruct (N, D, &found, X, M)) ;
+        if (found)
+        {
+            SPEX_CHECK (spex_left_lu_crt_verify (&found, A, N, D, b, option)) ;
+        }
+        SPEX_CHECK (SPEX_mpz_sizeinbase (&size, M, 2)) ;
+        if (!found && (int64_t) size >= need)
+        {
+            break ;
+        }
+    }
+
+    if (!found)
+    {
+        // A is singular, or x could not be reconstructed: use the REF LU
+        // factorization, which also reports the singular case
+        SPEX_FREE_WORK ;
+        return (SPEX_Left_LU_backslash (X_handle, type, A, b, option)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // x = N/D in lowest terms
+    //--------------------------------------------------------------------------
+
+    SPEX_CHECK (SPEX_matrix_allocate (&x, SPEX_DENSE, SPEX_MPQ, n, nrhs, nx,
+        false, true, option)) ;
+    for (j = 0 ; j < nrhs ; j++)
+    {
+        for (i = 0 ; i < n ; i++)
+        {
+            mpz_t *Nij = &SPEX_2D (N, i, j, mpz) ;
+            SPEX_CHECK (SPEX_mpz_gcd (g, *Nij, D->x.mpz[j])) ;
+            SPEX_CHECK (SPEX_mpz_divexact (*Nij, *Nij, g)) ;
+            SPEX_CHECK (SPEX_mpq_set_num (SPEX_2D (x, i, j, mpq), *Nij)) ;
+            SPEX_CHECK (SPEX_mpz_divexact (g, D->x.mpz[j], g)) ;
+            SPEX_CHECK (SPEX_mpq_set_den (SPEX_2D (x, i, j, mpq), g)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // Check the solution if desired (debugging only)
+    //--------------------------------------------------------------------------
+
+    bool check = SPEX_OPTION_CHECK (option) ;
+    if (check)
+    {
+        SPEX_CHECK (SPEX_check_solution (A, x, b, option)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // Scale the solution if necessary.
+    //--------------------------------------------------------------------------
+
+    SPEX_CHECK(SPEX_mpq_init(scale));
+
+    // set the scaling factor scale = A->scale / b->scale
+    SPEX_CHECK( SPEX_mpq_div(scale, A->scale, b->scale));
+
+    // Determine if the scaling factor is 1
+    int r;
+    SPEX_CHECK(SPEX_mpq_cmp_ui(&r, scale, 1, 1));
+    if (r != 0 )
+    {
+        for (i = 0; i < nx; i++)
+        {
+            SPEX_CHECK(SPEX_mpq_mul(x->x.mpq[i], x->x.mpq[i], scale));
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // Now, x contains the exact solution of the linear system in mpq_t
+    // precision set the output.
+    //--------------------------------------------------------------------------
+
+    if (type == SPEX_MPQ)
+    {
+        (*X_handle) = x ;
+    }
+    else
+    {
+        SPEX_matrix* x2 = NULL ;
+        SPEX_CHECK (SPEX_matrix_copy (&x2, SPEX_DENSE, type, x, option)) ;
+        (*X_handle) = x2 ;
+        SPEX_matrix_free (&x, NULL) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // Free memory
+    //--------------------------------------------------------------------------
+
+    SPEX_FREE_WORK ;
+    return (SPEX_OK) ;
+}
@@ -0,0 +1,116 @@
+//------------------------------------------------------------------------------
+// SPEX_Left_LU/spex_left_lu_crt_reconstruct: rational solution from residues
+//------------------------------------------------------------------------------
+
+// SPEX_Left_LU: (c) 2019-2022, Chris Lourenco (US Naval Academy), Jinhao Chen,
+// Erick Moreno-Centeno, Timothy A. Davis, Texas A&M.  All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0-or-later or LGPL-3.0-or-later
+
+//------------------------------------------------------------------------------
+
+/* Purpose: Given X = x mod M, this function finds a candidate rational
+ * solution x(:,j) = N(:,j) / D[j] with a common denominator for each column.
+ *
+ * The entries of a column share most of their denominator (all of them divide
+ * det(A)), so each entry is first tried with the denominator found so far:
+ * if v = D*X mod M is small (in the symmetric range), then x = v/D and no
+ * reconstruction is needed.  Otherwise, v is reconstructed as a/c, D is
+ * multiplied by c, and the earlier numerators of the column are rescaled.
+ *
+ * On output, ok is false if some entry or denominator cannot be reconstructed
+ * with M, in which case more primes are needed.  If ok is true, the candidate
+ * must still be verified.
+ */
+
+#define SPEX_FREE_ALL               \
+    SPEX_MPZ_CLEAR (v) ;            \
+    SPEX_MPZ_CLEAR (a) ;            \
+    SPEX_MPZ_CLEAR (c) ;
+
+#include "spex_left_lu_internal.h"
+
+SPEX_info spex_left_lu_crt_reconstruct
+(
+    SPEX_matrix *N,           // dense mpz_t matrix of numerators
+    SPEX_matrix *D,           // dense mpz_t vector of denominators
+    bool *ok,                 // true if N and D were found
+    const SPEX_matrix *X,     // dense mpz_t matrix, X = x mod M
+    const mpz_t M             // modulus
+)
+{
+    SPEX_info info ;
+    mpz_t v, a, c ;
+    SPEX_MPZ_SET_NULL (v) ;
+    SPEX_MPZ_SET_NULL (a) ;
+    SPEX_MPZ_SET_NULL (c) ;
+    (*ok) = false ;
+
+    SPEX_CHECK (SPEX_mpz_init (v)) ;
+    SPEX_CHECK (SPEX_mpz_init (a)) ;
+    SPEX_CHECK (SPEX_mpz_init (c)) ;
+
+    // numerators and denominators are bounded by 2^e <= sqrt (M/2)
+    size_t bits ;
+    SPEX_CHECK (SPEX_mpz_sizeinbase (&bits, M, 2)) ;
+    int64_t e = ((int64_t) bits - 2) / 2 ;
+
+    int64_t n = X->m ;
+    for (int64_t j = 0 ; j < X->n ; j++)
+    {
+        mpz_t *Dj = &(D->x.mpz[j]) ;
+        SPEX_CHECK (SPEX_mpz_set_ui (*Dj, 1)) ;
+        for (int64_t i = 0 ; i < n ; i++)
+        {
+            mpz_t *Nij = &SPEX_2D (N, i, j, mpz) ;
+
+            // v = D*X(i,j) mod M
+            SPEX_CHECK (SPEX_mpz_mul (v, SPEX_2D (X, i, j, mpz), *Dj)) ;
+            SPEX_CHECK (SPEX_mpz_fdiv_r (v, v, M)) ;
+            SPEX_CHECK (SPEX_mpz_sizeinbase (&bits, v, 2)) ;
+            if ((int64_t) bits <= e)
+            {
+                // x(i,j) = v/D, with v >= 0
+                SPEX_CHECK (SPEX_mpz_set (*Nij, v)) ;
+                continue ;
+            }
+
+            // a = v - M
+            SPEX_CHECK (SPEX_mpz_set_ui (c, 1)) ;
+            SPEX_CHECK (SPEX_mpz_set (a, v)) ;
+            SPEX_CHECK (SPEX_mpz_submul (a, M, c)) ;
+            SPEX_CHECK (SPEX_mpz_sizeinbase (&bits, a, 2)) ;
+            if ((int64_t) bits <= e)
+            {
+                // x(i,j) = (v-M)/D, with v-M < 0
+                SPEX_CHECK (SPEX_mpz_set (*Nij, a)) ;
+                continue ;
+            }
+
+            // v = a/c mod M, so x(i,j) = a/(c*D)
+            bool found ;
+            SPEX_CHECK (spex_left_lu_rat_reconstruct (a, c, &found, v, M, e)) ;
+            if (!found)
+            {
+                SPEX_FREE_ALL ;
+                return (SPEX_OK) ;
+            }
+            SPEX_CHECK (SPEX_mpz_set (*Nij, a)) ;
+            SPEX_CHECK (SPEX_mpz_mul (*Dj, *Dj, c)) ;
+            for (int64_t k = 0 ; k < i ; k++)
+            {
+                SPEX_CHECK (SPEX_mpz_mul (SPEX_2D (N, k, j, mpz),
+                    SPEX_2D (N, k, j, mpz), c)) ;
+            }
+            SPEX_CHECK (SPEX_mpz_sizeinbase (&bits, *Dj, 2)) ;
+            if ((int64_t) bits > e)
+            {
+                SPEX_FREE_ALL ;
+                return (SPEX_OK) ;
+            }
+        }
+    }
+
+    (*ok) = true ;
+    SPEX_FREE_ALL ;
+    return (SPEX_OK) ;
+}
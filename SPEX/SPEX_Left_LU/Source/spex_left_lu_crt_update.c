@@ -0,0 +1,61 @@
+//------------------------------------------------------------------------------
+// SPEX_Left_LU/spex_left_lu_crt_update: add a residue to a CRT reconstruction
+//------------------------------------------------------------------------------
+
+// SPEX_Left_LU: (c) 2019-2022, Chris Lourenco (US Naval Academy), Jinhao Chen,
+// Erick Moreno-Centeno, Timothy A. Davis, Texas A&M.  All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0-or-later or LGPL-3.0-or-later
+
+//------------------------------------------------------------------------------
+
+/* Purpose: Given X = x mod M with 0 <= X < M, and r = x mod p for a prime p
+ * that does not divide M, this function computes X = x mod M*p with
+ * 0 <= X < M*p, and sets M = M*p.  This is one step of Garner's algorithm for
+ * the Chinese remainder theorem: X = X + M * ((r - X) / M mod p).
+ */
+
+#define SPEX_FREE_ALL               \
+    SPEX_MPZ_CLEAR (t) ;
+
+#include "spex_left_lu_internal.h"
+
+SPEX_info spex_left_lu_crt_update
+(
+    SPEX_matrix *X,           // dense mpz_t matrix of residues modulo M
+    mpz_t M,                  // modulus, M*p on output
+    const uint64_t *r,        // residues modulo p, of size X->m * X->n
+    uint64_t p                // prime modulus
+)
+{
+    SPEX_info info ;
+    mpz_t t ;
+    SPEX_MPZ_SET_NULL (t) ;
+    SPEX_CHECK (SPEX_mpz_init (t)) ;
+
+    // minv = 1/M mod p
+    uint64_t base = spex_left_lu_powmod (2 % p, GMP_NUMB_BITS, p) ;
+    uint64_t minv = spex_left_lu_invmod (spex_left_lu_mpz_mod (M, base, p),
+        p) ;
+
+    int64_t nz = X->m * X->n ;
+    for (int64_t e = 0 ; e < nz ; e++)
+    {
+        // h = (r - X) / M mod p
+        uint64_t u = spex_left_lu_mpz_mod (X->x.mpz[e], base, p) ;
+        uint64_t h = (r [e] >= u) ? (r [e] - u) : (r [e] + (p - u)) ;
+        h = spex_left_lu_mulmod (h, minv, p) ;
+        if (h != 0)
+        {
+            // X = X + M*h
+            SPEX_CHECK (SPEX_mpz_set_ui (t, h)) ;
+            SPEX_CHECK (SPEX_mpz_addmul (X->x.mpz[e], M, t)) ;
+        }
+    }
+
+    // M = M*p
+    SPEX_CHECK (SPEX_mpz_set_ui (t, p)) ;
+    SPEX_CHECK (SPEX_mpz_mul (M, M, t)) ;
+
+    SPEX_FREE_ALL ;
+    return (SPEX_OK) ;
+}
@@ -0,0 +1,82 @@
+//------------------------------------------------------------------------------
+// SPEX_Left_LU/spex_left_lu_crt_verify: check a candidate solution of Ax=b
+//------------------------------------------------------------------------------
+
+// SPEX_Left_LU: (c) 2019-2022, Chris Lourenco (US Naval Academy), Jinhao Chen,
+// Erick Moreno-Centeno, Timothy A. Davis, Texas A&M.  All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0-or-later or LGPL-3.0-or-later
+
+//------------------------------------------------------------------------------
+
+/* Purpose: This function checks if x(:,j) = N(:,j) / D[j] solves Ax = b,
+ * by checking A*N(:,j) == D[j]*b(:,j) in integer arithmetic.  Unlike
+ * SPEX_check_solution, a wrong x is an expected outcome here (the
+ * reconstruction in SPEX_Left_LU_modular_backslash may be tried with too few
+ * primes), so it is reported in ok rather than as an error.
+ */
+
+#define SPEX_FREE_ALL               \
+    SPEX_matrix_free (&r, NULL) ;   \
+    SPEX_MPZ_CLEAR (t) ;
+
+#include "spex_left_lu_internal.h"
+
+SPEX_info spex_left_lu_crt_verify
+(
+    bool *ok,                 // true if A*N == b*diag(D)
+    const SPEX_matrix *A,     // input matrix
+    const SPEX_matrix *N,     // dense mpz_t matrix of numerators
+    const SPEX_matrix *D,     // dense mpz_t vector of denominators
+    const SPEX_matrix *b,     // right hand side vectors
+    const SPEX_options *option
+)
+{
+    SPEX_info info ;
+    SPEX_matrix *r = NULL ;
+    mpz_t t ;
+    SPEX_MPZ_SET_NULL (t) ;
+    (*ok) = false ;
+
+    int64_t n = A->n ;
+    SPEX_CHECK (SPEX_mpz_init (t)) ;
+    SPEX_CHECK (SPEX_matrix_allocate (&r, SPEX_DENSE, SPEX_MPZ, n, 1, n,
+        false, true, option)) ;
+
+    for (int64_t j = 0 ; j < b->n ; j++)
+    {
+        // r = A*N(:,j)
+        for (int64_t i = 0 ; i < n ; i++)
+        {
+            SPEX_CHECK (SPEX_mpz_set_ui (r->x.mpz[i], 0)) ;
+        }
+        for (int64_t k = 0 ; k < n ; k++)
+        {
+            int sgn ;
+            SPEX_CHECK (SPEX_mpz_sgn (&sgn, SPEX_2D (N, k, j, mpz))) ;
+            if (sgn == 0) continue ;
+            for (int64_t p = A->p[k] ; p < A->p[k+1] ; p++)
+            {
+                SPEX_CHECK (SPEX_mpz_addmul (r->x.mpz[A->i[p]], A->x.mpz[p],
+                    SPEX_2D (N, k, j, mpz))) ;
+            }
+        }
+
+        // compare r with D[j]*b(:,j)
+        for (int64_t i = 0 ; i < n ; i++)
+        {
+            int cmp ;
+            SPEX_CHECK (SPEX_mpz_mul (t, SPEX_2D (b, i, j, mpz),
+                D->x.mpz[j])) ;
+            SPEX_CHECK (SPEX_mpz_cmp (&cmp, r->x.mpz[i], t)) ;
+            if (cmp != 0)
+            {
+                SPEX_FREE_ALL ;
+                return (SPEX_OK) ;
+            }
+        }
+    }
+
+    (*ok) = true ;
+    SPEX_FREE_ALL ;
+    return (SPEX_OK) ;
+}
@@ -17,6 +17,177 @@
 
 #include "spex_util_internal.h"
 #include "SPEX.h"
+#include <limits.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// ============================================================================
+//                       Word-sized integer fast path
+// ============================================================================
+
+// The REF triangular solve keeps each entry of the workspace x as an int64_t
+// in the array xw for as long as it fits, and only uses the mpz_t x->x.mpz[i]
+// once an operation on it would overflow.  Such entries are flagged with
+// xw[i] = SPEX_LEFT_LU_BIG.  Small values are bounded by SPEX_LEFT_LU_SMALL_MAX
+// in magnitude, so INT64_MIN never occurs as a small value and the quotient
+// of two small values cannot overflow.
+
+#define SPEX_LEFT_LU_BIG INT64_MIN
+
+#if LONG_MAX < INT64_MAX
+// SPEX_mpz_set_si passes its int64_t to GMP as a long
+#define SPEX_LEFT_LU_SMALL_MAX ((int64_t) LONG_MAX)
+#else
+#define SPEX_LEFT_LU_SMALL_MAX INT64_MAX
+#endif
+
+// get an mpz_t as a small int64_t; return false if it does not fit.  This
+// only reads the mpz_t, so it does not need the SPEX_mpz_* wrappers.
+static inline bool spex_left_lu_get_small (int64_t *y, const mpz_t x)
+{
+    size_t size = mpz_size (x) ;
+    if (size == 0)
+    {
+        (*y) = 0 ;
+        return (true) ;
+    }
+    if (size > 1)
+    {
+        return (false) ;
+    }
+    uint64_t a = (uint64_t) mpz_getlimbn (x, 0) ;
+    if (a > (uint64_t) SPEX_LEFT_LU_SMALL_MAX)
+    {
+        return (false) ;
+    }
+    (*y) = (mpz_sgn (x) < 0) ? -((int64_t) a) : ((int64_t) a) ;
+    return (true) ;
+}
+
+// The IPGE updates of x by a column of L are split across threads only if
+// each thread gets at least this many entries of L.  The threshold is much
+// higher if x[j] is small, since then most updates are cheap int64_t ones.
+#ifndef SPEX_LEFT_LU_PAR_BIG
+#define SPEX_LEFT_LU_PAR_BIG   32
+#endif
+#ifndef SPEX_LEFT_LU_PAR_SMALL
+#define SPEX_LEFT_LU_PAR_SMALL 4096
+#endif
+
+// c = a*b for small a and b; return false if c is not small
+static inline bool spex_left_lu_mul_small (int64_t *c, int64_t a, int64_t b)
+{
+    #if defined (__GNUC__)
+    if (__builtin_mul_overflow (a, b, c))
+    {
+        return (false) ;
+    }
+    #else
+    uint64_t ua = (a < 0) ? -((uint64_t) a) : ((uint64_t) a) ;
+    uint64_t ub = (b < 0) ? -((uint64_t) b) : ((uint64_t) b) ;
+    if (ua != 0 && ub > ((uint64_t) SPEX_LEFT_LU_SMALL_MAX) / ua)
+    {
+        return (false) ;
+    }
+    (*c) = a * b ;
+    #endif
+    return ((*c) >= -SPEX_LEFT_LU_SMALL_MAX && (*c) <= SPEX_LEFT_LU_SMALL_MAX) ;
+}
+
+// c = a-b for small a and b; return false if c is not small
+static inline bool spex_left_lu_sub_small (int64_t *c, int64_t a, int64_t b)
+{
+    if ((b > 0 && a < b - SPEX_LEFT_LU_SMALL_MAX) ||
+        (b < 0 && a > b + SPEX_LEFT_LU_SMALL_MAX))
+    {
+        return (false) ;
+    }
+    (*c) = a - b ;
+    return (true) ;
+}
+
+// ============================================================================
+//                           Multi-modular solver
+// ============================================================================
+
+// SPEX_Left_LU_modular_backslash solves Ax=b modulo primes just below
+// 2^SPEX_LEFT_LU_PRIME_BITS.  Residues are passed to SPEX_mpz_set_ui, which
+// takes an unsigned long, so the primes are smaller if long is 32 bits.
+#if LONG_MAX < INT64_MAX
+#define SPEX_LEFT_LU_PRIME_BITS 30
+#else
+#define SPEX_LEFT_LU_PRIME_BITS 62
+#endif
+
+// number of primes handled per thread between two attempts to reconstruct x
+#ifndef SPEX_LEFT_LU_CRT_BATCH
+#define SPEX_LEFT_LU_CRT_BATCH 2
+#endif
+
+// c = a*b mod p, for a,b < p < 2^63
+static inline uint64_t spex_left_lu_mulmod (uint64_t a, uint64_t b, uint64_t p)
+{
+    #if defined (__SIZEOF_INT128__)
+    return ((uint64_t) (((unsigned __int128) a * b) % p)) ;
+    #else
+    if (p <= UINT32_MAX)
+    {
+        return ((a * b) % p) ;
+    }
+    uint64_t c = 0 ;
+    while (b > 0)
+    {
+        if (b & 1)
+        {
+            c += a ;
+            if (c >= p) c -= p ;
+        }
+        a += a ;
+        if (a >= p) a -= p ;
+        b >>= 1 ;
+    }
+    return (c) ;
+    #endif
+}
+
+// c = a^e mod p, for a < p
+static inline uint64_t spex_left_lu_powmod (uint64_t a, uint64_t e, uint64_t p)
+{
+    uint64_t c = 1 % p ;
+    while (e > 0)
+    {
+        if (e & 1) c = spex_left_lu_mulmod (c, a, p) ;
+        a = spex_left_lu_mulmod (a, a, p) ;
+        e >>= 1 ;
+    }
+    return (c) ;
+}
+
+// inverse of a modulo the prime p, for 0 < a < p
+static inline uint64_t spex_left_lu_invmod (uint64_t a, uint64_t p)
+{
+    return (spex_left_lu_powmod (a, p-2, p)) ;
+}
+
+// x mod p, where base = 2^GMP_NUMB_BITS mod p.  Like spex_left_lu_get_small,
+// this only reads the limbs of x, so it is safe to use in parallel regions.
+static inline uint64_t spex_left_lu_mpz_mod
+(
+    const mpz_t x,
+    uint64_t base,
+    uint64_t p
+)
+{
+    uint64_t r = 0 ;
+    for (int64_t k = (int64_t) mpz_size (x) - 1 ; k >= 0 ; k--)
+    {
+        r = spex_left_lu_mulmod (r, base, p)
+          + ((uint64_t) mpz_getlimbn (x, k)) % p ;
+        if (r >= p) r -= p ;
+    }
+    return ((mpz_sgn (x) < 0 && r != 0) ? (p - r) : r) ;
+}
 
 // ============================================================================
 //                           Internal Functions
@@ -178,7 +349,9 @@ void spex_left_lu_reach    // compute the reach of column k of A on the graph of
  * operations on the nonzeros to obtain their final value. All operations are
  * gauranteed to be integral. There are various enhancements in this code used
  * to reduce the overall cost of the operations and minimize operations as much
- * as possible.
+ * as possible.  Entries of x are kept in the int64_t workspace xw while they
+ * fit, and in mpz_t only once they overflow.  If nthreads > 1, the updates of
+ * x by a long column of L are done in parallel.
  */
 SPEX_info spex_left_lu_ref_triangular_solve // performs the sparse REF triangular solve
 (
@@ -192,8 +365,85 @@ SPEX_info spex_left_lu_ref_triangular_solve // performs the sparse REF triangula
     const int64_t* pinv,      // inverse row permutation
     const int64_t* row_perm,  // row permutation
     int64_t* h,               // history vector
-    SPEX_matrix* x            // solution of system ==> kth column of L and U
+    SPEX_matrix* x,           // solution of system ==> kth column of L and U
+    int64_t* xw,              // int64_t workspace for small entries of x
+    int nthreads              // max number of threads to use
 );
 
+/* Purpose: return the largest prime smaller than p, for 2 < p < 2^63, or
+ * zero if there is none.
+ */
+uint64_t spex_left_lu_prev_prime
+(
+    uint64_t p
+) ;
+
+/* Purpose: This function solves Ax = b modulo the prime p with a left-looking
+ * LU factorization of A(:,q) over the integers modulo p.  The pivot in each
+ * column is the diagonal entry if it is nonzero modulo p, and otherwise the
+ * first nonzero entry.  On output, x(:,j) = A\b(:,j) modulo p in natural
+ * order, unless A is singular modulo p.  Only SPEX_malloc is used, so this
+ * function can be called by several threads at once.
+ */
+SPEX_info spex_left_lu_mod_solve
+(
+    uint64_t *x,              // size n*b->n, solution modulo p
+    bool *singular,           // true if A is singular modulo p
+    const SPEX_matrix *A,     // input matrix
+    const SPEX_matrix *b,     // right hand side vectors
+    const int64_t *q,         // column permutation
+    uint64_t p                // prime modulus, p < 2^63
+) ;
+
+/* Purpose: This function finds a and d with a = d*u mod m, |a| < 2^e,
+ * 0 < d < 2^e and gcd (a,d) = 1, by rational reconstruction.  Such a and d
+ * are unique if 2^(2e+1) <= m.  On output, ok is false if they do not exist.
+ */
+SPEX_info spex_left_lu_rat_reconstruct
+(
+    mpz_t a,                  // numerator
+    mpz_t d,                  // denominator
+    bool *ok,                 // true if a/d was found
+    const mpz_t u,            // residue, 0 <= u < m
+    const mpz_t m,            // modulus
+    int64_t e                 // bound on the bits of a and d
+) ;
+
+/* Purpose: This function adds the residues r = x mod p to X = x mod M, so
+ * that X = x mod M*p on output, and sets M = M*p (Garner's algorithm).
+ */
+SPEX_info spex_left_lu_crt_update
+(
+    SPEX_matrix *X,           // dense mpz_t matrix of residues modulo M
+    mpz_t M,                  // modulus, M*p on output
+    const uint64_t *r,        // residues modulo p, of size X->m * X->n
+    uint64_t p                // prime modulus
+) ;
+
+/* Purpose: This function finds a candidate solution x(:,j) = N(:,j) / D[j]
+ * from X = x mod M by rational reconstruction.  ok is false if M is too small.
+ */
+SPEX_info spex_left_lu_crt_reconstruct
+(
+    SPEX_matrix *N,           // dense mpz_t matrix of numerators
+    SPEX_matrix *D,           // dense mpz_t vector of denominators
+    bool *ok,                 // true if N and D were found
+    const SPEX_matrix *X,     // dense mpz_t matrix, X = x mod M
+    const mpz_t M             // modulus
+) ;
+
+/* Purpose: This function checks if x(:,j) = N(:,j) / D[j] solves Ax = b
+ * exactly, and returns the result in ok.
+ */
+SPEX_info spex_left_lu_crt_verify
+(
+    bool *ok,                 // true if A*N == b*diag(D)
+    const SPEX_matrix *A,     // input matrix
+    const SPEX_matrix *N,     // dense mpz_t matrix of numerators
+    const SPEX_matrix *D,     // dense mpz_t vector of denominators
+    const SPEX_matrix *b,     // right hand side vectors
+    const SPEX_options *option
+) ;
+
 #endif
 
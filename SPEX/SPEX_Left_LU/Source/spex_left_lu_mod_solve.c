@@ -0,0 +1,378 @@
+//------------------------------------------------------------------------------
+// SPEX_Left_LU/spex_left_lu_mod_solve: solve Ax=b modulo a prime
+//------------------------------------------------------------------------------
+
+// SPEX_Left_LU: (c) 2019-2022, Chris Lourenco (US Naval Academy), Jinhao Chen,
+// Erick Moreno-Centeno, Timothy A. Davis, Texas A&M.  All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0-or-later or LGPL-3.0-or-later
+
+//------------------------------------------------------------------------------
+
+/* Purpose: This function solves Ax = b modulo the prime p, for use by
+ * SPEX_Left_LU_modular_backslash.  It computes the factorization
+ * P*A(:,q) = L*U modulo p with a left-looking (Gilbert-Peierls) algorithm,
+ * where L has a unit diagonal, and then solves L*U*x(q) = P*b modulo p.
+ *
+ * The structure follows SPEX_Left_LU_factorize: the nonzero pattern of each
+ * column is the reach of A(:,q[k]) in the graph of L, and the column is
+ * computed by a sparse triangular solve.  Since every entry is a single word
+ * modulo p, no history vector or IPGE division is needed.  L is kept with its
+ * original row indices, and pinv[i] is -1 until row i becomes pivotal.
+ *
+ * Only SPEX_malloc, SPEX_realloc and SPEX_free are used, and A and b are only
+ * read, so several threads may call this function at once with different p.
+ *
+ * If A is singular modulo p, singular is returned as true and x is not
+ * defined.  This happens for every p if A is singular, and otherwise only if
+ * p divides the determinant of A.
+ */
+
+#define SPEX_FREE_ALL               \
+    SPEX_FREE (Ax) ;                \
+    SPEX_FREE (Lp) ;                \
+    SPEX_FREE (Li) ;                \
+    SPEX_FREE (Lx) ;                \
+    SPEX_FREE (Up) ;                \
+    SPEX_FREE (Ui) ;                \
+    SPEX_FREE (Ux) ;                \
+    SPEX_FREE (Udinv) ;             \
+    SPEX_FREE (pinv) ;              \
+    SPEX_FREE (prow) ;              \
+    SPEX_FREE (mark) ;              \
+    SPEX_FREE (xi) ;                \
+    SPEX_FREE (pstack) ;            \
+    SPEX_FREE (w) ;                 \
+    SPEX_FREE (y) ;
+
+#include "spex_left_lu_internal.h"
+
+// Products modulo p in the factorization and solve.  With 128-bit integers,
+// the entries of L and U and the inverses of the pivots are kept scaled by
+// 2^64 mod p (Montgomery form), so that multiplying one of them by an unscaled
+// value is a single Montgomery reduction with an unscaled result, and needs no
+// division.  Otherwise, nothing is scaled and spex_left_lu_mulmod is used.
+typedef struct
+{
+    uint64_t p ;        // prime modulus
+    uint64_t pneg ;     // -1/p mod 2^64
+    uint64_t r2 ;       // 2^128 mod p
+} spex_left_lu_mod_t ;
+
+// a*b/2^64 mod p if 128-bit integers are available, or a*b mod p otherwise
+static inline uint64_t spex_left_lu_mod_mul
+(
+    uint64_t a,
+    uint64_t b,
+    const spex_left_lu_mod_t *m
+)
+{
+    #if defined (__SIZEOF_INT128__)
+    unsigned __int128 t = (unsigned __int128) a * b ;
+    uint64_t u = ((uint64_t) t) * m->pneg ;
+    uint64_t r = (uint64_t) ((t + (unsigned __int128) u * m->p) >> 64) ;
+    return ((r >= m->p) ? (r - m->p) : r) ;
+    #else
+    return (spex_left_lu_mulmod (a, b, m->p)) ;
+    #endif
+}
+
+// a scaled for spex_left_lu_mod_mul
+static inline uint64_t spex_left_lu_mod_scale
+(
+    uint64_t a,
+    const spex_left_lu_mod_t *m
+)
+{
+    #if defined (__SIZEOF_INT128__)
+    return (spex_left_lu_mod_mul (a, m->r2, m)) ;
+    #else
+    return (a) ;
+    #endif
+}
+
+// xi [top..n-1] = Reach (A(:,j)) in the graph of L, in topological order.
+// mark [i] == k if row i has been visited for column k.
+static void spex_left_lu_mod_reach
+(
+    int64_t *top_output,
+    const SPEX_matrix *A,
+    int64_t j,
+    int64_t k,
+    const int64_t *Lp,
+    const int64_t *Li,
+    const int64_t *pinv,
+    int64_t *mark,
+    int64_t *xi,
+    int64_t *pstack
+)
+{
+    int64_t n = A->n, top = n ;
+    for (int64_t pa = A->p[j] ; pa < A->p[j+1] ; pa++)
+    {
+        int64_t i = A->i[pa] ;
+        if (mark [i] == k) continue ;
+
+        // nonrecursive depth-first search from row i, using xi [0..head] as
+        // the recursion stack, as in spex_left_lu_dfs
+        int64_t head = 0 ;
+        xi [0] = i ;
+        while (head >= 0)
+        {
+            int64_t r = xi [head] ;
+            int64_t c = pinv [r] ;
+            if (mark [r] != k)
+            {
+                mark [r] = k ;
+                pstack [head] = (c < 0) ? 0 : Lp [c] ;
+            }
+            bool done = true ;
+            int64_t p2 = (c < 0) ? 0 : Lp [c+1] ;
+            for (int64_t p = pstack [head] ; p < p2 ; p++)
+            {
+                int64_t r2 = Li [p] ;
+                if (mark [r2] == k) continue ;
+                pstack [head] = p ;
+                xi [++head] = r2 ;
+                done = false ;
+                break ;
+            }
+            if (done)
+            {
+                head-- ;
+                xi [--top] = r ;
+            }
+        }
+    }
+    (*top_output) = top ;
+}
+
+SPEX_info spex_left_lu_mod_solve
+(
+    uint64_t *x,              // size n*b->n, solution modulo p
+    bool *singular,           // true if A is singular modulo p
+    const SPEX_matrix *A,     // input matrix
+    const SPEX_matrix *b,     // right hand side vectors
+    const int64_t *q,         // column permutation
+    uint64_t p                // prime modulus, p < 2^63
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    // inputs have been checked in SPEX_Left_LU_modular_backslash
+    ASSERT_KIND (A, SPEX_CSC) ;
+    ASSERT_KIND (b, SPEX_DENSE) ;
+
+    int64_t n = A->n, anz = A->p[n], nrhs = b->n ;
+    (*singular) = false ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    int64_t lnz = 0, unz = 0, lmax = anz + n, umax = anz + n ;
+    uint64_t *Ax = (uint64_t *) SPEX_malloc (SPEX_MAX (anz, 1) *
+        sizeof (uint64_t)) ;
+    int64_t  *Lp = (int64_t  *) SPEX_malloc ((n+1) * sizeof (int64_t)) ;
+    int64_t  *Li = (int64_t  *) SPEX_malloc (lmax * sizeof (int64_t)) ;
+    uint64_t *Lx = (uint64_t *) SPEX_malloc (lmax * sizeof (uint64_t)) ;
+    int64_t  *Up = (int64_t  *) SPEX_malloc ((n+1) * sizeof (int64_t)) ;
+    int64_t  *Ui = (int64_t  *) SPEX_malloc (umax * sizeof (int64_t)) ;
+    uint64_t *Ux = (uint64_t *) SPEX_malloc (umax * sizeof (uint64_t)) ;
+    uint64_t *Udinv = (uint64_t *) SPEX_malloc (n * sizeof (uint64_t)) ;
+    int64_t  *pinv = (int64_t  *) SPEX_malloc (n * sizeof (int64_t)) ;
+    int64_t  *prow = (int64_t  *) SPEX_malloc (n * sizeof (int64_t)) ;
+    int64_t  *mark = (int64_t  *) SPEX_malloc (n * sizeof (int64_t)) ;
+    int64_t  *xi = (int64_t  *) SPEX_malloc (n * sizeof (int64_t)) ;
+    int64_t  *pstack = (int64_t  *) SPEX_malloc (n * sizeof (int64_t)) ;
+    uint64_t *w = (uint64_t *) SPEX_calloc (n, sizeof (uint64_t)) ;
+    uint64_t *y = (uint64_t *) SPEX_malloc (n * sizeof (uint64_t)) ;
+
+    if (!Ax || !Lp || !Li || !Lx || !Up || !Ui || !Ux || !Udinv || !pinv ||
+        !prow || !mark || !xi || !pstack || !w || !y)
+    {
+        SPEX_FREE_ALL ;
+        return (SPEX_OUT_OF_MEMORY) ;
+    }
+
+    // constants for spex_left_lu_mod_mul.  p is odd, and each Newton step
+    // doubles the number of correct bits of 1/p mod 2^64, starting with 3.
+    spex_left_lu_mod_t mod ;
+    mod.p = p ;
+    uint64_t pinv64 = p ;
+    for (int t = 0 ; t < 5 ; t++)
+    {
+        pinv64 *= 2 - p * pinv64 ;
+    }
+    mod.pneg = -pinv64 ;
+    mod.r2 = spex_left_lu_powmod (2 % p, 128, p) ;
+
+    // A modulo p
+    uint64_t base = spex_left_lu_powmod (2 % p, GMP_NUMB_BITS, p) ;
+    for (int64_t pa = 0 ; pa < anz ; pa++)
+    {
+        Ax [pa] = spex_left_lu_mpz_mod (A->x.mpz[pa], base, p) ;
+    }
+
+    for (int64_t i = 0 ; i < n ; i++)
+    {
+        pinv [i] = -1 ;
+        mark [i] = -1 ;
+    }
+
+    //--------------------------------------------------------------------------
+    // factorize P*A(:,q) = L*U modulo p
+    //--------------------------------------------------------------------------
+
+    for (int64_t k = 0 ; k < n ; k++)
+    {
+        Lp [k] = lnz ;
+        Up [k] = unz ;
+        int64_t j = q [k] ;
+
+        // make room for a dense column of L and U
+        if (lnz + n > lmax || unz + n > umax)
+        {
+            bool ok1, ok2, ok3, ok4 ;
+            int64_t lmax2 = 2*lmax + n, umax2 = 2*umax + n ;
+            Li = (int64_t  *) SPEX_realloc (lmax2, lmax, sizeof (int64_t),
+                Li, &ok1) ;
+            Lx = (uint64_t *) SPEX_realloc (lmax2, lmax, sizeof (uint64_t),
+                Lx, &ok2) ;
+            Ui = (int64_t  *) SPEX_realloc (umax2, umax, sizeof (int64_t),
+                Ui, &ok3) ;
+            Ux = (uint64_t *) SPEX_realloc (umax2, umax, sizeof (uint64_t),
+                Ux, &ok4) ;
+            if (!ok1 || !ok2 || !ok3 || !ok4)
+            {
+                SPEX_FREE_ALL ;
+                return (SPEX_OUT_OF_MEMORY) ;
+            }
+            lmax = lmax2 ;
+            umax = umax2 ;
+        }
+
+        // xi [top..n-1] = nonzero pattern of L\A(:,j)
+        int64_t top ;
+        spex_left_lu_mod_reach (&top, A, j, k, Lp, Li, pinv, mark, xi,
+            pstack) ;
+
+        // w = A(:,j), scattered
+        for (int64_t t = top ; t < n ; t++)
+        {
+            w [xi [t]] = 0 ;
+        }
+        for (int64_t pa = A->p[j] ; pa < A->p[j+1] ; pa++)
+        {
+            w [A->i[pa]] = Ax [pa] ;
+        }
+
+        // w = L\w, in topological order
+        for (int64_t t = top ; t < n ; t++)
+        {
+            int64_t r = xi [t] ;
+            int64_t c = pinv [r] ;
+            uint64_t wr = w [r] ;
+            if (c < 0 || wr == 0) continue ;
+            for (int64_t pl = Lp [c] ; pl < Lp [c+1] ; pl++)
+            {
+                uint64_t lw = spex_left_lu_mod_mul (Lx [pl], wr, &mod) ;
+                uint64_t *wi = &w [Li [pl]] ;
+                (*wi) = ((*wi) >= lw) ? ((*wi) - lw) : ((*wi) + (p - lw)) ;
+            }
+        }
+
+        // U(:,k) = w (pivotal rows), and choose the pivot among the others:
+        // the diagonal entry if it is nonzero, or else the first nonzero.
+        int64_t pivot = -1 ;
+        for (int64_t t = top ; t < n ; t++)
+        {
+            int64_t r = xi [t] ;
+            if (w [r] == 0) continue ;
+            if (pinv [r] >= 0)
+            {
+                Ui [unz] = pinv [r] ;
+                Ux [unz++] = spex_left_lu_mod_scale (w [r], &mod) ;
+            }
+            else if (pivot < 0 || r == j)
+            {
+                pivot = r ;
+            }
+        }
+        if (pivot < 0)
+        {
+            // A(:,q[0..k]) is rank deficient modulo p
+            (*singular) = true ;
+            SPEX_FREE_ALL ;
+            return (SPEX_OK) ;
+        }
+
+        // L(:,k) = w (non-pivotal rows) / pivot, where dinv2 is scaled twice
+        // so that the entries of L are scaled once
+        uint64_t dinv = spex_left_lu_mod_scale (
+            spex_left_lu_invmod (w [pivot], p), &mod) ;
+        uint64_t dinv2 = spex_left_lu_mod_scale (dinv, &mod) ;
+        Udinv [k] = dinv ;
+        pinv [pivot] = k ;
+        prow [k] = pivot ;
+        for (int64_t t = top ; t < n ; t++)
+        {
+            int64_t r = xi [t] ;
+            if (w [r] == 0 || pinv [r] >= 0) continue ;
+            Li [lnz] = r ;
+            Lx [lnz++] = spex_left_lu_mod_mul (w [r], dinv2, &mod) ;
+        }
+    }
+    Lp [n] = lnz ;
+    Up [n] = unz ;
+
+    //--------------------------------------------------------------------------
+    // solve L*U*x(q) = P*b modulo p for each column of b
+    //--------------------------------------------------------------------------
+
+    for (int64_t s = 0 ; s < nrhs ; s++)
+    {
+        for (int64_t i = 0 ; i < n ; i++)
+        {
+            w [i] = spex_left_lu_mpz_mod (SPEX_2D (b, i, s, mpz), base, p) ;
+        }
+
+        // y = L\(P*w), where L has original row indices
+        for (int64_t k = 0 ; k < n ; k++)
+        {
+            uint64_t yk = w [prow [k]] ;
+            y [k] = yk ;
+            if (yk == 0) continue ;
+            for (int64_t pl = Lp [k] ; pl < Lp [k+1] ; pl++)
+            {
+                uint64_t lw = spex_left_lu_mod_mul (Lx [pl], yk, &mod) ;
+                uint64_t *wi = &w [Li [pl]] ;
+                (*wi) = ((*wi) >= lw) ? ((*wi) - lw) : ((*wi) + (p - lw)) ;
+            }
+        }
+
+        // x(q) = U\y
+        uint64_t *xs = x + s * n ;
+        for (int64_t k = n-1 ; k >= 0 ; k--)
+        {
+            uint64_t zk = spex_left_lu_mod_mul (y [k], Udinv [k], &mod) ;
+            xs [q [k]] = zk ;
+            if (zk == 0) continue ;
+            for (int64_t pu = Up [k] ; pu < Up [k+1] ; pu++)
+            {
+                uint64_t uz = spex_left_lu_mod_mul (Ux [pu], zk, &mod) ;
+                uint64_t *yi = &y [Ui [pu]] ;
+                (*yi) = ((*yi) >= uz) ? ((*yi) - uz) : ((*yi) + (p - uz)) ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    SPEX_FREE_ALL ;
+    return (SPEX_OK) ;
+}
@@ -0,0 +1,70 @@
+//------------------------------------------------------------------------------
+// SPEX_Left_LU/spex_left_lu_prev_prime: largest prime below a given number
+//------------------------------------------------------------------------------
+
+// SPEX_Left_LU: (c) 2019-2022, Chris Lourenco (US Naval Academy), Jinhao Chen,
+// Erick Moreno-Centeno, Timothy A. Davis, Texas A&M.  All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0-or-later or LGPL-3.0-or-later
+
+//------------------------------------------------------------------------------
+
+/* Purpose: This function returns the largest prime smaller than p, for
+ * 2 < p < 2^63.  It is used to generate the moduli of
+ * SPEX_Left_LU_modular_backslash.  Primality is tested with the Miller-Rabin
+ * test using the first 12 primes as bases, which is deterministic for all
+ * numbers below 2^64.
+ */
+
+#include "spex_left_lu_internal.h"
+
+static bool spex_left_lu_is_prime (uint64_t n)
+{
+    static const uint64_t bases [12] =
+        { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37 } ;
+
+    if (n < 2) return (false) ;
+    for (int k = 0 ; k < 12 ; k++)
+    {
+        if (n == bases [k]) return (true) ;
+        if (n % bases [k] == 0) return (false) ;
+    }
+
+    // n-1 = d * 2^s with d odd
+    uint64_t d = n - 1 ;
+    int s = 0 ;
+    while ((d & 1) == 0)
+    {
+        d >>= 1 ;
+        s++ ;
+    }
+
+    for (int k = 0 ; k < 12 ; k++)
+    {
+        uint64_t x = spex_left_lu_powmod (bases [k], d, n) ;
+        if (x == 1 || x == n - 1) continue ;
+        bool composite = true ;
+        for (int r = 1 ; r < s && composite ; r++)
+        {
+            x = spex_left_lu_mulmod (x, x, n) ;
+            composite = (x != n - 1) ;
+        }
+        if (composite) return (false) ;
+    }
+    return (true) ;
+}
+
+uint64_t spex_left_lu_prev_prime
+(
+    uint64_t p
+)
+{
+    if (p <= 3) return (p == 3 ? 2 : 0) ;
+
+    // only odd candidates are tested
+    uint64_t n = (p % 2 == 0) ? (p - 1) : (p - 2) ;
+    while (n > 2 && !spex_left_lu_is_prime (n))
+    {
+        n -= 2 ;
+    }
+    return (n > 2 ? n : 2) ;
+}
@@ -0,0 +1,102 @@
+//------------------------------------------------------------------------------
+// SPEX_Left_LU/spex_left_lu_rat_reconstruct: rational reconstruction
+//------------------------------------------------------------------------------
+
+// SPEX_Left_LU: (c) 2019-2022, Chris Lourenco (US Naval Academy), Jinhao Chen,
+// Erick Moreno-Centeno, Timothy A. Davis, Texas A&M.  All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0-or-later or LGPL-3.0-or-later
+
+//------------------------------------------------------------------------------
+
+/* Purpose: Given 0 <= u < m, this function finds a and d with a = d*u mod m,
+ * |a| < 2^e, 0 < d < 2^e and gcd (a,d) = 1, using the extended Euclidean
+ * algorithm on (m,u) stopped at the first remainder below 2^e (Wang's
+ * algorithm).  If 2^(2e+1) <= m, such a fraction a/d is unique if it exists,
+ * and this function finds it.  Otherwise, ok is returned as false.
+ */
+
+#define SPEX_FREE_ALL               \
+    SPEX_MPZ_CLEAR (r0) ;           \
+    SPEX_MPZ_CLEAR (r1) ;           \
+    SPEX_MPZ_CLEAR (t0) ;           \
+    SPEX_MPZ_CLEAR (t1) ;           \
+    SPEX_MPZ_CLEAR (qt) ;
+
+#include "spex_left_lu_internal.h"
+
+SPEX_info spex_left_lu_rat_reconstruct
+(
+    mpz_t a,                  // numerator
+    mpz_t d,                  // denominator
+    bool *ok,                 // true if a/d was found
+    const mpz_t u,            // residue, 0 <= u < m
+    const mpz_t m,            // modulus
+    int64_t e                 // bound on the bits of a and d
+)
+{
+    SPEX_info info ;
+    mpz_t r0, r1, t0, t1, qt ;
+    SPEX_MPZ_SET_NULL (r0) ;
+    SPEX_MPZ_SET_NULL (r1) ;
+    SPEX_MPZ_SET_NULL (t0) ;
+    SPEX_MPZ_SET_NULL (t1) ;
+    SPEX_MPZ_SET_NULL (qt) ;
+    (*ok) = false ;
+
+    SPEX_CHECK (SPEX_mpz_init (r0)) ;
+    SPEX_CHECK (SPEX_mpz_init (r1)) ;
+    SPEX_CHECK (SPEX_mpz_init (t0)) ;
+    SPEX_CHECK (SPEX_mpz_init (t1)) ;
+    SPEX_CHECK (SPEX_mpz_init (qt)) ;
+
+    //--------------------------------------------------------------------------
+    // extended Euclid: r1 = t1*u mod m, until |r1| < 2^e
+    //--------------------------------------------------------------------------
+
+    SPEX_CHECK (SPEX_mpz_set (r0, m)) ;
+    SPEX_CHECK (SPEX_mpz_set (r1, u)) ;
+    SPEX_CHECK (SPEX_mpz_set_ui (t0, 0)) ;
+    SPEX_CHECK (SPEX_mpz_set_ui (t1, 1)) ;
+
+    size_t bits ;
+    SPEX_CHECK (SPEX_mpz_sizeinbase (&bits, r1, 2)) ;
+    while ((int64_t) bits > e)
+    {
+        // (r0, r1) = (r1, r0 - qt*r1) and (t0, t1) = (t1, t0 - qt*t1).
+        // mpz_swap does not allocate memory, so it needs no wrapper.
+        SPEX_CHECK (SPEX_mpz_fdiv_q (qt, r0, r1)) ;
+        SPEX_CHECK (SPEX_mpz_submul (r0, qt, r1)) ;
+        SPEX_CHECK (SPEX_mpz_submul (t0, qt, t1)) ;
+        mpz_swap (r0, r1) ;
+        mpz_swap (t0, t1) ;
+        SPEX_CHECK (SPEX_mpz_sizeinbase (&bits, r1, 2)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // a/d = r1/t1 if the denominator is small and the fraction is reduced
+    //--------------------------------------------------------------------------
+
+    SPEX_CHECK (SPEX_mpz_sizeinbase (&bits, t1, 2)) ;
+    if ((int64_t) bits <= e)
+    {
+        SPEX_CHECK (SPEX_mpz_gcd (qt, r1, t1)) ;
+        int r ;
+        SPEX_CHECK (SPEX_mpz_cmp_ui (&r, qt, 1)) ;
+        if (r == 0)
+        {
+            // a = sign (t1) * r1 and d = |t1|, where qt = 1 here
+            int sgn ;
+            SPEX_CHECK (SPEX_mpz_sgn (&sgn, t1)) ;
+            if (sgn < 0)
+            {
+                SPEX_CHECK (SPEX_mpz_set_si (qt, -1)) ;
+            }
+            SPEX_CHECK (SPEX_mpz_mul (a, r1, qt)) ;
+            SPEX_CHECK (SPEX_mpz_abs (d, t1)) ;
+            (*ok) = true ;
+        }
+    }
+
+    SPEX_FREE_ALL ;
+    return (SPEX_OK) ;
+}
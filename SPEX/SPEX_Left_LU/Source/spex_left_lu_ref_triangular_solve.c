@@ -14,9 +14,15 @@
  * (LD) x = A(:,k). The algorithm is described in the paper; however in essence
  * it computes the nonzero pattern xi, then performs a sequence of IPGE
  * operations on the nonzeros to obtain their final value. All operations are
- * guaranteed to be integral (mpz_t). There are various enhancements in this
+ * guaranteed to be integral. There are various enhancements in this
  * code used to reduce the overall cost of the operations and minimize
  * operations as much as possible.
+ *
+ * Most entries of x stay small for many problems (network matrices, for
+ * example), so each entry is held as an int64_t in xw while it fits, using
+ * overflow-checked arithmetic.  Once an operation on x[i] overflows, x[i] is
+ * moved to the mpz_t x->x.mpz[i] and updated with GMP from then on.  The values
+ * of L and rhos are read as int64_t directly from their mpz_t when they fit.
  */
 
 /* Description of input/output
@@ -65,6 +71,16 @@
  *              On output, x[i] is the value of L(i,k) here i is in the nonzero
  *              pattern xi[top...n-1]. Other entries of x are undefined on
  *              output.
+ *
+ *  xw:         An int64_t workspace array of size n, unitialized on input and
+ *              undefined on output. During the triangular solve, xw[i] holds
+ *              the value of x[i] if it fits, or SPEX_LEFT_LU_BIG if x[i] is
+ *              held in the mpz_t x->x.mpz[i].
+ *
+ *  nthreads:   The maximum number of threads to use.  The updates of x by
+ *              each column of L are independent of each other, so they are
+ *              done in parallel if the column is long enough.  The result
+ *              does not depend on the number of threads.
  */
 
 #include "spex_left_lu_internal.h"
@@ -84,6 +100,197 @@ static inline int compare (const void * a, const void * b)
     }
 }
 
+//------------------------------------------------------------------------------
+// spex_left_lu_history_update: x[i] = x[i] * rhos[r1] / rhos[r2]
+//------------------------------------------------------------------------------
+
+// If r2 < 0, x[i] = x[i] * rhos[r1] and no division is done.
+
+static SPEX_info spex_left_lu_history_update
+(
+    mpz_t *x_mpz,           // mpz_t values of x
+    int64_t *xw,            // int64_t values of x
+    mpz_t *rhos_mpz,        // sequence of pivots
+    int64_t i,              // entry of x to update
+    int64_t r1,             // multiply by rhos[r1]
+    int64_t r2              // divide by rhos[r2], if r2 >= 0
+)
+{
+    SPEX_info info ;
+    int64_t rho1, rho2 = 1, t ;
+
+    if (xw[i] != SPEX_LEFT_LU_BIG
+        && spex_left_lu_get_small (&rho1, rhos_mpz[r1])
+        && (r2 < 0 || spex_left_lu_get_small (&rho2, rhos_mpz[r2]))
+        && spex_left_lu_mul_small (&t, xw[i], rho1))
+    {
+        // the division is exact, and the result is small since |rho2| >= 1
+        xw[i] = t / rho2 ;
+        return (SPEX_OK) ;
+    }
+
+    // x[i] is big, or x[i]*rhos[r1] overflows
+    if (xw[i] != SPEX_LEFT_LU_BIG)
+    {
+        SPEX_CHECK(SPEX_mpz_set_si(x_mpz[i], xw[i]));
+        xw[i] = SPEX_LEFT_LU_BIG ;
+    }
+    // x[i] = x[i] * rho[r1]
+    SPEX_CHECK(SPEX_mpz_mul(x_mpz[i], x_mpz[i], rhos_mpz[r1]));
+    if (r2 >= 0)
+    {
+        // x[i] = x[i] / rho[r2]
+        SPEX_CHECK(SPEX_mpz_divexact(x_mpz[i], x_mpz[i], rhos_mpz[r2]));
+    }
+    return (SPEX_OK) ;
+}
+
+//------------------------------------------------------------------------------
+// spex_left_lu_ipge_update: x[i] = (x[i] * rhos[r1] - lij * x[j]) / rhos[r2]
+//------------------------------------------------------------------------------
+
+// If r1 < 0, x[i] is zero on input and x[i] = -lij * x[j] / rhos[r2].  If
+// r2 < 0, no division is done.  If xj_mpz_ok is true, x_mpz[j] already holds
+// the value of x[j] even if it is small.
+
+static SPEX_info spex_left_lu_ipge_update
+(
+    mpz_t *x_mpz,           // mpz_t values of x
+    int64_t *xw,            // int64_t values of x
+    mpz_t *rhos_mpz,        // sequence of pivots
+    const mpz_t lij_mpz,    // the entry L(i,j)
+    int64_t i,              // entry of x to update
+    int64_t j,              // x[j] is final
+    int64_t r1,             // multiply x[i] by rhos[r1], if r1 >= 0
+    int64_t r2,             // divide by rhos[r2], if r2 >= 0
+    bool xj_mpz_ok          // if true, x_mpz[j] is already set
+)
+{
+    SPEX_info info ;
+    int64_t lij, rho1 = 1, rho2 = 1, t1, t2, t ;
+
+    if (xw[i] != SPEX_LEFT_LU_BIG && xw[j] != SPEX_LEFT_LU_BIG
+        && spex_left_lu_get_small (&lij, lij_mpz)
+        && (r1 < 0 || spex_left_lu_get_small (&rho1, rhos_mpz[r1]))
+        && (r2 < 0 || spex_left_lu_get_small (&rho2, rhos_mpz[r2]))
+        && spex_left_lu_mul_small (&t1, xw[i], rho1)
+        && spex_left_lu_mul_small (&t2, lij, xw[j])
+        && spex_left_lu_sub_small (&t, t1, t2))
+    {
+        // the division is exact, and the result is small since |rho2| >= 1
+        xw[i] = t / rho2 ;
+        return (SPEX_OK) ;
+    }
+
+    // x[i] must be an mpz_t from here on
+    if (xw[i] != SPEX_LEFT_LU_BIG)
+    {
+        SPEX_CHECK(SPEX_mpz_set_si(x_mpz[i], xw[i]));
+        xw[i] = SPEX_LEFT_LU_BIG ;
+    }
+    // x[j] is final, so it is kept small; only its mpz_t copy is refreshed
+    if (xw[j] != SPEX_LEFT_LU_BIG && !xj_mpz_ok)
+    {
+        SPEX_CHECK(SPEX_mpz_set_si(x_mpz[j], xw[j]));
+    }
+    if (r1 >= 0)
+    {
+        // x[i] = x[i] * rho[r1]
+        SPEX_CHECK(SPEX_mpz_mul(x_mpz[i], x_mpz[i], rhos_mpz[r1]));
+    }
+    // x[i] = x[i] - lij*x[j]
+    SPEX_CHECK(SPEX_mpz_submul(x_mpz[i], lij_mpz, x_mpz[j]));
+    if (r2 >= 0)
+    {
+        // x[i] = x[i] / rho[r2]
+        SPEX_CHECK(SPEX_mpz_divexact(x_mpz[i], x_mpz[i], rhos_mpz[r2]));
+    }
+    return (SPEX_OK) ;
+}
+
+//------------------------------------------------------------------------------
+// spex_left_lu_ipge_entry: update x[i] with the entry L(i,j) in L->x.mpz[m]
+//------------------------------------------------------------------------------
+
+// Each entry of L(:,j) updates a different x[i], so the entries of one column
+// of L can be handled in any order, and in parallel.
+
+static SPEX_info spex_left_lu_ipge_entry
+(
+    mpz_t *x_mpz,           // mpz_t values of x
+    int64_t *xw,            // int64_t values of x
+    mpz_t *rhos_mpz,        // sequence of pivots
+    const SPEX_matrix *L,   // partial L matrix
+    int64_t m,              // position of L(i,j) in L
+    const int64_t *pinv,    // inverse row permutation
+    int64_t *h,             // history vector
+    int64_t j,              // x[j] is final
+    int64_t jnew,           // pinv[j]
+    bool xj_mpz_ok          // if true, x_mpz[j] is already set
+)
+{
+    SPEX_info info ;
+    int sgn ;
+    int64_t lij ;
+    int64_t i = L->i[m];                   // i value of Lij
+    int64_t inew = pinv[i];                // i location of Lij
+    if (inew <= jnew)
+    {
+        return (SPEX_OK) ;
+    }
+
+    /*************** If lij==0 then no update******************/
+    // an mpz_t that does not fit in an int64_t is nonzero
+    if (spex_left_lu_get_small(&lij, L->x.mpz[m]) && lij == 0)
+    {
+        return (SPEX_OK) ;
+    }
+
+    // lij is nonzero. Check if x[i] is nonzero
+    if (xw[i] == SPEX_LEFT_LU_BIG)
+    {
+        SPEX_CHECK(SPEX_mpz_sgn(&sgn, x_mpz[i]));
+        if (sgn == 0) {xw[i] = 0;}
+    }
+
+    //--------------------------------------------------------------------------
+    /************* lij is nonzero, x[i] is zero****************/
+    // x[i] = 0 then only perform IPGE update
+    // subtraction/division
+    //--------------------------------------------------------------------------
+
+    if (xw[i] == 0)
+    {
+        // x[i] = 0 - lij*x[j], and if a previous pivot exists,
+        // x[i] = x[i] / rho[j-1]
+        SPEX_CHECK(spex_left_lu_ipge_update(x_mpz, xw, rhos_mpz, L->x.mpz[m],
+            i, j, -1, jnew-1, xj_mpz_ok));
+        h[i] = jnew;   // Entry is up to date
+    }
+
+    //--------------------------------------------------------------------------
+    /************ Both lij and x[i] are nonzero****************/
+    // x[i] != 0 --> History & IPGE update on x[i]
+    //--------------------------------------------------------------------------
+    else
+    {
+        // History update if necessary (only possible if there is a previous
+        // pivot)
+        if (jnew >= 1 && h[i] < jnew - 1)
+        {
+            // x[i] = x[i] * rho[j-1] / rho[h[i]]
+            SPEX_CHECK(spex_left_lu_history_update(x_mpz, xw, rhos_mpz,
+                i, jnew-1, h[i]));
+        }
+        // x[i] = x[i] * rho[j] - lij*xj, and if a previous pivot exists,
+        // x[i] = x[i] / rho[j-1]
+        SPEX_CHECK(spex_left_lu_ipge_update(x_mpz, xw, rhos_mpz, L->x.mpz[m],
+            i, j, jnew, jnew-1, xj_mpz_ok));
+        h[i] = jnew;   // Entry is up to date
+    }
+    return (SPEX_OK) ;
+}
+
 SPEX_info spex_left_lu_ref_triangular_solve // performs the sparse REF triangular solve
 (
     int64_t *top_output,      // Output the beginning of nonzero pattern
@@ -96,7 +303,9 @@ SPEX_info spex_left_lu_ref_triangular_solve // performs the sparse REF triangula
     const int64_t* pinv,      // inverse row permutation
     const int64_t* row_perm,  // row permutation
     int64_t* h,               // history vector
-    SPEX_matrix* x            // solution of system ==> kth column of L and U
+    SPEX_matrix* x,           // solution of system ==> kth column of L and U
+    int64_t* xw,              // int64_t workspace for small entries of x
+    int nthreads              // max number of threads to use
 )
 {
 
@@ -110,10 +319,9 @@ SPEX_info spex_left_lu_ref_triangular_solve // performs the sparse REF triangula
     SPEX_REQUIRE(A, SPEX_CSC, SPEX_MPZ);
     SPEX_REQUIRE(rhos, SPEX_DENSE, SPEX_MPZ);
 
-    int64_t j, jnew, i, inew, p, m, n, col, top ;
+    int64_t j, jnew, i, p, m, n, col, top ;
     int sgn ;
-    mpz_t *x_mpz = x->x.mpz, *Ax_mpz = A->x.mpz, *Lx_mpz = L->x.mpz,
-          *rhos_mpz = rhos->x.mpz;
+    mpz_t *x_mpz = x->x.mpz, *Ax_mpz = A->x.mpz, *rhos_mpz = rhos->x.mpz;
 
     //--------------------------------------------------------------------------
     // Begin the REF triangular solve by obtaining the nonzero pattern, and
@@ -148,10 +356,11 @@ SPEX_info spex_left_lu_ref_triangular_solve // performs the sparse REF triangula
         xi[j] = row_perm[xi[j]];
     }
 
-    // Reset x[i] = 0 for all i in nonzero pattern xi [top..n-1]
+    // Reset x[i] = 0 for all i in nonzero pattern xi [top..n-1].  Only the
+    // small value is reset; x_mpz[i] is set from xw[i] at the end.
     for (i = top; i < n; i++)
     {
-        SPEX_CHECK (SPEX_mpz_set_ui (x_mpz[xi [i]], 0)) ;
+        xw[xi[i]] = 0;
     }
     // Set x[col] = 0.  A(col,col) is the diagonal entry in the original
     // matrix.  The pivot search prefers to select the diagonal, if it is
@@ -168,13 +377,17 @@ SPEX_info spex_left_lu_ref_triangular_solve // performs the sparse REF triangula
     }
 
     // Set x = A(:,q(k))
-    for (i = A->p[col]; i < A->p[col + 1]; i++)
+    for (p = A->p[col]; p < A->p[col + 1]; p++)
     {
-        // Value of the ith nonzero
-        SPEX_CHECK(SPEX_mpz_set(x_mpz[A->i[i]], Ax_mpz[i]));
+        // Value of the pth nonzero
+        i = A->i[p];
+        if (!spex_left_lu_get_small(&xw[i], Ax_mpz[p]))
+        {
+            SPEX_CHECK(SPEX_mpz_set(x_mpz[i], Ax_mpz[p]));
+            xw[i] = SPEX_LEFT_LU_BIG;
+        }
     }
 
-
     //--------------------------------------------------------------------------
     // Iterate across nonzeros in x
     //--------------------------------------------------------------------------
@@ -184,8 +397,12 @@ SPEX_info spex_left_lu_ref_triangular_solve // performs the sparse REF triangula
         j = xi[p];                         // First nonzero term
         jnew = pinv[j];                    // Location of nonzero term
         // Check if x[j] == 0, if so continue to next nonzero
-        SPEX_CHECK(SPEX_mpz_sgn(&sgn, x_mpz[j]));
-        if (sgn == 0) {continue;}          // x[j] = 0 no work must be done
+        if (xw[j] == SPEX_LEFT_LU_BIG)
+        {
+            SPEX_CHECK(SPEX_mpz_sgn(&sgn, x_mpz[j]));
+            if (sgn == 0) {xw[j] = 0;}
+        }
+        if (xw[j] == 0) {continue;}        // x[j] = 0 no work must be done
 
         // x[j] is nonzero
         if (jnew < k)                      // jnew < k implies entries in U
@@ -195,15 +412,9 @@ SPEX_info spex_left_lu_ref_triangular_solve // performs the sparse REF triangula
             //------------------------------------------------------------------
             if (h[j] < jnew - 1)           // HU must be performed
             {
-                // x[j] = x[j] * rho[j-1]
-                SPEX_CHECK(SPEX_mpz_mul(x_mpz[j],x_mpz[j],rhos_mpz[jnew-1]));
-
-                if (h[j] > -1)
-                {
-                    // x[j] = x[j] / rho[h[j]]
-                    SPEX_CHECK(SPEX_mpz_divexact(x_mpz[j],x_mpz[j],
-                        rhos_mpz[h[j]]));
-                }
+                // x[j] = x[j] * rho[j-1] / rho[h[j]]
+                SPEX_CHECK(spex_left_lu_history_update(x_mpz, xw, rhos_mpz,
+                    j, jnew-1, h[j]));
             }
 
             //------------------------------------------------------------------
@@ -211,97 +422,49 @@ SPEX_info spex_left_lu_ref_triangular_solve // performs the sparse REF triangula
             //------------------------------------------------------------------
 
             // ----------- Iterate across nonzeros in Lij ---------------------
-            for (m = L->p[jnew]; m < L->p[jnew+1]; m++)
+            int64_t pstart = L->p[jnew], pend = L->p[jnew+1] ;
+            int nth = (int) SPEX_MIN (nthreads, (pend - pstart) /
+                ((xw[j] == SPEX_LEFT_LU_BIG) ?
+                SPEX_LEFT_LU_PAR_BIG : SPEX_LEFT_LU_PAR_SMALL)) ;
+            if (nth <= 1)
             {
-                i = L->i[m];               // i value of Lij
-                inew = pinv[i];            // i location of Lij
-                if (inew > jnew)
+                for (m = pstart; m < pend; m++)
                 {
-                    /*************** If lij==0 then no update******************/
-                    SPEX_CHECK(SPEX_mpz_sgn(&sgn, Lx_mpz[m]));
-                    if (sgn == 0) {continue;}
-
-                    // lij is nonzero. Check if x[i] is nonzero
-                    SPEX_CHECK(SPEX_mpz_sgn(&sgn, x_mpz[i]));
-
-                    //----------------------------------------------------------
-                    /************* lij is nonzero, x[i] is zero****************/
-                    // x[i] = 0 then only perform IPGE update
-                    // subtraction/division
-                    //----------------------------------------------------------
-
-                    if (sgn == 0)
+                    SPEX_CHECK(spex_left_lu_ipge_entry(x_mpz, xw, rhos_mpz, L,
+                        m, pinv, h, j, jnew, false));
+                }
+            }
+            else
+            {
+                // x[j] is only read by the updates, so its mpz_t is set here
+                // once, rather than by each thread that needs it
+                if (xw[j] != SPEX_LEFT_LU_BIG)
+                {
+                    SPEX_CHECK(SPEX_mpz_set_si(x_mpz[j], xw[j]));
+                }
+                SPEX_info pinfo = SPEX_OK ;
+                #pragma omp parallel num_threads(nth)
+                {
+                    SPEX_info tinfo = SPEX_OK ;
+                    int64_t tm ;
+                    #pragma omp for schedule(dynamic,16)
+                    for (tm = pstart; tm < pend; tm++)
                     {
-                        // No previous pivot
-                        if (jnew < 1)
-                        {
-                            // x[i] = 0 - lij*x[j]
-                            SPEX_CHECK(SPEX_mpz_submul(x_mpz[i], Lx_mpz[m],
-                                x_mpz[j]));
-                            h[i] = jnew;   // Entry is up to date
-                        }
-
-                        // Previous pivot exists
-                        else
-                        {
-                            // x[i] = 0 - lij*x[j]
-                            SPEX_CHECK(SPEX_mpz_submul(x_mpz[i], Lx_mpz[m],
-                                x_mpz[j]));
-
-                            // x[i] = x[i] / rho[j-1]
-                            SPEX_CHECK(SPEX_mpz_divexact(x_mpz[i], x_mpz[i],
-                                rhos_mpz[jnew-1]));
-                            h[i] = jnew;   // Entry is up to date
-                        }
+                        if (tinfo != SPEX_OK) continue ;
+                        tinfo = spex_left_lu_ipge_entry(x_mpz, xw, rhos_mpz, L,
+                            tm, pinv, h, j, jnew, true) ;
                     }
-
-                    //----------------------------------------------------------
-                    /************ Both lij and x[i] are nonzero****************/
-                    // x[i] != 0 --> History & IPGE update on x[i]
-                    //----------------------------------------------------------
-                    else
+                    if (tinfo != SPEX_OK)
                     {
-                        // No previous pivot in this case
-                        if (jnew < 1)
-                        {
-                            // x[i] = x[i]*rho[0]
-                            SPEX_CHECK(SPEX_mpz_mul(x_mpz[i],x_mpz[i],
-                                rhos_mpz[0]));
-
-                            // x[i] = x[i] - lij*xj
-                            SPEX_CHECK(SPEX_mpz_submul(x_mpz[i], Lx_mpz[m],
-                                x_mpz[j]));
-                            h[i] = jnew;   // Entry is now up to date
-                        }
-                        // There is a previous pivot
-                        else
-                        {
-                            // History update if necessary
-                            if (h[i] < jnew - 1)
-                            {
-                                // x[i] = x[i] * rho[j-1]
-                                SPEX_CHECK(SPEX_mpz_mul(x_mpz[i], x_mpz[i],
-                                    rhos_mpz[jnew-1]));
-                                if (h[i] > -1)
-                                {
-                                    // x[i] = x[i] / rho[h[i]]
-                                    SPEX_CHECK(SPEX_mpz_divexact(x_mpz[i],
-                                        x_mpz[i], rhos_mpz[h[i]]));
-                                }
-                            }
-                            // x[i] = x[i] * rho[j]
-                            SPEX_CHECK(SPEX_mpz_mul(x_mpz[i],x_mpz[i],
-                                rhos_mpz[jnew]));
-                            // x[i] = x[i] - lij*xj
-                            SPEX_CHECK(SPEX_mpz_submul(x_mpz[i], Lx_mpz[m],
-                                x_mpz[j]));
-                            // x[i] = x[i] / rho[j-1]
-                            SPEX_CHECK(SPEX_mpz_divexact(x_mpz[i], x_mpz[i],
-                                rhos_mpz[jnew-1]));
-                            h[i] = jnew;   // Entry is up to date
-                        }
+                        #pragma omp critical (spex_left_lu_ref_triangular_solve)
+                        pinfo = tinfo ;
                     }
+                    #ifdef _OPENMP
+                    // free the GMP wrapper list of each worker thread
+                    if (omp_get_thread_num ( ) != 0) spex_gmp_finalize ( ) ;
+                    #endif
                 }
+                SPEX_CHECK(pinfo);
             }
         }
         else                               // Entries of L
@@ -311,19 +474,27 @@ SPEX_info spex_left_lu_ref_triangular_solve // performs the sparse REF triangula
             //------------------------------------------------------------------
             if (h[j] < k-1)
             {
-                // x[j] = x[j] * rho[k-1]
-                SPEX_CHECK(SPEX_mpz_mul(x_mpz[j], x_mpz[j], rhos_mpz[k-1]));
-                if (h[j] > -1)
-                {
-                    // x[j] = x[j] / rho[h[j]]
-                    SPEX_CHECK(SPEX_mpz_divexact(x_mpz[j], x_mpz[j],
-                        rhos_mpz[h[j]]));
-                }
+                // x[j] = x[j] * rho[k-1] / rho[h[j]]
+                SPEX_CHECK(spex_left_lu_history_update(x_mpz, xw, rhos_mpz,
+                    j, k-1, h[j]));
             }
         }
     }
+
+    //--------------------------------------------------------------------------
+    // Set x_mpz[i] for all entries of x that are still small
+    //--------------------------------------------------------------------------
+
+    for (p = top; p < n; p++)
+    {
+        j = xi[p];
+        if (xw[j] != SPEX_LEFT_LU_BIG)
+        {
+            SPEX_CHECK(SPEX_mpz_set_si(x_mpz[j], xw[j]));
+        }
+    }
+
     // Output the beginning of nonzero pattern
     *top_output = top;
     return SPEX_OK;
 }
-
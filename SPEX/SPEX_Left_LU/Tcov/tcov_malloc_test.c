@@ -11,23 +11,53 @@
 #include "tcov_malloc_test.h"
 
 int64_t malloc_count = INT64_MAX ;
+int64_t tcov_nblocks = 0 ;
+int64_t tcov_nfail_parallel = 0 ;
 
 // Note that only the ANSI C memory manager is used here
 // (malloc, calloc, realloc, free)
 
+// SPEX_Left_LU_factorize may allocate from several threads at once, so the
+// counters are updated atomically
+static bool tcov_pretend_to_fail (void)
+{
+    int64_t count ;
+    #pragma omp atomic capture
+    count = --malloc_count ;
+    if (count >= 0) return (false) ;
+    #ifdef _OPENMP
+    if (omp_in_parallel ( ))
+    {
+        #pragma omp atomic
+        tcov_nfail_parallel++ ;
+    }
+    #endif
+    return (true) ;
+}
+
+static void *tcov_count_block (void *p)
+{
+    if (p != NULL)
+    {
+        #pragma omp atomic
+        tcov_nblocks++ ;
+    }
+    return (p) ;
+}
+
 // wrapper for malloc
 void *tcov_malloc
 (
     size_t size        // Size to alloc
 )
 {
-    if (--malloc_count < 0)
+    if (tcov_pretend_to_fail ( ))
     {
         /* pretend to fail */
         printf("malloc pretend to fail\n");
         return (NULL) ;
     }
-    return (malloc (size)) ;
+    return (tcov_count_block (malloc (size))) ;
 }
 
 // wrapper for calloc
@@ -37,14 +67,14 @@ void *tcov_calloc
     size_t size        // Size to alloc
 )
 {
-    if (--malloc_count < 0)
+    if (tcov_pretend_to_fail ( ))
     {
         /* pretend to fail */
         printf ("calloc pretend to fail\n");
         return (NULL) ;
     }
     // ensure at least one byte is calloc'd
-    return (calloc (n, size)) ;
+    return (tcov_count_block (calloc (n, size))) ;
 }
 
 // wrapper for realloc
@@ -54,13 +84,15 @@ void *tcov_realloc
     size_t new_size    // Size to alloc
 )
 {
-    if (--malloc_count < 0)
+    if (tcov_pretend_to_fail ( ))
     {
         /* pretend to fail */
         printf("realloc pretend to fail\n");
         return (NULL);
     }
-    return (realloc (p, new_size)) ;
+    void *pnew = realloc (p, new_size) ;
+    // a new block is created only if p is NULL
+    return ((p == NULL) ? tcov_count_block (pnew) : pnew) ;
 }
 
 // wrapper for free
@@ -69,12 +101,18 @@ void tcov_free
     void *p            // Pointer to be free
 )
 {
-    // This not really needed, but placed here anyway in case the Tcov tests
-    // want to do something different that free(p) in the future.
+    if (p != NULL)
+    {
+        #pragma omp atomic
+        tcov_nblocks-- ;
+    }
     free (p) ;
 }
 
 extern jmp_buf spex_gmp_environment ;  // for setjmp and longjmp
+#ifdef _OPENMP
+#pragma omp threadprivate (spex_gmp_environment)
+#endif
 
 int spex_gmp_realloc_test
 (
@@ -16,6 +16,8 @@
 #include "SPEX_gmp.h"
 
 extern int64_t malloc_count ;
+extern int64_t tcov_nblocks ;          // # of blocks allocated and not freed
+extern int64_t tcov_nfail_parallel ;   // # of failures in a parallel region
 
 #define GOTCHA \
     printf ("%s, line %d, spex_gmp_ntrials = %ld, malloc_count = %ld\n", \
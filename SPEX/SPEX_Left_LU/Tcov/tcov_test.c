@@ -117,6 +117,285 @@ int64_t bxden3[4] = {15,  3,   6,  7};                      // Denominator of b
 #include <float.h>
 #include <assert.h>
 
+#define TCOV_OK(method)                             \
+{                                                   \
+    info = (method) ; assert (info == SPEX_OK) ;    \
+}
+
+//------------------------------------------------------------------------------
+// tcov_create: create a test matrix A and right-hand side b
+//------------------------------------------------------------------------------
+
+// A is n-by-n, with a nonzero diagonal and every third off-diagonal entry,
+// and it is nonsingular since it is strictly diagonally dominant.  Its
+// factors have long columns, so that the parallel paths of
+// SPEX_Left_LU_factorize are taken (the Makefile sets SPEX_LEFT_LU_PAR_BIG and
+// SPEX_LEFT_LU_PAR_SMALL to 1).
+
+#define TCOV_N 16
+
+static void tcov_create
+(
+    SPEX_matrix **A_handle,
+    SPEX_matrix **b_handle,
+    const SPEX_options *option
+)
+{
+    SPEX_info info ;
+    SPEX_matrix *T = NULL, *B = NULL ;
+    int64_t n = TCOV_N, nz = 0 ;
+    TCOV_OK (SPEX_matrix_allocate (&T, SPEX_TRIPLET, SPEX_INT64, n, n, n*n,
+        false, true, option)) ;
+    for (int64_t j = 0 ; j < n ; j++)
+    {
+        for (int64_t i = 0 ; i < n ; i++)
+        {
+            if (i == j || (i + 2*j) % 3 == 0)
+            {
+                T->i [nz] = i ;
+                T->j [nz] = j ;
+                T->x.int64 [nz] = (i == j) ? 100 :
+                    ((((i + j) % 2) ? 1 : -1) * (1 + (7*i + 3*j) % 5)) ;
+                nz++ ;
+            }
+        }
+    }
+    T->nz = nz ;
+    TCOV_OK (SPEX_matrix_allocate (&B, SPEX_DENSE, SPEX_INT64, n, 1, n,
+        false, true, option)) ;
+    for (int64_t i = 0 ; i < n ; i++)
+    {
+        B->x.int64 [i] = i - 7 ;
+    }
+    TCOV_OK (SPEX_matrix_copy (A_handle, SPEX_CSC, SPEX_MPZ, T, option)) ;
+    TCOV_OK (SPEX_matrix_copy (b_handle, SPEX_DENSE, SPEX_MPZ, B, option)) ;
+    TCOV_OK (SPEX_matrix_free (&T, option)) ;
+    TCOV_OK (SPEX_matrix_free (&B, option)) ;
+}
+
+//------------------------------------------------------------------------------
+// tcov_same_mpz: check if two matrices have the same pattern and mpz values
+//------------------------------------------------------------------------------
+
+static void tcov_same_mpz (const SPEX_matrix *X, const SPEX_matrix *Y)
+{
+    SPEX_info info ;
+    int64_t nx, ny ;
+    TCOV_OK (SPEX_matrix_nnz (&nx, X, NULL)) ;
+    TCOV_OK (SPEX_matrix_nnz (&ny, Y, NULL)) ;
+    assert (X->kind == Y->kind && X->m == Y->m && X->n == Y->n && nx == ny) ;
+    if (X->kind == SPEX_CSC)
+    {
+        for (int64_t j = 0 ; j <= X->n ; j++)
+        {
+            assert (X->p [j] == Y->p [j]) ;
+        }
+        for (int64_t p = 0 ; p < nx ; p++)
+        {
+            assert (X->i [p] == Y->i [p]) ;
+        }
+    }
+    for (int64_t p = 0 ; p < nx ; p++)
+    {
+        int r ;
+        TCOV_OK (SPEX_mpz_cmp (&r, X->x.mpz [p], Y->x.mpz [p])) ;
+        assert (r == 0) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// tcov_nthreads_test: test SPEX_Left_LU_factorize with several threads
+//------------------------------------------------------------------------------
+
+// The factorization must be the same for any number of threads.  Then each
+// allocation of the factorization with 4 threads is made to fail in turn, so
+// that the failures inside its parallel regions are tested as well, and all
+// memory must be freed when the factorization fails.
+
+static void tcov_nthreads_test (void)
+{
+    SPEX_info info ;
+    SPEX_matrix *A = NULL, *b = NULL ;
+    SPEX_matrix *L1 = NULL, *U1 = NULL, *rhos1 = NULL ;
+    SPEX_matrix *L = NULL, *U = NULL, *rhos = NULL ;
+    int64_t *pinv1 = NULL, *pinv = NULL ;
+    SPEX_LU_analysis *S = NULL ;
+    SPEX_options *option = NULL ;
+    int64_t n = TCOV_N ;
+
+    printf ("\n[ SPEX_Left_LU_factorize with several threads ------\n") ;
+
+    //--------------------------------------------------------------------------
+    // the factorization is the same for 1, 2, and 4 threads
+    //--------------------------------------------------------------------------
+
+    malloc_count = INT64_MAX ;
+    int64_t nblocks = tcov_nblocks ;
+    TCOV_OK (SPEX_initialize_expert (tcov_malloc, tcov_calloc, tcov_realloc,
+        tcov_free)) ;
+    TCOV_OK (SPEX_create_default_options (&option)) ;
+    assert (option->nthreads == 1) ;
+    tcov_create (&A, &b, option) ;
+    TCOV_OK (SPEX_LU_analyze (&S, A, option)) ;
+    TCOV_OK (SPEX_Left_LU_factorize (&L1, &U1, &rhos1, &pinv1, A, S, option));
+
+    for (int nthreads = 2 ; nthreads <= 4 ; nthreads += 2)
+    {
+        option->nthreads = nthreads ;
+        TCOV_OK (SPEX_Left_LU_factorize (&L, &U, &rhos, &pinv, A, S, option)) ;
+        tcov_same_mpz (L, L1) ;
+        tcov_same_mpz (U, U1) ;
+        tcov_same_mpz (rhos, rhos1) ;
+        for (int64_t i = 0 ; i < n ; i++)
+        {
+            assert (pinv [i] == pinv1 [i]) ;
+        }
+        TCOV_OK (SPEX_matrix_free (&L, option)) ;
+        TCOV_OK (SPEX_matrix_free (&U, option)) ;
+        TCOV_OK (SPEX_matrix_free (&rhos, option)) ;
+        SPEX_FREE (pinv) ;
+        printf ("nthreads %d: same factorization as 1 thread\n", nthreads) ;
+    }
+
+    TCOV_OK (SPEX_matrix_free (&L1, option)) ;
+    TCOV_OK (SPEX_matrix_free (&U1, option)) ;
+    TCOV_OK (SPEX_matrix_free (&rhos1, option)) ;
+    SPEX_FREE (pinv1) ;
+    TCOV_OK (SPEX_LU_analysis_free (&S, option)) ;
+    TCOV_OK (SPEX_matrix_free (&A, option)) ;
+    TCOV_OK (SPEX_matrix_free (&b, option)) ;
+    SPEX_FREE (option) ;
+    TCOV_OK (SPEX_finalize ( )) ;
+    assert (tcov_nblocks == nblocks) ;
+
+    //--------------------------------------------------------------------------
+    // out-of-memory failures with 4 threads
+    //--------------------------------------------------------------------------
+
+    tcov_nfail_parallel = 0 ;
+    for (int64_t count = 0 ; ; count++)
+    {
+        malloc_count = INT64_MAX ;
+        TCOV_OK (SPEX_initialize_expert (tcov_malloc, tcov_calloc,
+            tcov_realloc, tcov_free)) ;
+        TCOV_OK (SPEX_create_default_options (&option)) ;
+        option->nthreads = 4 ;
+        tcov_create (&A, &b, option) ;
+        TCOV_OK (SPEX_LU_analyze (&S, A, option)) ;
+
+        // allow count allocations in the factorization
+        malloc_count = count ;
+        info = SPEX_Left_LU_factorize (&L, &U, &rhos, &pinv, A, S, option) ;
+        malloc_count = INT64_MAX ;
+        bool ok = (info == SPEX_OK) ;
+        if (!ok)
+        {
+            assert (info == SPEX_OUT_OF_MEMORY) ;
+            assert (L == NULL && U == NULL && rhos == NULL && pinv == NULL) ;
+        }
+
+        TCOV_OK (SPEX_matrix_free (&L, option)) ;
+        TCOV_OK (SPEX_matrix_free (&U, option)) ;
+        TCOV_OK (SPEX_matrix_free (&rhos, option)) ;
+        SPEX_FREE (pinv) ;
+        TCOV_OK (SPEX_LU_analysis_free (&S, option)) ;
+        TCOV_OK (SPEX_matrix_free (&A, option)) ;
+        TCOV_OK (SPEX_matrix_free (&b, option)) ;
+        SPEX_FREE (option) ;
+        TCOV_OK (SPEX_finalize ( )) ;
+
+        // nothing is left allocated, even if the factorization failed
+        assert (tcov_nblocks == nblocks) ;
+        if (ok)
+        {
+            printf ("factorization succeeds with %"PRId64" mallocs\n", count);
+            break ;
+        }
+    }
+
+    // some of the failures occurred inside a parallel region
+    printf ("failures in a parallel region: %"PRId64"\n",
+        tcov_nfail_parallel) ;
+    #ifdef _OPENMP
+    assert (tcov_nfail_parallel > 0) ;
+    #endif
+    printf ("-----------------------------------------------]\n") ;
+}
+
+//------------------------------------------------------------------------------
+// tcov_gmp_pool_test: test the GMP memory pool
+//------------------------------------------------------------------------------
+
+// SPEX_initialize installs the SPEX memory functions in GMP, and
+// SPEX_finalize must restore the ones in use before.  In between, a solve
+// reuses blocks from the pool, and SPEX_gmp_pool_stats reports this.
+
+static void tcov_gmp_pool_test (void)
+{
+    SPEX_info info ;
+    SPEX_matrix *A = NULL, *b = NULL, *x = NULL ;
+    SPEX_options *option = NULL ;
+    void *(*alloc0) (size_t), *(*alloc1) (size_t) ;
+    void *(*realloc0) (void *, size_t, size_t), *(*realloc1) (void *, size_t,
+        size_t) ;
+    void (*free0) (void *, size_t), (*free1) (void *, size_t) ;
+    int64_t nalloc, nreuse, pool_bytes, pool_peak ;
+
+    printf ("\n[ SPEX_gmp_pool_stats -----------------------------\n") ;
+
+    // the GMP memory functions in use before SPEX_initialize
+    mp_get_memory_functions (&alloc0, &realloc0, &free0) ;
+    assert (SPEX_gmp_pool_stats (&nalloc, NULL, NULL, NULL) == SPEX_PANIC) ;
+
+    malloc_count = INT64_MAX ;
+    int64_t nblocks = tcov_nblocks ;
+    TCOV_OK (SPEX_initialize_expert (tcov_malloc, tcov_calloc, tcov_realloc,
+        tcov_free)) ;
+    mp_get_memory_functions (&alloc1, &realloc1, &free1) ;
+    assert (alloc1 == spex_gmp_allocate && realloc1 == spex_gmp_reallocate &&
+        free1 == spex_gmp_free) ;
+
+    // the pool is empty when SPEX starts
+    TCOV_OK (SPEX_gmp_pool_stats (&nalloc, &nreuse, &pool_bytes, &pool_peak)) ;
+    assert (nalloc == 0 && nreuse == 0 && pool_bytes == 0 && pool_peak == 0) ;
+
+    // blocks are reused by a solve, with 1 and 4 threads
+    TCOV_OK (SPEX_create_default_options (&option)) ;
+    tcov_create (&A, &b, option) ;
+    int64_t nalloc_prior = 0 ;
+    for (int nthreads = 1 ; nthreads <= 4 ; nthreads += 3)
+    {
+        option->nthreads = nthreads ;
+        TCOV_OK (SPEX_Left_LU_backslash (&x, SPEX_MPQ, A, b, option)) ;
+        TCOV_OK (SPEX_check_solution (A, x, b, option)) ;
+        TCOV_OK (SPEX_matrix_free (&x, option)) ;
+        TCOV_OK (SPEX_gmp_pool_stats (&nalloc, &nreuse, &pool_bytes,
+            &pool_peak)) ;
+        printf ("nthreads %d: GMP blocks %"PRId64", reused %"PRId64
+            ", pool bytes %"PRId64", peak %"PRId64"\n", nthreads, nalloc,
+            nreuse, pool_bytes, pool_peak) ;
+        assert (nalloc > nalloc_prior) ;
+        assert (nreuse > 0 && nreuse <= nalloc) ;
+        assert (pool_bytes > 0 && pool_bytes <= pool_peak) ;
+        nalloc_prior = nalloc ;
+    }
+
+    // any output may be NULL
+    TCOV_OK (SPEX_gmp_pool_stats (NULL, NULL, NULL, NULL)) ;
+
+    TCOV_OK (SPEX_matrix_free (&A, option)) ;
+    TCOV_OK (SPEX_matrix_free (&b, option)) ;
+    SPEX_FREE (option) ;
+    TCOV_OK (SPEX_finalize ( )) ;
+
+    // the pool has been freed, and GMP has its prior memory functions again
+    assert (tcov_nblocks == nblocks) ;
+    mp_get_memory_functions (&alloc1, &realloc1, &free1) ;
+    assert (alloc1 == alloc0 && realloc1 == realloc0 && free1 == free0) ;
+    assert (SPEX_gmp_pool_stats (&nalloc, NULL, NULL, NULL) == SPEX_PANIC) ;
+    printf ("-----------------------------------------------]\n") ;
+}
+
 int main( int argc, char* argv[])
 {
     bool IS_SIMPLE_TEST = true;
@@ -231,6 +510,18 @@ int main( int argc, char* argv[])
     SPEX_FREE (p4) ;
     TEST_OK (SPEX_finalize ( )) ;
 
+    //--------------------------------------------------------------------------
+    // test SPEX_Left_LU_factorize with several threads
+    //--------------------------------------------------------------------------
+
+    tcov_nthreads_test ( ) ;
+
+    //--------------------------------------------------------------------------
+    // test the GMP memory pool
+    //--------------------------------------------------------------------------
+
+    tcov_gmp_pool_test ( ) ;
+
     //--------------------------------------------------------------------------
     // run all trials
     //--------------------------------------------------------------------------
@@ -366,6 +657,9 @@ int main( int argc, char* argv[])
                     TEST_CHECK_FAILURE(SPEX_Left_LU_backslash(&sol, SPEX_MPQ, A,
                        b, option), SPEX_SINGULAR);
                     if (pretend_to_fail) continue ;
+                    TEST_CHECK_FAILURE(SPEX_Left_LU_modular_backslash(&sol,
+                       SPEX_MPQ, A, b, option), SPEX_SINGULAR);
+                    if (pretend_to_fail) continue ;
 
                     //free the memory alloc'd
                     TEST_OK (SPEX_matrix_free (&A, option)) ;
@@ -886,6 +1180,19 @@ int main( int argc, char* argv[])
                     if (pretend_to_fail) continue ;
                 }
 
+                // the multi-modular method gives the same solution
+                SPEX_matrix *sol2 = NULL;
+                TEST_CHECK(SPEX_Left_LU_modular_backslash(&sol2, SPEX_MPQ, A,
+                    b, option));
+                if (pretend_to_fail) continue ;
+                for (int64_t k = 0; k < sol->m * sol->n; k++)
+                {
+                    int r;
+                    TEST_OK (SPEX_mpq_equal(&r, sol->x.mpq[k], sol2->x.mpq[k]));
+                    assert (r != 0);
+                }
+                TEST_OK (SPEX_matrix_free(&sol2, option));
+
             }
             else
             {
@@ -913,6 +1220,12 @@ int main( int argc, char* argv[])
                     TEST_CHECK_FAILURE(SPEX_Left_LU_backslash(NULL, SPEX_MPZ,
                         A, b, option), SPEX_INCORRECT_INPUT);
                     if (pretend_to_fail) continue ;
+                    TEST_CHECK_FAILURE(SPEX_Left_LU_modular_backslash(&sol,
+                        SPEX_MPZ, A, b, option), SPEX_INCORRECT_INPUT);
+                    if (pretend_to_fail) continue ;
+                    TEST_CHECK_FAILURE(SPEX_Left_LU_modular_backslash(NULL,
+                        SPEX_MPQ, A, b, option), SPEX_INCORRECT_INPUT);
+                    if (pretend_to_fail) continue ;
                     // invalid kind
                     A->kind = 4;
                     int64_t tmp;
@@ -21,6 +21,7 @@ SPEX_info SPEX_finalize
 
     SPEX_mpfr_free_cache ( ) ;    // Free mpfr internal cache
     spex_gmp_finalize ( ) ;       // Reset GMP memory variables
+    spex_gmp_restore_memory_functions ( ) ;
 
     spex_set_initialized (false) ;
     return (SPEX_OK) ;
@@ -56,6 +56,13 @@
     }
 */
 
+// Blocks freed by GMP are not returned to the system right away.  Blocks of
+// up to 8*SPEX_GMP_POOL_NCLASS bytes are kept in a pool, with one free list
+// per size, and reused by spex_gmp_allocate.  Each pooled block is exactly
+// the size GMP asked for, so a block can always be freed with SPEX_FREE
+// instead, as the failure handler does.  The pool is freed by
+// spex_gmp_finalize.
+
 // The SPEX_GMP*_WRAPPER_START macros also take an single 'archive' parameter,
 // for the current mpz, mpq, or mpfr object being operated on.  A pointer
 // parameter to this parameter is kept so that it can be safely freed in case
@@ -85,6 +92,189 @@ mpz_ptr  spex_gmpz_archive  = NULL ;    // current mpz object
 mpq_ptr  spex_gmpq_archive  = NULL ;    // current mpq object
 mpfr_ptr spex_gmpfr_archive = NULL ;    // current mpfr object
 
+// GMP memory pool: spex_gmp_pool_head [c] is a list of free blocks of
+// 8*(c+1) bytes, linked through their first word
+static void   *spex_gmp_pool_head  [SPEX_GMP_POOL_NCLASS] ;
+static int64_t spex_gmp_pool_count [SPEX_GMP_POOL_NCLASS] ;
+static int64_t spex_gmp_pool_bytes  = 0 ;   // bytes held in the pool
+static int64_t spex_gmp_pool_peak   = 0 ;   // max of spex_gmp_pool_bytes
+static int64_t spex_gmp_pool_nalloc = 0 ;   // # of blocks allocated for GMP
+static int64_t spex_gmp_pool_nreuse = 0 ;   // # of those taken from the pool
+
+#ifdef _OPENMP
+// SPEX_Left_LU_factorize calls the GMP wrappers from several threads, so each
+// thread has its own wrapper state and pool.  The list of a worker thread is
+// created on its first allocation, and freed with spex_gmp_finalize.
+#pragma omp threadprivate (spex_gmp_environment, spex_gmp_nmalloc, \
+    spex_gmp_nlist, spex_gmp_list, spex_gmpz_archive, spex_gmpq_archive, \
+    spex_gmpfr_archive, spex_gmp_pool_head, spex_gmp_pool_count, \
+    spex_gmp_pool_bytes, spex_gmp_pool_peak, spex_gmp_pool_nalloc, \
+    spex_gmp_pool_nreuse)
+#endif
+
+// counts from threads whose pool has been freed by spex_gmp_finalize
+static int64_t spex_gmp_pool_nalloc_done = 0 ;
+static int64_t spex_gmp_pool_nreuse_done = 0 ;
+
+// GMP memory functions in use before SPEX_initialize
+static void *(*spex_gmp_old_allocate) (size_t) = NULL ;
+static void *(*spex_gmp_old_reallocate) (void *, size_t, size_t) = NULL ;
+static void  (*spex_gmp_old_free) (void *, size_t) = NULL ;
+
+//------------------------------------------------------------------------------
+// spex_gmp_pool_get: get a block from the pool
+//------------------------------------------------------------------------------
+
+/* Purpose: return a free block of the given size from the pool, or NULL if
+ * the pool has none.
+ */
+
+static inline void *spex_gmp_pool_get
+(
+    size_t size     // size of the block
+)
+{
+    spex_gmp_pool_nalloc++ ;
+    if (size == 0 || size % 8 != 0 || size > 8 * SPEX_GMP_POOL_NCLASS)
+    {
+        return (NULL) ;
+    }
+    int64_t c = (int64_t) (size / 8) - 1 ;
+    void *p = spex_gmp_pool_head [c] ;
+    if (p != NULL)
+    {
+        spex_gmp_pool_head [c] = *((void **) p) ;
+        spex_gmp_pool_count [c]-- ;
+        spex_gmp_pool_bytes -= (int64_t) size ;
+        spex_gmp_pool_nreuse++ ;
+    }
+    return (p) ;
+}
+
+//------------------------------------------------------------------------------
+// spex_gmp_pool_put: return a block to the pool
+//------------------------------------------------------------------------------
+
+/* Purpose: keep a block freed by GMP in the pool.  Returns false if the block
+ * is not kept, in which case the caller must free it.
+ */
+
+static inline bool spex_gmp_pool_put
+(
+    void *p,        // block to keep
+    size_t size     // size of p
+)
+{
+    if (size == 0 || size % 8 != 0 || size > 8 * SPEX_GMP_POOL_NCLASS)
+    {
+        return (false) ;
+    }
+    int64_t c = (int64_t) (size / 8) - 1 ;
+    if (spex_gmp_pool_count [c] >= SPEX_GMP_POOL_DEPTH)
+    {
+        return (false) ;
+    }
+    *((void **) p) = spex_gmp_pool_head [c] ;
+    spex_gmp_pool_head [c] = p ;
+    spex_gmp_pool_count [c]++ ;
+    spex_gmp_pool_bytes += (int64_t) size ;
+    spex_gmp_pool_peak = SPEX_MAX (spex_gmp_pool_peak, spex_gmp_pool_bytes) ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// spex_gmp_pool_release: free all blocks in the pool
+//------------------------------------------------------------------------------
+
+static void spex_gmp_pool_release ( void )
+{
+    for (int64_t c = 0 ; c < SPEX_GMP_POOL_NCLASS ; c++)
+    {
+        void *p = spex_gmp_pool_head [c] ;
+        while (p != NULL)
+        {
+            void *next = *((void **) p) ;
+            SPEX_FREE (p) ;
+            p = next ;
+        }
+        spex_gmp_pool_head [c] = NULL ;
+        spex_gmp_pool_count [c] = 0 ;
+    }
+    spex_gmp_pool_bytes = 0 ;
+
+    // keep the counts of this thread for SPEX_gmp_pool_stats
+    #pragma omp atomic
+    spex_gmp_pool_nalloc_done += spex_gmp_pool_nalloc ;
+    #pragma omp atomic
+    spex_gmp_pool_nreuse_done += spex_gmp_pool_nreuse ;
+    spex_gmp_pool_nalloc = 0 ;
+    spex_gmp_pool_nreuse = 0 ;
+}
+
+//------------------------------------------------------------------------------
+// spex_gmp_set_memory_functions: use the SPEX memory functions in GMP
+//------------------------------------------------------------------------------
+
+/* Purpose: called by SPEX_initialize.  The GMP memory functions in use are
+ * kept, and restored by SPEX_finalize.
+ */
+
+void spex_gmp_set_memory_functions ( void )
+{
+    mp_get_memory_functions (&spex_gmp_old_allocate, &spex_gmp_old_reallocate,
+        &spex_gmp_old_free) ;
+    mp_set_memory_functions (spex_gmp_allocate, spex_gmp_reallocate,
+        spex_gmp_free) ;
+    spex_gmp_pool_nalloc = 0 ;
+    spex_gmp_pool_nreuse = 0 ;
+    spex_gmp_pool_peak = 0 ;
+    spex_gmp_pool_nalloc_done = 0 ;
+    spex_gmp_pool_nreuse_done = 0 ;
+}
+
+//------------------------------------------------------------------------------
+// spex_gmp_restore_memory_functions: restore the prior GMP memory functions
+//------------------------------------------------------------------------------
+
+void spex_gmp_restore_memory_functions ( void )
+{
+    mp_set_memory_functions (spex_gmp_old_allocate, spex_gmp_old_reallocate,
+        spex_gmp_old_free) ;
+}
+
+//------------------------------------------------------------------------------
+// SPEX_gmp_pool_stats: statistics of the GMP memory pool
+//------------------------------------------------------------------------------
+
+/* Purpose: return the number of blocks allocated for GMP since
+ * SPEX_initialize, and how many of them were reused from the pool, for the
+ * calling thread and all worker threads that have finished.  The current and
+ * peak size of the pool are those of the calling thread.  Any output may be
+ * NULL.
+ */
+
+SPEX_info SPEX_gmp_pool_stats
+(
+    int64_t *nalloc,        // # of blocks allocated for GMP
+    int64_t *nreuse,        // # of those blocks taken from the pool
+    int64_t *pool_bytes,    // # of bytes currently held in the pool
+    int64_t *pool_peak      // max # of bytes held in the pool
+)
+{
+    if (!spex_initialized ( )) return (SPEX_PANIC) ;
+    if (nalloc != NULL)
+    {
+        (*nalloc) = spex_gmp_pool_nalloc + spex_gmp_pool_nalloc_done ;
+    }
+    if (nreuse != NULL)
+    {
+        (*nreuse) = spex_gmp_pool_nreuse + spex_gmp_pool_nreuse_done ;
+    }
+    if (pool_bytes != NULL) (*pool_bytes) = spex_gmp_pool_bytes ;
+    if (pool_peak  != NULL) (*pool_peak ) = spex_gmp_pool_peak ;
+    return (SPEX_OK) ;
+}
+
 //------------------------------------------------------------------------------
 // spex_gmp_init: initialize gmp
 //------------------------------------------------------------------------------
@@ -115,6 +305,7 @@ void spex_gmp_finalize ( )
     spex_gmp_nmalloc = 0 ;
     spex_gmp_nlist = 0 ;
     SPEX_FREE (spex_gmp_list) ;
+    spex_gmp_pool_release ( ) ;
 }
 
 //------------------------------------------------------------------------------
@@ -190,10 +381,14 @@ void *spex_gmp_allocate
     }
 
     //--------------------------------------------------------------------------
-    // malloc the block
+    // get the block from the pool, or malloc it
     //--------------------------------------------------------------------------
 
-    void *p = SPEX_malloc (size) ;
+    void *p = spex_gmp_pool_get (size) ;
+    if (p == NULL)
+    {
+        p = SPEX_malloc (size) ;
+    }
 
     if (p == NULL)
     {
@@ -221,11 +416,11 @@ void *spex_gmp_allocate
 // spex_gmp_free: free space for gmp
 //------------------------------------------------------------------------------
 
-/* Purpose: Free space for GMP */
+/* Purpose: Free space for GMP, keeping the block in the pool if possible */
 void spex_gmp_free
 (
     void *p,        // Block to be freed
-    size_t size     // Size of p (currently an unused parameter)
+    size_t size     // Size of p
 )
 {
     #ifdef SPEX_GMP_MEMORY_DEBUG
@@ -257,7 +452,14 @@ void spex_gmp_free
     // SPEX_gmp_list if it was allocated inside the current GMP function.
     // If the block was allocated by one GMP function and freed by another,
     // it is not in the list.
-    SPEX_GMP_SAFE_FREE (p) ;
+    if (p != NULL)
+    {
+        SPEX_GMP_FORGET (p) ;
+        if (!spex_gmp_pool_put (p, size))
+        {
+            SPEX_FREE (p) ;
+        }
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -811,6 +1013,7 @@ SPEX_info SPEX_mpz_add
     SPEX_GMP_WRAPPER_FINISH ;
     return (SPEX_OK) ;
 }
+#endif
 
 //------------------------------------------------------------------------------
 // SPEX_mpz_addmul
@@ -832,8 +1035,6 @@ SPEX_info SPEX_mpz_addmul
     return (SPEX_OK) ;
 }
 
-#endif
-
 //------------------------------------------------------------------------------
 // SPEX_mpz_submul
 //------------------------------------------------------------------------------
@@ -879,6 +1080,56 @@ SPEX_info SPEX_mpz_divexact
     return (SPEX_OK) ;
 }
 
+//------------------------------------------------------------------------------
+// SPEX_mpz_fdiv_q
+//------------------------------------------------------------------------------
+
+/* Purpose: Safe version of floor division, i.e., q = floor (n / d) */
+
+SPEX_info SPEX_mpz_fdiv_q
+(
+    mpz_t q,
+    const mpz_t n,
+    const mpz_t d
+)
+{
+    SPEX_GMPZ_WRAPPER_START (q) ;
+    if (mpz_sgn(d) == 0)
+    {
+        SPEX_GMP_WRAPPER_FINISH;
+        return SPEX_PANIC;
+    }
+    mpz_fdiv_q (q, n, d) ;
+    SPEX_GMP_WRAPPER_FINISH ;
+    return (SPEX_OK) ;
+}
+
+//------------------------------------------------------------------------------
+// SPEX_mpz_fdiv_r
+//------------------------------------------------------------------------------
+
+/* Purpose: Safe version of the remainder of floor division, i.e.,
+ * r = n - d * floor (n / d).  r has the same sign as d.
+ */
+
+SPEX_info SPEX_mpz_fdiv_r
+(
+    mpz_t r,
+    const mpz_t n,
+    const mpz_t d
+)
+{
+    SPEX_GMPZ_WRAPPER_START (r) ;
+    if (mpz_sgn(d) == 0)
+    {
+        SPEX_GMP_WRAPPER_FINISH;
+        return SPEX_PANIC;
+    }
+    mpz_fdiv_r (r, n, d) ;
+    SPEX_GMP_WRAPPER_FINISH ;
+    return (SPEX_OK) ;
+}
+
 //------------------------------------------------------------------------------
 // SPEX_mpz_gcd
 //------------------------------------------------------------------------------
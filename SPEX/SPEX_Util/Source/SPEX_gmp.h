@@ -64,8 +64,8 @@
     spex_gmp_nmalloc = 0 ;                                              \
 }
 
-// free a block of memory, and also remove it from the archive if it's there
-#define SPEX_GMP_SAFE_FREE(p)                                           \
+// remove a block of memory from the archive if it's there
+#define SPEX_GMP_FORGET(p)                                              \
 {                                                                       \
     if (spex_gmpz_archive != NULL)                                      \
     {                                                                   \
@@ -92,6 +92,12 @@
             SPEX_MPFR_MANT(spex_gmpfr_archive) = NULL ;                 \
         }                                                               \
     }                                                                   \
+}
+
+// free a block of memory, and also remove it from the archive if it's there
+#define SPEX_GMP_SAFE_FREE(p)                                           \
+{                                                                       \
+    SPEX_GMP_FORGET (p) ;                                               \
     SPEX_FREE (p) ;                                                     \
 }
 
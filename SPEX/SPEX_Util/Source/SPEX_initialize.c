@@ -39,8 +39,7 @@ SPEX_info SPEX_initialize ( void )
 {
     if (spex_initialized ( )) return (SPEX_PANIC) ;
 
-    mp_set_memory_functions (spex_gmp_allocate, spex_gmp_reallocate,
-        spex_gmp_free) ;
+    spex_gmp_set_memory_functions ( ) ;
 
     spex_set_initialized (true) ;
     return (SPEX_OK) ;
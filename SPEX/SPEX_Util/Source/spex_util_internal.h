@@ -164,10 +164,25 @@ extern int64_t spex_gmp_ntrials ;
 #endif
 
 
+#ifndef SPEX_GMP_POOL_NCLASS
+// The GMP memory pool keeps freed blocks of 8, 16, ..., 8*SPEX_GMP_POOL_NCLASS
+// bytes for reuse, up to SPEX_GMP_POOL_DEPTH blocks of each size, per thread.
+// Larger blocks, and blocks whose size is not a multiple of 8, are not pooled.
+#define SPEX_GMP_POOL_NCLASS 64
+#endif
+
+#ifndef SPEX_GMP_POOL_DEPTH
+#define SPEX_GMP_POOL_DEPTH 256
+#endif
+
 bool spex_gmp_init (void) ;
 
 void spex_gmp_finalize (void) ;
 
+void spex_gmp_set_memory_functions (void) ;
+
+void spex_gmp_restore_memory_functions (void) ;
+
 void *spex_gmp_allocate (size_t size) ;
 
 void spex_gmp_free (void *p, size_t size) ;
@@ -208,6 +223,9 @@ void spex_gmp_failure (int status) ;
 // MPFR precision used (quad is default)
 #define SPEX_DEFAULT_PRECISION 128
 
+// Number of threads used by SPEX Left LU (1: no parallelism)
+#define SPEX_DEFAULT_NTHREADS 1
+
 //------------------------------------------------------------------------------
 // Type of MPFR rounding used.
 //------------------------------------------------------------------------------
@@ -254,6 +272,9 @@ void spex_gmp_failure (int status) ;
 #define SPEX_OPTION_ROUND(option) \
     SPEX_OPTION (option, round, SPEX_DEFAULT_MPFR_ROUND)
 
+#define SPEX_OPTION_NTHREADS(option) \
+    SPEX_OPTION (option, nthreads, SPEX_DEFAULT_NTHREADS)
+
 //------------------------------------------------------------------------------
 // Field access macros for MPZ/MPQ/MPFR struct
 //------------------------------------------------------------------------------
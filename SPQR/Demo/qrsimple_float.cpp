@@ -0,0 +1,100 @@
+// =============================================================================
+// === qrsimple_float.cpp ======================================================
+// =============================================================================
+
+// SPQR, Copyright (c) 2008-2022, Timothy A Davis. All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+// A very simple example of SuiteSparseQR in single precision.  The matrix is
+// read in double, converted to single, and x=A\b is found in single precision
+// both with the backslash function and with an explicit factorization.  The
+// residuals are computed in double precision.
+// Usage:  qrsimple_float < Matrix_in_MatrixMarket_format
+
+#include "SuiteSparseQR.hpp"
+
+template <typename Entry> void qrsimple_float
+(
+    cholmod_sparse *A,      // double precision matrix
+    int xtype,              // CHOLMOD_REAL or CHOLMOD_COMPLEX, + CHOLMOD_SINGLE
+    cholmod_common *cc
+)
+{
+    cholmod_sparse *A1 ;
+    cholmod_dense *X, *B, *Y, *B1, *Residual = NULL ;
+    SuiteSparseQR_factorization <Entry> *QR ;
+    double rnorm, one [2] = {1,0}, minusone [2] = {-1,0} ;
+
+    // A1 = single (A), B1 = ones (size (A,1),1,'single')
+    A1 = cholmod_l_copy_sparse (A, cc) ;
+    cholmod_l_sparse_xtype (xtype, A1, cc) ;
+    B1 = cholmod_l_ones (A->nrow, 1, xtype, cc) ;
+    B = cholmod_l_ones (A->nrow, 1, A->xtype, cc) ;
+
+    for (int method = 0 ; method <= 1 ; method++)
+    {
+        if (method == 0)
+        {
+            // X = A1\B1
+            X = SuiteSparseQR <Entry> (A1, B1, cc) ;
+        }
+        else
+        {
+            // [Q,R,E] = qr (A1), X = E*(R\(Q'*B1))
+            QR = SuiteSparseQR_factorize <Entry> (SPQR_ORDERING_DEFAULT,
+                SPQR_DEFAULT_TOL, A1, cc) ;
+            Y = SuiteSparseQR_qmult <Entry> (SPQR_QTX, QR, B1, cc) ;
+            X = SuiteSparseQR_solve <Entry> (SPQR_RETX_EQUALS_B, QR, Y, cc) ;
+            SuiteSparseQR_free <Entry> (&QR, cc) ;
+            cholmod_l_free_dense (&Y, cc) ;
+        }
+
+#ifndef NMATRIXOPS
+        // rnorm = norm (B-A*double(X))
+        cholmod_l_dense_xtype (A->xtype + CHOLMOD_DOUBLE, X, cc) ;
+        Residual = cholmod_l_copy_dense (B, cc) ;
+        cholmod_l_sdmult (A, 0, minusone, one, X, Residual, cc) ;
+        rnorm = cholmod_l_norm_dense (Residual, 2, cc) ;
+        printf ("%s 2-norm of residual: %8.1e\n",
+            method ? "factorize+solve:" : "backslash:      ", rnorm) ;
+#else
+        printf ("2-norm of residual: not computed (requires CHOLMOD/MatrixOps)\n") ;
+#endif
+        printf ("rank %" PRId64 "\n", cc->SPQR_istat [4]) ;
+        cholmod_l_free_dense (&Residual, cc) ;
+        cholmod_l_free_dense (&X, cc) ;
+    }
+
+    cholmod_l_free_sparse (&A1, cc) ;
+    cholmod_l_free_dense (&B1, cc) ;
+    cholmod_l_free_dense (&B, cc) ;
+}
+
+int main (int argc, char **argv)
+{
+    cholmod_common Common, *cc ;
+    cholmod_sparse *A ;
+    int mtype ;
+
+    // start CHOLMOD
+    cc = &Common ;
+    cholmod_l_start (cc) ;
+
+    // load A
+    A = (cholmod_sparse *)
+        cholmod_l_read_matrix (stdin, 1, &mtype, cc) ;
+
+    if (A->xtype == CHOLMOD_REAL)
+    {
+        qrsimple_float <float> (A, CHOLMOD_REAL + CHOLMOD_SINGLE, cc) ;
+    }
+    else
+    {
+        qrsimple_float <FComplex> (A, CHOLMOD_COMPLEX + CHOLMOD_SINGLE, cc) ;
+    }
+
+    // free everything and finish CHOLMOD
+    cholmod_l_free_sparse (&A, cc) ;
+    cholmod_l_finish (cc) ;
+    return (0) ;
+}
@@ -82,3 +82,4 @@ info.atrnorm               = gpu_results (16) / atanorm ;
 %   #define SPQR_ORDERING_DEFAULT 7     /* SuiteSparseQR default ordering */
 %   #define SPQR_ORDERING_BEST 8        /* try COLAMD, AMD, and METIS; pick best */
 %   #define SPQR_ORDERING_BESTAMD 9     /* try COLAMD and AMD; pick best */
+%   #define SPQR_ORDERING_MONGOOSE 10   /* nested dissection of A'*A, Mongoose */
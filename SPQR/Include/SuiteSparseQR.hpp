@@ -28,6 +28,7 @@ extern "C"
 
 #include <complex>
 typedef std::complex<double> Complex ;
+typedef std::complex<float> FComplex ;
 
 // =============================================================================
 // === spqr_gpu ================================================================
@@ -312,9 +313,13 @@ template <typename Entry, typename Int = int64_t> struct spqr_numeric
 } ;
 extern template struct spqr_numeric <double, int32_t>;
 extern template struct spqr_numeric <Complex, int32_t>;
+extern template struct spqr_numeric <float, int32_t>;
+extern template struct spqr_numeric <FComplex, int32_t>;
 
 extern template struct spqr_numeric <double, int64_t>;
 extern template struct spqr_numeric <Complex, int64_t>;
+extern template struct spqr_numeric <float, int64_t>;
+extern template struct spqr_numeric <FComplex, int64_t>;
 
 // =============================================================================
 // === SuiteSparseQR_factorization =============================================
@@ -551,6 +556,59 @@ template <typename Entry, typename Int = int64_t> cholmod_sparse *SuiteSparseQR_
     cholmod_common *cc
 ) ;
 
+// =============================================================================
+// === SuiteSparseQR_append_rows ===============================================
+// =============================================================================
+
+// These functions take as input the R factor, C = Q'*B, and E returned by
+// SuiteSparseQR (ordering, tol, econ, A, B, &C, &R, &E, cc) above.
+
+// update R and C with new rows [Anew Bnew]; returns TRUE if successful
+template <typename Entry, typename Int = int64_t> int SuiteSparseQR_append_rows
+(
+    // inputs, not modified
+    cholmod_sparse *Anew,   // k-by-n, the rows to append to A
+    cholmod_dense *Bnew,    // k-by-nrhs, the rows to append to B (may be NULL)
+    Int *E,                 // size n, column permutation of R (NULL if identity)
+
+    // input/output
+    cholmod_sparse **p_R,   // e-by-n R factor of A(:,E) on input,
+                            // R factor of [A;Anew](:,E) on output
+    cholmod_dense **p_C,    // C = Q'*B on input, Q'*[B;Bnew] on output
+                            // (may be NULL)
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+
+// returns X = E*(R\C) of size n-by-nrhs, or NULL on failure
+template <typename Entry, typename Int = int64_t> cholmod_dense
+*SuiteSparseQR_rsolve
+(
+    // inputs, not modified
+    cholmod_sparse *R,      // e-by-n R factor of A(:,E)
+    Int *E,                 // size n, column permutation of R (NULL if identity)
+    cholmod_dense *C,       // e-by-nrhs
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+
+// returns X = A\B of size n-by-nrhs, the least-squares solution found with R
+// alone by the corrected seminormal equations, or NULL on failure
+template <typename Entry, typename Int = int64_t> cholmod_dense
+*SuiteSparseQR_csne
+(
+    // inputs, not modified
+    cholmod_sparse *A,      // m-by-n sparse matrix
+    cholmod_sparse *R,      // e-by-n R factor of A(:,E)
+    Int *E,                 // size n, column permutation of R (NULL if identity)
+    cholmod_dense *B,       // m-by-nrhs
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+
 // =============================================================================
 // === Expert user-callable SuiteSparseQR functions ============================
 // =============================================================================
@@ -681,6 +739,24 @@ extern template int SuiteSparseQR_numeric <Complex, int32_t>
     SuiteSparseQR_factorization <Complex, int32_t> *QR,
     cholmod_common *cc      // workspace and parameters
 ) ;
+extern template int SuiteSparseQR_numeric <float, int32_t>
+(
+    // inputs:
+    double tol,             // treat columns with 2-norm <= tol as zero
+    cholmod_sparse *A,      // sparse matrix to factorize
+    // input/output
+    SuiteSparseQR_factorization <float, int32_t> *QR,
+    cholmod_common *cc      // workspace and parameters
+) ;
+extern template int SuiteSparseQR_numeric <FComplex, int32_t>
+(
+    // inputs:
+    double tol,             // treat columns with 2-norm <= tol as zero
+    cholmod_sparse *A,      // sparse matrix to factorize
+    // input/output
+    SuiteSparseQR_factorization <FComplex, int32_t> *QR,
+    cholmod_common *cc      // workspace and parameters
+) ;
 extern template int SuiteSparseQR_numeric <double, int64_t>
 (
     // inputs:
@@ -700,6 +776,24 @@ extern template int SuiteSparseQR_numeric <Complex, int64_t>
     SuiteSparseQR_factorization <Complex, int64_t> *QR,
     cholmod_common *cc      // workspace and parameters
 ) ;
+extern template int SuiteSparseQR_numeric <float, int64_t>
+(
+    // inputs:
+    double tol,             // treat columns with 2-norm <= tol as zero
+    cholmod_sparse *A,      // sparse matrix to factorize
+    // input/output
+    SuiteSparseQR_factorization <float, int64_t> *QR,
+    cholmod_common *cc      // workspace and parameters
+) ;
+extern template int SuiteSparseQR_numeric <FComplex, int64_t>
+(
+    // inputs:
+    double tol,             // treat columns with 2-norm <= tol as zero
+    cholmod_sparse *A,      // sparse matrix to factorize
+    // input/output
+    SuiteSparseQR_factorization <FComplex, int64_t> *QR,
+    cholmod_common *cc      // workspace and parameters
+) ;
 #endif
 
 #endif
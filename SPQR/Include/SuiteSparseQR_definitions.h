@@ -23,6 +23,7 @@
 #define SPQR_ORDERING_DEFAULT 7     /* SuiteSparseQR default ordering */
 #define SPQR_ORDERING_BEST 8        /* try COLAMD, AMD, and METIS; pick best */
 #define SPQR_ORDERING_BESTAMD 9     /* try COLAMD and AMD; pick best */
+#define SPQR_ORDERING_MONGOOSE 10   /* nested dissection of A'*A, Mongoose */
 
 /* Let [m n] = size of the matrix after pruning singletons.  The default
  * ordering strategy is to use COLAMD if m <= 2*n.  Otherwise, AMD(A'A) is
@@ -127,7 +127,7 @@
 
 #define RETURN_IF_XTYPE_INVALID(A,result) \
 { \
-    if (A->xtype != xtype) \
+    if (A->xtype + A->dtype != xtype) \
     { \
         ERROR (CHOLMOD_INVALID, "invalid xtype") ; \
         return (result) ; \
@@ -201,6 +201,36 @@
 #define FLOP_COUNT(f) { if (cc->SPQR_grain <= 1) cc->SPQR_flopcount += ((double) (f)) ; }
 #define FLOP_COUNT2(f1,f2) FLOP_COUNT(((double) (f1)) * ((double) (f2)))
 
+// -----------------------------------------------------------------------------
+// OpenMP support
+// -----------------------------------------------------------------------------
+
+// Returns the # of OpenMP threads to use for a given amount of work.  Each
+// thread is given at least cc->chunk work, and at most cc->SPQR_nthreads
+// threads are used (all of them if cc->SPQR_nthreads is zero).
+
+static inline int spqr_nthreads
+(
+    double work,                // total work to do
+    cholmod_common *cc
+)
+{
+    #ifdef _OPENMP
+    double chunk = MAX (cc->chunk, 1) ;
+    int nthreads_max = cc->SPQR_nthreads ;
+    if (nthreads_max <= 0)
+    {
+        nthreads_max = SUITESPARSE_OPENMP_MAX_THREADS ;
+    }
+    double nthreads = floor (MAX (work, 1) / chunk) ;
+    nthreads = MIN (nthreads, nthreads_max) ;
+    nthreads = MAX (nthreads, 1) ;
+    return ((int) nthreads) ;
+    #else
+    return (1) ;
+    #endif
+}
+
 // =============================================================================
 // === spqr_work ===============================================================
 // =============================================================================
@@ -652,6 +682,19 @@ template <typename Entry, typename Int = int64_t> int spqr_1colamd
     cholmod_common *cc
 ) ;
 
+template <typename Int = int64_t> int spqr_best_ordering
+(
+    // input
+    cholmod_sparse *AT,     // n-by-m, the transpose of A, not modified
+
+    // output
+    Int *Perm,              // size n, the best ordering found
+    int *p_ordering,        // the CHOLMOD ordering used for Perm
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+
 template <typename Entry, typename Int = int64_t> int spqr_1fixed
 (
     // inputs, not modified
@@ -1115,6 +1158,16 @@ inline Complex spqr_conj (Complex x)
     return (std::conj (x)) ;
 }
 
+inline float spqr_conj (float x)
+{
+    return (x) ;
+}
+
+inline FComplex spqr_conj (FComplex x)
+{
+    return (std::conj (x)) ;
+}
+
 
 // =============================================================================
 // === spqr_abs ================================================================
@@ -1130,6 +1183,16 @@ inline double spqr_abs (Complex x)
     return (SuiteSparse_config_hypot (x.real ( ), x.imag ( ))) ;
 }
 
+inline double spqr_abs (float x)
+{
+    return (fabs ((double) x)) ;
+}
+
+inline double spqr_abs (FComplex x)
+{
+    return (SuiteSparse_config_hypot (x.real ( ), x.imag ( ))) ;
+}
+
 
 // =============================================================================
 // === spqr_divide =============================================================
@@ -1148,6 +1211,19 @@ inline Complex spqr_divide (Complex a, Complex b)
     return (Complex (creal, cimag)) ;
 }
 
+inline float spqr_divide (float a, float b)
+{
+    return (a/b) ;
+}
+
+inline FComplex spqr_divide (FComplex a, FComplex b)
+{
+    double creal, cimag ;
+    SuiteSparse_config_divcomplex
+        (a.real(), a.imag(), b.real(), b.imag(), &creal, &cimag) ;
+    return (FComplex ((float) creal, (float) cimag)) ;
+}
+
 
 // =============================================================================
 // === spqr_add ================================================================
@@ -71,6 +71,9 @@ end
 
 flags = [flags ' -DBLAS64'] ;
 
+% the MATLAB interface does not compile the C++ Mongoose library
+flags = [flags ' -DNMONGOOSE'] ;
+
 if (~(ispc || ismac))
     % for POSIX timing routine
     lib = [lib ' -lrt'] ;
@@ -78,7 +81,11 @@ end
 
 %-------------------------------------------------------------------------------
 
-config_src = { '../../SuiteSparse_config/SuiteSparse_config' } ;
+config_src = { ...
+    '../../SuiteSparse_config/SuiteSparse_config', ...
+    '../../SuiteSparse_config/SuiteSparse_memstats', ...
+    '../../SuiteSparse_config/SuiteSparse_trace', ...
+    '../../SuiteSparse_config/SuiteSparse_memory' } ;
 
 amd_c_src = { ...
     '../../AMD/Source/amd_l1', ...
@@ -353,6 +360,7 @@ spqr_cpp_src = {
     '../Source/spqr_analyze', ...
     '../Source/spqr_append', ...
     '../Source/spqr_assemble', ...
+    '../Source/spqr_best_ordering', ...
     '../Source/spqr_cpack', ...
     '../Source/spqr_csize', ...
     '../Source/spqr_cumsum', ...
@@ -141,6 +141,7 @@ void spqr_mx_spumoni
         case SPQR_ORDERING_CHOLMOD: mexPrintf ("best'\n") ;    break ;
         case SPQR_ORDERING_AMD:     mexPrintf ("amd'\n") ;     break ;
         case SPQR_ORDERING_METIS:   mexPrintf ("metis'\n") ;   break ;
+        case SPQR_ORDERING_MONGOOSE: mexPrintf ("mongoose'\n") ; break ;
         case SPQR_ORDERING_DEFAULT: mexPrintf ("default'\n") ; break ;
         default: mexPrintf ("undefined'\n") ; break ;
     }
@@ -394,6 +395,10 @@ int spqr_mx_get_options
             {
                 opts->ordering = SPQR_ORDERING_METIS ;
             }
+            else if (strcmp (s, "mongoose") == 0)
+            {
+                opts->ordering = SPQR_ORDERING_MONGOOSE ;
+            }
             else if (strcmp (s, "best") == 0)
             {
                 opts->ordering = SPQR_ORDERING_BEST ;
@@ -1019,6 +1024,9 @@ mxArray *spqr_mx_info       // return a struct with info statistics
         case SPQR_ORDERING_METIS:
             ord = mxCreateString ("metis") ;
             break ;
+        case SPQR_ORDERING_MONGOOSE:
+            ord = mxCreateString ("mongoose") ;
+            break ;
         default:
             ord = mxCreateString ("unknown") ;
             break ;
@@ -0,0 +1,373 @@
+// =============================================================================
+// === SuiteSparseQR_csne ======================================================
+// =============================================================================
+
+// SPQR, Copyright (c) 2008-2022, Timothy A Davis. All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+// Least-squares solution of min ||A*X-B|| by the corrected seminormal
+// equations (CSNE), using the R factor of the Q-less QR factorization
+// A(:,E) = Q*R returned by
+//
+//      rank = SuiteSparseQR <Entry> (ordering, tol, econ, A, B, &C, &R, &E, cc)
+//
+// (or updated by SuiteSparseQR_append_rows).  Since R'*R = (A*E)'*(A*E), the
+// normal equations A'*A*X = A'*B can be solved with R alone:
+//
+//      X = E*(R\(R'\(E'*A'*B)))                    seminormal equations
+//      X = X + E*(R\(R'\(E'*A'*(B-A*X))))          one step of correction
+//
+// Neither Q nor its Householder vectors are needed, so a factorization done
+// once can be used for any number of new right-hand-sides B, at the cost of
+// two solves with R and two sparse matrix-vector products with A each time.
+// The correction step brings the accuracy close to that of the solution with
+// Q, as long as A is not too ill-conditioned (Bjorck, Numerical Methods for
+// Least Squares Problems, 1996, Section 6.6.5).
+//
+// If A is rank deficient, the columns of R without a diagonal entry are
+// treated as zero, giving a basic solution as SuiteSparseQR_rsolve does.
+
+#include "spqr.hpp"
+
+// =============================================================================
+// === spqr_private_sne ========================================================
+// =============================================================================
+
+// Solves the seminormal equations R'*R*X(E,:) = (A*E)'*B, for the m-by-nrhs
+// dense B held in Bx with leading dimension ldb.  Z is e-by-nrhs workspace.
+// Lead [j] is the row of R whose leading column is j, or EMPTY if none.
+// Returns X, or NULL if out of memory.
+
+template <typename Entry, typename Int> cholmod_dense *spqr_private_sne
+(
+    cholmod_sparse *A,
+    cholmod_sparse *R,
+    Int *E,
+    Int *Lead,
+    Entry *Bx,
+    Int ldb,
+    Int nrhs,
+    cholmod_dense *Z,
+    cholmod_common *cc
+)
+{
+    Int *Ap = (Int *) A->p ;
+    Int *Ai = (Int *) A->i ;
+    Entry *Ax = (Entry *) A->x ;
+    Int *Rp = (Int *) R->p ;
+    Int *Ri = (Int *) R->i ;
+    Entry *Rx = (Entry *) R->x ;
+    Entry *Zx = (Entry *) Z->x ;
+    Int n = R->ncol ;
+    Int erow = R->nrow ;
+
+    for (Int kk = 0 ; kk < nrhs ; kk++)
+    {
+        Entry *Zk = Zx + kk*erow ;
+        Entry *Bk = Bx + kk*ldb ;
+        for (Int i = 0 ; i < erow ; i++)
+        {
+            Zk [i] = 0 ;
+        }
+
+        // ---------------------------------------------------------------------
+        // Z(:,kk) = R'\(A(:,E)'*B(:,kk)), by columns of R from first to last
+        // ---------------------------------------------------------------------
+
+        for (Int j = 0 ; j < n ; j++)
+        {
+            Int i = Lead [j] ;
+            if (i == EMPTY) continue ;
+
+            // z = A(:,E(j))'*B(:,kk)
+            Int col = E ? E [j] : j ;
+            Entry z = 0 ;
+            for (Int p = Ap [col] ; p < Ap [col+1] ; p++)
+            {
+                z += spqr_conj (Ax [p]) * Bk [Ai [p]] ;
+            }
+
+            // z = z - R(0:i-1,j)'*Z(0:i-1,kk), and find R(i,j)
+            Entry rjj = 0 ;
+            for (Int p = Rp [j] ; p < Rp [j+1] ; p++)
+            {
+                Int k = Ri [p] ;
+                if (k == i)
+                {
+                    rjj = Rx [p] ;
+                }
+                else
+                {
+                    z -= spqr_conj (Rx [p]) * Zk [k] ;
+                }
+            }
+            Zk [i] = (rjj == (Entry) 0) ? 0 : spqr_divide (z, spqr_conj (rjj)) ;
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // X = E*(R\Z)
+    // -------------------------------------------------------------------------
+
+    return (SuiteSparseQR_rsolve <Entry, Int> (R, E, Z, cc)) ;
+}
+
+// =============================================================================
+// === SuiteSparseQR_csne ======================================================
+// =============================================================================
+
+// Returns the n-by-nrhs solution X, or NULL on failure.  A must be the same
+// m-by-n matrix whose R factor is given (or [A;Anew] if rows were appended to
+// R), and B is m-by-nrhs.  A and R must be packed.
+
+template <typename Entry, typename Int> cholmod_dense *SuiteSparseQR_csne
+(
+    // inputs, not modified
+    cholmod_sparse *A,      // m-by-n sparse matrix
+    cholmod_sparse *R,      // e-by-n R factor of A(:,E)
+    Int *E,                 // size n, column permutation of R (NULL if identity)
+    cholmod_dense *B,       // m-by-nrhs
+
+    // workspace and parameters
+    cholmod_common *cc
+)
+{
+    cholmod_dense *X, *D, *Z ;
+    Int *Ap, *Ai, *Rp, *Ri, *Lead, *Mark ;
+    Entry *Ax, *Bx, *Xx, *Dx, *Wx ;
+    Int i, j, p, m, n, erow, nrhs, ldb ;
+
+    // -------------------------------------------------------------------------
+    // check inputs
+    // -------------------------------------------------------------------------
+
+    RETURN_IF_NULL_COMMON (NULL) ;
+    RETURN_IF_NULL (A, NULL) ;
+    RETURN_IF_NULL (R, NULL) ;
+    RETURN_IF_NULL (B, NULL) ;
+    int64_t xtype = spqr_type <Entry> ( ) ;
+    RETURN_IF_XTYPE_INVALID (A, NULL) ;
+    RETURN_IF_XTYPE_INVALID (R, NULL) ;
+    RETURN_IF_XTYPE_INVALID (B, NULL) ;
+    m = A->nrow ;
+    n = A->ncol ;
+    erow = R->nrow ;
+    if ((Int) R->ncol != n || (Int) B->nrow != m)
+    {
+        ERROR (CHOLMOD_INVALID, "invalid dimensions") ;
+        return (NULL) ;
+    }
+    if (!A->packed || !R->packed)
+    {
+        ERROR (CHOLMOD_INVALID, "A and R must be packed") ;
+        return (NULL) ;
+    }
+    cc->status = CHOLMOD_OK ;
+
+    Ap = (Int *) A->p ;
+    Ai = (Int *) A->i ;
+    Ax = (Entry *) A->x ;
+    Rp = (Int *) R->p ;
+    Ri = (Int *) R->i ;
+    nrhs = B->ncol ;
+    ldb = B->d ;
+    Bx = (Entry *) B->x ;
+
+    // -------------------------------------------------------------------------
+    // allocate workspace
+    // -------------------------------------------------------------------------
+
+    Z = spqr_allocate_dense <Int> (erow, nrhs, erow, xtype, cc) ;
+    Lead = (Int *) spqr_malloc <Int> (n,    sizeof (Int), cc) ;
+    Mark = (Int *) spqr_calloc <Int> (erow, sizeof (Int), cc) ;
+    Wx = (Entry *) spqr_malloc <Int> (m*nrhs, sizeof (Entry), cc) ;
+    if (cc->status < CHOLMOD_OK || Z == NULL || Lead == NULL || Mark == NULL
+        || Wx == NULL)
+    {
+        // out of memory
+        ERROR (CHOLMOD_OUT_OF_MEMORY, "out of memory") ;
+        spqr_free_dense <Int> (&Z, cc) ;
+        spqr_free <Int> (n,      sizeof (Int),   Lead, cc) ;
+        spqr_free <Int> (erow,   sizeof (Int),   Mark, cc) ;
+        spqr_free <Int> (m*nrhs, sizeof (Entry), Wx, cc) ;
+        return (NULL) ;
+    }
+
+    // -------------------------------------------------------------------------
+    // find the row whose leading column is j, for each column j
+    // -------------------------------------------------------------------------
+
+    for (j = 0 ; j < n ; j++)
+    {
+        Lead [j] = EMPTY ;
+        for (p = Rp [j] ; p < Rp [j+1] ; p++)
+        {
+            i = Ri [p] ;
+            if (!Mark [i])
+            {
+                // the leading column of row i is j
+                Mark [i] = TRUE ;
+                if (Lead [j] == EMPTY) Lead [j] = i ;
+            }
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // solve the seminormal equations
+    // -------------------------------------------------------------------------
+
+    X = spqr_private_sne <Entry, Int> (A, R, E, Lead, Bx, ldb, nrhs, Z, cc) ;
+
+    // -------------------------------------------------------------------------
+    // W = B - A*X, and X = X + D where D solves the seminormal equations for W
+    // -------------------------------------------------------------------------
+
+    D = NULL ;
+    if (X != NULL)
+    {
+        Xx = (Entry *) X->x ;
+        for (Int kk = 0 ; kk < nrhs ; kk++)
+        {
+            Entry *Wk = Wx + kk*m ;
+            Entry *Xk = Xx + kk*n ;
+            for (i = 0 ; i < m ; i++)
+            {
+                Wk [i] = Bx [i + kk*ldb] ;
+            }
+            for (j = 0 ; j < n ; j++)
+            {
+                Entry xj = Xk [j] ;
+                if (xj == (Entry) 0) continue ;
+                for (p = Ap [j] ; p < Ap [j+1] ; p++)
+                {
+                    Wk [Ai [p]] -= Ax [p] * xj ;
+                }
+            }
+        }
+        D = spqr_private_sne <Entry, Int> (A, R, E, Lead, Wx, m, nrhs, Z, cc) ;
+    }
+
+    if (D == NULL)
+    {
+        // out of memory
+        ERROR (CHOLMOD_OUT_OF_MEMORY, "out of memory") ;
+        spqr_free_dense <Int> (&X, cc) ;
+    }
+    else
+    {
+        Dx = (Entry *) D->x ;
+        for (p = 0 ; p < n*nrhs ; p++)
+        {
+            Xx [p] += Dx [p] ;
+        }
+        spqr_free_dense <Int> (&D, cc) ;
+    }
+
+    // -------------------------------------------------------------------------
+    // free workspace and return result
+    // -------------------------------------------------------------------------
+
+    spqr_free_dense <Int> (&Z, cc) ;
+    spqr_free <Int> (n,      sizeof (Int),   Lead, cc) ;
+    spqr_free <Int> (erow,   sizeof (Int),   Mark, cc) ;
+    spqr_free <Int> (m*nrhs, sizeof (Entry), Wx, cc) ;
+    return (X) ;
+}
+
+template cholmod_dense *SuiteSparseQR_csne <double, int32_t>
+(
+    // inputs, not modified
+    cholmod_sparse *A,      // m-by-n sparse matrix
+    cholmod_sparse *R,      // e-by-n R factor of A(:,E)
+    int32_t *E,             // size n, column permutation of R (NULL if identity)
+    cholmod_dense *B,       // m-by-nrhs
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+
+template cholmod_dense *SuiteSparseQR_csne <Complex, int32_t>
+(
+    // inputs, not modified
+    cholmod_sparse *A,      // m-by-n sparse matrix
+    cholmod_sparse *R,      // e-by-n R factor of A(:,E)
+    int32_t *E,             // size n, column permutation of R (NULL if identity)
+    cholmod_dense *B,       // m-by-nrhs
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+
+template cholmod_dense *SuiteSparseQR_csne <float, int32_t>
+(
+    // inputs, not modified
+    cholmod_sparse *A,      // m-by-n sparse matrix
+    cholmod_sparse *R,      // e-by-n R factor of A(:,E)
+    int32_t *E,             // size n, column permutation of R (NULL if identity)
+    cholmod_dense *B,       // m-by-nrhs
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+
+template cholmod_dense *SuiteSparseQR_csne <FComplex, int32_t>
+(
+    // inputs, not modified
+    cholmod_sparse *A,      // m-by-n sparse matrix
+    cholmod_sparse *R,      // e-by-n R factor of A(:,E)
+    int32_t *E,             // size n, column permutation of R (NULL if identity)
+    cholmod_dense *B,       // m-by-nrhs
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+
+template cholmod_dense *SuiteSparseQR_csne <double, int64_t>
+(
+    // inputs, not modified
+    cholmod_sparse *A,      // m-by-n sparse matrix
+    cholmod_sparse *R,      // e-by-n R factor of A(:,E)
+    int64_t *E,             // size n, column permutation of R (NULL if identity)
+    cholmod_dense *B,       // m-by-nrhs
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+
+template cholmod_dense *SuiteSparseQR_csne <Complex, int64_t>
+(
+    // inputs, not modified
+    cholmod_sparse *A,      // m-by-n sparse matrix
+    cholmod_sparse *R,      // e-by-n R factor of A(:,E)
+    int64_t *E,             // size n, column permutation of R (NULL if identity)
+    cholmod_dense *B,       // m-by-nrhs
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+
+template cholmod_dense *SuiteSparseQR_csne <float, int64_t>
+(
+    // inputs, not modified
+    cholmod_sparse *A,      // m-by-n sparse matrix
+    cholmod_sparse *R,      // e-by-n R factor of A(:,E)
+    int64_t *E,             // size n, column permutation of R (NULL if identity)
+    cholmod_dense *B,       // m-by-nrhs
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+
+template cholmod_dense *SuiteSparseQR_csne <FComplex, int64_t>
+(
+    // inputs, not modified
+    cholmod_sparse *A,      // m-by-n sparse matrix
+    cholmod_sparse *R,      // e-by-n R factor of A(:,E)
+    int64_t *E,             // size n, column permutation of R (NULL if identity)
+    cholmod_dense *B,       // m-by-nrhs
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
@@ -91,7 +91,9 @@ SuiteSparseQR_factorization <Entry, Int> *SuiteSparseQR_symbolic
     // Using SuiteSparseQR_symbolic followed by SuiteSparseQR_numeric requires
     // that the Householder vectors be kept, and thus the GPU will not be used.
     int keepH = TRUE ;
+    SuiteSparse_trace_begin ("SPQR", "symbolic") ;
     QR->QRsym = QRsym = spqr_analyze <Int> (A, ordering, NULL, allow_tol, keepH, cc) ;
+    SuiteSparse_trace_end ("SPQR", "symbolic", 0, 0) ;
 
     QR->QRnum = NULL ;          // allocated later, by numeric factorization
 
@@ -177,6 +179,26 @@ SuiteSparseQR_factorization <Complex, int32_t> *SuiteSparseQR_symbolic <Complex,
     cholmod_common *cc      // workspace and parameters
 ) ;
 template
+SuiteSparseQR_factorization <float, int32_t> *SuiteSparseQR_symbolic <float, int32_t>
+(
+    // inputs:
+    int ordering,           // all, except 3:given treated as 0:fixed
+    int allow_tol,          // if FALSE, tol is ignored by the numeric
+                            // factorization, and no rank detection is performed
+    cholmod_sparse *A,      // sparse matrix to factorize (A->x ignored)
+    cholmod_common *cc      // workspace and parameters
+) ;
+template
+SuiteSparseQR_factorization <FComplex, int32_t> *SuiteSparseQR_symbolic <FComplex, int32_t>
+(
+    // inputs:
+    int ordering,           // all, except 3:given treated as 0:fixed
+    int allow_tol,          // if FALSE, tol is ignored by the numeric
+                            // factorization, and no rank detection is performed
+    cholmod_sparse *A,      // sparse matrix to factorize (A->x ignored)
+    cholmod_common *cc      // workspace and parameters
+) ;
+template
 SuiteSparseQR_factorization <double, int64_t> *SuiteSparseQR_symbolic <double, int64_t>
 (
     // inputs:
@@ -197,6 +219,26 @@ SuiteSparseQR_factorization <Complex, int64_t> *SuiteSparseQR_symbolic <Complex,
     cholmod_sparse *A,      // sparse matrix to factorize (A->x ignored)
     cholmod_common *cc      // workspace and parameters
 ) ;
+template
+SuiteSparseQR_factorization <float, int64_t> *SuiteSparseQR_symbolic <float, int64_t>
+(
+    // inputs:
+    int ordering,           // all, except 3:given treated as 0:fixed
+    int allow_tol,          // if FALSE, tol is ignored by the numeric
+                            // factorization, and no rank detection is performed
+    cholmod_sparse *A,      // sparse matrix to factorize (A->x ignored)
+    cholmod_common *cc      // workspace and parameters
+) ;
+template
+SuiteSparseQR_factorization <FComplex, int64_t> *SuiteSparseQR_symbolic <FComplex, int64_t>
+(
+    // inputs:
+    int ordering,           // all, except 3:given treated as 0:fixed
+    int allow_tol,          // if FALSE, tol is ignored by the numeric
+                            // factorization, and no rank detection is performed
+    cholmod_sparse *A,      // sparse matrix to factorize (A->x ignored)
+    cholmod_common *cc      // workspace and parameters
+) ;
 
 // =============================================================================
 // === SuiteSparseQR_numeric ===================================================
@@ -268,7 +310,9 @@ template <typename Entry, typename Int> int SuiteSparseQR_numeric
     spqr_freenum (&(QR->QRnum), cc) ;
 
     // compute the new factorization
+    SuiteSparse_trace_begin ("SPQR", "numeric") ;
     QR->QRnum = spqr_factorize <Entry, Int> (&A, FALSE, tol, n, QR->QRsym, cc) ;
+    SuiteSparse_trace_end ("SPQR", "numeric", cc->SPQR_flopcount_bound, 0) ;
 
     if (cc->status < CHOLMOD_OK)
     {
@@ -322,6 +366,24 @@ template int SuiteSparseQR_numeric <Complex, int32_t>
     SuiteSparseQR_factorization <Complex, int32_t> *QR,
     cholmod_common *cc      // workspace and parameters
 ) ;
+template int SuiteSparseQR_numeric <float, int32_t>
+(
+    // inputs:
+    double tol,             // treat columns with 2-norm <= tol as zero
+    cholmod_sparse *A,      // sparse matrix to factorize
+    // input/output
+    SuiteSparseQR_factorization <float, int32_t> *QR,
+    cholmod_common *cc      // workspace and parameters
+) ;
+template int SuiteSparseQR_numeric <FComplex, int32_t>
+(
+    // inputs:
+    double tol,             // treat columns with 2-norm <= tol as zero
+    cholmod_sparse *A,      // sparse matrix to factorize
+    // input/output
+    SuiteSparseQR_factorization <FComplex, int32_t> *QR,
+    cholmod_common *cc      // workspace and parameters
+) ;
 template int SuiteSparseQR_numeric <double, int64_t>
 (
     // inputs:
@@ -341,6 +403,24 @@ template int SuiteSparseQR_numeric <Complex, int64_t>
     SuiteSparseQR_factorization <Complex, int64_t> *QR,
     cholmod_common *cc      // workspace and parameters
 ) ;
+template int SuiteSparseQR_numeric <float, int64_t>
+(
+    // inputs:
+    double tol,             // treat columns with 2-norm <= tol as zero
+    cholmod_sparse *A,      // sparse matrix to factorize
+    // input/output
+    SuiteSparseQR_factorization <float, int64_t> *QR,
+    cholmod_common *cc      // workspace and parameters
+) ;
+template int SuiteSparseQR_numeric <FComplex, int64_t>
+(
+    // inputs:
+    double tol,             // treat columns with 2-norm <= tol as zero
+    cholmod_sparse *A,      // sparse matrix to factorize
+    // input/output
+    SuiteSparseQR_factorization <FComplex, int64_t> *QR,
+    cholmod_common *cc      // workspace and parameters
+) ;
 // =============================================================================
 // === SuiteSparseQR_factorize =================================================
 // =============================================================================
@@ -405,6 +485,24 @@ template SuiteSparseQR_factorization <Complex, int32_t> *SuiteSparseQR_factorize
     // workspace and parameters
     cholmod_common *cc
 ) ;
+template SuiteSparseQR_factorization <float, int32_t> *SuiteSparseQR_factorize<float, int32_t>
+(
+    // inputs, not modified:
+    int ordering,           // all, except 3:given treated as 0:fixed
+    double tol,             // treat columns with 2-norm <= tol as zero
+    cholmod_sparse *A,      // sparse matrix to factorize
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template SuiteSparseQR_factorization <FComplex, int32_t> *SuiteSparseQR_factorize<FComplex, int32_t>
+(
+    // inputs, not modified:
+    int ordering,           // all, except 3:given treated as 0:fixed
+    double tol,             // treat columns with 2-norm <= tol as zero
+    cholmod_sparse *A,      // sparse matrix to factorize
+    // workspace and parameters
+    cholmod_common *cc
+) ;
 template SuiteSparseQR_factorization <double, int64_t> *SuiteSparseQR_factorize <double, int64_t>
 (
     // inputs, not modified:
@@ -424,6 +522,24 @@ template SuiteSparseQR_factorization <Complex, int64_t> *SuiteSparseQR_factorize
     // workspace and parameters
     cholmod_common *cc
 ) ;
+template SuiteSparseQR_factorization <float, int64_t> *SuiteSparseQR_factorize<float, int64_t>
+(
+    // inputs, not modified:
+    int ordering,           // all, except 3:given treated as 0:fixed
+    double tol,             // treat columns with 2-norm <= tol as zero
+    cholmod_sparse *A,      // sparse matrix to factorize
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template SuiteSparseQR_factorization <FComplex, int64_t> *SuiteSparseQR_factorize<FComplex, int64_t>
+(
+    // inputs, not modified:
+    int ordering,           // all, except 3:given treated as 0:fixed
+    double tol,             // treat columns with 2-norm <= tol as zero
+    cholmod_sparse *A,      // sparse matrix to factorize
+    // workspace and parameters
+    cholmod_common *cc
+) ;
 
 // =============================================================================
 // === spqr_private_rtsolve ====================================================
@@ -788,6 +904,7 @@ template <typename Entry, typename Int> cholmod_dense *SuiteSparseQR_solve // re
     nrhs = B->ncol ;
     Bx = (Entry *) B->x ;
     ldb = B->d ;
+    SuiteSparse_trace_begin ("SPQR", "solve") ;
 
     if (system == SPQR_RX_EQUALS_B || system == SPQR_RETX_EQUALS_B)
     {
@@ -829,6 +946,7 @@ template <typename Entry, typename Int> cholmod_dense *SuiteSparseQR_solve // re
                 Bx, (Entry *) X->x, cc) ;
         }
     }
+    SuiteSparse_trace_end ("SPQR", "solve", 0, 0) ;
 
     if (!ok)
     {
@@ -851,6 +969,24 @@ template cholmod_dense *SuiteSparseQR_solve <Complex, int32_t>
     // workspace and parameters
     cholmod_common *cc
 ) ;
+template cholmod_dense *SuiteSparseQR_solve <float, int32_t>
+(
+    // inputs, not modified:
+    int system,                 // which system to solve
+    SuiteSparseQR_factorization <float, int32_t> *QR,  // of an m-by-n sparse matrix A
+    cholmod_dense *B,           // right-hand-side, m-by-nrhs or n-by-nrhs
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template cholmod_dense *SuiteSparseQR_solve <FComplex, int32_t>
+(
+    // inputs, not modified:
+    int system,                 // which system to solve
+    SuiteSparseQR_factorization <FComplex, int32_t> *QR,  // of an m-by-n sparse matrix A
+    cholmod_dense *B,           // right-hand-side, m-by-nrhs or n-by-nrhs
+    // workspace and parameters
+    cholmod_common *cc
+) ;
 
 template cholmod_dense *SuiteSparseQR_solve <Complex, int64_t>
 (
@@ -861,6 +997,24 @@ template cholmod_dense *SuiteSparseQR_solve <Complex, int64_t>
     // workspace and parameters
     cholmod_common *cc
 ) ;
+template cholmod_dense *SuiteSparseQR_solve <float, int64_t>
+(
+    // inputs, not modified:
+    int system,                 // which system to solve
+    SuiteSparseQR_factorization <float, int64_t> *QR,  // of an m-by-n sparse matrix A
+    cholmod_dense *B,           // right-hand-side, m-by-nrhs or n-by-nrhs
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template cholmod_dense *SuiteSparseQR_solve <FComplex, int64_t>
+(
+    // inputs, not modified:
+    int system,                 // which system to solve
+    SuiteSparseQR_factorization <FComplex, int64_t> *QR,  // of an m-by-n sparse matrix A
+    cholmod_dense *B,           // right-hand-side, m-by-nrhs or n-by-nrhs
+    // workspace and parameters
+    cholmod_common *cc
+) ;
 
 template cholmod_dense *SuiteSparseQR_solve <double, int64_t>
 (
@@ -945,6 +1099,24 @@ template cholmod_sparse *SuiteSparseQR_solve <Complex, int32_t>
     // workspace and parameters
     cholmod_common *cc
 ) ;
+template cholmod_sparse *SuiteSparseQR_solve <float, int32_t>
+(
+    // inputs, not modified:
+    int system,                 // which system to solve (0,1,2,3)
+    SuiteSparseQR_factorization <float, int32_t> *QR,  // of an m-by-n sparse matrix A
+    cholmod_sparse *Bsparse,    // right-hand-side, m-by-nrhs or n-by-nrhs
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template cholmod_sparse *SuiteSparseQR_solve <FComplex, int32_t>
+(
+    // inputs, not modified:
+    int system,                 // which system to solve (0,1,2,3)
+    SuiteSparseQR_factorization <FComplex, int32_t> *QR,  // of an m-by-n sparse matrix A
+    cholmod_sparse *Bsparse,    // right-hand-side, m-by-nrhs or n-by-nrhs
+    // workspace and parameters
+    cholmod_common *cc
+) ;
 template cholmod_sparse *SuiteSparseQR_solve <Complex, int64_t>
 (
     // inputs, not modified:
@@ -954,6 +1126,24 @@ template cholmod_sparse *SuiteSparseQR_solve <Complex, int64_t>
     // workspace and parameters
     cholmod_common *cc
 ) ;
+template cholmod_sparse *SuiteSparseQR_solve <float, int64_t>
+(
+    // inputs, not modified:
+    int system,                 // which system to solve (0,1,2,3)
+    SuiteSparseQR_factorization <float, int64_t> *QR,  // of an m-by-n sparse matrix A
+    cholmod_sparse *Bsparse,    // right-hand-side, m-by-nrhs or n-by-nrhs
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template cholmod_sparse *SuiteSparseQR_solve <FComplex, int64_t>
+(
+    // inputs, not modified:
+    int system,                 // which system to solve (0,1,2,3)
+    SuiteSparseQR_factorization <FComplex, int64_t> *QR,  // of an m-by-n sparse matrix A
+    cholmod_sparse *Bsparse,    // right-hand-side, m-by-nrhs or n-by-nrhs
+    // workspace and parameters
+    cholmod_common *cc
+) ;
 
 // =============================================================================
 // === spqr_private_get_H_vectors ==============================================
@@ -1098,6 +1288,78 @@ template <typename Entry, typename Int> Int spqr_private_load_H_vectors
 }
 
 
+// =============================================================================
+// === spqr_private_Happly_front ===============================================
+// =============================================================================
+
+// Apply the Householder vectors of a single front F to the m2-by-n2 matrix X2
+// with leading dimension ldx, in the forward or backward direction.
+
+template <typename Entry, typename Int> void spqr_private_Happly_front
+(
+    // inputs
+    int method,             // 0,1,2,3
+    SuiteSparseQR_factorization <Entry, Int> *QR,
+    Int hchunk,            // apply hchunk Householder vectors at a time
+    Int f,                 // front to apply
+
+    // input/output
+    Int m2,
+    Int n2,
+    Int ldx,
+    Entry *X2,              // size m2-by-n2 with leading dimension ldx
+
+    // workspace, not defined on input or output
+    Entry *H_Tau,           // size QRsym->maxfn
+    Int *H_start,          // size QRsym->maxfn
+    Int *H_end,            // size QRsym->maxfn
+    Entry *V,               // size v-by-hchunk, where v = QRnum->maxfm
+    Entry *C,               // size: method 0,1: v*n2,     method 2,3: m2*v
+    Entry *W,               // size: method 0,1: h*h+n2*h, method 2,3: h*h+m2*h
+                            // where h = hchunk
+    cholmod_common *cc
+)
+{
+    Entry *R ;
+    Int *Hi ;
+    Int nh, h1, h2, v ;
+
+    // get the Householder vectors for front F
+    nh = spqr_private_get_H_vectors (f, QR, H_Tau, H_start, H_end, cc) ;
+    R = QR->QRnum->Rblock [f] ;
+    Hi = &(QR->QRnum->Hii [QR->QRsym->Hip [f]]) ;  // list of row indices of H
+
+    if (method == SPQR_QTX || method == SPQR_XQ)
+    {
+        // apply the Householder vectors, one panel at a time
+        for (h1 = 0 ; h1 < nh ; h1 = h2)
+        {
+            // load vectors h1:h2-1 from R into the panel V and apply them
+            h2 = MIN (h1 + hchunk, nh) ;
+            v = spqr_private_load_H_vectors (h1, h2, H_start, H_end, R, V,
+                cc) ;
+            ASSERT (v+h1 <= QR->QRnum->Hm [f]) ;
+            spqr_panel (method, m2, n2, v, h2-h1, Hi+h1, V, H_Tau+h1,
+                ldx, X2, C, W, cc) ;
+        }
+    }
+    else
+    {
+        // apply the Householder vectors, one panel at a time, in reverse
+        for (h2 = nh ; h2 > 0 ; h2 = h1)
+        {
+            // load vectors h1:h2-1 from R into the panel V and apply them
+            h1 = MAX (h2 - hchunk, 0) ;
+            v = spqr_private_load_H_vectors (h1, h2, H_start, H_end, R, V,
+                cc) ;
+            ASSERT (v+h1 <= QR->QRnum->Hm [f]) ;
+            spqr_panel (method, m2, n2, v, h2-h1, Hi+h1, V, H_Tau+h1,
+                ldx, X2, C, W, cc) ;
+        }
+    }
+}
+
+
 // =============================================================================
 // === spqr_private_Happly =====================================================
 // =============================================================================
@@ -1130,23 +1392,15 @@ template <typename Entry, typename Int> void spqr_private_Happly
 )
 {
 
-    spqr_symbolic <Int> *QRsym ;
-    spqr_numeric <Entry, Int> *QRnum ;
-    Entry **Rblock, *R, *X2 ;
-    Int *Hii, *Hip, *Hi ;
-    Int nf, f, nh, h1, h2, v, n1rows, m2, n2 ;
+    Entry *X2 ;
+    Int nf, f, n1rows, m2, n2 ;
 
     // -------------------------------------------------------------------------
     // get the contents of the QR factorization
     // -------------------------------------------------------------------------
 
-    QRsym = QR->QRsym ;
-    QRnum = QR->QRnum ;
-    ASSERT (QRnum->keepH) ;
-    nf = QRsym->nf ;
-    Rblock = QRnum->Rblock ;
-    Hii = QRnum->Hii ;
-    Hip = QRsym->Hip ;
+    ASSERT (QR->QRnum->keepH) ;
+    nf = QR->QRsym->nf ;
     ASSERT (QR->narows == ((method <= SPQR_QX) ? m : n)) ;
     n1rows = QR->n1rows ;
 
@@ -1178,116 +1432,387 @@ template <typename Entry, typename Int> void spqr_private_Happly
 
     if (method == SPQR_QTX || method == SPQR_XQ)
     {
-
-        // ---------------------------------------------------------------------
         // apply in forward direction
-        // ---------------------------------------------------------------------
-
         for (f = 0 ; f < nf ; f++)
         {
-            // get the Householder vectors for front F
-            nh = spqr_private_get_H_vectors (f, QR, H_Tau, H_start, H_end, cc) ;
-            R = Rblock [f] ;
-            Hi = &Hii [Hip [f]] ;               // list of row indices of H
-
-            // apply the Householder vectors, one panel at a time
-            for (h1 = 0 ; h1 < nh ; h1 = h2)
-            {
-                // load vectors h1:h2-1 from R into the panel V and apply them
-                h2 = MIN (h1 + hchunk, nh) ;
-                v = spqr_private_load_H_vectors (h1, h2, H_start, H_end, R, V,
-                    cc) ;
-                ASSERT (v+h1 <= QR->QRnum->Hm [f]) ;
-                spqr_panel (method, m2, n2, v, h2-h1, Hi+h1, V, H_Tau+h1,
-                    m, X2, C, W, cc) ;
-            }
+            spqr_private_Happly_front (method, QR, hchunk, f, m2, n2, m, X2,
+                H_Tau, H_start, H_end, V, C, W, cc) ;
         }
     }
     else
     {
-
-        // ---------------------------------------------------------------------
         // apply in backward direction
-        // ---------------------------------------------------------------------
-
         for (f = nf-1 ; f >= 0 ; f--)
         {
-
-            // get the Householder vectors for front F
-            nh = spqr_private_get_H_vectors (f, QR, H_Tau, H_start, H_end, cc) ;
-            R = Rblock [f] ;
-            Hi = &Hii [Hip [f]] ;               // list of row indices of H
-
-            // apply the Householder vectors, one panel at a time
-            for (h2 = nh ; h2 > 0 ; h2 = h1)
-            {
-                // load vectors h1:h2-1 from R into the panel V and apply them
-                h1 = MAX (h2 - hchunk, 0) ;
-                v = spqr_private_load_H_vectors (h1, h2, H_start, H_end, R, V,
-                    cc) ;
-                ASSERT (v+h1 <= QR->QRnum->Hm [f]) ;
-                spqr_panel (method, m2, n2, v, h2-h1, Hi+h1, V, H_Tau+h1,
-                    m, X2, C, W, cc) ;
-            }
+            spqr_private_Happly_front (method, QR, hchunk, f, m2, n2, m, X2,
+                H_Tau, H_start, H_end, V, C, W, cc) ;
         }
     }
 }
 
 
 // =============================================================================
-// === SuiteSparseQR_qmult (dense case) ========================================
+// === spqr_private_Happly_parallel ============================================
 // =============================================================================
 
-// Applies Q in Householder form (as stored in the QR factorization object
-// returned by SuiteSparseQR_factorize) to a dense matrix X.
+// Same as spqr_private_Happly, but with OpenMP.  The columns of X (for Q*X and
+// Q'*X) or its rows (for X*Q and X*Q') are independent, and are split into
+// nblocks blocks.  If there are fewer blocks than threads, the frontal tree is
+// also split into subtrees.  Two disjoint subtrees operate on disjoint rows of
+// X (columns, for X*Q and X*Q'), so each (subtree,block) pair is a task that
+// can be done in parallel with all the others.  The fronts above the subtrees
+// are done afterwards (or beforehand, in the backward direction), one task
+// per block.  Each thread has its own workspace and its own copy of cc, for
+// cc->blas_ok.
 //
-//  method SPQR_QTX (0): Y = Q'*X
-//  method SPQR_QX  (1): Y = Q*X
-//  method SPQR_XQT (2): Y = X*Q'
-//  method SPQR_XQ  (3): Y = X*Q
-
-#define HCHUNK 32        // FUTURE: make this an input parameter
+// Returns TRUE if H has been applied to X, or FALSE if it is left to
+// spqr_private_Happly instead (if one thread is enough, or if out of memory).
 
-#define FREE_WORK \
-{ \
-    spqr_free_dense <Int> (&Zdense, cc) ; \
-    spqr_free_dense <Int> (&Vdense, cc) ; \
-    spqr_free_dense <Int> (&Wdense, cc) ; \
-    spqr_free_dense <Int> (&Cdense, cc) ; \
-    spqr_free <Int> (maxfn, sizeof (Entry), H_Tau,   cc) ; \
-    spqr_free <Int> (maxfn, sizeof (Int),  H_start, cc) ; \
-    spqr_free <Int> (maxfn, sizeof (Int),  H_end,   cc) ; \
-}
+#define SPQR_QMULT_BLOCK 4      // min # of columns or rows of X in a block
 
-// returns Y of size m-by-n, or NULL on failure
-template <typename Entry, typename Int> cholmod_dense *SuiteSparseQR_qmult
+template <typename Entry, typename Int> int spqr_private_Happly_parallel
 (
-    // inputs, not modified
+    // inputs
     int method,             // 0,1,2,3
     SuiteSparseQR_factorization <Entry, Int> *QR,
-    cholmod_dense *Xdense,  // size m-by-n with leading dimension ldx
+    Int hchunk,            // apply hchunk Householder vectors at a time
 
-    // workspace and parameters
+    // input/output
+    Int m,
+    Int n,
+    Entry *X,               // size m-by-n with leading dimension m; only
+                            // X (n1rows:m-1,:) or X (:,n1rows:n-1) is modified
     cholmod_common *cc
 )
 {
-    cholmod_dense *Ydense, *Cdense, *Vdense, *Wdense, *Zdense ;
-    Entry *X, *Y, *X1, *Y1, *Z1, *C, *V, *Z, *W, *H_Tau ;
-    Int *HPinv, *H_start, *H_end ;
-    Int i, k, mh, v, hchunk, ldx, m, n, maxfn, ok ;
+#ifdef _OPENMP
+
+    spqr_symbolic <Int> *QRsym ;
+    spqr_numeric <Entry, Int> *QRnum ;
+    cholmod_common *Ccommon ;
+    Entry *X2, *Ework ;
+    Int *Parent, *Rp, *Hm, *Iwork, *Task, *Fp, *Flist ;
+    double *Subwork, hwork ;
+    Int nf, f, t, p, n1rows, maxfn, v, m2, n2, nb, nblocks, bsize, nsub,
+        esize, isize, ewsize, iwsize ;
+    int nthreads, forward, ok = TRUE ;
 
     // -------------------------------------------------------------------------
-    // get inputs
+    // get the contents of the QR factorization
     // -------------------------------------------------------------------------
 
-    RETURN_IF_NULL_COMMON (NULL) ;
-    RETURN_IF_NULL (QR, NULL) ;
-    RETURN_IF_NULL (QR->QRnum, NULL) ;
-    RETURN_IF_NULL (QR->QRnum->Hm, NULL) ;
-    RETURN_IF_NULL (Xdense, NULL) ;
-    int64_t xtype = spqr_type <Entry> ( ) ;
-    RETURN_IF_XTYPE_INVALID (Xdense, NULL) ;
-    cc->status = CHOLMOD_OK ;
+    QRsym = QR->QRsym ;
+    QRnum = QR->QRnum ;
+    ASSERT (QRnum->keepH) ;
+    nf = QRsym->nf ;
+    Parent = QRsym->Parent ;
+    Rp = QRsym->Rp ;
+    Hm = QRnum->Hm ;
+    n1rows = QR->n1rows ;
+    maxfn = QRsym->maxfn ;
+    v = QRnum->maxfm ;
+    forward = (method == SPQR_QTX || method == SPQR_XQ) ;
+
+    // X2 is the m2-by-n2 part of X that is modified, as in spqr_private_Happly
+    if (method == SPQR_QTX || method == SPQR_QX)
+    {
+        X2 = X + n1rows ;
+        n2 = n ;
+        m2 = m - n1rows ;
+    }
+    else
+    {
+        X2 = X + n1rows * m ;
+        n2 = n - n1rows ;
+        m2 = m ;
+    }
+
+    // nb = # of independent columns (method 0,1) or rows (method 2,3) of X2
+    nb = (method <= SPQR_QX) ? n2 : m2 ;
+    if (nf == 0 || nb == 0)
+    {
+        return (FALSE) ;
+    }
+
+    // -------------------------------------------------------------------------
+    // determine the # of threads and the size of each block
+    // -------------------------------------------------------------------------
+
+    hwork = 0 ;
+    for (f = 0 ; f < nf ; f++)
+    {
+        hwork += ((double) Hm [f]) * ((double) (Rp [f+1] - Rp [f])) ;
+    }
+    nthreads = spqr_nthreads (4 * hwork * ((double) nb), cc) ;
+    if (nthreads <= 1)
+    {
+        return (FALSE) ;
+    }
+    nblocks = MIN (nthreads, MAX (1, nb / SPQR_QMULT_BLOCK)) ;
+    bsize = (nb + nblocks - 1) / nblocks ;
+    nblocks = (nb + bsize - 1) / bsize ;
+
+    // -------------------------------------------------------------------------
+    // allocate workspace
+    // -------------------------------------------------------------------------
+
+    // each thread has H_Tau, V, C, and W of type Entry, and H_start and H_end
+    // of type Int.  C and W are sized for a block of X2.
+    esize = spqr_add (maxfn, spqr_mult (v, hchunk, &ok), &ok) ;
+    esize = spqr_add (esize, spqr_mult (v, bsize, &ok), &ok) ;
+    esize = spqr_add (esize, spqr_mult (hchunk, hchunk+bsize, &ok), &ok) ;
+    isize = 2*maxfn ;
+    ewsize = spqr_mult (esize, (Int) nthreads, &ok) ;
+    iwsize = spqr_add (spqr_mult (isize, (Int) nthreads, &ok), 3*nf+2, &ok) ;
+    if (!ok)
+    {
+        // problem too large; let spqr_private_Happly handle it
+        return (FALSE) ;
+    }
+
+    Ework = (Entry *) spqr_malloc <Int> (ewsize, sizeof (Entry), cc) ;
+    Iwork = (Int *) spqr_malloc <Int> (iwsize, sizeof (Int), cc) ;
+    Subwork = (double *) spqr_malloc <Int> (nf, sizeof (double), cc) ;
+    Ccommon = (cholmod_common *) spqr_malloc <Int> (nthreads,
+        sizeof (cholmod_common), cc) ;
+
+    if (cc->status < CHOLMOD_OK)
+    {
+        // out of memory; do it with one thread instead
+        spqr_free <Int> (ewsize, sizeof (Entry), Ework, cc) ;
+        spqr_free <Int> (iwsize, sizeof (Int), Iwork, cc) ;
+        spqr_free <Int> (nf, sizeof (double), Subwork, cc) ;
+        spqr_free <Int> (nthreads, sizeof (cholmod_common), Ccommon, cc) ;
+        cc->status = CHOLMOD_OK ;
+        return (FALSE) ;
+    }
+
+    Task  = Iwork + isize * nthreads ;  // size nf
+    Flist = Task + nf ;                 // size nf
+    Fp    = Flist + nf ;                // size nsub+2 <= nf+2
+
+    for (t = 0 ; t < nthreads ; t++)
+    {
+        Ccommon [t] = *cc ;
+    }
+
+    // -------------------------------------------------------------------------
+    // split the frontal tree into subtrees
+    // -------------------------------------------------------------------------
+
+    // Task [f] is the subtree that contains front f, or EMPTY if f is above
+    // all subtrees.  Subtrees are only needed if there are too few blocks to
+    // keep all the threads busy.  Each is at most half of the work that each
+    // thread would have, for load balancing.
+
+    nsub = 0 ;
+    for (f = 0 ; f < nf ; f++)
+    {
+        Task [f] = EMPTY ;
+    }
+    if (nblocks < nthreads)
+    {
+        // Subwork [f] = work in the subtree rooted at front f
+        for (f = 0 ; f < nf ; f++)
+        {
+            Subwork [f] = ((double) Hm [f]) * ((double) (Rp [f+1] - Rp [f])) ;
+        }
+        for (f = 0 ; f < nf ; f++)
+        {
+            p = Parent [f] ;
+            ASSERT (p > f && p <= nf) ;
+            if (p < nf)
+            {
+                Subwork [p] += Subwork [f] ;
+            }
+        }
+        double target = hwork * ((double) nblocks) / (2.0 * nthreads) ;
+        for (f = nf-1 ; f >= 0 ; f--)
+        {
+            p = Parent [f] ;
+            if (p < nf && Task [p] != EMPTY)
+            {
+                // f is in the same subtree as its parent
+                Task [f] = Task [p] ;
+            }
+            else if (Subwork [f] <= target)
+            {
+                // f is the root of a new subtree
+                Task [f] = nsub++ ;
+            }
+        }
+    }
+
+    // Flist [Fp [t] ... Fp [t+1]-1] lists the fronts of subtree t, in
+    // increasing order, and t = nsub is the list of fronts above all subtrees
+    for (t = 0 ; t <= nsub+1 ; t++)
+    {
+        Fp [t] = 0 ;
+    }
+    for (f = 0 ; f < nf ; f++)
+    {
+        t = (Task [f] == EMPTY) ? nsub : Task [f] ;
+        Fp [t+2]++ ;
+    }
+    for (t = 0 ; t < nsub ; t++)
+    {
+        Fp [t+2] += Fp [t+1] ;
+    }
+    for (f = 0 ; f < nf ; f++)
+    {
+        t = (Task [f] == EMPTY) ? nsub : Task [f] ;
+        Flist [Fp [t+1]++] = f ;
+    }
+    ASSERT (Fp [nsub+1] == nf) ;
+
+    // -------------------------------------------------------------------------
+    // apply the Householder vectors
+    // -------------------------------------------------------------------------
+
+    PR (("Happly parallel: %d threads, %ld blocks, %ld subtrees\n", nthreads,
+        nblocks, nsub)) ;
+
+    for (int phase = 0 ; phase <= 1 ; phase++)
+    {
+        // in the forward direction, the subtrees are done first and the fronts
+        // above them last; the reverse is done in the backward direction
+        int top = forward ? (phase == 1) : (phase == 0) ;
+        Int t1 = top ? nsub : 0 ;
+        Int ntasks = (top ? 1 : nsub) * nblocks ;
+
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+        for (Int k = 0 ; k < ntasks ; k++)
+        {
+            // task k: subtree (or top) t of block b
+            Int tk = t1 + k / nblocks ;
+            Int b  = k % nblocks ;
+            int tid = SUITESPARSE_OPENMP_GET_THREAD_ID ;
+
+            // get the workspace for this thread
+            Entry *H_Tau = Ework + esize * tid ;
+            Entry *V = H_Tau + maxfn ;
+            Entry *C = V + v * hchunk ;
+            Entry *W = C + v * bsize ;
+            Int *H_start = Iwork + isize * tid ;
+            Int *H_end = H_start + maxfn ;
+
+            // Xb is an mb-by-nbb block of X2, with leading dimension m
+            Int k1 = b * bsize ;
+            Int k2 = MIN (k1 + bsize, nb) ;
+            Entry *Xb ;
+            Int mb, nbb ;
+            if (method <= SPQR_QX)
+            {
+                Xb = X2 + k1 * m ;
+                mb = m2 ;
+                nbb = k2 - k1 ;
+            }
+            else
+            {
+                Xb = X2 + k1 ;
+                mb = k2 - k1 ;
+                nbb = n2 ;
+            }
+
+            if (forward)
+            {
+                for (Int pf = Fp [tk] ; pf < Fp [tk+1] ; pf++)
+                {
+                    spqr_private_Happly_front (method, QR, hchunk, Flist [pf],
+                        mb, nbb, m, Xb, H_Tau, H_start, H_end, V, C, W,
+                        &(Ccommon [tid])) ;
+                }
+            }
+            else
+            {
+                for (Int pf = Fp [tk+1]-1 ; pf >= Fp [tk] ; pf--)
+                {
+                    spqr_private_Happly_front (method, QR, hchunk, Flist [pf],
+                        mb, nbb, m, Xb, H_Tau, H_start, H_end, V, C, W,
+                        &(Ccommon [tid])) ;
+                }
+            }
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // free workspace and return result
+    // -------------------------------------------------------------------------
+
+    for (t = 0 ; t < nthreads ; t++)
+    {
+        cc->blas_ok = cc->blas_ok && Ccommon [t].blas_ok ;
+    }
+
+    spqr_free <Int> (ewsize, sizeof (Entry), Ework, cc) ;
+    spqr_free <Int> (iwsize, sizeof (Int), Iwork, cc) ;
+    spqr_free <Int> (nf, sizeof (double), Subwork, cc) ;
+    spqr_free <Int> (nthreads, sizeof (cholmod_common), Ccommon, cc) ;
+    return (TRUE) ;
+
+#else
+
+    // no OpenMP
+    return (FALSE) ;
+
+#endif
+}
+
+
+// =============================================================================
+// === SuiteSparseQR_qmult (dense case) ========================================
+// =============================================================================
+
+// Applies Q in Householder form (as stored in the QR factorization object
+// returned by SuiteSparseQR_factorize) to a dense matrix X.
+//
+//  method SPQR_QTX (0): Y = Q'*X
+//  method SPQR_QX  (1): Y = Q*X
+//  method SPQR_XQT (2): Y = X*Q'
+//  method SPQR_XQ  (3): Y = X*Q
+
+#define HCHUNK 32        // FUTURE: make this an input parameter
+
+#define FREE_WORK \
+{ \
+    spqr_free_dense <Int> (&Zdense, cc) ; \
+    spqr_free_dense <Int> (&Vdense, cc) ; \
+    spqr_free_dense <Int> (&Wdense, cc) ; \
+    spqr_free_dense <Int> (&Cdense, cc) ; \
+    spqr_free <Int> (maxfn, sizeof (Entry), H_Tau,   cc) ; \
+    spqr_free <Int> (maxfn, sizeof (Int),  H_start, cc) ; \
+    spqr_free <Int> (maxfn, sizeof (Int),  H_end,   cc) ; \
+}
+
+// returns Y of size m-by-n, or NULL on failure
+template <typename Entry, typename Int> cholmod_dense *SuiteSparseQR_qmult
+(
+    // inputs, not modified
+    int method,             // 0,1,2,3
+    SuiteSparseQR_factorization <Entry, Int> *QR,
+    cholmod_dense *Xdense,  // size m-by-n with leading dimension ldx
+
+    // workspace and parameters
+    cholmod_common *cc
+)
+{
+    cholmod_dense *Ydense, *Cdense, *Vdense, *Wdense, *Zdense ;
+    Entry *X, *Y, *X1, *Y1, *Z1, *C, *V, *Z, *W, *H_Tau, *XH ;
+    Int *HPinv, *H_start, *H_end ;
+    Int i, k, mh, v, hchunk, ldx, m, n, maxfn ;
+
+    // -------------------------------------------------------------------------
+    // get inputs
+    // -------------------------------------------------------------------------
+
+    RETURN_IF_NULL_COMMON (NULL) ;
+    RETURN_IF_NULL (QR, NULL) ;
+    RETURN_IF_NULL (QR->QRnum, NULL) ;
+    RETURN_IF_NULL (QR->QRnum->Hm, NULL) ;
+    RETURN_IF_NULL (Xdense, NULL) ;
+    int64_t xtype = spqr_type <Entry> ( ) ;
+    RETURN_IF_XTYPE_INVALID (Xdense, NULL) ;
+    cc->status = CHOLMOD_OK ;
 
     // get HPinv from QR->HP1inv if singletons exist, else QR->QRnum->HPinv
     HPinv = (QR->n1cols > 0) ? QR->HP1inv : QR->QRnum->HPinv ;
@@ -1345,49 +1870,71 @@ template <typename Entry, typename Int> cholmod_dense *SuiteSparseQR_qmult
     }
 
     // -------------------------------------------------------------------------
-    // allocate workspace
+    // allocate Z
     // -------------------------------------------------------------------------
 
     Z = NULL ;
     Zdense = NULL ;
-    ok = TRUE ;
+    Cdense = NULL ;
+    Vdense = NULL ;
+    Wdense = NULL ;
+    H_Tau = NULL ;
+    H_start = NULL ;
+    H_end = NULL ;
     if (method == SPQR_QX || method == SPQR_XQT)
     {
         // Z of size m-by-n is needed only for Q*X and X*Q'
         Zdense = spqr_allocate_dense <Int> (m, n, m, xtype, cc) ;
-        ok = (Zdense != NULL) ;
+        if (Zdense == NULL)
+        {
+            // out of memory; free result Y
+            ERROR (CHOLMOD_OUT_OF_MEMORY, "out of memory") ;
+            spqr_free_dense <Int> (&Ydense, cc) ;
+            return (NULL) ;
+        }
+        Z = (Entry *) Zdense->x ;
     }
 
-    hchunk = HCHUNK ;
-    ASSERT (v <= mh) ;
-
-    // C is workspace of size v-by-n or m-by-v
-    Cdense = spqr_allocate_dense <Int> (v, (method <= SPQR_QX) ? n : m,
-        v, xtype, cc) ;
-    Vdense = NULL ;
-    Wdense = NULL ;
+    // -------------------------------------------------------------------------
+    // copy X into Y or Z, where H will be applied
+    // -------------------------------------------------------------------------
 
-    H_Tau   = (Entry *) spqr_malloc <Int> (maxfn, sizeof (Entry), cc) ;
-    H_start = (Int *)  spqr_malloc <Int> (maxfn, sizeof (Int),  cc) ;
-    H_end   = (Int *)  spqr_malloc <Int> (maxfn, sizeof (Int),  cc) ;
+    PR (("Qfmult Method %d m %ld n %ld X %p Y %p\n", method, m, n, X, Y)) ;
 
-    if (!ok || Cdense == NULL || cc->status < CHOLMOD_OK)
+    if (method == SPQR_QTX)
     {
-        // out of memory; free workspace and result Y
-        ERROR (CHOLMOD_OUT_OF_MEMORY, "out of memory") ;
-        spqr_free_dense <Int> (&Ydense, cc) ;
-        FREE_WORK ;
-        return (NULL) ;
+        // Y (P,:) = X, and change leading dimension from ldx to m
+        X1 = X ;
+        Y1 = Y ;
+        for (k = 0 ; k < n ; k++)
+        {
+            for (i = 0 ; i < m ; i++)
+            {
+                Y1 [HPinv [i]] = X1 [i] ;
+            }
+            X1 += ldx ;
+            Y1 += m ;
+        }
+        XH = Y ;
     }
-
-    // -------------------------------------------------------------------------
-    // copy X into Z
-    // -------------------------------------------------------------------------
-
-    if (method == SPQR_QX || method == SPQR_XQT)
+    else if (method == SPQR_XQ)
+    {
+        // Y (:,P) = X and change leading dimension from ldx to m
+        X1 = X ;
+        for (k = 0 ; k < n ; k++)
+        {
+            Y1 = Y + HPinv [k] * m ;    // m = leading dimension of Y
+            for (i = 0 ; i < m ; i++)
+            {
+                Y1 [i] = X1 [i] ;
+            }
+            X1 += ldx ;
+        }
+        XH = Y ;
+    }
+    else
     {
         // Z = X
-        Z = (Entry *) Zdense->x ;
         Z1 = Z ;
         X1 = X ;
         for (k = 0 ; k < n ; k++)
@@ -1399,37 +1946,32 @@ template <typename Entry, typename Int> cholmod_dense *SuiteSparseQR_qmult
             X1 += ldx ;
             Z1 += m ;
         }
+        XH = Z ;
     }
 
     // -------------------------------------------------------------------------
-    // allocate O(hchunk) workspace
+    // apply H to Y or Z
     // -------------------------------------------------------------------------
 
-    // V is workspace of size v-by-hchunk
-    Vdense = spqr_allocate_dense <Int> (v, hchunk, v, xtype, cc) ;
-
-    // W is workspace of size h*h+n*h or h*h+m*h where h = hchunk
-    Wdense = spqr_allocate_dense <Int> (hchunk,
-        hchunk + ((method <= SPQR_QX) ? n : m), hchunk, xtype, cc) ;
-
-    // -------------------------------------------------------------------------
-    // punt if out of memory
-    // -------------------------------------------------------------------------
+    hchunk = HCHUNK ;
+    ASSERT (v <= mh) ;
 
-    if (Vdense == NULL || Wdense == NULL)
+    if (!spqr_private_Happly_parallel (method, QR, hchunk, m, n, XH, cc))
     {
-        // PUNT: out of memory; try again with hchunk = 1
-        cc->status = CHOLMOD_OK ;
-        hchunk = 1 ;
 
-        spqr_free_dense <Int> (&Vdense, cc) ;
-        spqr_free_dense <Int> (&Wdense, cc) ;
+        // ---------------------------------------------------------------------
+        // allocate workspace
+        // ---------------------------------------------------------------------
 
-        Vdense = spqr_allocate_dense <Int> (v, hchunk, v, xtype, cc) ;
-        Wdense = spqr_allocate_dense <Int> (hchunk,
-            hchunk + ((method <= SPQR_QX) ? n : m), hchunk, xtype, cc) ;
+        // C is workspace of size v-by-n or m-by-v
+        Cdense = spqr_allocate_dense <Int> (v, (method <= SPQR_QX) ? n : m,
+            v, xtype, cc) ;
 
-        if (Vdense == NULL || Wdense == NULL)
+        H_Tau   = (Entry *) spqr_malloc <Int> (maxfn, sizeof (Entry), cc) ;
+        H_start = (Int *)  spqr_malloc <Int> (maxfn, sizeof (Int),  cc) ;
+        H_end   = (Int *)  spqr_malloc <Int> (maxfn, sizeof (Int),  cc) ;
+
+        if (Cdense == NULL || cc->status < CHOLMOD_OK)
         {
             // out of memory; free workspace and result Y
             ERROR (CHOLMOD_OUT_OF_MEMORY, "out of memory") ;
@@ -1437,56 +1979,61 @@ template <typename Entry, typename Int> cholmod_dense *SuiteSparseQR_qmult
             FREE_WORK ;
             return (NULL) ;
         }
-    }
 
-    // the dimension (->nrow, ->ncol, and ->d) of this workspace is not used,
-    // just the arrays themselves.
-    V = (Entry *) Vdense->x ;
-    C = (Entry *) Cdense->x ;
-    W = (Entry *) Wdense->x ;
-
-    // -------------------------------------------------------------------------
-    // Y = Q'*X, Q*X, X*Q, or X*Q'
-    // -------------------------------------------------------------------------
+        // ---------------------------------------------------------------------
+        // allocate O(hchunk) workspace
+        // ---------------------------------------------------------------------
 
-    PR (("Qfmult Method %d m %ld n %ld X %p Y %p\n", method, m, n, X, Y)) ;
+        // V is workspace of size v-by-hchunk
+        Vdense = spqr_allocate_dense <Int> (v, hchunk, v, xtype, cc) ;
 
-    if (method == SPQR_QTX)
-    {
+        // W is workspace of size h*h+n*h or h*h+m*h where h = hchunk
+        Wdense = spqr_allocate_dense <Int> (hchunk,
+            hchunk + ((method <= SPQR_QX) ? n : m), hchunk, xtype, cc) ;
 
         // ---------------------------------------------------------------------
-        // Y = Q'*X
+        // punt if out of memory
         // ---------------------------------------------------------------------
 
-        // Y (P,:) = X, and change leading dimension from ldx to m
-        X1 = X ;
-        Y1 = Y ;
-        for (k = 0 ; k < n ; k++)
+        if (Vdense == NULL || Wdense == NULL)
         {
-            for (i = 0 ; i < m ; i++)
+            // PUNT: out of memory; try again with hchunk = 1
+            cc->status = CHOLMOD_OK ;
+            hchunk = 1 ;
+
+            spqr_free_dense <Int> (&Vdense, cc) ;
+            spqr_free_dense <Int> (&Wdense, cc) ;
+
+            Vdense = spqr_allocate_dense <Int> (v, hchunk, v, xtype, cc) ;
+            Wdense = spqr_allocate_dense <Int> (hchunk,
+                hchunk + ((method <= SPQR_QX) ? n : m), hchunk, xtype, cc) ;
+
+            if (Vdense == NULL || Wdense == NULL)
             {
-                Y1 [HPinv [i]] = X1 [i] ;
+                // out of memory; free workspace and result Y
+                ERROR (CHOLMOD_OUT_OF_MEMORY, "out of memory") ;
+                spqr_free_dense <Int> (&Ydense, cc) ;
+                FREE_WORK ;
+                return (NULL) ;
             }
-            X1 += ldx ;
-            Y1 += m ;
         }
 
-        // apply H to Y
-        spqr_private_Happly (method, QR, hchunk, m, n, Y, H_Tau, H_start, H_end,
-            V, C, W, cc) ;
+        // the dimension (->nrow, ->ncol, and ->d) of this workspace is not
+        // used, just the arrays themselves.
+        V = (Entry *) Vdense->x ;
+        C = (Entry *) Cdense->x ;
+        W = (Entry *) Wdense->x ;
 
+        spqr_private_Happly (method, QR, hchunk, m, n, XH, H_Tau, H_start,
+            H_end, V, C, W, cc) ;
     }
-    else if (method == SPQR_QX)
-    {
-
-        // ---------------------------------------------------------------------
-        // Y = Q*X
-        // ---------------------------------------------------------------------
 
-        // apply H to Z
-        spqr_private_Happly (method, QR, hchunk, m, n, Z, H_Tau, H_start, H_end,
-            V, C, W, cc) ;
+    // -------------------------------------------------------------------------
+    // copy Z into Y, for Q*X and X*Q'
+    // -------------------------------------------------------------------------
 
+    if (method == SPQR_QX)
+    {
         // Y = Z (P,:)
         Z1 = Z ;
         Y1 = Y ;
@@ -1499,19 +2046,9 @@ template <typename Entry, typename Int> cholmod_dense *SuiteSparseQR_qmult
             Z1 += m ;
             Y1 += m ;
         }
-
     }
     else if (method == SPQR_XQT)
     {
-
-        // ---------------------------------------------------------------------
-        // Y = X*Q'
-        // ---------------------------------------------------------------------
-
-        // apply H to Z
-        spqr_private_Happly (method, QR, hchunk, m, n, Z, H_Tau, H_start, H_end,
-            V, C, W, cc) ;
-
         // Y = Z (:,P)
         Y1 = Y ;
         for (k = 0 ; k < n ; k++)
@@ -1523,31 +2060,6 @@ template <typename Entry, typename Int> cholmod_dense *SuiteSparseQR_qmult
             }
             Y1 += m ;
         }
-
-    }
-    else if (method == SPQR_XQ)
-    {
-
-        // ---------------------------------------------------------------------
-        // Y = X*Q
-        // ---------------------------------------------------------------------
-
-        // Y (:,P) = X and change leading dimension from ldx to m
-        X1 = X ;
-        for (k = 0 ; k < n ; k++)
-        {
-            Y1 = Y + HPinv [k] * m ;    // m = leading dimension of Y
-            for (i = 0 ; i < m ; i++)
-            {
-                Y1 [i] = X1 [i] ;
-            }
-            X1 += ldx ;
-        }
-
-        // apply H to Y
-        spqr_private_Happly (method, QR, hchunk, m, n, Y, H_Tau, H_start, H_end,
-            V, C, W, cc) ;
-
     }
 
     // -------------------------------------------------------------------------
@@ -1598,6 +2110,26 @@ template cholmod_dense *SuiteSparseQR_qmult <Complex, int32_t>
     // workspace and parameters
     cholmod_common *cc
 ) ;
+template cholmod_dense *SuiteSparseQR_qmult <float, int32_t>
+(
+    // inputs, not modified
+    int method,             // 0,1,2,3
+    SuiteSparseQR_factorization <float, int32_t> *QR,
+    cholmod_dense *Xdense,  // size m-by-n with leading dimension ldx
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template cholmod_dense *SuiteSparseQR_qmult <FComplex, int32_t>
+(
+    // inputs, not modified
+    int method,             // 0,1,2,3
+    SuiteSparseQR_factorization <FComplex, int32_t> *QR,
+    cholmod_dense *Xdense,  // size m-by-n with leading dimension ldx
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
 template cholmod_dense *SuiteSparseQR_qmult <Complex, int64_t>
 (
     // inputs, not modified
@@ -1608,6 +2140,26 @@ template cholmod_dense *SuiteSparseQR_qmult <Complex, int64_t>
     // workspace and parameters
     cholmod_common *cc
 ) ;
+template cholmod_dense *SuiteSparseQR_qmult <float, int64_t>
+(
+    // inputs, not modified
+    int method,             // 0,1,2,3
+    SuiteSparseQR_factorization <float, int64_t> *QR,
+    cholmod_dense *Xdense,  // size m-by-n with leading dimension ldx
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template cholmod_dense *SuiteSparseQR_qmult <FComplex, int64_t>
+(
+    // inputs, not modified
+    int method,             // 0,1,2,3
+    SuiteSparseQR_factorization <FComplex, int64_t> *QR,
+    cholmod_dense *Xdense,  // size m-by-n with leading dimension ldx
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
 
 // =============================================================================
 // === SuiteSparseQR_qmult (sparse case) =======================================
@@ -1674,6 +2226,24 @@ template cholmod_sparse *SuiteSparseQR_qmult <Complex, int32_t>
     // workspace and parameters
     cholmod_common *cc
 ) ;
+template cholmod_sparse *SuiteSparseQR_qmult <float, int32_t>
+(
+    // inputs, not modified
+    int method,                 // 0,1,2,3
+    SuiteSparseQR_factorization <float, int32_t> *QR,
+    cholmod_sparse *Xsparse,    // size m-by-n
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template cholmod_sparse *SuiteSparseQR_qmult <FComplex, int32_t>
+(
+    // inputs, not modified
+    int method,                 // 0,1,2,3
+    SuiteSparseQR_factorization <FComplex, int32_t> *QR,
+    cholmod_sparse *Xsparse,    // size m-by-n
+    // workspace and parameters
+    cholmod_common *cc
+) ;
 template cholmod_sparse *SuiteSparseQR_qmult <Complex, int64_t>
 (
     // inputs, not modified
@@ -1683,6 +2253,24 @@ template cholmod_sparse *SuiteSparseQR_qmult <Complex, int64_t>
     // workspace and parameters
     cholmod_common *cc
 ) ;
+template cholmod_sparse *SuiteSparseQR_qmult <float, int64_t>
+(
+    // inputs, not modified
+    int method,                 // 0,1,2,3
+    SuiteSparseQR_factorization <float, int64_t> *QR,
+    cholmod_sparse *Xsparse,    // size m-by-n
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template cholmod_sparse *SuiteSparseQR_qmult <FComplex, int64_t>
+(
+    // inputs, not modified
+    int method,                 // 0,1,2,3
+    SuiteSparseQR_factorization <FComplex, int64_t> *QR,
+    cholmod_sparse *Xsparse,    // size m-by-n
+    // workspace and parameters
+    cholmod_common *cc
+) ;
 
 // =============================================================================
 // === SuiteSparseQR_free ======================================================
@@ -1717,11 +2305,31 @@ template int SuiteSparseQR_free <Complex, int32_t>
     SuiteSparseQR_factorization <Complex, int32_t> **QR,
     cholmod_common *cc
 ) ;
+template int SuiteSparseQR_free <float, int32_t>
+(
+    SuiteSparseQR_factorization <float, int32_t> **QR,
+    cholmod_common *cc
+) ;
+template int SuiteSparseQR_free <FComplex, int32_t>
+(
+    SuiteSparseQR_factorization <FComplex, int32_t> **QR,
+    cholmod_common *cc
+) ;
 template int SuiteSparseQR_free <Complex, int64_t>
 (
     SuiteSparseQR_factorization <Complex, int64_t> **QR,
     cholmod_common *cc
 ) ;
+template int SuiteSparseQR_free <float, int64_t>
+(
+    SuiteSparseQR_factorization <float, int64_t> **QR,
+    cholmod_common *cc
+) ;
+template int SuiteSparseQR_free <FComplex, int64_t>
+(
+    SuiteSparseQR_factorization <FComplex, int64_t> **QR,
+    cholmod_common *cc
+) ;
 
 // =============================================================================
 // === SuiteSparseQR_min2norm ==================================================
@@ -1819,6 +2427,22 @@ template cholmod_dense *SuiteSparseQR_min2norm <Complex, int32_t>
     cholmod_dense *B,
     cholmod_common *cc
 ) ;
+template cholmod_dense *SuiteSparseQR_min2norm <float, int32_t>
+(
+    int ordering,           // all, except 3:given treated as 0:fixed
+    double tol,
+    cholmod_sparse *A,
+    cholmod_dense *B,
+    cholmod_common *cc
+) ;
+template cholmod_dense *SuiteSparseQR_min2norm <FComplex, int32_t>
+(
+    int ordering,           // all, except 3:given treated as 0:fixed
+    double tol,
+    cholmod_sparse *A,
+    cholmod_dense *B,
+    cholmod_common *cc
+) ;
 template cholmod_dense *SuiteSparseQR_min2norm <Complex, int64_t>
 (
     int ordering,           // all, except 3:given treated as 0:fixed
@@ -1827,6 +2451,22 @@ template cholmod_dense *SuiteSparseQR_min2norm <Complex, int64_t>
     cholmod_dense *B,
     cholmod_common *cc
 ) ;
+template cholmod_dense *SuiteSparseQR_min2norm <float, int64_t>
+(
+    int ordering,           // all, except 3:given treated as 0:fixed
+    double tol,
+    cholmod_sparse *A,
+    cholmod_dense *B,
+    cholmod_common *cc
+) ;
+template cholmod_dense *SuiteSparseQR_min2norm <FComplex, int64_t>
+(
+    int ordering,           // all, except 3:given treated as 0:fixed
+    double tol,
+    cholmod_sparse *A,
+    cholmod_dense *B,
+    cholmod_common *cc
+) ;
 
 // =============================================================================
 // === SuiteSparseQR_min2norm (sparse case) ====================================
@@ -1897,6 +2537,22 @@ template cholmod_sparse *SuiteSparseQR_min2norm <Complex, int32_t>
     cholmod_sparse *Bsparse,
     cholmod_common *cc
 ) ;
+template cholmod_sparse *SuiteSparseQR_min2norm <float, int32_t>
+(
+    int ordering,           // all, except 3:given treated as 0:fixed
+    double tol,
+    cholmod_sparse *A,
+    cholmod_sparse *Bsparse,
+    cholmod_common *cc
+) ;
+template cholmod_sparse *SuiteSparseQR_min2norm <FComplex, int32_t>
+(
+    int ordering,           // all, except 3:given treated as 0:fixed
+    double tol,
+    cholmod_sparse *A,
+    cholmod_sparse *Bsparse,
+    cholmod_common *cc
+) ;
 template cholmod_sparse *SuiteSparseQR_min2norm <Complex, int64_t>
 (
     int ordering,           // all, except 3:given treated as 0:fixed
@@ -1905,5 +2561,21 @@ template cholmod_sparse *SuiteSparseQR_min2norm <Complex, int64_t>
     cholmod_sparse *Bsparse,
     cholmod_common *cc
 ) ;
+template cholmod_sparse *SuiteSparseQR_min2norm <float, int64_t>
+(
+    int ordering,           // all, except 3:given treated as 0:fixed
+    double tol,
+    cholmod_sparse *A,
+    cholmod_sparse *Bsparse,
+    cholmod_common *cc
+) ;
+template cholmod_sparse *SuiteSparseQR_min2norm <FComplex, int64_t>
+(
+    int ordering,           // all, except 3:given treated as 0:fixed
+    double tol,
+    cholmod_sparse *A,
+    cholmod_sparse *Bsparse,
+    cholmod_common *cc
+) ;
 
 #endif
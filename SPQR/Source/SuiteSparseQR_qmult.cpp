@@ -32,6 +32,130 @@
 
 #define HCHUNK_DENSE 32        // FUTURE: make this an input parameter
 
+// -----------------------------------------------------------------------------
+// spqr_private_happly_parallel: apply H to blocks of columns of X in parallel
+// -----------------------------------------------------------------------------
+
+// For Q'*X and Q*X only.  Each column of X is independent, so X is split into
+// blocks of columns, and each thread applies H to one block at a time, with
+// its own Wi, Wmap, C, and V workspace, and its own copy of cc (for
+// cc->blas_ok).  Returns FALSE if out of memory, in which case X is unchanged
+// and H must be applied with spqr_happly instead.
+
+template <typename Entry, typename Int> int spqr_private_happly_parallel
+(
+    // input
+    int method,     // SPQR_QTX or SPQR_QX
+    Int m,         // X is m-by-n with leading dimension m
+    Int n,
+    Int nh,        // number of Householder vectors
+    Int *Hp,       // H is m-by-nh
+    Int *Hi,
+    Entry *Hx,
+    Entry *Tau,     // size nh
+    int nthreads,   // # of threads to use
+
+    // input/output
+    Entry *X,
+
+    cholmod_common *cc
+)
+{
+#ifdef _OPENMP
+
+    Int hchunk, vmax, vsize, csize, cvsize, wisize, bsize, nblocks,
+        cvwsize, wiwsize ;
+    Entry *CVwork ;
+    Int *Wiwork ;
+    cholmod_common *Ccommon ;
+    int ok = TRUE ;
+
+    // -------------------------------------------------------------------------
+    // determine the blocks and the workspace for each thread
+    // -------------------------------------------------------------------------
+
+    nblocks = MIN (nthreads, n) ;
+    bsize = (n + nblocks - 1) / nblocks ;
+    nblocks = (n + bsize - 1) / bsize ;
+    nthreads = (int) MIN (nthreads, nblocks) ;
+
+    hchunk = MIN (HCHUNK_DENSE, nh) ;
+    ok = spqr_happly_work (method, m, bsize, nh, Hp, hchunk,
+        &vmax, &vsize, &csize) ;
+    cvsize = spqr_add (csize, vsize, &ok) ;
+    wisize = spqr_add (m, vmax, &ok) ;
+    cvwsize = spqr_mult (cvsize, (Int) nthreads, &ok) ;
+    wiwsize = spqr_mult (wisize, (Int) nthreads, &ok) ;
+    if (!ok)
+    {
+        // problem too large; let spqr_happly handle it
+        return (FALSE) ;
+    }
+
+    CVwork = (Entry *) spqr_malloc <Int> (cvwsize, sizeof (Entry), cc) ;
+    Wiwork = (Int *) spqr_malloc <Int> (wiwsize, sizeof (Int), cc) ;
+    Ccommon = (cholmod_common *) spqr_malloc <Int> (nthreads,
+        sizeof (cholmod_common), cc) ;
+
+    if (cc->status < CHOLMOD_OK)
+    {
+        // out of memory; do it with one thread instead
+        spqr_free <Int> (cvwsize, sizeof (Entry), CVwork, cc) ;
+        spqr_free <Int> (wiwsize, sizeof (Int), Wiwork, cc) ;
+        spqr_free <Int> (nthreads, sizeof (cholmod_common), Ccommon, cc) ;
+        cc->status = CHOLMOD_OK ;
+        return (FALSE) ;
+    }
+
+    for (int tid = 0 ; tid < nthreads ; tid++)
+    {
+        Ccommon [tid] = *cc ;
+        Int *Wmap = Wiwork + wisize * tid + vmax ;
+        for (Int i = 0 ; i < m ; i++)
+        {
+            Wmap [i] = EMPTY ;
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // apply H to each block of X
+    // -------------------------------------------------------------------------
+
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (Int b = 0 ; b < nblocks ; b++)
+    {
+        int tid = SUITESPARSE_OPENMP_GET_THREAD_ID ;
+        Int *Wi = Wiwork + wisize * tid ;       // size vmax
+        Int *Wmap = Wi + vmax ;                 // size m, all EMPTY
+        Entry *C = CVwork + cvsize * tid ;      // size csize
+        Entry *V = C + csize ;                  // size vsize
+        Int k1 = b * bsize ;
+        Int k2 = MIN (k1 + bsize, n) ;
+        spqr_happly (method, m, k2-k1, nh, Hp, Hi, Hx, Tau, X + k1 * m,
+            vmax, hchunk, Wi, Wmap, C, V, &(Ccommon [tid])) ;
+    }
+
+    // -------------------------------------------------------------------------
+    // free workspace
+    // -------------------------------------------------------------------------
+
+    for (int tid = 0 ; tid < nthreads ; tid++)
+    {
+        cc->blas_ok = cc->blas_ok && Ccommon [tid].blas_ok ;
+    }
+    spqr_free <Int> (cvwsize, sizeof (Entry), CVwork, cc) ;
+    spqr_free <Int> (wiwsize, sizeof (Int), Wiwork, cc) ;
+    spqr_free <Int> (nthreads, sizeof (cholmod_common), Ccommon, cc) ;
+    return (TRUE) ;
+
+#else
+
+    // no OpenMP
+    return (FALSE) ;
+
+#endif
+}
+
 // returns Y of size m-by-n, or NULL on failure
 template <typename Entry, typename Int> cholmod_dense *SuiteSparseQR_qmult
 (
@@ -133,6 +257,82 @@ template <typename Entry, typename Int> cholmod_dense *SuiteSparseQR_qmult
         Z = (Entry *) spqr_malloc <Int> (zsize, sizeof (Entry), cc) ;
     }
 
+    // -------------------------------------------------------------------------
+    // Y = Q'*X or Q*X in parallel, if worthwhile
+    // -------------------------------------------------------------------------
+
+    int nthreads = 1 ;
+    if ((method == SPQR_QTX || method == SPQR_QX) && nh > 0
+        && (method == SPQR_QTX || Z != NULL))
+    {
+        nthreads = spqr_nthreads (4 * ((double) Hp [nh]) * ((double) n), cc) ;
+    }
+
+    if (nthreads > 1)
+    {
+        if (method == SPQR_QTX)
+        {
+            // Y (P,:) = X, then apply H to Y
+            X1 = X ;
+            Y1 = Y ;
+            for (k = 0 ; k < n ; k++)
+            {
+                for (i = 0 ; i < m ; i++)
+                {
+                    Y1 [HPinv ? HPinv [i] : i] = X1 [i] ;
+                }
+                X1 += ldx ;
+                Y1 += m ;
+            }
+            ok = spqr_private_happly_parallel (method, m, n, nh, Hp, Hi, Hx,
+                (Entry *) HTau->x, nthreads, Y, cc) ;
+        }
+        else
+        {
+            // Z = X, apply H to Z, then Y = Z (P,:)
+            Z1 = Z ;
+            X1 = X ;
+            for (k = 0 ; k < n ; k++)
+            {
+                for (i = 0 ; i < m ; i++)
+                {
+                    Z1 [i] = X1 [i] ;
+                }
+                X1 += ldx ;
+                Z1 += m ;
+            }
+            ok = spqr_private_happly_parallel (method, m, n, nh, Hp, Hi, Hx,
+                (Entry *) HTau->x, nthreads, Z, cc) ;
+            if (ok)
+            {
+                Z1 = Z ;
+                Y1 = Y ;
+                for (k = 0 ; k < n ; k++)
+                {
+                    for (i = 0 ; i < m ; i++)
+                    {
+                        Y1 [i] = Z1 [HPinv ? HPinv [i] : i] ;
+                    }
+                    Z1 += m ;
+                    Y1 += m ;
+                }
+            }
+        }
+        if (ok)
+        {
+            spqr_free <Int> (zsize, sizeof (Entry), Z, cc) ;
+            if (sizeof (SUITESPARSE_BLAS_INT) < sizeof (Int) && !cc->blas_ok)
+            {
+                ERROR (CHOLMOD_INVALID, "problem too large for the BLAS") ;
+                spqr_free_dense <Int> (&Ydense, cc) ;
+                return (NULL) ;
+            }
+            return (Ydense) ;
+        }
+        // out of memory; continue with one thread
+        ok = TRUE ;
+    }
+
     hchunk = MIN (HCHUNK_DENSE, nh) ;
     ok = spqr_happly_work (method, m, n, nh, Hp, hchunk, &vmax, &vsize, &csize);
 
@@ -393,6 +593,30 @@ template cholmod_dense *SuiteSparseQR_qmult <Complex, int64_t>
     // workspace and parameters
     cholmod_common *cc
 ) ;
+template cholmod_dense *SuiteSparseQR_qmult <float, int64_t>
+(
+    // inputs, not modified
+    int method,             // 0,1,2,3
+    cholmod_sparse *H,      // either m-by-nh or n-by-nh
+    cholmod_dense *HTau,    // size 1-by-nh
+    int64_t *HPinv,            // size mh
+    cholmod_dense *Xdense,  // size m-by-n with leading dimension ldx
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template cholmod_dense *SuiteSparseQR_qmult <FComplex, int64_t>
+(
+    // inputs, not modified
+    int method,             // 0,1,2,3
+    cholmod_sparse *H,      // either m-by-nh or n-by-nh
+    cholmod_dense *HTau,    // size 1-by-nh
+    int64_t *HPinv,            // size mh
+    cholmod_dense *Xdense,  // size m-by-n with leading dimension ldx
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
 template cholmod_dense *SuiteSparseQR_qmult <Complex, int32_t>
 (
     // inputs, not modified
@@ -405,6 +629,30 @@ template cholmod_dense *SuiteSparseQR_qmult <Complex, int32_t>
     // workspace and parameters
     cholmod_common *cc
 ) ;
+template cholmod_dense *SuiteSparseQR_qmult <float, int32_t>
+(
+    // inputs, not modified
+    int method,             // 0,1,2,3
+    cholmod_sparse *H,      // either m-by-nh or n-by-nh
+    cholmod_dense *HTau,    // size 1-by-nh
+    int32_t *HPinv,            // size mh
+    cholmod_dense *Xdense,  // size m-by-n with leading dimension ldx
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template cholmod_dense *SuiteSparseQR_qmult <FComplex, int32_t>
+(
+    // inputs, not modified
+    int method,             // 0,1,2,3
+    cholmod_sparse *H,      // either m-by-nh or n-by-nh
+    cholmod_dense *HTau,    // size 1-by-nh
+    int32_t *HPinv,            // size mh
+    cholmod_dense *Xdense,  // size m-by-n with leading dimension ldx
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
 
 // =============================================================================
 // === SuiteSparseQR_qmult (sparse) ============================================
@@ -768,6 +1016,30 @@ template cholmod_sparse *SuiteSparseQR_qmult <Complex, int32_t>
     // workspace and parameters
     cholmod_common *cc
 ) ;
+template cholmod_sparse *SuiteSparseQR_qmult <float, int32_t>
+(
+    // inputs, not modified
+    int method,                 // 0,1,2,3
+    cholmod_sparse *H,          // size m-by-nh or n-by-nh
+    cholmod_dense *HTau,        // size 1-by-nh
+    int32_t *HPinv,                // size mh
+    cholmod_sparse *Xsparse,
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template cholmod_sparse *SuiteSparseQR_qmult <FComplex, int32_t>
+(
+    // inputs, not modified
+    int method,                 // 0,1,2,3
+    cholmod_sparse *H,          // size m-by-nh or n-by-nh
+    cholmod_dense *HTau,        // size 1-by-nh
+    int32_t *HPinv,                // size mh
+    cholmod_sparse *Xsparse,
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
 template cholmod_sparse *SuiteSparseQR_qmult <Complex, int64_t>
 (
     // inputs, not modified
@@ -780,3 +1052,27 @@ template cholmod_sparse *SuiteSparseQR_qmult <Complex, int64_t>
     // workspace and parameters
     cholmod_common *cc
 ) ;
+template cholmod_sparse *SuiteSparseQR_qmult <float, int64_t>
+(
+    // inputs, not modified
+    int method,                 // 0,1,2,3
+    cholmod_sparse *H,          // size m-by-nh or n-by-nh
+    cholmod_dense *HTau,        // size 1-by-nh
+    int64_t *HPinv,                // size mh
+    cholmod_sparse *Xsparse,
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template cholmod_sparse *SuiteSparseQR_qmult <FComplex, int64_t>
+(
+    // inputs, not modified
+    int method,                 // 0,1,2,3
+    cholmod_sparse *H,          // size m-by-nh or n-by-nh
+    cholmod_dense *HTau,        // size 1-by-nh
+    int64_t *HPinv,                // size mh
+    cholmod_sparse *Xsparse,
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
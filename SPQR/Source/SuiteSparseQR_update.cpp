@@ -0,0 +1,972 @@
+// =============================================================================
+// === SuiteSparseQR_update ====================================================
+// =============================================================================
+
+// SPQR, Copyright (c) 2008-2022, Timothy A Davis. All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+// Row-append updates of a Q-less QR factorization, for least-squares problems
+// whose rows arrive in batches:
+//
+//      SuiteSparseQR_append_rows   given the R factor and C = Q'*B of
+//                                  [A B](:,E), compute the R factor and
+//                                  C = Q'*[B;Bnew] of [A;Anew](:,E)
+//      SuiteSparseQR_rsolve        X = E*(R\C), the least-squares solution
+//
+// R, E, and C are those returned by the Q-less form of SuiteSparseQR,
+//
+//      rank = SuiteSparseQR <Entry> (ordering, tol, econ, A, B, &C, &R, &E, cc)
+//
+// and they can be updated any number of times.  Q is never formed or kept.
+// The column ordering E is not changed, so it should be computed from a
+// matrix A whose pattern is representative of the rows still to come.
+//
+// Each new row is merged into R with a sequence of Givens rotations, in
+// increasing column order, as in George and Heath's row-sequential sparse QR.
+// A row only touches the rows of R on the path from its leading column to
+// the root of the column elimination tree of R, so the work is proportional
+// to the number of entries in the rows of R that the new rows affect, not to
+// the number of rows of A.  Converting R to and from its row form takes
+// O(nnz(R)) time.
+
+#include "spqr.hpp"
+
+// =============================================================================
+// === spqr_private_heap_push/pop ==============================================
+// =============================================================================
+
+// The pattern of a new row is kept in a binary min-heap of column indices, so
+// that its entries are eliminated in increasing column order as the rotations
+// fill it in.
+
+template <typename Int> void spqr_private_heap_push
+(
+    Int *Heap,
+    Int *hsize,
+    Int j
+)
+{
+    Int k = (*hsize)++ ;
+    while (k > 0)
+    {
+        Int parent = (k-1) / 2 ;
+        if (Heap [parent] <= j) break ;
+        Heap [k] = Heap [parent] ;
+        k = parent ;
+    }
+    Heap [k] = j ;
+}
+
+template <typename Int> Int spqr_private_heap_pop
+(
+    Int *Heap,
+    Int *hsize
+)
+{
+    Int jmin = Heap [0] ;
+    Int j = Heap [--(*hsize)] ;
+    Int k = 0 ;
+    for ( ; ; )
+    {
+        Int c = 2*k + 1 ;
+        if (c >= (*hsize)) break ;
+        if (c+1 < (*hsize) && Heap [c+1] < Heap [c]) c++ ;
+        if (j <= Heap [c]) break ;
+        Heap [k] = Heap [c] ;
+        k = c ;
+    }
+    if ((*hsize) > 0) Heap [k] = j ;
+    return (jmin) ;
+}
+
+// =============================================================================
+// === SuiteSparseQR_append_rows ===============================================
+// =============================================================================
+
+// On input, R is the e-by-n R factor of A(:,E) (upper triangular, or upper
+// trapezoidal in the squeezed form returned by SuiteSparseQR when A is rank
+// deficient), and C = Q'*B is e-by-nrhs.  On output, R and C are replaced with
+// the R factor of [A;Anew](:,E) and C = Q'*[B;Bnew].  The output R is in
+// triangular form: R (k,:) is either empty or has a nonzero diagonal entry
+// R (k,k), and its number of rows is the larger of e and one plus the last
+// nonempty row, which is at most n.
+//
+// C and Bnew may be NULL, in which case only R is updated.  If C is present
+// and Bnew is NULL, the right-hand-sides of the new rows are taken as zero.
+//
+// Returns TRUE if successful.  On failure (out of memory or invalid inputs)
+// R and C are not modified.
+
+#define FREE_WORK \
+{ \
+    if (Rowi != NULL && Rown != NULL) \
+    { \
+        for (i = 0 ; i < nrmax ; i++) \
+        { \
+            if (Rown [i]) \
+            { \
+                spqr_free <Int> (Rcap [i], sizeof (Int),   Rowi [i], cc) ; \
+                spqr_free <Int> (Rcap [i], sizeof (Entry), Rowx [i], cc) ; \
+            } \
+        } \
+    } \
+    spqr_free <Int> (nrmax, sizeof (Int *),   Rowi, cc) ; \
+    spqr_free <Int> (nrmax, sizeof (Entry *), Rowx, cc) ; \
+    spqr_free <Int> (nrmax, sizeof (Int),     Rlen, cc) ; \
+    spqr_free <Int> (nrmax, sizeof (Int),     Rcap, cc) ; \
+    spqr_free <Int> (nrmax, sizeof (char),    Rown, cc) ; \
+    spqr_free <Int> (rnz,   sizeof (Int),     Ipool, cc) ; \
+    spqr_free <Int> (rnz,   sizeof (Entry),   Xpool, cc) ; \
+    spqr_free <Int> (n,     sizeof (Int),     Einv, cc) ; \
+    spqr_free <Int> (n,     sizeof (Int),     Heap, cc) ; \
+    spqr_free <Int> (n,     sizeof (char),    Inw, cc) ; \
+    spqr_free <Int> (n,     sizeof (Entry),   Wx, cc) ; \
+    spqr_free <Int> (n,     sizeof (Entry),   Rw, cc) ; \
+    spqr_free <Int> (nrhs,  sizeof (Entry),   Cw, cc) ; \
+    spqr_free <Int> (erow,  sizeof (Int),     Lead, cc) ; \
+    spqr_free <Int> (erow+1, sizeof (Int),    Rstart, cc) ; \
+    spqr_free <Int> (erow,  sizeof (Int),     Extra, cc) ; \
+    spqr_free_sparse <Int> (&AT, cc) ; \
+    spqr_free_dense <Int> (&Cwork, cc) ; \
+}
+
+template <typename Entry, typename Int> int SuiteSparseQR_append_rows
+(
+    // inputs, not modified
+    cholmod_sparse *Anew,   // k-by-n, the rows to append to A
+    cholmod_dense *Bnew,    // k-by-nrhs, the rows to append to B (may be NULL)
+    Int *E,                 // size n, column permutation of R (NULL if identity)
+
+    // input/output
+    cholmod_sparse **p_R,   // e-by-n R factor of A(:,E) on input,
+                            // R factor of [A;Anew](:,E) on output
+    cholmod_dense **p_C,    // C = Q'*B on input, Q'*[B;Bnew] on output
+                            // (may be NULL)
+
+    // workspace and parameters
+    cholmod_common *cc
+)
+{
+    cholmod_sparse *R, *Rnew, *AT ;
+    cholmod_dense *C, *Cnew, *Cwork ;
+    Int *Rp, *Ri, *ATp, *ATi, *Rnewp, *Rnewi, *Einv, *Heap, *Rlen, *Rcap,
+        *Ipool, *Lead, *Rstart, *Extra, **Rowi ;
+    Entry *Rx, *ATx, *Bx, *Cx, *Rnewx, *Wx, *Rw, *Cw, *Xpool, *Y, **Rowx ;
+    char *Rown, *Inw ;
+    Int i, j, k, p, n, erow, nrmax, nrow, rnz, nrhs, ldb, ldc, hsize, len,
+        anew, q, nextra ;
+
+    // -------------------------------------------------------------------------
+    // check inputs
+    // -------------------------------------------------------------------------
+
+    RETURN_IF_NULL_COMMON (FALSE) ;
+    RETURN_IF_NULL (Anew, FALSE) ;
+    RETURN_IF_NULL (p_R, FALSE) ;
+    R = *p_R ;
+    RETURN_IF_NULL (R, FALSE) ;
+    C = (p_C == NULL) ? NULL : (*p_C) ;
+    int64_t xtype = spqr_type <Entry> ( ) ;
+    RETURN_IF_XTYPE_INVALID (Anew, FALSE) ;
+    RETURN_IF_XTYPE_INVALID (R, FALSE) ;
+    if (C != NULL) RETURN_IF_XTYPE_INVALID (C, FALSE) ;
+    if (Bnew != NULL) RETURN_IF_XTYPE_INVALID (Bnew, FALSE) ;
+    n = R->ncol ;
+    erow = R->nrow ;
+    anew = Anew->nrow ;
+    nrhs = (C == NULL) ? 0 : C->ncol ;
+    if ((Int) Anew->ncol != n || (C != NULL && (Int) C->nrow != erow)
+        || (Bnew != NULL && (C == NULL || (Int) Bnew->nrow != anew
+        || (Int) Bnew->ncol != nrhs)))
+    {
+        ERROR (CHOLMOD_INVALID, "invalid dimensions") ;
+        return (FALSE) ;
+    }
+    if (!R->packed || !Anew->packed || Anew->stype != 0)
+    {
+        ERROR (CHOLMOD_INVALID, "R and Anew must be packed and unsymmetric") ;
+        return (FALSE) ;
+    }
+    cc->status = CHOLMOD_OK ;
+
+    Rp = (Int *) R->p ;
+    Ri = (Int *) R->i ;
+    Rx = (Entry *) R->x ;
+    rnz = Rp [n] ;
+    ldc = (C == NULL) ? 0 : C->d ;
+    Cx = (C == NULL) ? NULL : ((Entry *) C->x) ;
+    ldb = (Bnew == NULL) ? 0 : Bnew->d ;
+    Bx = (Bnew == NULL) ? NULL : ((Entry *) Bnew->x) ;
+
+    // row k of the updated R, for k < nrmax, is Rowi [k] [0..Rlen[k]-1]
+    nrmax = MAX (erow, n) ;
+
+    // -------------------------------------------------------------------------
+    // allocate workspace
+    // -------------------------------------------------------------------------
+
+    Rnew = NULL ;
+    Cnew = NULL ;
+    Y = NULL ;
+    Cwork = NULL ;
+    Rown = NULL ;
+    // AT and Cwork are allocated first, since allocating a CHOLMOD object
+    // clears cc->status
+    AT = spqr_transpose <Int> (Anew, 1, cc) ;   // AT = Anew.', rows of Anew
+    if (C != NULL)
+    {
+        Cwork = spqr_allocate_dense <Int> (nrmax, nrhs, nrmax, xtype, cc) ;
+    }
+    Rowi  = (Int **)   spqr_malloc <Int> (nrmax, sizeof (Int *),   cc) ;
+    Rowx  = (Entry **) spqr_malloc <Int> (nrmax, sizeof (Entry *), cc) ;
+    Rlen  = (Int *)    spqr_calloc <Int> (nrmax, sizeof (Int),     cc) ;
+    Rcap  = (Int *)    spqr_calloc <Int> (nrmax, sizeof (Int),     cc) ;
+    Rown  = (char *)   spqr_calloc <Int> (nrmax, sizeof (char),    cc) ;
+    Ipool = (Int *)    spqr_malloc <Int> (rnz,   sizeof (Int),     cc) ;
+    Xpool = (Entry *)  spqr_malloc <Int> (rnz,   sizeof (Entry),   cc) ;
+    Einv  = (Int *)    spqr_malloc <Int> (n,     sizeof (Int),     cc) ;
+    Heap  = (Int *)    spqr_malloc <Int> (n,     sizeof (Int),     cc) ;
+    Inw   = (char *)   spqr_calloc <Int> (n,     sizeof (char),    cc) ;
+    Wx    = (Entry *)  spqr_calloc <Int> (n,     sizeof (Entry),   cc) ;
+    Rw    = (Entry *)  spqr_calloc <Int> (n,     sizeof (Entry),   cc) ;
+    Cw    = (Entry *)  spqr_malloc <Int> (nrhs,  sizeof (Entry),   cc) ;
+    Lead  = (Int *)    spqr_malloc <Int> (erow,  sizeof (Int),     cc) ;
+    Rstart = (Int *)   spqr_malloc <Int> (erow+1, sizeof (Int),    cc) ;
+    Extra = (Int *)    spqr_malloc <Int> (erow,  sizeof (Int),     cc) ;
+
+    if (cc->status < CHOLMOD_OK || AT == NULL || (C != NULL && Cwork == NULL))
+    {
+        // out of memory
+        ERROR (CHOLMOD_OUT_OF_MEMORY, "out of memory") ;
+        FREE_WORK ;
+        return (FALSE) ;
+    }
+
+    for (k = 0 ; k < nrmax ; k++)
+    {
+        Rowi [k] = NULL ;
+        Rowx [k] = NULL ;
+    }
+    for (k = 0 ; k < n ; k++)
+    {
+        Einv [E ? E [k] : k] = k ;
+    }
+
+    // -------------------------------------------------------------------------
+    // convert R to row form, placing each row at the index of its leading column
+    // -------------------------------------------------------------------------
+
+    // A squeezed R (from a rank-deficient A) has rows whose leading column is
+    // past the diagonal; moving each row to the index of its leading column
+    // is a row permutation of R and C, so it leaves R'*R unchanged.  If two
+    // rows have the same leading column, the second one is merged into R
+    // below, like a new row.  After this step, row k of R is either empty or
+    // starts with R (k,k).
+
+    // R is first copied into the pool in compressed-row form
+    for (i = 0 ; i <= erow ; i++)
+    {
+        Rstart [i] = 0 ;
+    }
+    for (i = 0 ; i < erow ; i++)
+    {
+        Lead [i] = EMPTY ;
+    }
+    for (j = 0 ; j < n ; j++)
+    {
+        for (p = Rp [j] ; p < Rp [j+1] ; p++)
+        {
+            i = Ri [p] ;
+            if (Lead [i] == EMPTY) Lead [i] = j ;
+            Rstart [i]++ ;
+        }
+    }
+    spqr_cumsum (erow, Rstart) ;
+    for (j = 0 ; j < n ; j++)
+    {
+        for (p = Rp [j] ; p < Rp [j+1] ; p++)
+        {
+            Int pr = Rstart [Ri [p]]++ ;
+            Ipool [pr] = j ;
+            Xpool [pr] = Rx [p] ;
+        }
+    }
+    spqr_shift (erow, Rstart) ;
+
+    // Y (k,:) = C (i,:) where row i of R becomes row k.  The rows of C for
+    // empty rows of R are part of the old residual and are not needed.
+    if (C != NULL)
+    {
+        Y = (Entry *) Cwork->x ;
+        for (i = 0 ; i < nrmax * nrhs ; i++)
+        {
+            Y [i] = 0 ;
+        }
+    }
+    nextra = 0 ;
+    for (i = 0 ; i < erow ; i++)
+    {
+        k = Lead [i] ;
+        if (k == EMPTY) continue ;
+        if (Rlen [k] > 0)
+        {
+            // row k is taken; merge row i into R later
+            Extra [nextra++] = i ;
+            continue ;
+        }
+        Rowi [k] = Ipool + Rstart [i] ;
+        Rowx [k] = Xpool + Rstart [i] ;
+        Rlen [k] = Rstart [i+1] - Rstart [i] ;
+        Rcap [k] = Rlen [k] ;
+        for (Int kk = 0 ; kk < nrhs ; kk++)
+        {
+            Y [k + kk*nrmax] = Cx [i + kk*ldc] ;
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // merge each extra row of R, and then each new row, into R
+    // -------------------------------------------------------------------------
+
+    ATp = (Int *) AT->p ;
+    ATi = (Int *) AT->i ;
+    ATx = (Entry *) AT->x ;
+
+    for (Int t = 0 ; t < nextra + anew ; t++)
+    {
+
+        // ---------------------------------------------------------------------
+        // scatter the row into w, in the column order of R
+        // ---------------------------------------------------------------------
+
+        hsize = 0 ;
+        if (t < nextra)
+        {
+            // row i of the input R
+            i = Extra [t] ;
+            for (p = Rstart [i] ; p < Rstart [i+1] ; p++)
+            {
+                j = Ipool [p] ;
+                Inw [j] = TRUE ;
+                Wx [j] = Xpool [p] ;
+                spqr_private_heap_push (Heap, &hsize, j) ;
+            }
+            for (Int kk = 0 ; kk < nrhs ; kk++)
+            {
+                Cw [kk] = Cx [i + kk*ldc] ;
+            }
+        }
+        else
+        {
+            // row i of Anew
+            i = t - nextra ;
+            for (p = ATp [i] ; p < ATp [i+1] ; p++)
+            {
+                j = Einv [ATi [p]] ;
+                if (!Inw [j])
+                {
+                    Inw [j] = TRUE ;
+                    Wx [j] = 0 ;
+                    spqr_private_heap_push (Heap, &hsize, j) ;
+                }
+                Wx [j] += ATx [p] ;
+            }
+            for (Int kk = 0 ; kk < nrhs ; kk++)
+            {
+                Cw [kk] = (Bx == NULL) ? ((Entry) 0) : Bx [i + kk*ldb] ;
+            }
+        }
+
+        // ---------------------------------------------------------------------
+        // eliminate w, one column at a time
+        // ---------------------------------------------------------------------
+
+        while (hsize > 0)
+        {
+            j = spqr_private_heap_pop (Heap, &hsize) ;
+            Inw [j] = FALSE ;
+            Entry b = Wx [j] ;
+            Wx [j] = 0 ;
+            if (b == (Entry) 0) continue ;
+
+            // the new row k = j of R is {j} and the rest of the pattern of w,
+            // which becomes the union of w and the old row j
+            Int *Rj = Rowi [j] ;
+            Entry *Rjx = Rowx [j] ;
+            Int rlen = Rlen [j] ;
+            int empty = (rlen == 0) ;
+            for (p = 0 ; p < rlen ; p++)
+            {
+                q = Rj [p] ;
+                Rw [q] = Rjx [p] ;
+                if (q != j && !Inw [q])
+                {
+                    Inw [q] = TRUE ;
+                    Wx [q] = 0 ;
+                    spqr_private_heap_push (Heap, &hsize, q) ;
+                }
+            }
+
+            // make room for the new row j
+            len = hsize + 1 ;
+            if (len > Rcap [j])
+            {
+                Int cap = MAX (len, 2 * Rcap [j]) ;
+                Int *Rj2 = (Int *) spqr_malloc <Int> (cap, sizeof (Int), cc) ;
+                Entry *Rjx2 = (Entry *)
+                    spqr_malloc <Int> (cap, sizeof (Entry), cc) ;
+                if (cc->status < CHOLMOD_OK)
+                {
+                    // out of memory
+                    spqr_free <Int> (cap, sizeof (Int),   Rj2,  cc) ;
+                    spqr_free <Int> (cap, sizeof (Entry), Rjx2, cc) ;
+                    FREE_WORK ;
+                    return (FALSE) ;
+                }
+                if (Rown [j])
+                {
+                    spqr_free <Int> (Rcap [j], sizeof (Int),   Rj,  cc) ;
+                    spqr_free <Int> (Rcap [j], sizeof (Entry), Rjx, cc) ;
+                }
+                Rowi [j] = Rj = Rj2 ;
+                Rowx [j] = Rjx = Rjx2 ;
+                Rcap [j] = cap ;
+                Rown [j] = TRUE ;
+            }
+            Rlen [j] = len ;
+
+            if (empty)
+            {
+
+                // -------------------------------------------------------------
+                // row j of R is empty: w becomes row j, and is done
+                // -------------------------------------------------------------
+
+                Rj [0] = j ;
+                Rjx [0] = b ;
+                for (p = 0 ; p < hsize ; p++)
+                {
+                    q = Heap [p] ;
+                    Rj [p+1] = q ;
+                    Rjx [p+1] = Wx [q] ;
+                    Inw [q] = FALSE ;
+                    Wx [q] = 0 ;
+                }
+                hsize = 0 ;
+                for (Int kk = 0 ; kk < nrhs ; kk++)
+                {
+                    Y [j + kk*nrmax] = Cw [kk] ;
+                }
+
+            }
+            else
+            {
+
+                // -------------------------------------------------------------
+                // rotate row j of R and w so that w (j) becomes zero
+                // -------------------------------------------------------------
+
+                // [Rj ; w] = [c s ; -conj(s) c] * [Rj ; w], with c real
+                Entry a = Rw [j] ;
+                double alpha = spqr_abs (a) ;
+                double beta = spqr_abs (b) ;
+                double rnorm = SuiteSparse_config_hypot (alpha, beta) ;
+                Entry c, s ;
+                if (alpha == 0)
+                {
+                    c = 0 ;
+                    s = spqr_conj (b) * ((Entry) (1 / beta)) ;
+                }
+                else
+                {
+                    c = (Entry) (alpha / rnorm) ;
+                    s = a * ((Entry) (1 / (alpha * rnorm))) * spqr_conj (b) ;
+                }
+                Entry sc = -spqr_conj (s) ;
+
+                Rj [0] = j ;
+                Rjx [0] = c * a + s * b ;
+                Rw [j] = 0 ;
+                for (p = 0 ; p < hsize ; p++)
+                {
+                    q = Heap [p] ;
+                    Entry r = Rw [q] ;
+                    Entry w = Wx [q] ;
+                    Rj [p+1] = q ;
+                    Rjx [p+1] = c * r + s * w ;
+                    Wx [q] = sc * r + c * w ;
+                    Rw [q] = 0 ;
+                }
+                for (Int kk = 0 ; kk < nrhs ; kk++)
+                {
+                    Entry r = Y [j + kk*nrmax] ;
+                    Entry w = Cw [kk] ;
+                    Y [j + kk*nrmax] = c * r + s * w ;
+                    Cw [kk] = sc * r + c * w ;
+                }
+            }
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // convert R back to column form
+    // -------------------------------------------------------------------------
+
+    nrow = erow ;
+    Int nz = 0 ;
+    for (k = 0 ; k < nrmax ; k++)
+    {
+        if (Rlen [k] > 0)
+        {
+            nrow = MAX (nrow, k+1) ;
+            nz += Rlen [k] ;
+        }
+    }
+
+    Rnew = spqr_allocate_sparse <Int> (nrow, n, nz, TRUE, TRUE, 0, xtype, cc) ;
+    if (C != NULL)
+    {
+        Cnew = spqr_allocate_dense <Int> (nrow, nrhs, nrow, xtype, cc) ;
+    }
+    if (Rnew == NULL || (C != NULL && Cnew == NULL))
+    {
+        // out of memory
+        ERROR (CHOLMOD_OUT_OF_MEMORY, "out of memory") ;
+        spqr_free_sparse <Int> (&Rnew, cc) ;
+        spqr_free_dense <Int> (&Cnew, cc) ;
+        FREE_WORK ;
+        return (FALSE) ;
+    }
+
+    Rnewp = (Int *) Rnew->p ;
+    Rnewi = (Int *) Rnew->i ;
+    Rnewx = (Entry *) Rnew->x ;
+    for (j = 0 ; j <= n ; j++)
+    {
+        Rnewp [j] = 0 ;
+    }
+    for (k = 0 ; k < nrmax ; k++)
+    {
+        for (p = 0 ; p < Rlen [k] ; p++)
+        {
+            Rnewp [Rowi [k] [p]]++ ;
+        }
+    }
+    spqr_cumsum (n, Rnewp) ;
+    // the rows are scanned in order, so each column of Rnew is sorted
+    for (k = 0 ; k < nrmax ; k++)
+    {
+        for (p = 0 ; p < Rlen [k] ; p++)
+        {
+            Int pr = Rnewp [Rowi [k] [p]]++ ;
+            Rnewi [pr] = k ;
+            Rnewx [pr] = Rowx [k] [p] ;
+        }
+    }
+    spqr_shift (n, Rnewp) ;
+
+    if (C != NULL)
+    {
+        Entry *Cnewx = (Entry *) Cnew->x ;
+        for (Int kk = 0 ; kk < nrhs ; kk++)
+        {
+            for (k = 0 ; k < nrow ; k++)
+            {
+                Cnewx [k + kk*nrow] = Y [k + kk*nrmax] ;
+            }
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // replace R and C with their updated versions
+    // -------------------------------------------------------------------------
+
+    FREE_WORK ;
+    spqr_free_sparse <Int> (p_R, cc) ;
+    *p_R = Rnew ;
+    if (C != NULL)
+    {
+        spqr_free_dense <Int> (p_C, cc) ;
+        *p_C = Cnew ;
+    }
+    return (TRUE) ;
+}
+
+// =============================================================================
+// === SuiteSparseQR_rsolve ====================================================
+// =============================================================================
+
+// X = E*(R\C), where R is the e-by-n upper trapezoidal R factor of A(:,E) and
+// C is e-by-nrhs, as returned by SuiteSparseQR or SuiteSparseQR_append_rows.
+// If C = Q'*B, X is a basic solution to the least-squares problem min
+// norm(A*X-B).  R may be in the squeezed form of a rank-deficient A: each
+// nonempty row of R is used to solve for its leading column, and the
+// entries of X for all other columns, and for columns whose pivot is exactly
+// zero, are zero.  Returns X, of size n-by-nrhs, or NULL on failure.
+
+template <typename Entry, typename Int> cholmod_dense *SuiteSparseQR_rsolve
+(
+    // inputs, not modified
+    cholmod_sparse *R,      // e-by-n R factor of A(:,E)
+    Int *E,                 // size n, column permutation of R (NULL if identity)
+    cholmod_dense *C,       // e-by-nrhs
+
+    // workspace and parameters
+    cholmod_common *cc
+)
+{
+    cholmod_dense *X, *W ;
+    Int *Rp, *Ri, *Lead, *Mark ;
+    Entry *Rx, *Cx, *Xx, *Wx ;
+    Int i, j, k, p, n, erow, nrhs, ldc ;
+
+    // -------------------------------------------------------------------------
+    // check inputs
+    // -------------------------------------------------------------------------
+
+    RETURN_IF_NULL_COMMON (NULL) ;
+    RETURN_IF_NULL (R, NULL) ;
+    RETURN_IF_NULL (C, NULL) ;
+    int64_t xtype = spqr_type <Entry> ( ) ;
+    RETURN_IF_XTYPE_INVALID (R, NULL) ;
+    RETURN_IF_XTYPE_INVALID (C, NULL) ;
+    n = R->ncol ;
+    erow = R->nrow ;
+    if ((Int) C->nrow != erow)
+    {
+        ERROR (CHOLMOD_INVALID, "invalid dimensions") ;
+        return (NULL) ;
+    }
+    if (!R->packed)
+    {
+        ERROR (CHOLMOD_INVALID, "R must be packed") ;
+        return (NULL) ;
+    }
+    cc->status = CHOLMOD_OK ;
+
+    Rp = (Int *) R->p ;
+    Ri = (Int *) R->i ;
+    Rx = (Entry *) R->x ;
+    nrhs = C->ncol ;
+    ldc = C->d ;
+    Cx = (Entry *) C->x ;
+
+    // -------------------------------------------------------------------------
+    // allocate the result and workspace
+    // -------------------------------------------------------------------------
+
+    X = spqr_allocate_dense <Int> (n, nrhs, n, xtype, cc) ;
+    W = spqr_allocate_dense <Int> (erow, nrhs, erow, xtype, cc) ;
+    Lead = (Int *) spqr_malloc <Int> (n,    sizeof (Int), cc) ;
+    Mark = (Int *) spqr_calloc <Int> (erow, sizeof (Int), cc) ;
+    if (cc->status < CHOLMOD_OK || X == NULL || W == NULL)
+    {
+        // out of memory
+        ERROR (CHOLMOD_OUT_OF_MEMORY, "out of memory") ;
+        spqr_free_dense <Int> (&X, cc) ;
+        spqr_free_dense <Int> (&W, cc) ;
+        spqr_free <Int> (n,    sizeof (Int), Lead, cc) ;
+        spqr_free <Int> (erow, sizeof (Int), Mark, cc) ;
+        return (NULL) ;
+    }
+    Xx = (Entry *) X->x ;
+    Wx = (Entry *) W->x ;
+
+    // -------------------------------------------------------------------------
+    // find the row whose leading column is j, for each column j
+    // -------------------------------------------------------------------------
+
+    for (j = 0 ; j < n ; j++)
+    {
+        Lead [j] = EMPTY ;
+        for (p = Rp [j] ; p < Rp [j+1] ; p++)
+        {
+            i = Ri [p] ;
+            if (!Mark [i])
+            {
+                // the leading column of row i is j
+                Mark [i] = TRUE ;
+                if (Lead [j] == EMPTY) Lead [j] = i ;
+            }
+        }
+    }
+
+    // W = C
+    for (Int kk = 0 ; kk < nrhs ; kk++)
+    {
+        for (i = 0 ; i < erow ; i++)
+        {
+            Wx [i + kk*erow] = Cx [i + kk*ldc] ;
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // X (E,:) = R\W, by columns from last to first
+    // -------------------------------------------------------------------------
+
+    for (j = n-1 ; j >= 0 ; j--)
+    {
+        Int jnew = E ? E [j] : j ;
+        i = Lead [j] ;
+        Entry rjj = 0 ;
+        if (i != EMPTY)
+        {
+            for (p = Rp [j] ; p < Rp [j+1] ; p++)
+            {
+                if (Ri [p] == i)
+                {
+                    rjj = Rx [p] ;
+                    break ;
+                }
+            }
+        }
+        for (Int kk = 0 ; kk < nrhs ; kk++)
+        {
+            Entry xj = 0 ;
+            if (rjj != (Entry) 0)
+            {
+                xj = spqr_divide (Wx [i + kk*erow], rjj) ;
+                for (p = Rp [j] ; p < Rp [j+1] ; p++)
+                {
+                    k = Ri [p] ;
+                    if (k != i)
+                    {
+                        Wx [k + kk*erow] -= Rx [p] * xj ;
+                    }
+                }
+            }
+            Xx [jnew + kk*n] = xj ;
+        }
+    }
+
+    spqr_free_dense <Int> (&W, cc) ;
+    spqr_free <Int> (n,    sizeof (Int), Lead, cc) ;
+    spqr_free <Int> (erow, sizeof (Int), Mark, cc) ;
+    return (X) ;
+}
+
+template int SuiteSparseQR_append_rows <double, int32_t>
+(
+    // inputs, not modified
+    cholmod_sparse *Anew,   // k-by-n, the rows to append to A
+    cholmod_dense *Bnew,    // k-by-nrhs, the rows to append to B (may be NULL)
+    int32_t *E,             // size n, column permutation of R (NULL if identity)
+
+    // input/output
+    cholmod_sparse **p_R,   // e-by-n R factor of A(:,E) on input,
+                            // R factor of [A;Anew](:,E) on output
+    cholmod_dense **p_C,    // C = Q'*B on input, Q'*[B;Bnew] on output
+                            // (may be NULL)
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+
+template int SuiteSparseQR_append_rows <Complex, int32_t>
+(
+    // inputs, not modified
+    cholmod_sparse *Anew,   // k-by-n, the rows to append to A
+    cholmod_dense *Bnew,    // k-by-nrhs, the rows to append to B (may be NULL)
+    int32_t *E,             // size n, column permutation of R (NULL if identity)
+
+    // input/output
+    cholmod_sparse **p_R,   // e-by-n R factor of A(:,E) on input,
+                            // R factor of [A;Anew](:,E) on output
+    cholmod_dense **p_C,    // C = Q'*B on input, Q'*[B;Bnew] on output
+                            // (may be NULL)
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+
+template int SuiteSparseQR_append_rows <float, int32_t>
+(
+    // inputs, not modified
+    cholmod_sparse *Anew,   // k-by-n, the rows to append to A
+    cholmod_dense *Bnew,    // k-by-nrhs, the rows to append to B (may be NULL)
+    int32_t *E,             // size n, column permutation of R (NULL if identity)
+
+    // input/output
+    cholmod_sparse **p_R,   // e-by-n R factor of A(:,E) on input,
+                            // R factor of [A;Anew](:,E) on output
+    cholmod_dense **p_C,    // C = Q'*B on input, Q'*[B;Bnew] on output
+                            // (may be NULL)
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+
+template int SuiteSparseQR_append_rows <FComplex, int32_t>
+(
+    // inputs, not modified
+    cholmod_sparse *Anew,   // k-by-n, the rows to append to A
+    cholmod_dense *Bnew,    // k-by-nrhs, the rows to append to B (may be NULL)
+    int32_t *E,             // size n, column permutation of R (NULL if identity)
+
+    // input/output
+    cholmod_sparse **p_R,   // e-by-n R factor of A(:,E) on input,
+                            // R factor of [A;Anew](:,E) on output
+    cholmod_dense **p_C,    // C = Q'*B on input, Q'*[B;Bnew] on output
+                            // (may be NULL)
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+
+template int SuiteSparseQR_append_rows <double, int64_t>
+(
+    // inputs, not modified
+    cholmod_sparse *Anew,   // k-by-n, the rows to append to A
+    cholmod_dense *Bnew,    // k-by-nrhs, the rows to append to B (may be NULL)
+    int64_t *E,             // size n, column permutation of R (NULL if identity)
+
+    // input/output
+    cholmod_sparse **p_R,   // e-by-n R factor of A(:,E) on input,
+                            // R factor of [A;Anew](:,E) on output
+    cholmod_dense **p_C,    // C = Q'*B on input, Q'*[B;Bnew] on output
+                            // (may be NULL)
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+
+template int SuiteSparseQR_append_rows <Complex, int64_t>
+(
+    // inputs, not modified
+    cholmod_sparse *Anew,   // k-by-n, the rows to append to A
+    cholmod_dense *Bnew,    // k-by-nrhs, the rows to append to B (may be NULL)
+    int64_t *E,             // size n, column permutation of R (NULL if identity)
+
+    // input/output
+    cholmod_sparse **p_R,   // e-by-n R factor of A(:,E) on input,
+                            // R factor of [A;Anew](:,E) on output
+    cholmod_dense **p_C,    // C = Q'*B on input, Q'*[B;Bnew] on output
+                            // (may be NULL)
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+
+template int SuiteSparseQR_append_rows <float, int64_t>
+(
+    // inputs, not modified
+    cholmod_sparse *Anew,   // k-by-n, the rows to append to A
+    cholmod_dense *Bnew,    // k-by-nrhs, the rows to append to B (may be NULL)
+    int64_t *E,             // size n, column permutation of R (NULL if identity)
+
+    // input/output
+    cholmod_sparse **p_R,   // e-by-n R factor of A(:,E) on input,
+                            // R factor of [A;Anew](:,E) on output
+    cholmod_dense **p_C,    // C = Q'*B on input, Q'*[B;Bnew] on output
+                            // (may be NULL)
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+
+template int SuiteSparseQR_append_rows <FComplex, int64_t>
+(
+    // inputs, not modified
+    cholmod_sparse *Anew,   // k-by-n, the rows to append to A
+    cholmod_dense *Bnew,    // k-by-nrhs, the rows to append to B (may be NULL)
+    int64_t *E,             // size n, column permutation of R (NULL if identity)
+
+    // input/output
+    cholmod_sparse **p_R,   // e-by-n R factor of A(:,E) on input,
+                            // R factor of [A;Anew](:,E) on output
+    cholmod_dense **p_C,    // C = Q'*B on input, Q'*[B;Bnew] on output
+                            // (may be NULL)
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+
+template cholmod_dense *SuiteSparseQR_rsolve <double, int32_t>
+(
+    // inputs, not modified
+    cholmod_sparse *R,      // e-by-n R factor of A(:,E)
+    int32_t *E,             // size n, column permutation of R (NULL if identity)
+    cholmod_dense *C,       // e-by-nrhs
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+
+template cholmod_dense *SuiteSparseQR_rsolve <Complex, int32_t>
+(
+    // inputs, not modified
+    cholmod_sparse *R,      // e-by-n R factor of A(:,E)
+    int32_t *E,             // size n, column permutation of R (NULL if identity)
+    cholmod_dense *C,       // e-by-nrhs
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+
+template cholmod_dense *SuiteSparseQR_rsolve <float, int32_t>
+(
+    // inputs, not modified
+    cholmod_sparse *R,      // e-by-n R factor of A(:,E)
+    int32_t *E,             // size n, column permutation of R (NULL if identity)
+    cholmod_dense *C,       // e-by-nrhs
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+
+template cholmod_dense *SuiteSparseQR_rsolve <FComplex, int32_t>
+(
+    // inputs, not modified
+    cholmod_sparse *R,      // e-by-n R factor of A(:,E)
+    int32_t *E,             // size n, column permutation of R (NULL if identity)
+    cholmod_dense *C,       // e-by-nrhs
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+
+template cholmod_dense *SuiteSparseQR_rsolve <double, int64_t>
+(
+    // inputs, not modified
+    cholmod_sparse *R,      // e-by-n R factor of A(:,E)
+    int64_t *E,             // size n, column permutation of R (NULL if identity)
+    cholmod_dense *C,       // e-by-nrhs
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+
+template cholmod_dense *SuiteSparseQR_rsolve <Complex, int64_t>
+(
+    // inputs, not modified
+    cholmod_sparse *R,      // e-by-n R factor of A(:,E)
+    int64_t *E,             // size n, column permutation of R (NULL if identity)
+    cholmod_dense *C,       // e-by-nrhs
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+
+template cholmod_dense *SuiteSparseQR_rsolve <float, int64_t>
+(
+    // inputs, not modified
+    cholmod_sparse *R,      // e-by-n R factor of A(:,E)
+    int64_t *E,             // size n, column permutation of R (NULL if identity)
+    cholmod_dense *C,       // e-by-nrhs
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+
+template cholmod_dense *SuiteSparseQR_rsolve <FComplex, int64_t>
+(
+    // inputs, not modified
+    cholmod_sparse *R,      // e-by-n R factor of A(:,E)
+    int64_t *E,             // size n, column permutation of R (NULL if identity)
+    cholmod_dense *C,       // e-by-nrhs
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
@@ -523,6 +523,15 @@ template <typename Entry, typename Int> int spqr_1colamd  // TRUE if OK, FALSE o
             cc->method [1].ordering = CHOLMOD_AMD ;
         }
 
+        // 10:mongoose: CHOLMOD's nested dissection of A'A, with Mongoose.
+        // If Mongoose is not installed, CHOLMOD falls back to AMD(A'A).
+        if (ordering == SPQR_ORDERING_MONGOOSE)
+        {
+            ordering = SPQR_ORDERING_CHOLMOD ;
+            cc->nmethods = 1 ;
+            cc->method [0].ordering = CHOLMOD_MONGOOSE ;
+        }
+
         if (ordering == SPQR_ORDERING_DEFAULT)
         {
             // Version 1.2.0:  just use COLAMD
@@ -552,9 +561,15 @@ template <typename Entry, typename Int> int spqr_1colamd  // TRUE if OK, FALSE o
             PR (("Using CHOLMOD, nmethods %d\n", cc->nmethods)) ;
             cc->supernodal = CHOLMOD_SIMPLICIAL ;
             cc->postorder = TRUE ;
-            cholmod_factor *Sc ;
+            cholmod_factor *Sc = NULL ;
+            int corder = EMPTY ;
             TEST_COVERAGE_PAUSE ;
-            Sc = spqr_analyze_p2 <Int> (FALSE, AT, NULL, NULL, 0, cc) ;
+            // try the methods in parallel, if possible
+            if (!spqr_best_ordering <Int> (AT, (Int *) (Q1fill + n1cols),
+                &corder, cc))
+            {
+                Sc = spqr_analyze_p2 <Int> (FALSE, AT, NULL, NULL, 0, cc) ;
+            }
             TEST_COVERAGE_RESUME ;
             if (Sc != NULL)
             {
@@ -564,13 +579,16 @@ template <typename Entry, typename Int> int spqr_1colamd  // TRUE if OK, FALSE o
                 {
                     Q1fill [k + n1cols] = Sc_perm [k] ;
                 }
-                // CHOLMOD selected an ordering; determine the ordering used
-                switch (Sc->ordering)
-                {
-                    case CHOLMOD_AMD:    ordering = SPQR_ORDERING_AMD    ;break;
-                    case CHOLMOD_COLAMD: ordering = SPQR_ORDERING_COLAMD ;break;
-                    case CHOLMOD_METIS:  ordering = SPQR_ORDERING_METIS  ;break;
-                }
+                corder = Sc->ordering ;
+            }
+            // CHOLMOD selected an ordering; determine the ordering used
+            switch (corder)
+            {
+                case CHOLMOD_AMD:    ordering = SPQR_ORDERING_AMD    ; break ;
+                case CHOLMOD_COLAMD: ordering = SPQR_ORDERING_COLAMD ; break ;
+                case CHOLMOD_METIS:  ordering = SPQR_ORDERING_METIS  ; break ;
+                case CHOLMOD_MONGOOSE: ordering = SPQR_ORDERING_MONGOOSE ;
+                    break ;
             }
             spqr_free_factor <Int> (&Sc, cc) ;
             PR (("CHOLMOD used method %d : ordering: %d\n", cc->selected,
@@ -781,6 +799,68 @@ template int spqr_1colamd <Complex, int32_t>  // TRUE if OK, FALSE otherwise
     // workspace and parameters
     cholmod_common *cc
 ) ;
+template int spqr_1colamd <float, int32_t>  // TRUE if OK, FALSE otherwise
+(
+    // inputs, not modified
+    int ordering,           // all available, except 0:fixed and 3:given
+                            // treated as 1:natural
+    double tol,             // only accept singletons above tol
+    int32_t bncols,            // number of columns of B
+    cholmod_sparse *A,      // m-by-n sparse matrix
+
+    // outputs, neither allocated nor defined on input
+
+    int32_t **p_Q1fill,        // size n+bncols, fill-reducing
+                            // or natural ordering
+
+    int32_t **p_R1p,           // size n1rows+1, R1p [k] = # of nonzeros in kth
+                            // row of R1.  NULL if n1cols == 0.
+    int32_t **p_P1inv,         // size m, singleton row inverse permutation.
+                            // If row i of A is the kth singleton row, then
+                            // P1inv [i] = k.  NULL if n1cols is zero.
+
+    cholmod_sparse **p_Y,   // on output, only the first n-n1cols+1 entries of
+                            // Y->p are defined (if Y is not NULL), where
+                            // Y = [A B] or Y = [A2 B2].  If B is empty and
+                            // there are no column singletons, Y is NULL
+
+    int32_t *p_n1cols,         // number of column singletons found
+    int32_t *p_n1rows,         // number of corresponding rows found
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template int spqr_1colamd <FComplex, int32_t>  // TRUE if OK, FALSE otherwise
+(
+    // inputs, not modified
+    int ordering,           // all available, except 0:fixed and 3:given
+                            // treated as 1:natural
+    double tol,             // only accept singletons above tol
+    int32_t bncols,            // number of columns of B
+    cholmod_sparse *A,      // m-by-n sparse matrix
+
+    // outputs, neither allocated nor defined on input
+
+    int32_t **p_Q1fill,        // size n+bncols, fill-reducing
+                            // or natural ordering
+
+    int32_t **p_R1p,           // size n1rows+1, R1p [k] = # of nonzeros in kth
+                            // row of R1.  NULL if n1cols == 0.
+    int32_t **p_P1inv,         // size m, singleton row inverse permutation.
+                            // If row i of A is the kth singleton row, then
+                            // P1inv [i] = k.  NULL if n1cols is zero.
+
+    cholmod_sparse **p_Y,   // on output, only the first n-n1cols+1 entries of
+                            // Y->p are defined (if Y is not NULL), where
+                            // Y = [A B] or Y = [A2 B2].  If B is empty and
+                            // there are no column singletons, Y is NULL
+
+    int32_t *p_n1cols,         // number of column singletons found
+    int32_t *p_n1rows,         // number of corresponding rows found
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
 
 template  int spqr_1colamd <double, int64_t> // TRUE if OK, FALSE otherwise
 (
@@ -845,3 +925,65 @@ template int spqr_1colamd <Complex, int64_t> // TRUE if OK, FALSE otherwise
     // workspace and parameters
     cholmod_common *cc
 ) ;
+template int spqr_1colamd <float, int64_t> // TRUE if OK, FALSE otherwise
+(
+    // inputs, not modified
+    int ordering,           // all available, except 0:fixed and 3:given
+                            // treated as 1:natural
+    double tol,             // only accept singletons above tol
+    int64_t bncols,            // number of columns of B
+    cholmod_sparse *A,      // m-by-n sparse matrix
+
+    // outputs, neither allocated nor defined on input
+
+    int64_t **p_Q1fill,        // size n+bncols, fill-reducing
+                            // or natural ordering
+
+    int64_t **p_R1p,           // size n1rows+1, R1p [k] = # of nonzeros in kth
+                            // row of R1.  NULL if n1cols == 0.
+    int64_t **p_P1inv,         // size m, singleton row inverse permutation.
+                            // If row i of A is the kth singleton row, then
+                            // P1inv [i] = k.  NULL if n1cols is zero.
+
+    cholmod_sparse **p_Y,   // on output, only the first n-n1cols+1 entries of
+                            // Y->p are defined (if Y is not NULL), where
+                            // Y = [A B] or Y = [A2 B2].  If B is empty and
+                            // there are no column singletons, Y is NULL
+
+    int64_t *p_n1cols,         // number of column singletons found
+    int64_t *p_n1rows,         // number of corresponding rows found
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template int spqr_1colamd <FComplex, int64_t> // TRUE if OK, FALSE otherwise
+(
+    // inputs, not modified
+    int ordering,           // all available, except 0:fixed and 3:given
+                            // treated as 1:natural
+    double tol,             // only accept singletons above tol
+    int64_t bncols,            // number of columns of B
+    cholmod_sparse *A,      // m-by-n sparse matrix
+
+    // outputs, neither allocated nor defined on input
+
+    int64_t **p_Q1fill,        // size n+bncols, fill-reducing
+                            // or natural ordering
+
+    int64_t **p_R1p,           // size n1rows+1, R1p [k] = # of nonzeros in kth
+                            // row of R1.  NULL if n1cols == 0.
+    int64_t **p_P1inv,         // size m, singleton row inverse permutation.
+                            // If row i of A is the kth singleton row, then
+                            // P1inv [i] = k.  NULL if n1cols is zero.
+
+    cholmod_sparse **p_Y,   // on output, only the first n-n1cols+1 entries of
+                            // Y->p are defined (if Y is not NULL), where
+                            // Y = [A B] or Y = [A2 B2].  If B is empty and
+                            // there are no column singletons, Y is NULL
+
+    int64_t *p_n1cols,         // number of column singletons found
+    int64_t *p_n1rows,         // number of corresponding rows found
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
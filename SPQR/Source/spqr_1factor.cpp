@@ -199,6 +199,7 @@ template <typename Entry, typename Int> SuiteSparseQR_factorization <Entry, Int>
         ordering = SPQR_ORDERING_FIXED ;
     }
 
+    SuiteSparse_trace_begin ("SPQR", "ordering") ;
     if (ordering == SPQR_ORDERING_FIXED)
     {
         // fixed ordering: find column singletons without permuting columns
@@ -215,6 +216,7 @@ template <typename Entry, typename Int> SuiteSparseQR_factorization <Entry, Int>
             &R1p, &P1inv, &Y, &n1cols, &n1rows, cc) ;
         ordering = cc->SPQR_istat [7]  ;
     }
+    SuiteSparse_trace_end ("SPQR", "ordering", 0, 0) ;
 
     if (cc->status < CHOLMOD_OK)
     {
@@ -630,18 +632,26 @@ template <typename Entry, typename Int> SuiteSparseQR_factorization <Entry, Int>
     if (noY)
     {
         // factorize A, with fill-reducing ordering already given in Q1fill
+        SuiteSparse_trace_begin ("SPQR", "symbolic") ;
         QRsym = spqr_analyze (A, SPQR_ORDERING_GIVEN, Q1fill,
             tol >= 0, keepH, cc) ;
+        SuiteSparse_trace_end ("SPQR", "symbolic", 0, 0) ;
         t1 = SUITESPARSE_TIME ;
+        SuiteSparse_trace_begin ("SPQR", "numeric") ;
         QRnum = spqr_factorize <Entry, Int> (&A, FALSE, tol, n, QRsym, cc) ;
+        SuiteSparse_trace_end ("SPQR", "numeric", cc->SPQR_flopcount_bound, 0) ;
     }
     else
     {
         // fill-reducing ordering is already applied to Y; free Y when loaded
+        SuiteSparse_trace_begin ("SPQR", "symbolic") ;
         QRsym = spqr_analyze <Int> (Y, SPQR_ORDERING_FIXED, NULL,
             tol >= 0, keepH, cc) ;
+        SuiteSparse_trace_end ("SPQR", "symbolic", 0, 0) ;
         t1 = SUITESPARSE_TIME ;
+        SuiteSparse_trace_begin ("SPQR", "numeric") ;
         QRnum = spqr_factorize <Entry, Int> (&Y, TRUE, tol, n2, QRsym, cc) ;
+        SuiteSparse_trace_end ("SPQR", "numeric", cc->SPQR_flopcount_bound, 0) ;
         // Y has been freed
         ASSERT (Y == NULL) ;
     }
@@ -774,6 +784,40 @@ template SuiteSparseQR_factorization <Complex, int32_t> *spqr_1factor <Complex,
     // workspace and parameters
     cholmod_common *cc
 ) ;
+template SuiteSparseQR_factorization <float, int32_t> *spqr_1factor <float, int32_t>
+(
+    // inputs, not modified
+    int ordering,           // all, except 3:given treated as 0:fixed
+    double tol,             // only accept singletons above tol.  If tol <= -2,
+                            // then use the default tolerance
+    int32_t bncols,            // number of columns of B
+    int keepH,              // if TRUE, keep the Householder vectors
+    cholmod_sparse *A,      // m-by-n sparse matrix
+    int32_t ldb,               // if dense, the leading dimension of B
+    int32_t *Bp,               // size bncols+1, column pointers of B
+    int32_t *Bi,               // size bnz = Bp [bncols], row indices of B
+    float *Bx,              // size bnz, numerical values of B
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template SuiteSparseQR_factorization <FComplex, int32_t> *spqr_1factor <FComplex, int32_t>
+(
+    // inputs, not modified
+    int ordering,           // all, except 3:given treated as 0:fixed
+    double tol,             // only accept singletons above tol.  If tol <= -2,
+                            // then use the default tolerance
+    int32_t bncols,            // number of columns of B
+    int keepH,              // if TRUE, keep the Householder vectors
+    cholmod_sparse *A,      // m-by-n sparse matrix
+    int32_t ldb,               // if dense, the leading dimension of B
+    int32_t *Bp,               // size bncols+1, column pointers of B
+    int32_t *Bi,               // size bnz = Bp [bncols], row indices of B
+    FComplex *Bx,              // size bnz, numerical values of B
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
 
 
 template SuiteSparseQR_factorization <double, int32_t> *spqr_1factor <double, int32_t>
@@ -811,6 +855,40 @@ template SuiteSparseQR_factorization <Complex, int64_t> *spqr_1factor <Complex,
     // workspace and parameters
     cholmod_common *cc
 ) ;
+template SuiteSparseQR_factorization <float, int64_t> *spqr_1factor <float, int64_t>
+(
+    // inputs, not modified
+    int ordering,           // all, except 3:given treated as 0:fixed
+    double tol,             // only accept singletons above tol.  If tol <= -2,
+                            // then use the default tolerance
+    int64_t bncols,            // number of columns of B
+    int keepH,              // if TRUE, keep the Householder vectors
+    cholmod_sparse *A,      // m-by-n sparse matrix
+    int64_t ldb,               // if dense, the leading dimension of B
+    int64_t *Bp,               // size bncols+1, column pointers of B
+    int64_t *Bi,               // size bnz = Bp [bncols], row indices of B
+    float *Bx,              // size bnz, numerical values of B
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template SuiteSparseQR_factorization <FComplex, int64_t> *spqr_1factor <FComplex, int64_t>
+(
+    // inputs, not modified
+    int ordering,           // all, except 3:given treated as 0:fixed
+    double tol,             // only accept singletons above tol.  If tol <= -2,
+                            // then use the default tolerance
+    int64_t bncols,            // number of columns of B
+    int keepH,              // if TRUE, keep the Householder vectors
+    cholmod_sparse *A,      // m-by-n sparse matrix
+    int64_t ldb,               // if dense, the leading dimension of B
+    int64_t *Bp,               // size bncols+1, column pointers of B
+    int64_t *Bi,               // size bnz = Bp [bncols], row indices of B
+    FComplex *Bx,              // size bnz, numerical values of B
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
 
 
 template SuiteSparseQR_factorization <double, int64_t> *spqr_1factor <double, int64_t>
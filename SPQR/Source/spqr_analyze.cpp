@@ -121,9 +121,9 @@ template <typename Int> spqr_symbolic <Int> *spqr_analyze
     }
 
     // Disable the GPU if the Householder vectors are requested, if we're
-    // using TBB, if rank detection is requested, or if A is not real
+    // using TBB, if rank detection is requested, or if A is not real double
     if (keepH || do_parallel_analysis || do_rank_detection ||
-        A->xtype != CHOLMOD_REAL)
+        A->xtype != CHOLMOD_REAL || A->dtype != CHOLMOD_DOUBLE)
     {
         useGPU = FALSE ;
     }
@@ -265,6 +265,15 @@ template <typename Int> spqr_symbolic <Int> *spqr_analyze
         cc->postorder = TRUE ;
         Quser = NULL ;
     }
+    else if (ordering == SPQR_ORDERING_MONGOOSE)
+    {
+        // nested dissection of A'*A with Mongoose, if installed (CHOLMOD
+        // falls back to AMD otherwise)
+        cc->nmethods = 1 ;
+        cc->method [0].ordering = CHOLMOD_MONGOOSE ;
+        cc->postorder = TRUE ;
+        Quser = NULL ;
+    }
     else // if (ordering == SPQR_ORDERING_COLAMD)
          // or ordering == SPQR_ORDERING_DEFAULT
          // or ordering == SPQR_ORDERING_METIS and METIS not installed
@@ -281,21 +290,52 @@ template <typename Int> spqr_symbolic <Int> *spqr_analyze
     // multifrontal QR ordering and analysis.
     // The GPU-accelerated SPQR requires additional supernodal analysis.
     TEST_COVERAGE_PAUSE ;
+    Int *Qbest = NULL ;
+    int corder = EMPTY ;
+    // the best ordering is analyzed as the only method, so the methods of cc
+    // are changed below, and must be put back whether or not the analysis
+    // succeeds
+    int save_nmethods = cc->nmethods ;
+    int save_selected = cc->selected ;
+    auto save_method0 = cc->method [0] ;
+    bool best_given = false ;
+    if (AT != NULL && ordering == SPQR_ORDERING_CHOLMOD && cc->nmethods > 1)
+    {
+        // try the methods in parallel, if possible, and then analyze the best
+        // one as a given ordering
+        Qbest = (Int *) spqr_malloc <Int> (n, sizeof (Int), cc) ;
+        if (Qbest != NULL && spqr_best_ordering <Int> (AT, Qbest, &corder, cc))
+        {
+            Quser = Qbest ;
+            best_given = true ;
+            cc->nmethods = 1 ;
+            cc->method [0].ordering = CHOLMOD_GIVEN ;
+        }
+        cc->status = CHOLMOD_OK ;
+    }
     Sc = spqr_analyze_p2 <Int> (
         useGPU ? CHOLMOD_ANALYZE_FOR_SPQRGPU : CHOLMOD_ANALYZE_FOR_SPQR,
         AT, (Int *) Quser, NULL, 0, cc) ;
+    if (best_given)
+    {
+        cc->nmethods = save_nmethods ;
+        cc->selected = save_selected ;
+        cc->method [0] = save_method0 ;
+    }
+    spqr_free <Int> (n, sizeof (Int), Qbest, cc) ;
     TEST_COVERAGE_RESUME ;
 
     // record the actual ordering used
     if (Sc != NULL)
     {
-        switch (Sc->ordering)
+        switch ((corder == EMPTY) ? Sc->ordering : corder)
         {
             case CHOLMOD_NATURAL: ordering = SPQR_ORDERING_NATURAL ; break ;
             case CHOLMOD_GIVEN:   ordering = SPQR_ORDERING_GIVEN   ; break ;
             case CHOLMOD_AMD:     ordering = SPQR_ORDERING_AMD     ; break ;
             case CHOLMOD_COLAMD:  ordering = SPQR_ORDERING_COLAMD  ; break ;
             case CHOLMOD_METIS:   ordering = SPQR_ORDERING_METIS   ; break ;
+            case CHOLMOD_MONGOOSE: ordering = SPQR_ORDERING_MONGOOSE ; break ;
         }
     }
 
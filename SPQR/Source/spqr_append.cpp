@@ -163,6 +163,34 @@ template int spqr_append <Complex, int32_t>       // TRUE/FALSE if OK or not
     // workspace and parameters
     cholmod_common *cc
 ) ;
+template int spqr_append <float, int32_t>       // TRUE/FALSE if OK or not
+(
+    // inputs, not modified
+    float *X,           // size m-by-1
+    int32_t *P,            // size m, or NULL; permutation to apply to X.
+                        // P [k] = i if row k of A is row i of X
+
+    // input/output
+    cholmod_sparse *A,  // size m-by-(A->ncol) where A->ncol > n must hold
+    int32_t *p_n,          // n = # of columns of A so far; increased one
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template int spqr_append <FComplex, int32_t>       // TRUE/FALSE if OK or not
+(
+    // inputs, not modified
+    FComplex *X,           // size m-by-1
+    int32_t *P,            // size m, or NULL; permutation to apply to X.
+                        // P [k] = i if row k of A is row i of X
+
+    // input/output
+    cholmod_sparse *A,  // size m-by-(A->ncol) where A->ncol > n must hold
+    int32_t *p_n,          // n = # of columns of A so far; increased one
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
 
 template int spqr_append <double, int64_t>       // TRUE/FALSE if OK or not
 (
@@ -193,3 +221,31 @@ template int spqr_append <Complex, int64_t>       // TRUE/FALSE if OK or not
     // workspace and parameters
     cholmod_common *cc
 ) ;
+template int spqr_append <float, int64_t>       // TRUE/FALSE if OK or not
+(
+    // inputs, not modified
+    float *X,           // size m-by-1
+    int64_t *P,            // size m, or NULL; permutation to apply to X.
+                        // P [k] = i if row k of A is row i of X
+
+    // input/output
+    cholmod_sparse *A,  // size m-by-(A->ncol) where A->ncol > n must hold
+    int64_t *p_n,          // n = # of columns of A so far; increased one
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template int spqr_append <FComplex, int64_t>       // TRUE/FALSE if OK or not
+(
+    // inputs, not modified
+    FComplex *X,           // size m-by-1
+    int64_t *P,            // size m, or NULL; permutation to apply to X.
+                        // P [k] = i if row k of A is row i of X
+
+    // input/output
+    cholmod_sparse *A,  // size m-by-(A->ncol) where A->ncol > n must hold
+    int64_t *p_n,          // n = # of columns of A so far; increased one
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
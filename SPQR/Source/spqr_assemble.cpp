@@ -515,6 +515,76 @@ template void spqr_assemble <Complex, int32_t>
     /* workspace, not defined on input or output */
     int32_t *Cmap
 ) ;
+template void spqr_assemble <float, int32_t>
+(
+    /* inputs, not modified */
+    int32_t f,                 /* front to assemble F */
+    int32_t fm,                /* number of rows of F */
+    int keepH,              /* if TRUE, then construct row pattern of H */
+    int32_t *Super,
+    int32_t *Rp,
+    int32_t *Rj,
+    int32_t *Sp,
+    int32_t *Sj,
+    int32_t *Sleft,
+    int32_t *Child,
+    int32_t *Childp,
+    float *Sx,
+    int32_t *Fmap,
+    int32_t *Cm,
+    float **Cblock,
+#ifndef NDEBUG
+    char *Rdead,
+#endif
+    int32_t *Hr,
+
+    /* input/output */
+    int32_t *Stair,
+    int32_t *Hii,              /* if keepH, construct list of row indices for F */
+    // input only
+    int32_t *Hip,
+
+    /* outputs, not defined on input */
+    float *F,
+
+    /* workspace, not defined on input or output */
+    int32_t *Cmap
+) ;
+template void spqr_assemble <FComplex, int32_t>
+(
+    /* inputs, not modified */
+    int32_t f,                 /* front to assemble F */
+    int32_t fm,                /* number of rows of F */
+    int keepH,              /* if TRUE, then construct row pattern of H */
+    int32_t *Super,
+    int32_t *Rp,
+    int32_t *Rj,
+    int32_t *Sp,
+    int32_t *Sj,
+    int32_t *Sleft,
+    int32_t *Child,
+    int32_t *Childp,
+    FComplex *Sx,
+    int32_t *Fmap,
+    int32_t *Cm,
+    FComplex **Cblock,
+#ifndef NDEBUG
+    char *Rdead,
+#endif
+    int32_t *Hr,
+
+    /* input/output */
+    int32_t *Stair,
+    int32_t *Hii,              /* if keepH, construct list of row indices for F */
+    // input only
+    int32_t *Hip,
+
+    /* outputs, not defined on input */
+    FComplex *F,
+
+    /* workspace, not defined on input or output */
+    int32_t *Cmap
+) ;
 template void spqr_assemble <double, int64_t>
 (
     /* inputs, not modified */
@@ -585,3 +655,73 @@ template void spqr_assemble <Complex, int64_t>
     /* workspace, not defined on input or output */
     int64_t *Cmap
 ) ;
+template void spqr_assemble <float, int64_t>
+(
+    /* inputs, not modified */
+    int64_t f,                 /* front to assemble F */
+    int64_t fm,                /* number of rows of F */
+    int keepH,              /* if TRUE, then construct row pattern of H */
+    int64_t *Super,
+    int64_t *Rp,
+    int64_t *Rj,
+    int64_t *Sp,
+    int64_t *Sj,
+    int64_t *Sleft,
+    int64_t *Child,
+    int64_t *Childp,
+    float *Sx,
+    int64_t *Fmap,
+    int64_t *Cm,
+    float **Cblock,
+#ifndef NDEBUG
+    char *Rdead,
+#endif
+    int64_t *Hr,
+
+    /* input/output */
+    int64_t *Stair,
+    int64_t *Hii,              /* if keepH, construct list of row indices for F */
+    // input only
+    int64_t *Hip,
+
+    /* outputs, not defined on input */
+    float *F,
+
+    /* workspace, not defined on input or output */
+    int64_t *Cmap
+) ;
+template void spqr_assemble <FComplex, int64_t>
+(
+    /* inputs, not modified */
+    int64_t f,                 /* front to assemble F */
+    int64_t fm,                /* number of rows of F */
+    int keepH,              /* if TRUE, then construct row pattern of H */
+    int64_t *Super,
+    int64_t *Rp,
+    int64_t *Rj,
+    int64_t *Sp,
+    int64_t *Sj,
+    int64_t *Sleft,
+    int64_t *Child,
+    int64_t *Childp,
+    FComplex *Sx,
+    int64_t *Fmap,
+    int64_t *Cm,
+    FComplex **Cblock,
+#ifndef NDEBUG
+    char *Rdead,
+#endif
+    int64_t *Hr,
+
+    /* input/output */
+    int64_t *Stair,
+    int64_t *Hii,              /* if keepH, construct list of row indices for F */
+    // input only
+    int64_t *Hip,
+
+    /* outputs, not defined on input */
+    FComplex *F,
+
+    /* workspace, not defined on input or output */
+    int64_t *Cmap
+) ;
@@ -0,0 +1,187 @@
+// =============================================================================
+// === spqr_best_ordering ======================================================
+// =============================================================================
+
+// SPQR, Copyright (c) 2008-2022, Timothy A Davis. All Rights Reserved.
+// SPDX-License-Identifier: GPL-2.0+
+
+//------------------------------------------------------------------------------
+
+// Finds the best of the fill-reducing orderings cc->method [0..nmethods-1] of
+// A'*A (the ones tried by SPQR_ORDERING_BEST and SPQR_ORDERING_BESTAMD), with
+// each ordering and its symbolic analysis done by its own thread.  This gives
+// the same result as cholmod_analyze_p2 with cc->nmethods > 1, which tries
+// the methods one after the other: the ordering with the fewest nonzeros in
+// R is kept, and ties go to the first method in the list.
+//
+// Each thread uses its own copy of cc, with its own CHOLMOD workspace.  The
+// results of each method are returned in cc->method [k].lnz and fl, and the
+// one selected in cc->selected, as cholmod_analyze_p2 would.
+//
+// Returns TRUE if the ordering was found.  Returns FALSE if the methods should
+// be tried one at a time by the caller instead: if SPQR is not compiled with
+// OpenMP, if there is only one method or one thread, if out of memory, or if
+// all methods fail (in which case cholmod_analyze_p2 falls back to AMD, and
+// reports the error).  cc->status is CHOLMOD_OK on return.
+
+#include "spqr.hpp"
+
+template <typename Int> int spqr_best_ordering
+(
+    // input
+    cholmod_sparse *AT,     // n-by-m, the transpose of A, not modified
+
+    // output
+    Int *Perm,              // size n, the best ordering found
+    int *p_ordering,        // the CHOLMOD ordering used for Perm
+
+    // workspace and parameters
+    cholmod_common *cc
+)
+{
+#ifdef _OPENMP
+
+    // -------------------------------------------------------------------------
+    // determine the # of threads to use
+    // -------------------------------------------------------------------------
+
+    int nmethods = MIN (cc->nmethods, CHOLMOD_MAXMETHODS) ;
+    if (nmethods <= 1)
+    {
+        return (FALSE) ;
+    }
+    Int n = AT->nrow ;
+    Int *ATp = (Int *) AT->p ;
+    double work = ((double) ATp [AT->ncol]) * ((double) nmethods) ;
+    int nthreads = spqr_nthreads (work, cc) ;
+    nthreads = MIN (nthreads, nmethods) ;
+    if (nthreads <= 1)
+    {
+        return (FALSE) ;
+    }
+
+    // -------------------------------------------------------------------------
+    // allocate a copy of cc and a result for each method
+    // -------------------------------------------------------------------------
+
+    cholmod_common *Ccommon ;
+    cholmod_factor **Sc ;
+    Ccommon = (cholmod_common *) spqr_malloc <Int> (nmethods,
+        sizeof (cholmod_common), cc) ;
+    Sc = (cholmod_factor **) spqr_calloc <Int> (nmethods,
+        sizeof (cholmod_factor *), cc) ;
+
+    if (cc->status < CHOLMOD_OK)
+    {
+        // out of memory; do it with one thread instead
+        spqr_free <Int> (nmethods, sizeof (cholmod_common), Ccommon, cc) ;
+        spqr_free <Int> (nmethods, sizeof (cholmod_factor *), Sc, cc) ;
+        cc->status = CHOLMOD_OK ;
+        return (FALSE) ;
+    }
+
+    for (int k = 0 ; k < nmethods ; k++)
+    {
+        cholmod_common *ck = &(Ccommon [k]) ;
+        *ck = *cc ;
+        // each thread allocates its own workspace
+        ck->nrow = 0 ;
+        ck->mark = EMPTY ;
+        ck->iworksize = 0 ;
+        ck->xworkbytes = 0 ;
+        ck->Flag = NULL ;
+        ck->Head = NULL ;
+        ck->Xwork = NULL ;
+        ck->Iwork = NULL ;
+        // try just method k, with a simplicial analysis
+        ck->nmethods = 1 ;
+        ck->method [0] = cc->method [k] ;
+        ck->supernodal = CHOLMOD_SIMPLICIAL ;
+        ck->postorder = TRUE ;
+    }
+
+    // -------------------------------------------------------------------------
+    // try each method in parallel
+    // -------------------------------------------------------------------------
+
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (int k = 0 ; k < nmethods ; k++)
+    {
+        cholmod_common *ck = &(Ccommon [k]) ;
+        Sc [k] = spqr_analyze_p2 <Int> (FALSE, AT, NULL, NULL, 0, ck) ;
+    }
+
+    // -------------------------------------------------------------------------
+    // pick the best method
+    // -------------------------------------------------------------------------
+
+    int best = EMPTY ;
+    for (int k = 0 ; k < nmethods ; k++)
+    {
+        cc->method [k].lnz = (Sc [k] == NULL) ? EMPTY : Ccommon [k].lnz ;
+        cc->method [k].fl  = (Sc [k] == NULL) ? EMPTY : Ccommon [k].fl ;
+        if (Sc [k] != NULL &&
+            (best == EMPTY || Ccommon [k].lnz < Ccommon [best].lnz))
+        {
+            best = k ;
+        }
+    }
+
+    if (best != EMPTY)
+    {
+        Int *Sc_perm = (Int *) Sc [best]->Perm ;
+        for (Int k = 0 ; k < n ; k++)
+        {
+            Perm [k] = Sc_perm [k] ;
+        }
+        *p_ordering = Sc [best]->ordering ;
+        cc->selected = best ;
+        cc->lnz = Ccommon [best].lnz ;
+        cc->fl  = Ccommon [best].fl ;
+    }
+
+    // -------------------------------------------------------------------------
+    // free the results and the workspace of each thread
+    // -------------------------------------------------------------------------
+
+    for (int k = 0 ; k < nmethods ; k++)
+    {
+        spqr_free_factor <Int> (&(Sc [k]), &(Ccommon [k])) ;
+        spqr_free_work <Int> (&(Ccommon [k])) ;
+    }
+    spqr_free <Int> (nmethods, sizeof (cholmod_common), Ccommon, cc) ;
+    spqr_free <Int> (nmethods, sizeof (cholmod_factor *), Sc, cc) ;
+    cc->status = CHOLMOD_OK ;
+    return (best != EMPTY) ;
+
+#else
+
+    return (FALSE) ;
+
+#endif
+}
+
+template int spqr_best_ordering <int32_t>
+(
+    // input
+    cholmod_sparse *AT,     // n-by-m, the transpose of A, not modified
+
+    // output
+    int32_t *Perm,          // size n, the best ordering found
+    int *p_ordering,        // the CHOLMOD ordering used for Perm
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template int spqr_best_ordering <int64_t>
+(
+    // input
+    cholmod_sparse *AT,     // n-by-m, the transpose of A, not modified
+
+    // output
+    int64_t *Perm,          // size n, the best ordering found
+    int *p_ordering,        // the CHOLMOD ordering used for Perm
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
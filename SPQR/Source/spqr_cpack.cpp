@@ -136,6 +136,36 @@ template int32_t spqr_cpack <Complex, int32_t>     // returns # of rows in C
     Complex *C                // packed columns of C, of size cm-by-cn in upper
                             // trapezoidal form.
 ) ;
+template int32_t spqr_cpack <float, int32_t>     // returns # of rows in C
+(
+    // input, not modified
+    int32_t m,                 // # of rows in F
+    int32_t n,                 // # of columns in F
+    int32_t npiv,              // number of pivotal columns in F
+    int32_t rank,              // the C block starts at F (rank,npiv)
+
+    // input, not modified unless the pack occurs in-place
+    float *F,               // m-by-n frontal matrix in column-major order
+
+    // output, contents not defined on input
+    float *C                // packed columns of C, of size cm-by-cn in upper
+                            // trapezoidal form.
+) ;
+template int32_t spqr_cpack <FComplex, int32_t>     // returns # of rows in C
+(
+    // input, not modified
+    int32_t m,                 // # of rows in F
+    int32_t n,                 // # of columns in F
+    int32_t npiv,              // number of pivotal columns in F
+    int32_t rank,              // the C block starts at F (rank,npiv)
+
+    // input, not modified unless the pack occurs in-place
+    FComplex *F,               // m-by-n frontal matrix in column-major order
+
+    // output, contents not defined on input
+    FComplex *C                // packed columns of C, of size cm-by-cn in upper
+                            // trapezoidal form.
+) ;
 template int64_t spqr_cpack <double, int64_t>     // returns # of rows in C
 (
     // input, not modified
@@ -166,3 +196,33 @@ template int64_t spqr_cpack <Complex, int64_t>     // returns # of rows in C
     Complex *C                // packed columns of C, of size cm-by-cn in upper
                             // trapezoidal form.
 ) ;
+template int64_t spqr_cpack <float, int64_t>     // returns # of rows in C
+(
+    // input, not modified
+    int64_t m,                 // # of rows in F
+    int64_t n,                 // # of columns in F
+    int64_t npiv,              // number of pivotal columns in F
+    int64_t rank,              // the C block starts at F (rank,npiv)
+
+    // input, not modified unless the pack occurs in-place
+    float *F,               // m-by-n frontal matrix in column-major order
+
+    // output, contents not defined on input
+    float *C                // packed columns of C, of size cm-by-cn in upper
+                            // trapezoidal form.
+) ;
+template int64_t spqr_cpack <FComplex, int64_t>     // returns # of rows in C
+(
+    // input, not modified
+    int64_t m,                 // # of rows in F
+    int64_t n,                 // # of columns in F
+    int64_t npiv,              // number of pivotal columns in F
+    int64_t rank,              // the C block starts at F (rank,npiv)
+
+    // input, not modified unless the pack occurs in-place
+    FComplex *F,               // m-by-n frontal matrix in column-major order
+
+    // output, contents not defined on input
+    FComplex *C                // packed columns of C, of size cm-by-cn in upper
+                            // trapezoidal form.
+) ;
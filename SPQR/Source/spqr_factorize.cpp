@@ -387,6 +387,13 @@ template <typename Entry, typename Int> spqr_numeric <Entry, Int> *spqr_factoriz
 
     if (cc->status == CHOLMOD_OK)
     {
+        // The frontal matrices, and R and H, are kept in the stacks.  A single
+        // stack is spread across the memory of all threads, since the BLAS
+        // work on its fronts in parallel.  Each of several stacks is first
+        // touched by the task that uses it, so only huge pages are requested.
+        int stackclass = (ns == 1) ?
+            (SUITESPARSE_MEMORY_INTERLEAVE | SUITESPARSE_MEMORY_HUGEPAGE) :
+            SUITESPARSE_MEMORY_HUGEPAGE ;
         for (stack = 0 ; stack < ns ; stack++)
         {
             Entry *Stack ;
@@ -394,6 +401,8 @@ template <typename Entry, typename Int> spqr_numeric <Entry, Int> *spqr_factoriz
                 maxstack : Stack_maxstack [stack] ;
             Stack_size [stack] = stacksize ;
             Stack = (Entry *) spqr_malloc <Int> (stacksize, sizeof (Entry), cc) ;
+            SuiteSparse_memory_advise (Stack, stacksize * sizeof (Entry),
+                stackclass) ;
             Stacks [stack] = Stack ;
             Work [stack].Stack_head = Stack ;
             Work [stack].Stack_top  = Stack + stacksize ;
@@ -441,6 +450,8 @@ template <typename Entry, typename Int> spqr_numeric <Entry, Int> *spqr_factoriz
             Entry *Stack ;
             Stack_size [0] = maxstack ;
             Stack = (Entry *) spqr_malloc <Int> (maxstack, sizeof (Entry), cc) ;
+            SuiteSparse_memory_advise (Stack, maxstack * sizeof (Entry),
+                SUITESPARSE_MEMORY_INTERLEAVE | SUITESPARSE_MEMORY_HUGEPAGE) ;
             Stacks [0] = Stack ;
             Work [0].Stack_head = Stack ;
             Work [0].Stack_top  = Stack + maxstack ;
@@ -775,6 +786,34 @@ template spqr_numeric <Complex, int32_t> *spqr_factorize <Complex, int32_t>
     // workspace and parameters
     cholmod_common *cc
 ) ;
+template spqr_numeric <float, int32_t> *spqr_factorize <float, int32_t>
+(
+    // input, optionally freed on output
+    cholmod_sparse **Ahandle,
+
+    // inputs, not modified
+    int32_t freeA,                     // if TRUE, free A on output
+    double tol,                     // for rank detection
+    int32_t ntol,                      // apply tol only to first ntol columns
+    spqr_symbolic <int32_t> *QRsym,
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template spqr_numeric <FComplex, int32_t> *spqr_factorize <FComplex, int32_t>
+(
+    // input, optionally freed on output
+    cholmod_sparse **Ahandle,
+
+    // inputs, not modified
+    int32_t freeA,                     // if TRUE, free A on output
+    double tol,                     // for rank detection
+    int32_t ntol,                      // apply tol only to first ntol columns
+    spqr_symbolic <int32_t> *QRsym,
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
 template spqr_numeric <double, int64_t> *spqr_factorize <double, int64_t>
 (
     // input, optionally freed on output
@@ -803,3 +842,31 @@ template spqr_numeric <Complex, int64_t> *spqr_factorize <Complex, int64_t>
     // workspace and parameters
     cholmod_common *cc
 ) ;
+template spqr_numeric <float, int64_t> *spqr_factorize <float, int64_t>
+(
+    // input, optionally freed on output
+    cholmod_sparse **Ahandle,
+
+    // inputs, not modified
+    int64_t freeA,                     // if TRUE, free A on output
+    double tol,                     // for rank detection
+    int64_t ntol,                      // apply tol only to first ntol columns
+    spqr_symbolic <int64_t> *QRsym,
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template spqr_numeric <FComplex, int64_t> *spqr_factorize <FComplex, int64_t>
+(
+    // input, optionally freed on output
+    cholmod_sparse **Ahandle,
+
+    // inputs, not modified
+    int64_t freeA,                     // if TRUE, free A on output
+    double tol,                     // for rank detection
+    int64_t ntol,                      // apply tol only to first ntol columns
+    spqr_symbolic <int64_t> *QRsym,
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
@@ -66,6 +66,20 @@ template void spqr_freefac <Complex, int32_t>
     // workspace and parameters
     cholmod_common *cc
 ) ;
+template void spqr_freefac <float, int32_t>
+(
+    SuiteSparseQR_factorization <float, int32_t> **QR_handle,
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template void spqr_freefac <FComplex, int32_t>
+(
+    SuiteSparseQR_factorization <FComplex, int32_t> **QR_handle,
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
 template void spqr_freefac <double, int64_t>
 (
     SuiteSparseQR_factorization <double, int64_t> **QR_handle,
@@ -80,3 +94,17 @@ template void spqr_freefac <Complex, int64_t>
     // workspace and parameters
     cholmod_common *cc
 ) ;
+template void spqr_freefac <float, int64_t>
+(
+    SuiteSparseQR_factorization <float, int64_t> **QR_handle,
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template void spqr_freefac <FComplex, int64_t>
+(
+    SuiteSparseQR_factorization <FComplex, int64_t> **QR_handle,
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
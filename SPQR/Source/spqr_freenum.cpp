@@ -89,6 +89,20 @@ template void spqr_freenum <Complex, int32_t>
     // workspace and parameters
     cholmod_common *cc
 ) ;
+template void spqr_freenum <float, int32_t>
+(
+    spqr_numeric <float, int32_t> **QRnum_handle,
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template void spqr_freenum <FComplex, int32_t>
+(
+    spqr_numeric <FComplex, int32_t> **QRnum_handle,
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
 template void spqr_freenum <Complex, int64_t>
 (
     spqr_numeric <Complex, int64_t> **QRnum_handle,
@@ -96,4 +110,18 @@ template void spqr_freenum <Complex, int64_t>
     // workspace and parameters
     cholmod_common *cc
 ) ;
+template void spqr_freenum <float, int64_t>
+(
+    spqr_numeric <float, int64_t> **QRnum_handle,
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template void spqr_freenum <FComplex, int64_t>
+(
+    spqr_numeric <FComplex, int64_t> **QRnum_handle,
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
 // =============================================================================
@@ -169,6 +169,32 @@ inline Complex spqr_private_larfg (int32_t n, Complex *X, cholmod_common *cc)
     return (tau) ;
 }
 
+inline float spqr_private_larfg (int64_t n, float *X, cholmod_common *cc)
+{
+    float tau = 0 ;
+    SUITESPARSE_LAPACK_slarfg (n, X, X + 1, 1, &tau, cc->blas_ok) ;
+    return (tau) ;
+}
+inline float spqr_private_larfg (int32_t n, float *X, cholmod_common *cc)
+{
+    float tau = 0 ;
+    SUITESPARSE_LAPACK_slarfg (n, X, X + 1, 1, &tau, cc->blas_ok) ;
+    return (tau) ;
+}
+
+inline FComplex spqr_private_larfg (int64_t n, FComplex *X, cholmod_common *cc)
+{
+    FComplex tau = 0 ;
+    SUITESPARSE_LAPACK_clarfg (n, X, X + 1, 1, &tau, cc->blas_ok) ;
+    return (tau) ;
+}
+inline FComplex spqr_private_larfg (int32_t n, FComplex *X, cholmod_common *cc)
+{
+    FComplex tau = 0 ;
+    SUITESPARSE_LAPACK_clarfg (n, X, X + 1, 1, &tau, cc->blas_ok) ;
+    return (tau) ;
+}
+
 template <typename Entry, typename Int> Entry spqr_private_house  // returns tau
 (
     // inputs, not modified
@@ -233,6 +259,36 @@ inline void spqr_private_larf (int32_t m, int32_t n, Complex *V, Complex tau,
         cc->blas_ok) ;
 }
 
+inline void spqr_private_larf (int64_t m, int64_t n, float *V, float tau,
+    float *C, int64_t ldc, float *W, cholmod_common *cc)
+{
+    char left = 'L' ;
+    SUITESPARSE_LAPACK_slarf (&left, m, n, V, 1, &tau, C, ldc, W, cc->blas_ok) ;
+}
+inline void spqr_private_larf (int32_t m, int32_t n, float *V, float tau,
+    float *C, int32_t ldc, float *W, cholmod_common *cc)
+{
+    char left = 'L' ;
+    SUITESPARSE_LAPACK_slarf (&left, m, n, V, 1, &tau, C, ldc, W, cc->blas_ok) ;
+}
+
+inline void spqr_private_larf (int64_t m, int64_t n, FComplex *V, FComplex tau,
+    FComplex *C, int64_t ldc, FComplex *W, cholmod_common *cc)
+{
+    char left = 'L' ;
+    FComplex conj_tau = spqr_conj (tau) ;
+    SUITESPARSE_LAPACK_clarf (&left, m, n, V, 1, &conj_tau, C, ldc, W,
+        cc->blas_ok) ;
+}
+inline void spqr_private_larf (int32_t m, int32_t n, FComplex *V, FComplex tau,
+    FComplex *C, int32_t ldc, FComplex *W, cholmod_common *cc)
+{
+    char left = 'L' ;
+    FComplex conj_tau = spqr_conj (tau) ;
+    SUITESPARSE_LAPACK_clarf (&left, m, n, V, 1, &conj_tau, C, ldc, W,
+        cc->blas_ok) ;
+}
+
 template <typename Entry, typename Int> void spqr_private_apply1
 (
     // inputs, not modified
@@ -636,6 +692,66 @@ template int32_t spqr_front <Complex, int32_t>
 
     cholmod_common *cc
 ) ;
+template int32_t spqr_front <float, int32_t>
+(
+    // input, not modified
+    int32_t m,             // F is m-by-n with leading dimension m
+    int32_t n,
+    int32_t npiv,          // number of pivot columns
+    double tol,         // a column is flagged as dead if its norm is <= tol
+    int32_t ntol,          // apply tol only to first ntol pivot columns
+    int32_t fchunk,        // block size for compact WY Householder reflections,
+                        // treated as 1 if fchunk <= 1
+
+    // input/output
+    float *F,           // frontal matrix F of size m-by-n
+    int32_t *Stair,        // size n, entries F (Stair[k]:m-1, k) are all zero,
+                        // for each k = 0:n-1, and remain zero on output.
+    char *Rdead,        // size npiv; all zero on input.  If k is dead,
+                        // Rdead [k] is set to 1
+
+    // output, not defined on input
+    float *Tau,         // size n, Householder coefficients
+
+    // workspace, undefined on input and output
+    float *W,           // size b*n, where b = min (fchunk,n,m)
+
+    // input/output
+    double *wscale,
+    double *wssq,
+
+    cholmod_common *cc
+) ;
+template int32_t spqr_front <FComplex, int32_t>
+(
+    // input, not modified
+    int32_t m,             // F is m-by-n with leading dimension m
+    int32_t n,
+    int32_t npiv,          // number of pivot columns
+    double tol,         // a column is flagged as dead if its norm is <= tol
+    int32_t ntol,          // apply tol only to first ntol pivot columns
+    int32_t fchunk,        // block size for compact WY Householder reflections,
+                        // treated as 1 if fchunk <= 1
+
+    // input/output
+    FComplex *F,           // frontal matrix F of size m-by-n
+    int32_t *Stair,        // size n, entries F (Stair[k]:m-1, k) are all zero,
+                        // for each k = 0:n-1, and remain zero on output.
+    char *Rdead,        // size npiv; all zero on input.  If k is dead,
+                        // Rdead [k] is set to 1
+
+    // output, not defined on input
+    FComplex *Tau,         // size n, Householder coefficients
+
+    // workspace, undefined on input and output
+    FComplex *W,           // size b*n, where b = min (fchunk,n,m)
+
+    // input/output
+    double *wscale,
+    double *wssq,
+
+    cholmod_common *cc
+) ;
 template int64_t spqr_front <double, int64_t>
 (
     // input, not modified
@@ -696,3 +812,63 @@ template int64_t spqr_front <Complex, int64_t>
 
     cholmod_common *cc
 ) ;
+template int64_t spqr_front <float, int64_t>
+(
+    // input, not modified
+    int64_t m,             // F is m-by-n with leading dimension m
+    int64_t n,
+    int64_t npiv,          // number of pivot columns
+    double tol,         // a column is flagged as dead if its norm is <= tol
+    int64_t ntol,          // apply tol only to first ntol pivot columns
+    int64_t fchunk,        // block size for compact WY Householder reflections,
+                        // treated as 1 if fchunk <= 1
+
+    // input/output
+    float *F,           // frontal matrix F of size m-by-n
+    int64_t *Stair,        // size n, entries F (Stair[k]:m-1, k) are all zero,
+                        // for each k = 0:n-1, and remain zero on output.
+    char *Rdead,        // size npiv; all zero on input.  If k is dead,
+                        // Rdead [k] is set to 1
+
+    // output, not defined on input
+    float *Tau,         // size n, Householder coefficients
+
+    // workspace, undefined on input and output
+    float *W,           // size b*n, where b = min (fchunk,n,m)
+
+    // input/output
+    double *wscale,
+    double *wssq,
+
+    cholmod_common *cc
+) ;
+template int64_t spqr_front <FComplex, int64_t>
+(
+    // input, not modified
+    int64_t m,             // F is m-by-n with leading dimension m
+    int64_t n,
+    int64_t npiv,          // number of pivot columns
+    double tol,         // a column is flagged as dead if its norm is <= tol
+    int64_t ntol,          // apply tol only to first ntol pivot columns
+    int64_t fchunk,        // block size for compact WY Householder reflections,
+                        // treated as 1 if fchunk <= 1
+
+    // input/output
+    FComplex *F,           // frontal matrix F of size m-by-n
+    int64_t *Stair,        // size n, entries F (Stair[k]:m-1, k) are all zero,
+                        // for each k = 0:n-1, and remain zero on output.
+    char *Rdead,        // size npiv; all zero on input.  If k is dead,
+                        // Rdead [k] is set to 1
+
+    // output, not defined on input
+    FComplex *Tau,         // size n, Householder coefficients
+
+    // workspace, undefined on input and output
+    FComplex *W,           // size b*n, where b = min (fchunk,n,m)
+
+    // input/output
+    double *wscale,
+    double *wssq,
+
+    cholmod_common *cc
+) ;
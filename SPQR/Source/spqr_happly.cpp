@@ -470,6 +470,62 @@ template void spqr_private_do_panel <Complex, int32_t>
     Complex *W,           // workspace
     cholmod_common *cc
 ) ;
+template void spqr_private_do_panel <float, int32_t>
+(
+    // inputs, not modified
+    int method,         // which method to use (0,1,2,3)
+    int32_t m,
+    int32_t n,
+    int32_t v,             // number of Householder vectors in the panel
+    int32_t *Wi,           // Wi [0:v-1] defines the pattern of the panel
+    int32_t h1,            // load H (h1) to H (h2-1) into V
+    int32_t h2,
+
+    // FUTURE : make H cholmod_sparse:
+    int32_t *Hp,           // Householder vectors: mh-by-nh sparse matrix
+    int32_t *Hi,
+    float *Hx,
+
+    float *Tau,         // Householder coefficients (size nh)
+
+    // input/output
+    int32_t *Wmap,         // inverse of Wi on input, set to all EMPTY on output
+    float *X,           // m-by-n with leading dimension m
+
+    // workspace, undefined on input and output
+    float *V,           // dense panel
+    float *C,           // workspace
+    float *W,           // workspace
+    cholmod_common *cc
+) ;
+template void spqr_private_do_panel <FComplex, int32_t>
+(
+    // inputs, not modified
+    int method,         // which method to use (0,1,2,3)
+    int32_t m,
+    int32_t n,
+    int32_t v,             // number of Householder vectors in the panel
+    int32_t *Wi,           // Wi [0:v-1] defines the pattern of the panel
+    int32_t h1,            // load H (h1) to H (h2-1) into V
+    int32_t h2,
+
+    // FUTURE : make H cholmod_sparse:
+    int32_t *Hp,           // Householder vectors: mh-by-nh sparse matrix
+    int32_t *Hi,
+    FComplex *Hx,
+
+    FComplex *Tau,         // Householder coefficients (size nh)
+
+    // input/output
+    int32_t *Wmap,         // inverse of Wi on input, set to all EMPTY on output
+    FComplex *X,           // m-by-n with leading dimension m
+
+    // workspace, undefined on input and output
+    FComplex *V,           // dense panel
+    FComplex *C,           // workspace
+    FComplex *W,           // workspace
+    cholmod_common *cc
+) ;
 
 template void spqr_private_do_panel <Complex, int64_t>
 (
@@ -499,6 +555,62 @@ template void spqr_private_do_panel <Complex, int64_t>
     Complex *W,           // workspace
     cholmod_common *cc
 ) ;
+template void spqr_private_do_panel <float, int64_t>
+(
+    // inputs, not modified
+    int method,         // which method to use (0,1,2,3)
+    int64_t m,
+    int64_t n,
+    int64_t v,             // number of Householder vectors in the panel
+    int64_t *Wi,           // Wi [0:v-1] defines the pattern of the panel
+    int64_t h1,            // load H (h1) to H (h2-1) into V
+    int64_t h2,
+
+    // FUTURE : make H cholmod_sparse:
+    int64_t *Hp,           // Householder vectors: mh-by-nh sparse matrix
+    int64_t *Hi,
+    float *Hx,
+
+    float *Tau,         // Householder coefficients (size nh)
+
+    // input/output
+    int64_t *Wmap,         // inverse of Wi on input, set to all EMPTY on output
+    float *X,           // m-by-n with leading dimension m
+
+    // workspace, undefined on input and output
+    float *V,           // dense panel
+    float *C,           // workspace
+    float *W,           // workspace
+    cholmod_common *cc
+) ;
+template void spqr_private_do_panel <FComplex, int64_t>
+(
+    // inputs, not modified
+    int method,         // which method to use (0,1,2,3)
+    int64_t m,
+    int64_t n,
+    int64_t v,             // number of Householder vectors in the panel
+    int64_t *Wi,           // Wi [0:v-1] defines the pattern of the panel
+    int64_t h1,            // load H (h1) to H (h2-1) into V
+    int64_t h2,
+
+    // FUTURE : make H cholmod_sparse:
+    int64_t *Hp,           // Householder vectors: mh-by-nh sparse matrix
+    int64_t *Hi,
+    FComplex *Hx,
+
+    FComplex *Tau,         // Householder coefficients (size nh)
+
+    // input/output
+    int64_t *Wmap,         // inverse of Wi on input, set to all EMPTY on output
+    FComplex *X,           // m-by-n with leading dimension m
+
+    // workspace, undefined on input and output
+    FComplex *V,           // dense panel
+    FComplex *C,           // workspace
+    FComplex *W,           // workspace
+    cholmod_common *cc
+) ;
 template void spqr_happly <double, int32_t>
 (
     // input
@@ -557,6 +669,64 @@ template void spqr_happly <Complex, int32_t>
     Complex *V,       // size vsize
     cholmod_common *cc
 ) ;
+template void spqr_happly <float, int32_t>
+(
+    // input
+    int method,     // 0,1,2,3
+
+    int32_t m,         // X is m-by-n with leading dimension m
+    int32_t n,
+
+    // FUTURE : make H cholmod_sparse:
+    int32_t nh,        // number of Householder vectors
+    int32_t *Hp,       // size nh+1, column pointers for H
+    int32_t *Hi,       // size hnz = Hp [nh], row indices of H
+    float *Hx,      // size hnz, Householder values.  Note that the first
+                    // entry in each column must be equal to 1.0
+
+    float *Tau,     // size nh
+
+    // input/output
+    float *X,       // size m-by-n with leading dimension m
+
+    // workspace
+    int32_t vmax,
+    int32_t hchunk,
+    int32_t *Wi,       // size vmax
+    int32_t *Wmap,     // size MAX(mh,1) where H is mh-by-nh; all EMPTY
+    float *C,       // size csize
+    float *V,       // size vsize
+    cholmod_common *cc
+) ;
+template void spqr_happly <FComplex, int32_t>
+(
+    // input
+    int method,     // 0,1,2,3
+
+    int32_t m,         // X is m-by-n with leading dimension m
+    int32_t n,
+
+    // FUTURE : make H cholmod_sparse:
+    int32_t nh,        // number of Householder vectors
+    int32_t *Hp,       // size nh+1, column pointers for H
+    int32_t *Hi,       // size hnz = Hp [nh], row indices of H
+    FComplex *Hx,      // size hnz, Householder values.  Note that the first
+                    // entry in each column must be equal to 1.0
+
+    FComplex *Tau,     // size nh
+
+    // input/output
+    FComplex *X,       // size m-by-n with leading dimension m
+
+    // workspace
+    int32_t vmax,
+    int32_t hchunk,
+    int32_t *Wi,       // size vmax
+    int32_t *Wmap,     // size MAX(mh,1) where H is mh-by-nh; all EMPTY
+    FComplex *C,       // size csize
+    FComplex *V,       // size vsize
+    cholmod_common *cc
+) ;
 template void spqr_happly <double, int64_t>
 (
     // input
@@ -615,3 +785,61 @@ template void spqr_happly <Complex, int64_t>
     Complex *V,       // size vsize
     cholmod_common *cc
 ) ;
+template void spqr_happly <float, int64_t>
+(
+    // input
+    int method,     // 0,1,2,3
+
+    int64_t m,         // X is m-by-n with leading dimension m
+    int64_t n,
+
+    // FUTURE : make H cholmod_sparse:
+    int64_t nh,        // number of Householder vectors
+    int64_t *Hp,       // size nh+1, column pointers for H
+    int64_t *Hi,       // size hnz = Hp [nh], row indices of H
+    float *Hx,      // size hnz, Householder values.  Note that the first
+                    // entry in each column must be equal to 1.0
+
+    float *Tau,     // size nh
+
+    // input/output
+    float *X,       // size m-by-n with leading dimension m
+
+    // workspace
+    int64_t vmax,
+    int64_t hchunk,
+    int64_t *Wi,       // size vmax
+    int64_t *Wmap,     // size MAX(mh,1) where H is mh-by-nh; all EMPTY
+    float *C,       // size csize
+    float *V,       // size vsize
+    cholmod_common *cc
+) ;
+template void spqr_happly <FComplex, int64_t>
+(
+    // input
+    int method,     // 0,1,2,3
+
+    int64_t m,         // X is m-by-n with leading dimension m
+    int64_t n,
+
+    // FUTURE : make H cholmod_sparse:
+    int64_t nh,        // number of Householder vectors
+    int64_t *Hp,       // size nh+1, column pointers for H
+    int64_t *Hi,       // size hnz = Hp [nh], row indices of H
+    FComplex *Hx,      // size hnz, Householder values.  Note that the first
+                    // entry in each column must be equal to 1.0
+
+    FComplex *Tau,     // size nh
+
+    // input/output
+    FComplex *X,       // size m-by-n with leading dimension m
+
+    // workspace
+    int64_t vmax,
+    int64_t hchunk,
+    int64_t *Wi,       // size vmax
+    int64_t *Wmap,     // size MAX(mh,1) where H is mh-by-nh; all EMPTY
+    FComplex *C,       // size csize
+    FComplex *V,       // size vsize
+    cholmod_common *cc
+) ;
@@ -186,6 +186,24 @@ template void spqr_hpinv <Complex, int32_t>
     // workspace
     int32_t *W              // size QRnum->m
 ) ;
+template void spqr_hpinv <float, int32_t>
+(
+    // input
+    spqr_symbolic <int32_t> *QRsym,
+    // input/output
+    spqr_numeric <float, int32_t> *QRnum,
+    // workspace
+    int32_t *W              // size QRnum->m
+) ;
+template void spqr_hpinv <FComplex, int32_t>
+(
+    // input
+    spqr_symbolic <int32_t> *QRsym,
+    // input/output
+    spqr_numeric <FComplex, int32_t> *QRnum,
+    // workspace
+    int32_t *W              // size QRnum->m
+) ;
 template void spqr_hpinv <double, int64_t>
 (
     // input
@@ -204,3 +222,21 @@ template void spqr_hpinv <Complex, int64_t>
     // workspace
     int64_t *W              // size QRnum->m
 ) ;
+template void spqr_hpinv <float, int64_t>
+(
+    // input
+    spqr_symbolic <int64_t> *QRsym,
+    // input/output
+    spqr_numeric <float, int64_t> *QRnum,
+    // workspace
+    int64_t *W              // size QRnum->m
+) ;
+template void spqr_hpinv <FComplex, int64_t>
+(
+    // input
+    spqr_symbolic <int64_t> *QRsym,
+    // input/output
+    spqr_numeric <FComplex, int64_t> *QRnum,
+    // workspace
+    int64_t *W              // size QRnum->m
+) ;
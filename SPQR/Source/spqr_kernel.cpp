@@ -349,6 +349,16 @@ template void spqr_kernel <Complex, int32_t> // _worker
     int32_t task,
     spqr_blob <Complex, int32_t> *Blob
 ) ;
+template void spqr_kernel <float, int32_t> // _worker
+(
+    int32_t task,
+    spqr_blob <float, int32_t> *Blob
+) ;
+template void spqr_kernel <FComplex, int32_t> // _worker
+(
+    int32_t task,
+    spqr_blob <FComplex, int32_t> *Blob
+) ;
 template void spqr_kernel <double, int64_t> // _worker
 (
     int64_t task,
@@ -359,3 +369,13 @@ template void spqr_kernel <Complex, int64_t> // _worker
     int64_t task,
     spqr_blob <Complex, int64_t> *Blob
 ) ;
+template void spqr_kernel <float, int64_t> // _worker
+(
+    int64_t task,
+    spqr_blob <float, int64_t> *Blob
+) ;
+template void spqr_kernel <FComplex, int64_t> // _worker
+(
+    int64_t task,
+    spqr_blob <FComplex, int64_t> *Blob
+) ;
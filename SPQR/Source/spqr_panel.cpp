@@ -169,6 +169,50 @@ template void spqr_panel <Complex, int32_t>
 
     cholmod_common *cc
 ) ;
+template void spqr_panel <float, int32_t>
+(
+    // input
+    int method,         // 0,1,2,3
+    int32_t m,
+    int32_t n,
+    int32_t v,             // length of the first vector in V
+    int32_t h,             // number of Householder vectors in the panel
+    int32_t *Vi,           // Vi [0:v-1] defines the pattern of the panel
+    float *V,           // v-by-h, panel of Householder vectors
+    float *Tau,         // size h, Householder coefficients for the panel
+    int32_t ldx,
+
+    // input/output
+    float *X,           // m-by-n with leading dimension ldx
+
+    // workspace
+    float *C,           // method 0,1: v-by-n;  method 2,3: m-by-v
+    float *W,           // method 0,1: h*h+n*h; method 2,3: h*h+m*h
+
+    cholmod_common *cc
+) ;
+template void spqr_panel <FComplex, int32_t>
+(
+    // input
+    int method,         // 0,1,2,3
+    int32_t m,
+    int32_t n,
+    int32_t v,             // length of the first vector in V
+    int32_t h,             // number of Householder vectors in the panel
+    int32_t *Vi,           // Vi [0:v-1] defines the pattern of the panel
+    FComplex *V,           // v-by-h, panel of Householder vectors
+    FComplex *Tau,         // size h, Householder coefficients for the panel
+    int32_t ldx,
+
+    // input/output
+    FComplex *X,           // m-by-n with leading dimension ldx
+
+    // workspace
+    FComplex *C,           // method 0,1: v-by-n;  method 2,3: m-by-v
+    FComplex *W,           // method 0,1: h*h+n*h; method 2,3: h*h+m*h
+
+    cholmod_common *cc
+) ;
 
 template void spqr_panel <Complex, int64_t>
 (
@@ -192,6 +236,50 @@ template void spqr_panel <Complex, int64_t>
 
     cholmod_common *cc
 ) ;
+template void spqr_panel <float, int64_t>
+(
+    // input
+    int method,         // 0,1,2,3
+    int64_t m,
+    int64_t n,
+    int64_t v,             // length of the first vector in V
+    int64_t h,             // number of Householder vectors in the panel
+    int64_t *Vi,           // Vi [0:v-1] defines the pattern of the panel
+    float *V,           // v-by-h, panel of Householder vectors
+    float *Tau,         // size h, Householder coefficients for the panel
+    int64_t ldx,
+
+    // input/output
+    float *X,           // m-by-n with leading dimension ldx
+
+    // workspace
+    float *C,           // method 0,1: v-by-n;  method 2,3: m-by-v
+    float *W,           // method 0,1: h*h+n*h; method 2,3: h*h+m*h
+
+    cholmod_common *cc
+) ;
+template void spqr_panel <FComplex, int64_t>
+(
+    // input
+    int method,         // 0,1,2,3
+    int64_t m,
+    int64_t n,
+    int64_t v,             // length of the first vector in V
+    int64_t h,             // number of Householder vectors in the panel
+    int64_t *Vi,           // Vi [0:v-1] defines the pattern of the panel
+    FComplex *V,           // v-by-h, panel of Householder vectors
+    FComplex *Tau,         // size h, Householder coefficients for the panel
+    int64_t ldx,
+
+    // input/output
+    FComplex *X,           // m-by-n with leading dimension ldx
+
+    // workspace
+    FComplex *C,           // method 0,1: v-by-n;  method 2,3: m-by-v
+    FComplex *W,           // method 0,1: h*h+n*h; method 2,3: h*h+m*h
+
+    cholmod_common *cc
+) ;
 
 template void spqr_panel <double, int32_t>
 (
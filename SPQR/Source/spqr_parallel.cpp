@@ -111,6 +111,18 @@ template void spqr_parallel <Complex, int32_t>
     int nthreads,
     spqr_blob <Complex, int32_t> *Blob
 ) ;
+template void spqr_parallel <float, int32_t>
+(
+    int32_t ntasks,
+    int nthreads,
+    spqr_blob <float, int32_t> *Blob
+) ;
+template void spqr_parallel <FComplex, int32_t>
+(
+    int32_t ntasks,
+    int nthreads,
+    spqr_blob <FComplex, int32_t> *Blob
+) ;
 template void spqr_parallel <double, int64_t>
 (
     int64_t ntasks,
@@ -123,4 +135,16 @@ template void spqr_parallel <Complex, int64_t>
     int nthreads,
     spqr_blob <Complex, int64_t> *Blob
 ) ;
+template void spqr_parallel <float, int64_t>
+(
+    int64_t ntasks,
+    int nthreads,
+    spqr_blob <float, int64_t> *Blob
+) ;
+template void spqr_parallel <FComplex, int64_t>
+(
+    int64_t ntasks,
+    int nthreads,
+    spqr_blob <FComplex, int64_t> *Blob
+) ;
 #endif
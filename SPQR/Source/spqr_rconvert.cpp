@@ -396,6 +396,98 @@ template void spqr_rconvert <Complex, int32_t>
 
     Complex *H2Tau        // size nh; Householder coefficients
 ) ;
+template void spqr_rconvert <float, int32_t>
+(
+    // inputs, not modified
+    spqr_symbolic <int32_t> *QRsym,
+    spqr_numeric <float, int32_t> *QRnum,
+
+    int32_t n1rows,        // added to each row index of Ra, Rb, and H
+    int32_t econ,          // only get entries in rows n1rows to econ-1
+    int32_t n2,            // Ra = R (:,0:n2-1), Rb = R (:,n2:n-1)
+    int getT,           // if true, get Rb' instead of Rb
+
+    // input/output
+    // FUTURE : make Ra, Rb, H2 cholmod_sparse:
+    int32_t *Rap,          // size n2+1; on input, Rap [j] is the column pointer
+                        // for Ra.  Incremented on output by the number of
+                        // entries added to column j of Ra.
+
+    // output, not defined on input
+    int32_t *Rai,          // size rnz1 = nnz(Ra); row indices of Ra
+    float *Rax,         // size rnz; numerical values of Ra
+
+    // input/output
+    int32_t *Rbp,          // if getT is false:
+                        // size (n-n2)+1; on input, Rbp [j] is the column
+                        // pointer for Rb.  Incremented on output by the number
+                        // of entries added to column j of Rb.
+                        // if getT is true:
+                        // size econ+1; on input, Rbp [i] is the row
+                        // pointer for Rb.  Incremented on output by the number
+                        // of entries added to row i of Rb.
+
+    // output, not defined on input
+    int32_t *Rbi,          // size rnz2 = nnz(Rb); indices of Rb
+    float *Rbx,         // size rnz2; numerical values of Rb
+
+    // input
+    int32_t *H2p,          // size nh+1; H2p [j] is the column pointer for H.
+                        // H2p, H2i, and H2x are ignored if H was not kept
+                        // during factorization.  nh computed by rcount
+
+    // output, not defined on input
+    int32_t *H2i,          // size hnz = nnz(H); indices of H
+    float *H2x,         // size hnz; numerical values of H
+
+    float *H2Tau        // size nh; Householder coefficients
+) ;
+template void spqr_rconvert <FComplex, int32_t>
+(
+    // inputs, not modified
+    spqr_symbolic <int32_t> *QRsym,
+    spqr_numeric <FComplex, int32_t> *QRnum,
+
+    int32_t n1rows,        // added to each row index of Ra, Rb, and H
+    int32_t econ,          // only get entries in rows n1rows to econ-1
+    int32_t n2,            // Ra = R (:,0:n2-1), Rb = R (:,n2:n-1)
+    int getT,           // if true, get Rb' instead of Rb
+
+    // input/output
+    // FUTURE : make Ra, Rb, H2 cholmod_sparse:
+    int32_t *Rap,          // size n2+1; on input, Rap [j] is the column pointer
+                        // for Ra.  Incremented on output by the number of
+                        // entries added to column j of Ra.
+
+    // output, not defined on input
+    int32_t *Rai,          // size rnz1 = nnz(Ra); row indices of Ra
+    FComplex *Rax,         // size rnz; numerical values of Ra
+
+    // input/output
+    int32_t *Rbp,          // if getT is false:
+                        // size (n-n2)+1; on input, Rbp [j] is the column
+                        // pointer for Rb.  Incremented on output by the number
+                        // of entries added to column j of Rb.
+                        // if getT is true:
+                        // size econ+1; on input, Rbp [i] is the row
+                        // pointer for Rb.  Incremented on output by the number
+                        // of entries added to row i of Rb.
+
+    // output, not defined on input
+    int32_t *Rbi,          // size rnz2 = nnz(Rb); indices of Rb
+    FComplex *Rbx,         // size rnz2; numerical values of Rb
+
+    // input
+    int32_t *H2p,          // size nh+1; H2p [j] is the column pointer for H.
+                        // H2p, H2i, and H2x are ignored if H was not kept
+                        // during factorization.  nh computed by rcount
+
+    // output, not defined on input
+    int32_t *H2i,          // size hnz = nnz(H); indices of H
+    FComplex *H2x,         // size hnz; numerical values of H
+
+    FComplex *H2Tau        // size nh; Householder coefficients
+) ;
 template void spqr_rconvert <double, int64_t>
 (
     // inputs, not modified
@@ -488,3 +580,95 @@ template void spqr_rconvert <Complex, int64_t>
 
     Complex *H2Tau        // size nh; Householder coefficients
 ) ;
+template void spqr_rconvert <float, int64_t>
+(
+    // inputs, not modified
+    spqr_symbolic <int64_t> *QRsym,
+    spqr_numeric <float, int64_t> *QRnum,
+
+    int64_t n1rows,        // added to each row index of Ra, Rb, and H
+    int64_t econ,          // only get entries in rows n1rows to econ-1
+    int64_t n2,            // Ra = R (:,0:n2-1), Rb = R (:,n2:n-1)
+    int getT,           // if true, get Rb' instead of Rb
+
+    // input/output
+    // FUTURE : make Ra, Rb, H2 cholmod_sparse:
+    int64_t *Rap,          // size n2+1; on input, Rap [j] is the column pointer
+                        // for Ra.  Incremented on output by the number of
+                        // entries added to column j of Ra.
+
+    // output, not defined on input
+    int64_t *Rai,          // size rnz1 = nnz(Ra); row indices of Ra
+    float *Rax,         // size rnz; numerical values of Ra
+
+    // input/output
+    int64_t *Rbp,          // if getT is false:
+                        // size (n-n2)+1; on input, Rbp [j] is the column
+                        // pointer for Rb.  Incremented on output by the number
+                        // of entries added to column j of Rb.
+                        // if getT is true:
+                        // size econ+1; on input, Rbp [i] is the row
+                        // pointer for Rb.  Incremented on output by the number
+                        // of entries added to row i of Rb.
+
+    // output, not defined on input
+    int64_t *Rbi,          // size rnz2 = nnz(Rb); indices of Rb
+    float *Rbx,         // size rnz2; numerical values of Rb
+
+    // input
+    int64_t *H2p,          // size nh+1; H2p [j] is the column pointer for H.
+                        // H2p, H2i, and H2x are ignored if H was not kept
+                        // during factorization.  nh computed by rcount
+
+    // output, not defined on input
+    int64_t *H2i,          // size hnz = nnz(H); indices of H
+    float *H2x,         // size hnz; numerical values of H
+
+    float *H2Tau        // size nh; Householder coefficients
+) ;
+template void spqr_rconvert <FComplex, int64_t>
+(
+    // inputs, not modified
+    spqr_symbolic <int64_t> *QRsym,
+    spqr_numeric <FComplex, int64_t> *QRnum,
+
+    int64_t n1rows,        // added to each row index of Ra, Rb, and H
+    int64_t econ,          // only get entries in rows n1rows to econ-1
+    int64_t n2,            // Ra = R (:,0:n2-1), Rb = R (:,n2:n-1)
+    int getT,           // if true, get Rb' instead of Rb
+
+    // input/output
+    // FUTURE : make Ra, Rb, H2 cholmod_sparse:
+    int64_t *Rap,          // size n2+1; on input, Rap [j] is the column pointer
+                        // for Ra.  Incremented on output by the number of
+                        // entries added to column j of Ra.
+
+    // output, not defined on input
+    int64_t *Rai,          // size rnz1 = nnz(Ra); row indices of Ra
+    FComplex *Rax,         // size rnz; numerical values of Ra
+
+    // input/output
+    int64_t *Rbp,          // if getT is false:
+                        // size (n-n2)+1; on input, Rbp [j] is the column
+                        // pointer for Rb.  Incremented on output by the number
+                        // of entries added to column j of Rb.
+                        // if getT is true:
+                        // size econ+1; on input, Rbp [i] is the row
+                        // pointer for Rb.  Incremented on output by the number
+                        // of entries added to row i of Rb.
+
+    // output, not defined on input
+    int64_t *Rbi,          // size rnz2 = nnz(Rb); indices of Rb
+    FComplex *Rbx,         // size rnz2; numerical values of Rb
+
+    // input
+    int64_t *H2p,          // size nh+1; H2p [j] is the column pointer for H.
+                        // H2p, H2i, and H2x are ignored if H was not kept
+                        // during factorization.  nh computed by rcount
+
+    // output, not defined on input
+    int64_t *H2i,          // size hnz = nnz(H); indices of H
+    FComplex *H2x,         // size hnz; numerical values of H
+
+    FComplex *H2Tau        // size nh; Householder coefficients
+) ;
@@ -179,6 +179,40 @@ template int32_t spqr_rhpack <Complex, int32_t>   // returns # of entries in R+H
     Complex *R,               // packed columns of R+H
     int32_t *p_rm              // number of rows in R block
 ) ;
+template int32_t spqr_rhpack <float, int32_t>   // returns # of entries in R+H
+(
+    // input, not modified
+    int keepH,              // if true, then H is packed
+    int32_t m,                 // # of rows in F
+    int32_t n,                 // # of columns in F
+    int32_t npiv,              // number of pivotal columns in F
+    int32_t *Stair,            // size npiv; column j is dead if Stair [j] == 0.
+                            // Only the first npiv columns can be dead.
+
+    // input, not modified (unless the pack occurs in-place)
+    float *F,               // m-by-n frontal matrix in column-major order
+
+    // output, contents not defined on input
+    float *R,               // packed columns of R+H
+    int32_t *p_rm              // number of rows in R block
+) ;
+template int32_t spqr_rhpack <FComplex, int32_t>   // returns # of entries in R+H
+(
+    // input, not modified
+    int keepH,              // if true, then H is packed
+    int32_t m,                 // # of rows in F
+    int32_t n,                 // # of columns in F
+    int32_t npiv,              // number of pivotal columns in F
+    int32_t *Stair,            // size npiv; column j is dead if Stair [j] == 0.
+                            // Only the first npiv columns can be dead.
+
+    // input, not modified (unless the pack occurs in-place)
+    FComplex *F,               // m-by-n frontal matrix in column-major order
+
+    // output, contents not defined on input
+    FComplex *R,               // packed columns of R+H
+    int32_t *p_rm              // number of rows in R block
+) ;
 
 template int64_t spqr_rhpack <double, int64_t>   // returns # of entries in R+H
 (
@@ -215,3 +249,37 @@ template int64_t spqr_rhpack <Complex, int64_t>   // returns # of entries in R+H
     Complex *R,               // packed columns of R+H
     int64_t *p_rm              // number of rows in R block
 ) ;
+template int64_t spqr_rhpack <float, int64_t>   // returns # of entries in R+H
+(
+    // input, not modified
+    int keepH,              // if true, then H is packed
+    int64_t m,                 // # of rows in F
+    int64_t n,                 // # of columns in F
+    int64_t npiv,              // number of pivotal columns in F
+    int64_t *Stair,            // size npiv; column j is dead if Stair [j] == 0.
+                            // Only the first npiv columns can be dead.
+
+    // input, not modified (unless the pack occurs in-place)
+    float *F,               // m-by-n frontal matrix in column-major order
+
+    // output, contents not defined on input
+    float *R,               // packed columns of R+H
+    int64_t *p_rm              // number of rows in R block
+) ;
+template int64_t spqr_rhpack <FComplex, int64_t>   // returns # of entries in R+H
+(
+    // input, not modified
+    int keepH,              // if true, then H is packed
+    int64_t m,                 // # of rows in F
+    int64_t n,                 // # of columns in F
+    int64_t npiv,              // number of pivotal columns in F
+    int64_t *Stair,            // size npiv; column j is dead if Stair [j] == 0.
+                            // Only the first npiv columns can be dead.
+
+    // input, not modified (unless the pack occurs in-place)
+    FComplex *F,               // m-by-n frontal matrix in column-major order
+
+    // output, contents not defined on input
+    FComplex *R,               // packed columns of R+H
+    int64_t *p_rm              // number of rows in R block
+) ;
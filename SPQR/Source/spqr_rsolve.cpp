@@ -61,11 +61,147 @@
 
 #include "spqr.hpp"
 
-template <typename Entry, typename Int> void spqr_rsolve
+// The fronts are solved in reverse order, from the roots of the frontal tree
+// down.  The only columns of X that the R block of a front needs are the
+// pivot columns of its ancestors, so once a front is solved the subtrees
+// rooted at each of its children can be solved in parallel.  This is done
+// with OpenMP tasks if SPQR is compiled with OpenMP and there is enough
+// work.  The singleton rows of R are solved last, by a single thread.
+//
+// With many right-hand sides, each R block is copied into a dense matrix and
+// the front is solved with the level-3 BLAS (gemm for the rectangular part,
+// trsm for the triangular part) instead of one column at a time.
+
+// use the BLAS if there are at least this many right-hand sides
+#define SPQR_RSOLVE_BLAS3 4
+
+// =============================================================================
+// === spqr_private_gemm/trsm ==================================================
+// =============================================================================
+
+// C = C - A*B, where C is m-by-n and A is m-by-k
+
+inline void spqr_private_gemm (int64_t m, int64_t n, int64_t k,
+    double *A, int64_t lda, double *B, int64_t ldb, double *C, int64_t ldc,
+    int &ok)
+{
+    double alpha = -1, beta = 1 ;
+    SUITESPARSE_BLAS_dgemm ("N", "N", m, n, k, &alpha, A, lda, B, ldb, &beta,
+        C, ldc, ok) ;
+}
+
+inline void spqr_private_gemm (int64_t m, int64_t n, int64_t k,
+    Complex *A, int64_t lda, Complex *B, int64_t ldb, Complex *C, int64_t ldc,
+    int &ok)
+{
+    Complex alpha = -1, beta = 1 ;
+    SUITESPARSE_BLAS_zgemm ("N", "N", m, n, k, &alpha, A, lda, B, ldb, &beta,
+        C, ldc, ok) ;
+}
+
+inline void spqr_private_gemm (int64_t m, int64_t n, int64_t k,
+    float *A, int64_t lda, float *B, int64_t ldb, float *C, int64_t ldc,
+    int &ok)
+{
+    float alpha = -1, beta = 1 ;
+    SUITESPARSE_BLAS_sgemm ("N", "N", m, n, k, &alpha, A, lda, B, ldb, &beta,
+        C, ldc, ok) ;
+}
+
+inline void spqr_private_gemm (int64_t m, int64_t n, int64_t k,
+    FComplex *A, int64_t lda, FComplex *B, int64_t ldb, FComplex *C,
+    int64_t ldc, int &ok)
+{
+    FComplex alpha = -1, beta = 1 ;
+    SUITESPARSE_BLAS_cgemm ("N", "N", m, n, k, &alpha, A, lda, B, ldb, &beta,
+        C, ldc, ok) ;
+}
+
+// B = T\B, where T is m-by-m upper triangular and B is m-by-n
+
+inline void spqr_private_trsm (int64_t m, int64_t n,
+    double *T, int64_t ldt, double *B, int64_t ldb, int &ok)
+{
+    double one = 1 ;
+    SUITESPARSE_BLAS_dtrsm ("L", "U", "N", "N", m, n, &one, T, ldt, B, ldb,
+        ok) ;
+}
+
+inline void spqr_private_trsm (int64_t m, int64_t n,
+    Complex *T, int64_t ldt, Complex *B, int64_t ldb, int &ok)
+{
+    Complex one = 1 ;
+    SUITESPARSE_BLAS_ztrsm ("L", "U", "N", "N", m, n, &one, T, ldt, B, ldb,
+        ok) ;
+}
+
+inline void spqr_private_trsm (int64_t m, int64_t n,
+    float *T, int64_t ldt, float *B, int64_t ldb, int &ok)
+{
+    float one = 1 ;
+    SUITESPARSE_BLAS_strsm ("L", "U", "N", "N", m, n, &one, T, ldt, B, ldb,
+        ok) ;
+}
+
+inline void spqr_private_trsm (int64_t m, int64_t n,
+    FComplex *T, int64_t ldt, FComplex *B, int64_t ldb, int &ok)
+{
+    FComplex one = 1 ;
+    SUITESPARSE_BLAS_ctrsm ("L", "U", "N", "N", m, n, &one, T, ldt, B, ldb,
+        ok) ;
+}
+
+// =============================================================================
+// === spqr_private_front_rank =================================================
+// =============================================================================
+
+// Returns the number of rows in the R block of front f (its live pivot
+// columns), as found by spqr_private_rsolve_front.
+
+template <typename Entry, typename Int> Int spqr_private_front_rank
+(
+    SuiteSparseQR_factorization <Entry, Int> *QR,
+    Int f
+)
+{
+    spqr_symbolic <Int> *QRsym = QR->QRsym ;
+    spqr_numeric <Entry, Int> *QRnum = QR->QRnum ;
+    Int col1 = QRsym->Super [f] ;
+    Int fp = QRsym->Super [f+1] - col1 ;
+    Int rm = 0 ;
+    if (QRnum->keepH)
+    {
+        Int *Stair = QRnum->HStair + QRsym->Rp [f] ;
+        Int fm = QRnum->Hm [f] ;
+        for (Int k = 0 ; k < fp ; k++)
+        {
+            if (Stair [k] != 0 && rm < fm) rm++ ;
+        }
+    }
+    else
+    {
+        for (Int k = 0 ; k < fp ; k++)
+        {
+            if (!QRnum->Rdead [col1 + k]) rm++ ;
+        }
+    }
+    return (rm) ;
+}
+
+// =============================================================================
+// === spqr_private_rsolve_front ===============================================
+// =============================================================================
+
+// Solve with the R block of front f, which holds rows row2-rm:row2-1 of the
+// R factor of [A Binput].  Returns row1 = row2-rm.
+
+template <typename Entry, typename Int> Int spqr_private_rsolve_front
 (
     // inputs
     SuiteSparseQR_factorization <Entry, Int> *QR,
-    int use_Q1fill,         // if TRUE, do X=E*(R\B), otherwise do X=R\B
+    Int *Q1fill,
+    Int f,
+    Int row2,
 
     Int nrhs,              // number of columns of B
     Int ldb,               // leading dimension of B
@@ -78,6 +214,7 @@ template <typename Entry, typename Int> void spqr_rsolve
     Entry **Rcolp,          // size QRnum->maxfrank
     Int *Rlive,            // size QRnum->maxfrank
     Entry *W,               // size QRnum->maxfrank * nrhs
+    Entry *Wblas,           // size maxfrank*maxfn + maxfn*nrhs, or NULL
 
     cholmod_common *cc
 )
@@ -85,36 +222,20 @@ template <typename Entry, typename Int> void spqr_rsolve
     spqr_symbolic <Int> *QRsym ;
     spqr_numeric <Entry, Int> *QRnum ;
     Int n1rows, n1cols, n ;
-    Int *Q1fill, *R1p, *R1j ;
-    Entry *R1x ;
 
     Entry xi ;
-    Entry **Rblock, *R, *W1, *B1, *X1 ;
+    Entry *R, *W1, *B1 ;
     Int *Rp, *Rj, *Super, *HStair, *Hm, *Stair ;
     char *Rdead ;
-    Int nf, // m,
-        rank, j, f, col1, col2, fp, pr, fn, rm, k, i, row1, row2, ii,
+    Int rank, j, col1, col2, fp, pr, fn, rm, k, i, row1, ii,
         keepH, fm, h, t, live, kk ;
 
-    // -------------------------------------------------------------------------
-    // get the contents of the QR object
-    // -------------------------------------------------------------------------
-
     QRsym = QR->QRsym ;
     QRnum = QR->QRnum ;
     n1rows = QR->n1rows ;
     n1cols = QR->n1cols ;
     n = QR->nacols ;
-    Q1fill = use_Q1fill ? QR->Q1fill : NULL ;
-    R1p = QR->R1p ;
-    R1j = QR->R1j ;
-    R1x = QR->R1x ;
-
     keepH = QRnum->keepH ;
-    PR (("rsolve keepH %ld\n", keepH)) ;
-    nf = QRsym->nf ;
-    // m = QRsym->m ;
-    Rblock = QRnum->Rblock ;
     Rp = QRsym->Rp ;
     Rj = QRsym->Rj ;
     Super = QRsym->Super ;
@@ -124,224 +245,599 @@ template <typename Entry, typename Int> void spqr_rsolve
     HStair = QRnum->HStair ;
     Hm = QRnum->Hm ;
 
+    Stair = NULL ;
+    fm = 0 ;
+    h = 0 ;
+    t = 0 ;
+
     // -------------------------------------------------------------------------
-    // X = 0
+    // get the R block for front F
     // -------------------------------------------------------------------------
 
-    X1 = X ;
-    for (kk = 0 ; kk < nrhs ; kk++)
+    R = QRnum->Rblock [f] ;
+    col1 = Super [f] ;                  // first pivot column in front F
+    col2 = Super [f+1] ;                // col2-1 is last pivot col
+    fp = col2 - col1 ;                  // number of pivots in front F
+    pr = Rp [f] ;                       // pointer to row indices for F
+    fn = Rp [f+1] - pr ;                // # of columns in front F
+
+    if (keepH)
     {
-        for (i = 0 ; i < n ; i++)
-        {
-            X1 [i] = 0 ;
-        }
-        X1 += n ;
+        Stair = HStair + pr ;           // staircase of front F
+        fm = Hm [f] ;                   // # of rows in front F
+        h = 0 ;                         // H vector starts in row h
     }
 
-    // =========================================================================
-    // === solve with the multifrontal rows of R ===============================
-    // =========================================================================
+    // -------------------------------------------------------------------------
+    // find the live pivot columns in this R or RH block
+    // -------------------------------------------------------------------------
 
-    Stair = NULL ;
-    fm = 0 ;
-    h = 0 ;
-    t = 0 ;
+    rm = 0 ;                            // number of rows in R block
+    for (k = 0 ; k < fp ; k++)
+    {
+        j = col1 + k ;
+        ASSERT (Rj [pr + k] == j) ;
+        if (keepH)
+        {
+            t = Stair [k] ;             // length of R+H vector
+            ASSERT (t >= 0 && t <= fm) ;
+            if (t == 0)
+            {
+                live = FALSE ;          // column k is dead
+                t = rm ;                // dead col, R only, no H
+                h = rm ;
+            }
+            else
+            {
+                live = (rm < fm) ;      // k is live, unless we hit the wall
+                h = rm + 1 ;            // H vector starts in row h
+            }
+            ASSERT (t >= h) ;
+        }
+        else
+        {
+            live = (!Rdead [j])  ;
+        }
 
-    // start with row2 = QR-num->rank + n1rows, the last row of the combined R
-    // factor of [A Binput]
+        if (live)
+        {
+            // R (rm,k) is a "diagonal"; rm and k are local indices.
+            // Keep track of a pointer to the first entry R(0,k)
+            Rcolp [rm] = R ;
+            Rlive [rm] = j ;
+            rm++ ;
+        }
+        else
+        {
+            // compute the basic solution; dead columns are zero
+            ii = Q1fill ? Q1fill [j+n1cols] : j+n1cols ;
+            if (ii < n)
+            {
+                for (kk = 0 ; kk < nrhs ; kk++)
+                {
+                    // X (ii,kk) = 0; note this is stride n
+                    X [INDEX (ii,kk,n)] = 0 ;
+                }
+            }
+        }
 
-    row2 = QRnum->rank + n1rows ;
-    for (f = nf-1 ; f >= 0 ; f--)
-    {
+        // advance to the next column of R in the R block
+        R += rm + (keepH ? (t-h) : 0) ;
+    }
 
-        // ---------------------------------------------------------------------
-        // get the R block for front F
-        // ---------------------------------------------------------------------
+    // There are rm rows in this R block, corresponding to the rm live
+    // columns in the range col1:col2-1.  The list of live global column
+    // indices is given in Rlive [0:rm-1].  Pointers to the numerical
+    // entries for each of these columns in this R block are given in
+    // Rcolp [0:rm-1].   The rm rows in this R block correspond to
+    // row1:row2-1 of R and b.
 
-        R = Rblock [f] ;
-        col1 = Super [f] ;                  // first pivot column in front F
-        col2 = Super [f+1] ;                // col2-1 is last pivot col
-        fp = col2 - col1 ;                  // number of pivots in front F
-        pr = Rp [f] ;                       // pointer to row indices for F
-        fn = Rp [f+1] - pr ;                // # of columns in front F
+    row1 = row2 - rm ;
 
-        if (keepH)
+    // -------------------------------------------------------------------------
+    // get the right-hand sides for these rm equations
+    // -------------------------------------------------------------------------
+
+    // W = B (row1:row2-1,:)
+    ASSERT (rm <= QRnum->maxfrank) ;
+    W1 = W ;
+    B1 = B ;
+    for (kk = 0 ; kk < nrhs ; kk++)
+    {
+        for (i = 0 ; i < rm ; i++)
         {
-            Stair = HStair + pr ;           // staircase of front F
-            fm = Hm [f] ;                   // # of rows in front F
-            h = 0 ;                         // H vector starts in row h
+            ii = row1 + i ;
+            ASSERT (ii >= n1rows) ;
+            W1 [i] = (ii < rank) ? B1 [ii] : 0 ;
         }
+        W1 += rm ;
+        B1 += ldb ;
+    }
+
+    // -------------------------------------------------------------------------
+    // solve with the level-3 BLAS, if possible
+    // -------------------------------------------------------------------------
 
-        // ---------------------------------------------------------------------
-        // find the live pivot columns in this R or RH block
-        // ---------------------------------------------------------------------
+    // The BLAS are used only if each live pivot column is a column of A, not
+    // of Binput.
 
-        rm = 0 ;                            // number of rows in R block
-        for (k = 0 ; k < fp ; k++)
+    int use_blas = (Wblas != NULL && rm > 0 && nrhs >= SPQR_RSOLVE_BLAS3) ;
+    for (Int k1 = 0 ; use_blas && k1 < rm ; k1++)
+    {
+        j = Rlive [k1] ;
+        ii = Q1fill ? Q1fill [j+n1cols] : j+n1cols ;
+        use_blas = (ii < n) ;
+    }
+
+    if (use_blas)
+    {
+        // R2 = the live columns of the rectangular part of R, and X2 = the
+        // corresponding rows of X
+        Int ldx2 = fn - fp ;
+        Entry *R2 = Wblas ;                         // rm-by-nc
+        Entry *X2 = Wblas + QRnum->maxfrank * QRsym->maxfn ; // nc-by-nrhs
+        Entry *Rk = R ;
+        Int hk = h ;
+        Int nc = 0 ;
+        for (Int k2 = fp ; k2 < fn ; k2++)
         {
-            j = col1 + k ;
-            ASSERT (Rj [pr + k] == j) ;
-            if (keepH)
+            j = Rj [pr + k2] ;
+            ii = Q1fill ? Q1fill [j+n1cols] : j+n1cols ;
+            if (ii >= n) break ;
+            if (!Rdead [j])
             {
-                t = Stair [k] ;             // length of R+H vector
-                ASSERT (t >= 0 && t <= fm) ;
-                if (t == 0)
+                for (i = 0 ; i < rm ; i++)
                 {
-                    live = FALSE ;          // column k is dead
-                    t = rm ;                // dead col, R only, no H
-                    h = rm ;
+                    R2 [i + nc*rm] = Rk [i] ;
                 }
-                else
+                for (kk = 0 ; kk < nrhs ; kk++)
                 {
-                    live = (rm < fm) ;      // k is live, unless we hit the wall
-                    h = rm + 1 ;            // H vector starts in row h
+                    X2 [nc + kk*ldx2] = X [INDEX (ii,kk,n)] ;
                 }
-                ASSERT (t >= h) ;
+                nc++ ;
             }
-            else
+            Rk += rm ;
+            if (keepH)
             {
-                live = (!Rdead [j])  ;
+                hk = MIN (hk+1, fm) ;
+                Rk += (Stair [k2] - hk) ;
             }
+        }
+
+        // W = W - R2*X2
+        int ok = TRUE ;
+        if (nc > 0)
+        {
+            spqr_private_gemm (rm, nrhs, nc, R2, rm, X2, ldx2, W, rm, ok) ;
+            FLOP_COUNT2 (2*rm*nc, nrhs) ;
+        }
 
-            if (live)
+        if (ok)
+        {
+            // W = T\W, where T is the squeezed upper triangular part of R
+            Entry *T = Wblas ;
+            for (Int k1 = 0 ; k1 < rm ; k1++)
             {
-                // R (rm,k) is a "diagonal"; rm and k are local indices.
-                // Keep track of a pointer to the first entry R(0,k)
-                Rcolp [rm] = R ;
-                Rlive [rm] = j ;
-                rm++ ;
+                Entry *Rc = Rcolp [k1] ;
+                for (i = 0 ; i <= k1 ; i++)
+                {
+                    T [i + k1*rm] = Rc [i] ;
+                }
             }
-            else
+            spqr_private_trsm (rm, nrhs, T, rm, W, rm, ok) ;
+            FLOP_COUNT2 (rm*rm, nrhs) ;
+            ASSERT (ok) ;   // the dimensions are no larger than for gemm
+            for (Int k1 = 0 ; k1 < rm ; k1++)
             {
-                // compute the basic solution; dead columns are zero
+                j = Rlive [k1] ;
                 ii = Q1fill ? Q1fill [j+n1cols] : j+n1cols ;
-                if (ii < n)
+                for (kk = 0 ; kk < nrhs ; kk++)
                 {
-                    for (kk = 0 ; kk < nrhs ; kk++)
-                    {
-                        // X (ii,kk) = 0; note this is stride n
-                        X [INDEX (ii,kk,n)] = 0 ;
-                    }
+                    X [INDEX (ii,kk,n)] = W [k1 + kk*rm] ;
                 }
             }
-
-            // advance to the next column of R in the R block
-            R += rm + (keepH ? (t-h) : 0) ;
+            return (row1) ;
         }
 
-        // There are rm rows in this R block, corresponding to the rm live
-        // columns in the range col1:col2-1.  The list of live global column
-        // indices is given in Rlive [0:rm-1].  Pointers to the numerical
-        // entries for each of these columns in this R block are given in
-        // Rcolp [0:rm-1].   The rm rows in this R block correspond to
-        // row1:row2-1 of R and b.
-
-        row1 = row2 - rm ;
+        // the BLAS cannot be used (integer overflow); W is unchanged, so
+        // solve one column at a time instead
+    }
 
-        // ---------------------------------------------------------------------
-        // get the right-hand sides for these rm equations
-        // ---------------------------------------------------------------------
+    // -------------------------------------------------------------------------
+    // solve with the rectangular part of R (W = W - R2*x2)
+    // -------------------------------------------------------------------------
 
-        // W = B (row1:row2-1,:)
-        ASSERT (rm <= QRnum->maxfrank) ;
-        W1 = W ;
-        B1 = B ;
-        for (kk = 0 ; kk < nrhs ; kk++)
+    for ( ; k < fn ; k++)
+    {
+        j = Rj [pr + k] ;
+        ASSERT (j >= col2 && j < QRsym->n) ;
+        ii = Q1fill ? Q1fill [j+n1cols] : j+n1cols ;
+        ASSERT ((ii < n) == (j+n1cols < n)) ;
+        // break if past the last column of A in QR of [A Binput]
+        if (ii >= n) break ;
+
+        if (!Rdead [j])
         {
-            for (i = 0 ; i < rm ; i++)
+            // global column j is live
+            W1 = W ;
+            for (kk = 0 ; kk < nrhs ; kk++)
             {
-                ii = row1 + i ;
-                ASSERT (ii >= n1rows) ;
-                W1 [i] = (ii < rank) ? B1 [ii] : 0 ;
+                xi = X [INDEX (ii,kk,n)] ;        // xi = X (ii,kk)
+                if (xi != (Entry) 0)
+                {
+                    FLOP_COUNT (2*rm) ;
+                    for (i = 0 ; i < rm ; i++)
+                    {
+                        W1 [i] -= R [i] * xi ;
+                    }
+                }
+                W1 += rm ;
             }
-            W1 += rm ;
-            B1 += ldb ;
         }
 
-        // ---------------------------------------------------------------------
-        // solve with the rectangular part of R (W = W - R2*x2)
-        // ---------------------------------------------------------------------
-
-        for ( ; k < fn ; k++)
+        // go to the next column of R
+        R += rm ;
+        if (keepH)
         {
-            j = Rj [pr + k] ;
-            ASSERT (j >= col2 && j < QRsym->n) ;
-            ii = Q1fill ? Q1fill [j+n1cols] : j+n1cols ;
-            ASSERT ((ii < n) == (j+n1cols < n)) ;
-            // break if past the last column of A in QR of [A Binput]
-            if (ii >= n) break ;
+            t = Stair [k] ;             // length of R+H vector
+            ASSERT (t >= 0 && t <= fm) ;
+            h = MIN (h+1, fm) ;         // H vector starts in row h
+            ASSERT (t >= h) ;
+            R += (t-h) ;
+        }
+    }
 
-            if (!Rdead [j])
+    // -------------------------------------------------------------------------
+    // solve with the squeezed upper triangular part of R
+    // -------------------------------------------------------------------------
+
+    for (k = rm-1 ; k >= 0 ; k--)
+    {
+        R = Rcolp [k] ;                 // kth live pivot column
+        j = Rlive [k] ;                 // is jth global column
+        ii = Q1fill ? Q1fill [j+n1cols] : j+n1cols ;
+        ASSERT ((ii < n) == (j+n1cols < n)) ;
+        if (ii < n)
+        {
+            W1 = W ;
+            for (kk = 0 ; kk < nrhs ; kk++)
             {
-                // global column j is live
-                W1 = W ;
-                for (kk = 0 ; kk < nrhs ; kk++)
+                // divide by the "diagonal"
+                // xi = W1 [k] / R [k] ;
+                xi = spqr_divide (W1 [k], R [k]) ;
+                FLOP_COUNT (1) ;
+                X [INDEX(ii,kk,n)] = xi ;
+                if (xi != (Entry) 0)
                 {
-                    xi = X [INDEX (ii,kk,n)] ;        // xi = X (ii,kk)
-                    if (xi != (Entry) 0)
+                    FLOP_COUNT (2*k) ;
+                    for (i = 0 ; i < k ; i++)
                     {
-                        FLOP_COUNT (2*rm) ;
-                        for (i = 0 ; i < rm ; i++)
-                        {
-                            W1 [i] -= R [i] * xi ;
-                        }
+                        W1 [i] -= R [i] * xi ;
                     }
-                    W1 += rm ;
                 }
+                W1 += rm ;
             }
+        }
+    }
 
-            // go to the next column of R
-            R += rm ;
-            if (keepH)
+    return (row1) ;
+}
+
+// =============================================================================
+// === spqr_private_rsolve_subtree =============================================
+// =============================================================================
+
+// Solve with the fronts of the subtree rooted at front f.  A task is started
+// for each child but one, and this task continues with that child.  Each
+// thread has its own workspace and its own copy of cc.
+
+template <typename Entry, typename Int> void spqr_private_rsolve_subtree
+(
+    // inputs
+    SuiteSparseQR_factorization <Entry, Int> *QR,
+    Int *Q1fill,
+    Int f,
+    Int *Row2,              // size nf, last row + 1 of the R block of each front
+
+    Int nrhs,              // number of columns of B
+    Int ldb,               // leading dimension of B
+    Entry *B,               // size m-by-nrhs with leading dimesion ldb
+
+    // output
+    Entry *X,               // size n-by-nrhs with leading dimension n
+
+    // workspace for each thread
+    Entry **Rcolp_all,      // size maxfrank per thread
+    Int *Rlive_all,        // size maxfrank per thread
+    Entry *W_all,           // size maxfrank*nrhs per thread
+    Entry *Wblas_all,       // size bsize per thread, or NULL
+    Int bsize,
+    cholmod_common *Ccommon // size nthreads
+)
+{
+    Int maxfrank = QR->QRnum->maxfrank ;
+    Int *Childp = QR->QRsym->Childp ;
+    Int *Child = QR->QRsym->Child ;
+    while (f != EMPTY)
+    {
+        int tid = SUITESPARSE_OPENMP_GET_THREAD_ID ;
+        spqr_private_rsolve_front (QR, Q1fill, f, Row2 [f], nrhs, ldb, B, X,
+            Rcolp_all + tid * maxfrank, Rlive_all + tid * maxfrank,
+            W_all + tid * maxfrank * nrhs,
+            (Wblas_all == NULL) ? NULL : (Wblas_all + tid * bsize),
+            &(Ccommon [tid])) ;
+        Int next = EMPTY ;
+        for (Int p = Childp [f] ; p < Childp [f+1] ; p++)
+        {
+            Int c = Child [p] ;
+            if (next == EMPTY)
+            {
+                next = c ;
+            }
+            else
             {
-                t = Stair [k] ;             // length of R+H vector
-                ASSERT (t >= 0 && t <= fm) ;
-                h = MIN (h+1, fm) ;         // H vector starts in row h
-                ASSERT (t >= h) ;
-                R += (t-h) ;
+                #pragma omp task firstprivate(c)
+                spqr_private_rsolve_subtree (QR, Q1fill, c, Row2, nrhs, ldb,
+                    B, X, Rcolp_all, Rlive_all, W_all, Wblas_all, bsize,
+                    Ccommon) ;
             }
         }
+        f = next ;
+    }
+}
+
+// =============================================================================
+// === spqr_private_rsolve_parallel ============================================
+// =============================================================================
+
+// Solve with the multifrontal rows of R in parallel.  Returns FALSE if there
+// is not enough work, or not enough memory, in which case nothing is done.
+
+template <typename Entry, typename Int> int spqr_private_rsolve_parallel
+(
+    // inputs
+    SuiteSparseQR_factorization <Entry, Int> *QR,
+    Int *Q1fill,
+    Int nrhs,              // number of columns of B
+    Int ldb,               // leading dimension of B
+    Entry *B,               // size m-by-nrhs with leading dimesion ldb
+    Int bsize,              // size of the BLAS workspace, 0 if not used
+
+    // output
+    Entry *X,               // size n-by-nrhs with leading dimension n
+
+    cholmod_common *cc
+)
+{
+#ifdef _OPENMP
+
+    spqr_symbolic <Int> *QRsym = QR->QRsym ;
+    spqr_numeric <Entry, Int> *QRnum = QR->QRnum ;
+    Int nf = QRsym->nf ;
+    Int *Rp = QRsym->Rp ;
+    Int *Super = QRsym->Super ;
+    Int maxfrank = QRnum->maxfrank ;
+
+    // -------------------------------------------------------------------------
+    // quick return if there is not enough work for more than one thread
+    // -------------------------------------------------------------------------
+
+    // 2*nnz(R)*nrhs flops at most
+    double work = 2 * ((double) Rp [nf]) * ((double) maxfrank)
+        * ((double) nrhs) ;
+    if (nf <= 1 || maxfrank == 0 || spqr_nthreads (work, cc) <= 1)
+    {
+        return (FALSE) ;
+    }
+
+    // -------------------------------------------------------------------------
+    // find the rows of each R block, and the flops
+    // -------------------------------------------------------------------------
+
+    Int *Row2 = (Int *) spqr_malloc <Int> (nf, sizeof (Int), cc) ;
+    if (cc->status < CHOLMOD_OK)
+    {
+        // out of memory; do it with one thread instead
+        cc->status = CHOLMOD_OK ;
+        return (FALSE) ;
+    }
+    Int row2 = QRnum->rank + QR->n1rows ;
+    work = 0 ;
+    for (Int f = nf-1 ; f >= 0 ; f--)
+    {
+        Row2 [f] = row2 ;
+        Int rm = spqr_private_front_rank (QR, f) ;
+        Int fp = Super [f+1] - Super [f] ;
+        Int fn = Rp [f+1] - Rp [f] ;
+        work += ((double) rm) * ((double) (rm + 2 * (fn - fp))) ;
+        row2 -= rm ;
+    }
+    int nthreads = spqr_nthreads (work * ((double) nrhs), cc) ;
+    if (nthreads <= 1)
+    {
+        spqr_free <Int> (nf, sizeof (Int), Row2, cc) ;
+        return (FALSE) ;
+    }
+
+    // -------------------------------------------------------------------------
+    // allocate workspace for each thread
+    // -------------------------------------------------------------------------
+
+    int ok = TRUE ;
+    Int rsize = spqr_mult (maxfrank, (Int) nthreads, &ok) ;
+    Int wsize = spqr_mult (rsize, nrhs, &ok) ;
+    Int bwsize = spqr_mult (bsize, (Int) nthreads, &ok) ;
+    if (!ok)
+    {
+        // problem too large; do it with one thread instead
+        spqr_free <Int> (nf, sizeof (Int), Row2, cc) ;
+        return (FALSE) ;
+    }
+
+    Entry **Rcolp_all = (Entry **) spqr_malloc <Int> (rsize,
+        sizeof (Entry *), cc) ;
+    Int *Rlive_all = (Int *) spqr_malloc <Int> (rsize, sizeof (Int), cc) ;
+    Entry *W_all = (Entry *) spqr_malloc <Int> (wsize, sizeof (Entry), cc) ;
+    Entry *Wblas_all = (bsize == 0) ? NULL :
+        ((Entry *) spqr_malloc <Int> (bwsize, sizeof (Entry), cc)) ;
+    cholmod_common *Ccommon = (cholmod_common *) spqr_malloc <Int> (nthreads,
+        sizeof (cholmod_common), cc) ;
+
+    if (cc->status < CHOLMOD_OK)
+    {
+        // out of memory; do it with one thread instead
+        spqr_free <Int> (nf, sizeof (Int), Row2, cc) ;
+        spqr_free <Int> (rsize, sizeof (Entry *), Rcolp_all, cc) ;
+        spqr_free <Int> (rsize, sizeof (Int), Rlive_all, cc) ;
+        spqr_free <Int> (wsize, sizeof (Entry), W_all, cc) ;
+        spqr_free <Int> (bwsize, sizeof (Entry), Wblas_all, cc) ;
+        spqr_free <Int> (nthreads, sizeof (cholmod_common), Ccommon, cc) ;
+        cc->status = CHOLMOD_OK ;
+        return (FALSE) ;
+    }
+
+    for (int tid = 0 ; tid < nthreads ; tid++)
+    {
+        Ccommon [tid] = *cc ;
+        Ccommon [tid].SPQR_flopcount = 0 ;
+    }
 
-        // ---------------------------------------------------------------------
-        // solve with the squeezed upper triangular part of R
-        // ---------------------------------------------------------------------
+    // -------------------------------------------------------------------------
+    // solve each tree of the frontal forest, starting at its root
+    // -------------------------------------------------------------------------
+
+    // the roots of the forest are the children of the placeholder node nf
+    Int *Childp = QRsym->Childp ;
+    Int *Child = QRsym->Child ;
+    #pragma omp parallel num_threads(nthreads)
+    #pragma omp single nowait
+    for (Int p = Childp [nf] ; p < Childp [nf+1] ; p++)
+    {
+        Int root = Child [p] ;
+        #pragma omp task firstprivate(root)
+        spqr_private_rsolve_subtree (QR, Q1fill, root, Row2, nrhs, ldb, B, X,
+            Rcolp_all, Rlive_all, W_all, Wblas_all, bsize, Ccommon) ;
+    }
+
+    // -------------------------------------------------------------------------
+    // free workspace
+    // -------------------------------------------------------------------------
+
+    for (int tid = 0 ; tid < nthreads ; tid++)
+    {
+        cc->SPQR_flopcount += Ccommon [tid].SPQR_flopcount ;
+    }
+    spqr_free <Int> (nf, sizeof (Int), Row2, cc) ;
+    spqr_free <Int> (rsize, sizeof (Entry *), Rcolp_all, cc) ;
+    spqr_free <Int> (rsize, sizeof (Int), Rlive_all, cc) ;
+    spqr_free <Int> (wsize, sizeof (Entry), W_all, cc) ;
+    spqr_free <Int> (bwsize, sizeof (Entry), Wblas_all, cc) ;
+    spqr_free <Int> (nthreads, sizeof (cholmod_common), Ccommon, cc) ;
+    return (TRUE) ;
+
+#else
+
+    return (FALSE) ;
+
+#endif
+}
+
+// =============================================================================
+// === spqr_rsolve =============================================================
+// =============================================================================
+
+template <typename Entry, typename Int> void spqr_rsolve
+(
+    // inputs
+    SuiteSparseQR_factorization <Entry, Int> *QR,
+    int use_Q1fill,         // if TRUE, do X=E*(R\B), otherwise do X=R\B
 
-        for (k = rm-1 ; k >= 0 ; k--)
+    Int nrhs,              // number of columns of B
+    Int ldb,               // leading dimension of B
+    Entry *B,               // size m-by-nrhs with leading dimesion ldb
+
+    // output
+    Entry *X,               // size n-by-nrhs with leading dimension n
+
+    // workspace
+    Entry **Rcolp,          // size QRnum->maxfrank
+    Int *Rlive,            // size QRnum->maxfrank
+    Entry *W,               // size QRnum->maxfrank * nrhs
+
+    cholmod_common *cc
+)
+{
+    spqr_symbolic <Int> *QRsym ;
+    spqr_numeric <Entry, Int> *QRnum ;
+    Int n1rows, n, nf, row2, f, i, kk ;
+    Int *Q1fill, *R1p, *R1j ;
+    Entry *R1x, *X1 ;
+
+    // -------------------------------------------------------------------------
+    // get the contents of the QR object
+    // -------------------------------------------------------------------------
+
+    QRsym = QR->QRsym ;
+    QRnum = QR->QRnum ;
+    n1rows = QR->n1rows ;
+    n = QR->nacols ;
+    Q1fill = use_Q1fill ? QR->Q1fill : NULL ;
+    R1p = QR->R1p ;
+    R1j = QR->R1j ;
+    R1x = QR->R1x ;
+    PR (("rsolve keepH %ld\n", QRnum->keepH)) ;
+    nf = QRsym->nf ;
+
+    // -------------------------------------------------------------------------
+    // X = 0
+    // -------------------------------------------------------------------------
+
+    X1 = X ;
+    for (kk = 0 ; kk < nrhs ; kk++)
+    {
+        for (i = 0 ; i < n ; i++)
         {
-            R = Rcolp [k] ;                 // kth live pivot column
-            j = Rlive [k] ;                 // is jth global column
-            ii = Q1fill ? Q1fill [j+n1cols] : j+n1cols ;
-            ASSERT ((ii < n) == (j+n1cols < n)) ;
-            if (ii < n)
-            {
-                W1 = W ;
-                for (kk = 0 ; kk < nrhs ; kk++)
-                {
-                    // divide by the "diagonal"
-                    // xi = W1 [k] / R [k] ;
-                    xi = spqr_divide (W1 [k], R [k]) ;
-                    FLOP_COUNT (1) ;
-                    X [INDEX(ii,kk,n)] = xi ;
-                    if (xi != (Entry) 0)
-                    {
-                        FLOP_COUNT (2*k) ;
-                        for (i = 0 ; i < k ; i++)
-                        {
-                            W1 [i] -= R [i] * xi ;
-                        }
-                    }
-                    W1 += rm ;
-                }
-            }
+            X1 [i] = 0 ;
         }
+        X1 += n ;
+    }
+
+    // =========================================================================
+    // === solve with the multifrontal rows of R ===============================
+    // =========================================================================
+
+    // workspace for the level-3 BLAS, if used
+    Int bsize = 0 ;
+    if (nrhs >= SPQR_RSOLVE_BLAS3)
+    {
+        int ok = TRUE ;
+        Int maxfn = QRsym->maxfn ;
+        bsize = spqr_add (spqr_mult (QRnum->maxfrank, maxfn, &ok),
+            spqr_mult (maxfn, nrhs, &ok), &ok) ;
+        if (!ok) bsize = 0 ;
+    }
 
-        // ---------------------------------------------------------------------
-        // prepare for the R block for front f-1
-        // ---------------------------------------------------------------------
+    if (!spqr_private_rsolve_parallel (QR, Q1fill, nrhs, ldb, B, bsize, X, cc))
+    {
+        Entry *Wblas = (bsize == 0) ? NULL :
+            ((Entry *) spqr_malloc <Int> (bsize, sizeof (Entry), cc)) ;
+        if (cc->status < CHOLMOD_OK)
+        {
+            // out of memory; solve without the BLAS
+            cc->status = CHOLMOD_OK ;
+        }
 
-        row2 = row1 ;
+        // start with row2 = QR-num->rank + n1rows, the last row of the
+        // combined R factor of [A Binput]
+        row2 = QRnum->rank + n1rows ;
+        for (f = nf-1 ; f >= 0 ; f--)
+        {
+            row2 = spqr_private_rsolve_front (QR, Q1fill, f, row2, nrhs, ldb,
+                B, X, Rcolp, Rlive, W, Wblas, cc) ;
+        }
+        ASSERT (row2 == n1rows) ;
+        spqr_free <Int> (bsize, sizeof (Entry), Wblas, cc) ;
     }
-    ASSERT (row2 == n1rows) ;
 
     // =========================================================================
     // === solve with the singleton rows of R ==================================
@@ -422,6 +918,46 @@ template void spqr_rsolve <Complex, int32_t>
 
     cholmod_common *cc
 ) ;
+template void spqr_rsolve <float, int32_t>
+(
+    // inputs
+    SuiteSparseQR_factorization <float, int32_t> *QR,
+    int use_Q1fill,         // if TRUE, do X=E*(R\B), otherwise do X=R\B
+
+    int32_t nrhs,              // number of columns of B
+    int32_t ldb,               // leading dimension of B
+    float *B,               // size m-by-nrhs with leading dimesion ldb
+
+    // output
+    float *X,               // size n-by-nrhs with leading dimension n
+
+    // workspace
+    float **Rcolp,          // size QRnum->maxfrank
+    int32_t *Rlive,            // size QRnum->maxfrank
+    float *W,               // size QRnum->maxfrank * nrhs
+
+    cholmod_common *cc
+) ;
+template void spqr_rsolve <FComplex, int32_t>
+(
+    // inputs
+    SuiteSparseQR_factorization <FComplex, int32_t> *QR,
+    int use_Q1fill,         // if TRUE, do X=E*(R\B), otherwise do X=R\B
+
+    int32_t nrhs,              // number of columns of B
+    int32_t ldb,               // leading dimension of B
+    FComplex *B,               // size m-by-nrhs with leading dimesion ldb
+
+    // output
+    FComplex *X,               // size n-by-nrhs with leading dimension n
+
+    // workspace
+    FComplex **Rcolp,          // size QRnum->maxfrank
+    int32_t *Rlive,            // size QRnum->maxfrank
+    FComplex *W,               // size QRnum->maxfrank * nrhs
+
+    cholmod_common *cc
+) ;
 
 template void spqr_rsolve <double, int64_t>
 (
@@ -463,3 +999,43 @@ template void spqr_rsolve <Complex, int64_t>
 
     cholmod_common *cc
 ) ;
+template void spqr_rsolve <float, int64_t>
+(
+    // inputs
+    SuiteSparseQR_factorization <float, int64_t> *QR,
+    int use_Q1fill,         // if TRUE, do X=E*(R\B), otherwise do X=R\B
+
+    int64_t nrhs,              // number of columns of B
+    int64_t ldb,               // leading dimension of B
+    float *B,               // size m-by-nrhs with leading dimesion ldb
+
+    // output
+    float *X,               // size n-by-nrhs with leading dimension n
+
+    // workspace
+    float **Rcolp,          // size QRnum->maxfrank
+    int64_t *Rlive,            // size QRnum->maxfrank
+    float *W,               // size QRnum->maxfrank * nrhs
+
+    cholmod_common *cc
+) ;
+template void spqr_rsolve <FComplex, int64_t>
+(
+    // inputs
+    SuiteSparseQR_factorization <FComplex, int64_t> *QR,
+    int use_Q1fill,         // if TRUE, do X=E*(R\B), otherwise do X=R\B
+
+    int64_t nrhs,              // number of columns of B
+    int64_t ldb,               // leading dimension of B
+    FComplex *B,               // size m-by-nrhs with leading dimesion ldb
+
+    // output
+    FComplex *X,               // size n-by-nrhs with leading dimension n
+
+    // workspace
+    FComplex **Rcolp,          // size QRnum->maxfrank
+    int64_t *Rlive,            // size QRnum->maxfrank
+    FComplex *W,               // size QRnum->maxfrank * nrhs
+
+    cholmod_common *cc
+) ;
@@ -26,7 +26,11 @@ template <typename Entry, typename Int> double spqr_tol
 {
     RETURN_IF_NULL_COMMON (EMPTY) ;
     RETURN_IF_NULL (A, EMPTY) ;
-    double tol = (20 * ((double) A->nrow + (double) A->ncol) * DBL_EPSILON *
+    // machine epsilon of the precision of Entry
+    double eps = (spqr_type <Entry> ( ) & CHOLMOD_SINGLE) ?
+        std::numeric_limits<float>::epsilon ( ) :
+        std::numeric_limits<double>::epsilon ( ) ;
+    double tol = (20 * ((double) A->nrow + (double) A->ncol) * eps *
                   spqr_maxcolnorm <Entry, Int> (A, cc));
     // MathWorks modification: if the tolerance becomes Inf, replace it with
     // realmax; otherwise, we may end up with an all-zero matrix R
@@ -52,6 +56,22 @@ template double spqr_tol <Complex, int32_t>
     // workspace and parameters
     cholmod_common *cc
 ) ;
+template double spqr_tol <float, int32_t>
+(
+    // inputs, not modified
+    cholmod_sparse *A,
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template double spqr_tol <FComplex, int32_t>
+(
+    // inputs, not modified
+    cholmod_sparse *A,
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
 
 template double spqr_tol <double, int64_t>
 (
@@ -69,3 +89,19 @@ template double spqr_tol <Complex, int64_t>
     // workspace and parameters
     cholmod_common *cc
 ) ;
+template double spqr_tol <float, int64_t>
+(
+    // inputs, not modified
+    cholmod_sparse *A,
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template double spqr_tol <FComplex, int64_t>
+(
+    // inputs, not modified
+    cholmod_sparse *A,
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
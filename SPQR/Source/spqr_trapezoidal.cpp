@@ -277,6 +277,68 @@ template int32_t spqr_trapezoidal <Complex, int32_t> // rank of R; EMPTY on fail
     // workspace and parameters
     cholmod_common *cc
 ) ;
+template int32_t spqr_trapezoidal <float, int32_t> // rank of R; EMPTY on failure
+(
+    // inputs, not modified
+
+    // FUTURE : make R and T cholmod_sparse:
+    int32_t n,         // R is m-by-n (m is not needed here; can be economy R)
+    int32_t *Rp,       // size n+1, column pointers of R
+    int32_t *Ri,       // size rnz = Rp [n], row indices of R
+    float *Rx,      // size rnz, numerical values of R
+
+    int32_t bncols,    // number of columns of B
+
+    int32_t *Qfill,    // size n+bncols, fill-reducing ordering.  Qfill [k] = j if
+                    // the jth column of A is the kth column of R.  If Qfill is
+                    // NULL, then it is assumed to be the identity
+                    // permutation.
+
+    int skip_if_trapezoidal,        // if R is already in trapezoidal form,
+                                    // and skip_if_trapezoidal is TRUE, then
+                                    // the matrix T is not created.
+
+    // outputs, not allocated on input
+    int32_t **p_Tp,    // size n+1, column pointers of T
+    int32_t **p_Ti,    // size rnz, row indices of T
+    float **p_Tx,   // size rnz, numerical values of T
+
+    int32_t **p_Qtrap,  // size n+bncols, modified Qfill
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template int32_t spqr_trapezoidal <FComplex, int32_t> // rank of R; EMPTY on failure
+(
+    // inputs, not modified
+
+    // FUTURE : make R and T cholmod_sparse:
+    int32_t n,         // R is m-by-n (m is not needed here; can be economy R)
+    int32_t *Rp,       // size n+1, column pointers of R
+    int32_t *Ri,       // size rnz = Rp [n], row indices of R
+    FComplex *Rx,      // size rnz, numerical values of R
+
+    int32_t bncols,    // number of columns of B
+
+    int32_t *Qfill,    // size n+bncols, fill-reducing ordering.  Qfill [k] = j if
+                    // the jth column of A is the kth column of R.  If Qfill is
+                    // NULL, then it is assumed to be the identity
+                    // permutation.
+
+    int skip_if_trapezoidal,        // if R is already in trapezoidal form,
+                                    // and skip_if_trapezoidal is TRUE, then
+                                    // the matrix T is not created.
+
+    // outputs, not allocated on input
+    int32_t **p_Tp,    // size n+1, column pointers of T
+    int32_t **p_Ti,    // size rnz, row indices of T
+    FComplex **p_Tx,   // size rnz, numerical values of T
+
+    int32_t **p_Qtrap,  // size n+bncols, modified Qfill
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
 
 template int64_t spqr_trapezoidal <double, int64_t> // rank of R; EMPTY on failure
 (
@@ -341,3 +403,65 @@ template int64_t spqr_trapezoidal <Complex, int64_t> // rank of R; EMPTY on fail
     // workspace and parameters
     cholmod_common *cc
 ) ;
+template int64_t spqr_trapezoidal <float, int64_t> // rank of R; EMPTY on failure
+(
+    // inputs, not modified
+
+    // FUTURE : make R and T cholmod_sparse:
+    int64_t n,         // R is m-by-n (m is not needed here; can be economy R)
+    int64_t *Rp,       // size n+1, column pointers of R
+    int64_t *Ri,       // size rnz = Rp [n], row indices of R
+    float *Rx,      // size rnz, numerical values of R
+
+    int64_t bncols,    // number of columns of B
+
+    int64_t *Qfill,    // size n+bncols, fill-reducing ordering.  Qfill [k] = j if
+                    // the jth column of A is the kth column of R.  If Qfill is
+                    // NULL, then it is assumed to be the identity
+                    // permutation.
+
+    int skip_if_trapezoidal,        // if R is already in trapezoidal form,
+                                    // and skip_if_trapezoidal is TRUE, then
+                                    // the matrix T is not created.
+
+    // outputs, not allocated on input
+    int64_t **p_Tp,    // size n+1, column pointers of T
+    int64_t **p_Ti,    // size rnz, row indices of T
+    float **p_Tx,   // size rnz, numerical values of T
+
+    int64_t **p_Qtrap,  // size n+bncols, modified Qfill
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
+template int64_t spqr_trapezoidal <FComplex, int64_t> // rank of R; EMPTY on failure
+(
+    // inputs, not modified
+
+    // FUTURE : make R and T cholmod_sparse:
+    int64_t n,         // R is m-by-n (m is not needed here; can be economy R)
+    int64_t *Rp,       // size n+1, column pointers of R
+    int64_t *Ri,       // size rnz = Rp [n], row indices of R
+    FComplex *Rx,      // size rnz, numerical values of R
+
+    int64_t bncols,    // number of columns of B
+
+    int64_t *Qfill,    // size n+bncols, fill-reducing ordering.  Qfill [k] = j if
+                    // the jth column of A is the kth column of R.  If Qfill is
+                    // NULL, then it is assumed to be the identity
+                    // permutation.
+
+    int skip_if_trapezoidal,        // if R is already in trapezoidal form,
+                                    // and skip_if_trapezoidal is TRUE, then
+                                    // the matrix T is not created.
+
+    // outputs, not allocated on input
+    int64_t **p_Tp,    // size n+1, column pointers of T
+    int64_t **p_Ti,    // size rnz, row indices of T
+    FComplex **p_Tx,   // size rnz, numerical values of T
+
+    int64_t **p_Qtrap,  // size n+bncols, modified Qfill
+
+    // workspace and parameters
+    cholmod_common *cc
+) ;
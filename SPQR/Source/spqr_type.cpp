@@ -8,7 +8,9 @@
 //------------------------------------------------------------------------------
 
 // Return the CHOLMOD type, based on the SuiteSparseQR template Entry type.
-// Note that CHOLMOD_REAL is 1 an CHOLMOD_COMPLEX is 2.
+// Note that CHOLMOD_REAL is 1 an CHOLMOD_COMPLEX is 2.  For the single
+// precision types, CHOLMOD_SINGLE is added, so the result is the xtype+dtype
+// that CHOLMOD expects when allocating a matrix.
 
 #include "spqr.hpp"
 
@@ -21,3 +23,13 @@ template <> int spqr_type <Complex> (void)
 {
     return (CHOLMOD_COMPLEX) ;
 }
+
+template <> int spqr_type <float> (void)
+{
+    return (CHOLMOD_REAL + CHOLMOD_SINGLE) ;
+}
+
+template <> int spqr_type <FComplex> (void)
+{
+    return (CHOLMOD_COMPLEX + CHOLMOD_SINGLE) ;
+}
@@ -22,6 +22,7 @@
 // complains about not understanding some of the assembly-level instructions
 // used.
 
+#include <limits>
 #include "spqr.hpp"
 #include "SuiteSparseQR_C.h"
 
@@ -196,6 +197,12 @@ int main (int argc, char **argv)
     spqr_start <Int> (cc) ;
     normal_memory_handler (cc, true) ;
 
+    // the default tol in double and single precision
+    nfail += check_default_tol <double, Int> (cc) ;
+    nfail += check_default_tol <Complex, Int> (cc) ;
+    nfail += check_default_tol <float, Int> (cc) ;
+    nfail += check_default_tol <FComplex, Int> (cc) ;
+
     if (argc == 1)
     {
 
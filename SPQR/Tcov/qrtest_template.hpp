@@ -652,6 +652,96 @@ template <typename Entry, typename Int> Int SPQR_qr
 }
 
 
+// =============================================================================
+// === SPQR_append_rows ========================================================
+// =============================================================================
+
+// wrapper for SuiteSparseQR_append_rows, optionally testing memory allocation
+
+template <typename Entry, typename Int> int SPQR_append_rows
+(
+    // arguments for SuiteSparseQR_append_rows:
+    cholmod_sparse *Anew,
+    cholmod_dense *Bnew,
+    Int *E,
+    cholmod_sparse **R,
+    cholmod_dense **C,
+    cholmod_common *cc,
+
+    // malloc control
+    int memory_test,        // if TRUE, test malloc error handling
+    int memory_punt         // if TRUE, test punt case
+)
+{
+    int ok = FALSE ;
+    if (!memory_test)
+    {
+        // just call the method directly; no memory testing
+        ok = SuiteSparseQR_append_rows <Entry,Int> (Anew, Bnew, E, R, C, cc) ;
+    }
+    else
+    {
+        // test malloc error handling; R and C are unchanged on failure
+        int64_t tries ;
+        test_memory_handler (cc, true) ;
+        my_punt = memory_punt ;
+        for (tries = 0 ; my_tries < 0 ; tries++)
+        {
+            my_tries = tries ;
+            ok = SuiteSparseQR_append_rows <Entry,Int> (Anew, Bnew, E, R, C,
+                cc) ;
+            if (cc->status == CHOLMOD_OK) break ;
+        }
+        normal_memory_handler (cc, true) ;
+    }
+    return (ok) ;
+}
+
+
+// =============================================================================
+// === SPQR_csne ===============================================================
+// =============================================================================
+
+// wrapper for SuiteSparseQR_csne, optionally testing memory allocation
+
+template <typename Entry, typename Int> cholmod_dense *SPQR_csne
+(
+    // arguments for SuiteSparseQR_csne:
+    cholmod_sparse *A,
+    cholmod_sparse *R,
+    Int *E,
+    cholmod_dense *B,
+    cholmod_common *cc,
+
+    // malloc control
+    int memory_test,        // if TRUE, test malloc error handling
+    int memory_punt         // if TRUE, test punt case
+)
+{
+    cholmod_dense *X = NULL ;
+    if (!memory_test)
+    {
+        // just call the method directly; no memory testing
+        X = SuiteSparseQR_csne <Entry,Int> (A, R, E, B, cc) ;
+    }
+    else
+    {
+        // test malloc error handling
+        int64_t tries ;
+        test_memory_handler (cc, true) ;
+        my_punt = memory_punt ;
+        for (tries = 0 ; my_tries < 0 ; tries++)
+        {
+            my_tries = tries ;
+            X = SuiteSparseQR_csne <Entry,Int> (A, R, E, B, cc) ;
+            if (cc->status == CHOLMOD_OK) break ;
+        }
+        normal_memory_handler (cc, true) ;
+    }
+    return (X) ;
+}
+
+
 // =============================================================================
 // === my_rand =================================================================
 // =============================================================================
@@ -977,6 +1067,81 @@ template <typename Entry, typename Int> cholmod_sparse *permute_columns
 }
 
 
+// =============================================================================
+// === split_rows ==============================================================
+// =============================================================================
+
+// A1 = A(0:m1-1,:) and A2 = A(m1:m-1,:), and the same for B (m-by-nb)
+
+template <typename Entry, typename Int> void split_rows
+(
+    cholmod_sparse *A,
+    cholmod_dense *B,
+    Int m1,
+    cholmod_sparse **A1,
+    cholmod_sparse **A2,
+    cholmod_dense **B1,
+    cholmod_dense **B2,
+    cholmod_common *cc
+)
+{
+    Int m = A->nrow ;
+    Int n = A->ncol ;
+    Int nb = B->ncol ;
+    Int nz = spqr_nnz <Int> (A, cc) ;
+    int xtype = spqr_type <Entry> ( ) ;
+    Int *Ap = (Int *) A->p ;
+    Int *Ai = (Int *) A->i ;
+    Entry *Ax = (Entry *) A->x ;
+    Entry *Bx = (Entry *) B->x ;
+    cholmod_sparse *S [2] ;
+    cholmod_dense *D [2] ;
+
+    S [0] = spqr_allocate_sparse <Int> (m1, n, nz, TRUE, TRUE, 0, xtype, cc) ;
+    S [1] = spqr_allocate_sparse <Int> (m-m1, n, nz, TRUE, TRUE, 0, xtype, cc) ;
+    D [0] = spqr_zeros <Int> (m1, nb, xtype, cc) ;
+    D [1] = spqr_zeros <Int> (m-m1, nb, xtype, cc) ;
+
+    for (int t = 0 ; t < 2 ; t++)
+    {
+        Int *Sp = (Int *) S [t]->p ;
+        Int *Si = (Int *) S [t]->i ;
+        Entry *Sx = (Entry *) S [t]->x ;
+        Entry *Dx = (Entry *) D [t]->x ;
+        Int i1 = (t == 0) ? 0 : m1 ;
+        Int i2 = (t == 0) ? m1 : m ;
+        Int snz = 0 ;
+        for (Int j = 0 ; j < n ; j++)
+        {
+            Sp [j] = snz ;
+            for (Int p = Ap [j] ; p < Ap [j+1] ; p++)
+            {
+                Int i = Ai [p] ;
+                if (i >= i1 && i < i2)
+                {
+                    Si [snz] = i - i1 ;
+                    Sx [snz] = Ax [p] ;
+                    snz++ ;
+                }
+            }
+        }
+        Sp [n] = snz ;
+        for (Int k = 0 ; k < nb ; k++)
+        {
+            for (Int i = i1 ; i < i2 ; i++)
+            {
+                Dx [(i-i1) + k*(i2-i1)] = Bx [i + k*m] ;
+            }
+        }
+    }
+
+    *A1 = S [0] ;
+    *A2 = S [1] ;
+    *B1 = D [0] ;
+    *B2 = D [1] ;
+}
+
+
 // =============================================================================
 // === sparse_multiply =========================================================
 // =============================================================================
@@ -1354,9 +1519,9 @@ template <typename Entry, typename Int> double check_qmult
 )
 {
     cholmod_sparse *Q, *QT, *Xsparse, *Ssparse, *Zsparse ;
-    cholmod_dense *Xdense, *Zdense, *Sdense, *Ydense ;
+    cholmod_dense *Xdense, *Zdense, *Sdense, *Ydense, *Wdense ;
     int xtype = spqr_type <Entry> ( ) ;
-    Entry *X, *Y, *Z, *S ;
+    Entry *X, *Y, *Z, *S, *W ;
     double err, maxerr = 0 ;
     double one [2] = {1,0}, zero [2] = {0,0} ;
     Entry range = (Entry) 1.0 ;
@@ -1410,6 +1575,27 @@ template <typename Entry, typename Int> double check_qmult
                 }
                 maxerr = MAX (maxerr, err) ;
 
+                // Y = Q'*X or Q*X again, with the columns of X split
+                // between several threads
+                int save_nthreads = cc->SPQR_nthreads ;
+                double save_chunk = cc->chunk ;
+                cc->SPQR_nthreads = 4 ;
+                cc->chunk = 1 ;
+                Wdense = SuiteSparseQR_qmult <Entry,Int> (method, H, HTau,
+                    HPinv, Xdense, cc) ;
+                cc->SPQR_nthreads = save_nthreads ;
+                cc->chunk = save_chunk ;
+                W = (Entry *) Wdense->x ;
+
+                for (err = 0, k = 0 ; k < xsize ; k++)
+                {
+                    double e1 = spqr_abs (W [k] - Z [k]) ;
+                    e1 = CHECK_NAN (e1) ;
+                    err = MAX (err, e1) ;
+                }
+                maxerr = MAX (maxerr, err) ;
+                spqr_free_dense <Int> (&Wdense, cc) ;
+
                 // S = Q'*Xsparse or Q*Xsparse
                 Ssparse = SPQR_qmult <Entry,Int> (
                     method, H, HTau, HPinv, Xsparse, cc, m < 300, nrand (2)) ;
@@ -1645,6 +1831,270 @@ template <typename Entry, typename Int> cholmod_dense *transpose
     return (Ydense) ;
 }
 
+// =============================================================================
+// === check_qmult_threads =====================================================
+// =============================================================================
+
+// Compare Q'*B, Q*B, B'*Q', and B'*Q with one thread and with several, using
+// the Q held in the QR object.
+
+template <typename Entry, typename Int> double check_qmult_threads
+(
+    SuiteSparseQR_factorization <Entry, Int> *QR,
+    cholmod_dense *Bdense,
+    cholmod_common *cc
+)
+{
+    cholmod_dense *BT, *Xdense, *Y1dense, *Y2dense ;
+    Entry *Y1, *Y2 ;
+    double err, maxerr = 0 ;
+    Int k ;
+    int save_nthreads = cc->SPQR_nthreads ;
+    double save_chunk = cc->chunk ;
+
+    BT = transpose <Entry,Int> (Bdense, cc) ;
+    for (int method = 0 ; method <= 3 ; method++)
+    {
+        Xdense = (method <= SPQR_QX) ? Bdense : BT ;
+        cc->SPQR_nthreads = 1 ;
+        Y1dense = SuiteSparseQR_qmult <Entry,Int> (method, QR, Xdense, cc) ;
+        cc->SPQR_nthreads = 4 ;
+        cc->chunk = 1 ;
+        Y2dense = SuiteSparseQR_qmult <Entry,Int> (method, QR, Xdense, cc) ;
+        cc->chunk = save_chunk ;
+        if (Y1dense == NULL || Y2dense == NULL)
+        {
+            maxerr = 1 ;
+        }
+        else
+        {
+            Y1 = (Entry *) Y1dense->x ;
+            Y2 = (Entry *) Y2dense->x ;
+            Int ysize = Y1dense->nrow * Y1dense->ncol ;
+            for (err = 0, k = 0 ; k < ysize ; k++)
+            {
+                double e1 = spqr_abs (Y1 [k] - Y2 [k]) ;
+                e1 = CHECK_NAN (e1) ;
+                err = MAX (err, e1) ;
+            }
+            maxerr = MAX (maxerr, err) ;
+        }
+        spqr_free_dense <Int> (&Y1dense, cc) ;
+        spqr_free_dense <Int> (&Y2dense, cc) ;
+    }
+    cc->SPQR_nthreads = save_nthreads ;
+    spqr_free_dense <Int> (&BT, cc) ;
+    return (CHECK_NAN (maxerr)) ;
+}
+
+// =============================================================================
+// === check_rsolve_threads ====================================================
+// =============================================================================
+
+// Compare E*(R\B) with one thread and with the fronts solved in parallel, for
+// one right-hand side and for several (which uses the BLAS), with the R of
+// the QR object and with the R of the Q-less QR in x=A\b.
+
+template <typename Entry, typename Int> double check_rsolve_threads
+(
+    SuiteSparseQR_factorization <Entry, Int> *QR,
+    int ordering,
+    double tol,
+    cholmod_sparse *A,
+    cholmod_dense *Bdense,
+    cholmod_common *cc
+)
+{
+    cholmod_dense *B1dense, *X1dense, *X2dense ;
+    Entry *X1, *X2 ;
+    double err, maxerr = 0 ;
+    Int k ;
+    int save_nthreads = cc->SPQR_nthreads ;
+    double save_chunk = cc->chunk ;
+
+    // B1 = B (:,0)
+    B1dense = spqr_zeros <Int> (Bdense->nrow, 1, Bdense->xtype, cc) ;
+    for (k = 0 ; k < (Int) Bdense->nrow ; k++)
+    {
+        ((Entry *) B1dense->x) [k] = ((Entry *) Bdense->x) [k] ;
+    }
+
+    for (int trial = 0 ; trial <= 3 ; trial++)
+    {
+        cholmod_dense *Y = (trial % 2) ? Bdense : B1dense ;
+        for (int t = 0 ; t <= 1 ; t++)
+        {
+            cc->SPQR_nthreads = t ? 4 : 1 ;
+            cc->chunk = t ? 1 : save_chunk ;
+            cholmod_dense *Xt = (trial < 2) ?
+                SuiteSparseQR_solve <Entry,Int> (SPQR_RETX_EQUALS_B, QR, Y,
+                    cc) :
+                SuiteSparseQR <Entry,Int> (ordering, tol, A, Y, cc) ;
+            if (t == 0) X1dense = Xt ; else X2dense = Xt ;
+        }
+        cc->SPQR_nthreads = save_nthreads ;
+        cc->chunk = save_chunk ;
+        if (X1dense == NULL || X2dense == NULL)
+        {
+            maxerr = 1 ;
+        }
+        else
+        {
+            X1 = (Entry *) X1dense->x ;
+            X2 = (Entry *) X2dense->x ;
+            // X can be Inf or NaN if R has a zero on the diagonal; it must
+            // be so in both solutions
+            Int xsize = X1dense->nrow * X1dense->ncol ;
+            double xnorm = 1 ;
+            for (k = 0 ; k < xsize ; k++)
+            {
+                double a1 = spqr_abs (X1 [k]) ;
+                if (a1 < INF) xnorm = MAX (xnorm, a1) ;
+            }
+            for (err = 0, k = 0 ; k < xsize ; k++)
+            {
+                double a1 = spqr_abs (X1 [k]) ;
+                double a2 = spqr_abs (X2 [k]) ;
+                int finite1 = (a1 < INF) ;
+                int finite2 = (a2 < INF) ;
+                double e1 ;
+                if (finite1 && finite2)
+                {
+                    e1 = spqr_abs (X1 [k] - X2 [k]) / xnorm ;
+                }
+                else
+                {
+                    e1 = (finite1 == finite2) ? 0 : INF ;
+                }
+                e1 = CHECK_NAN (e1) ;
+                err = MAX (err, e1) ;
+            }
+            maxerr = MAX (maxerr, err) ;
+        }
+        spqr_free_dense <Int> (&X1dense, cc) ;
+        spqr_free_dense <Int> (&X2dense, cc) ;
+    }
+    spqr_free_dense <Int> (&B1dense, cc) ;
+    return (CHECK_NAN (maxerr)) ;
+}
+
+// =============================================================================
+// === check_best_threads ======================================================
+// =============================================================================
+
+// Compare the orderings found by 8:best or 9:bestamd with one thread and with
+// the methods tried in parallel, with singletons (spqr_1colamd) and without
+// (spqr_analyze).
+
+template <typename Entry, typename Int> double check_best_threads
+(
+    int ordering,
+    double tol,
+    cholmod_sparse *A,
+    cholmod_common *cc
+)
+{
+    SuiteSparseQR_factorization <Entry, Int> *QR [2] ;
+    Int *Q [2], used [2] ;
+    Int n = A->ncol ;
+    double err = 0 ;
+    int save_nthreads = cc->SPQR_nthreads ;
+    double save_chunk = cc->chunk ;
+
+    for (int split = 0 ; split <= 1 ; split++)
+    {
+        for (int t = 0 ; t <= 1 ; t++)
+        {
+            cc->SPQR_nthreads = t ? 4 : 1 ;
+            cc->chunk = t ? 1 : save_chunk ;
+            QR [t] = split ?
+                SuiteSparseQR_symbolic <Entry,Int> (ordering, TRUE, A, cc) :
+                SuiteSparseQR_factorize <Entry,Int> (ordering, tol, A, cc) ;
+            used [t] = cc->SPQR_istat [7] ;
+            Q [t] = (QR [t] == NULL) ? NULL :
+                (split ? QR [t]->QRsym->Qfill : QR [t]->Q1fill) ;
+        }
+        cc->SPQR_nthreads = save_nthreads ;
+        cc->chunk = save_chunk ;
+        if (QR [0] == NULL || QR [1] == NULL || used [0] != used [1]
+            || (Q [0] == NULL) != (Q [1] == NULL))
+        {
+            err = 1 ;
+        }
+        else if (Q [0] != NULL)
+        {
+            for (Int k = 0 ; k < n ; k++)
+            {
+                if (Q [0][k] != Q [1][k]) err = 1 ;
+            }
+        }
+        SuiteSparseQR_free <Entry,Int> (&QR [0], cc) ;
+        SuiteSparseQR_free <Entry,Int> (&QR [1], cc) ;
+    }
+    return (err) ;
+}
+
+
+// SPQR_ORDERING_CHOLMOD with more than one method in cc tries the methods in
+// parallel, and then analyzes the best one as a given ordering.  Check that
+// the ordering settings of cc are left unchanged, by calling SPQR twice on
+// the same cc, and that both calls find the same ordering.
+
+template <typename Entry, typename Int> double check_cholmod_methods
+(
+    cholmod_sparse *A,
+    cholmod_common *cc
+)
+{
+    SuiteSparseQR_factorization <Entry, Int> *QR [2] ;
+    Int n = A->ncol ;
+    double err = 0 ;
+    int save_nthreads = cc->SPQR_nthreads ;
+    double save_chunk = cc->chunk ;
+    int save_nmethods = cc->nmethods ;
+    int save_order [CHOLMOD_MAXMETHODS+1] ;
+    for (int k = 0 ; k <= CHOLMOD_MAXMETHODS ; k++)
+    {
+        save_order [k] = cc->method [k].ordering ;
+    }
+
+    cc->nmethods = 2 ;
+    cc->method [0].ordering = CHOLMOD_AMD ;
+    cc->method [1].ordering = CHOLMOD_COLAMD ;
+    cc->SPQR_nthreads = 4 ;
+    cc->chunk = 1 ;
+    for (int t = 0 ; t <= 1 ; t++)
+    {
+        QR [t] = SuiteSparseQR_symbolic <Entry,Int> (SPQR_ORDERING_CHOLMOD,
+            TRUE, A, cc) ;
+        if (QR [t] == NULL || cc->nmethods != 2 ||
+            cc->method [0].ordering != CHOLMOD_AMD ||
+            cc->method [1].ordering != CHOLMOD_COLAMD)
+        {
+            err = 1 ;
+        }
+    }
+    if (err == 0)
+    {
+        for (Int k = 0 ; k < n ; k++)
+        {
+            if (QR [0]->QRsym->Qfill [k] != QR [1]->QRsym->Qfill [k]) err = 1 ;
+        }
+    }
+    SuiteSparseQR_free <Entry,Int> (&QR [0], cc) ;
+    SuiteSparseQR_free <Entry,Int> (&QR [1], cc) ;
+
+    cc->SPQR_nthreads = save_nthreads ;
+    cc->chunk = save_chunk ;
+    cc->nmethods = save_nmethods ;
+    for (int k = 0 ; k <= CHOLMOD_MAXMETHODS ; k++)
+    {
+        cc->method [k].ordering = save_order [k] ;
+    }
+    return (err) ;
+}
+
+
 // =============================================================================
 // === qrtest ==================================================================
 // =============================================================================
@@ -1727,7 +2177,7 @@ template <typename Entry, typename Int> void qrtest
 
     econ = m ;
 
-    for (ordering = 0 ; ordering <= 9 ; ordering++)
+    for (ordering = 0 ; ordering <= 10 ; ordering++)
     {
 
         // skip SPQR_ORDERING_GIVEN, unless the matrix is tiny
@@ -1965,10 +2415,98 @@ template <typename Entry, typename Int> void qrtest
             printf ("order %d : R'R-(A*E)'*(A*E), Err3:  %g\n", ordering, err) ;
             maxerr = MAX (maxerr, err) ;
 
+            // X = A\B by the corrected seminormal equations, with R alone, and
+            // check norm (A*x-b); only sure to be accurate if A has full rank
+            Xdense = SPQR_csne <Entry,Int> (A, R, Qfill, Bdense, cc,
+                m < 300, nrand (2)) ;
+            resid = dense_resid <Entry,Int> (A, anorm, Xdense, nb, B, cc) ;
+            if (rank == n)
+            {
+                maxresid [m>n][which] = MAX (maxresid [m>n][which], resid) ;
+            }
+            printf ("Resid11 %d %d %d : %g\n", m>n, (int) ntol,
+                ordering, resid) ;
+            spqr_free_dense <Int> (&Xdense, cc) ;
+
+            if (ordering == 0 && tol == SPQR_DEFAULT_TOL)
+            {
+                // error handling
+                cholmod_dense *Y = spqr_zeros <Int> (m+1, 1, xtype, cc) ;
+                printf ("Error handling ... expect 1 error message: \n") ;
+                err = (SuiteSparseQR_csne <Entry,Int> (A, R, Qfill, Y, cc)
+                    != NULL) ;
+                spqr_free_dense <Int> (&Y, cc) ;
+                printf ("order %d : csne errors       Err22: %g\n",
+                    ordering, err) ;
+                maxerr = MAX (maxerr, err) ;
+            }
+
             spqr_free_dense <Int> (&Cdense, cc) ;
             spqr_free_sparse <Int> (&R, cc) ;
             spqr_free <Int> (n+nb, sizeof (Int), Qfill, cc) ;
 
+            // -----------------------------------------------------------------
+            // [C,R,E] = qr (A1,B1), then append the rows [A2 B2]
+            // -----------------------------------------------------------------
+
+            if (m > 1)
+            {
+                cholmod_sparse *A1, *A2 ;
+                cholmod_dense *B1, *B2 ;
+                split_rows <Entry,Int> (A, Bdense, m/2, &A1, &A2, &B1, &B2,
+                    cc) ;
+                SuiteSparseQR <Entry, Int> (ordering, tol, econ, A1, B1,
+                    &Cdense, &R, &Qfill, cc) ;
+                int ok = SPQR_append_rows <Entry,Int> (A2, B2, Qfill, &R,
+                    &Cdense, cc, m < 300, nrand (2)) ;
+
+                // check that R'*R = (A*E)'*(A*E)
+                err = ok ? check_r_factor <Entry,Int> (R, A, Qfill, cc) : 1 ;
+                printf ("order %d : append rows       Err18: %g\n",
+                    ordering, err) ;
+                maxerr = MAX (maxerr, err) ;
+
+                // X = E*(R\C) and check norm (A*x-b); R is only sure to be
+                // well-conditioned if A has full column rank
+                Xdense = SuiteSparseQR_rsolve <Entry,Int> (R, Qfill, Cdense,
+                    cc) ;
+                resid = dense_resid <Entry,Int> (A, anorm, Xdense, nb, B, cc) ;
+                if (rank == n)
+                {
+                    maxresid [m>n][which] = MAX (maxresid [m>n][which], resid) ;
+                }
+                printf ("Resid10 %d %d %d : %g\n", m>n, (int) ntol,
+                    ordering, resid) ;
+                spqr_free_dense <Int> (&Xdense, cc) ;
+
+                if (ordering == 0 && tol == SPQR_DEFAULT_TOL)
+                {
+                    // R alone, and error handling
+                    ok = SuiteSparseQR_append_rows <Entry,Int> (A2, NULL,
+                        Qfill, &R, NULL, cc) ;
+                    err = !ok ;
+                    printf ("Error handling ... expect 2 error messages: \n");
+                    err += SuiteSparseQR_append_rows <Entry,Int> (A, B2,
+                        Qfill, &R, &Cdense, cc) ;
+                    cholmod_dense *Y = spqr_zeros <Int> (R->nrow+1, 1, xtype,
+                        cc) ;
+                    err += (SuiteSparseQR_rsolve <Entry,Int> (R, Qfill, Y, cc)
+                        != NULL) ;
+                    spqr_free_dense <Int> (&Y, cc) ;
+                    printf ("order %d : error handling    Err19: %g\n",
+                        ordering, err) ;
+                    maxerr = MAX (maxerr, err) ;
+                }
+
+                spqr_free_dense <Int> (&Cdense, cc) ;
+                spqr_free_sparse <Int> (&R, cc) ;
+                spqr_free <Int> (n+nb, sizeof (Int), Qfill, cc) ;
+                spqr_free_sparse <Int> (&A1, cc) ;
+                spqr_free_sparse <Int> (&A2, cc) ;
+                spqr_free_dense <Int> (&B1, cc) ;
+                spqr_free_dense <Int> (&B2, cc) ;
+            }
+
             // -----------------------------------------------------------------
             // [C,R,E] = qr (A,B) where C and B are sparse, simple wrapper
             // -----------------------------------------------------------------
@@ -2139,6 +2677,26 @@ template <typename Entry, typename Int> void qrtest
                 (int) rank, (int) rank1, err) ;
             maxerr = MAX (maxerr, err) ;
 
+            // -----------------------------------------------------------------
+            // best-of orderings, with the methods tried in parallel
+            // -----------------------------------------------------------------
+
+            if ((ordering == SPQR_ORDERING_BEST || ordering == SPQR_ORDERING_BESTAMD)
+                && tol == SPQR_DEFAULT_TOL)
+            {
+                err = check_best_threads <Entry,Int> (ordering, tol, A, cc) ;
+                printf ("order %d : best threads      Err20: %g\n",
+                    ordering, err) ;
+                maxerr = MAX (maxerr, err) ;
+                if (ordering == SPQR_ORDERING_BEST)
+                {
+                    err = check_cholmod_methods <Entry,Int> (A, cc) ;
+                    printf ("order %d : cholmod methods   Err23: %g\n",
+                        ordering, err) ;
+                    maxerr = MAX (maxerr, err) ;
+                }
+            }
+
             // -----------------------------------------------------------------
             // [C,H,R,E] = qr (A)
             // -----------------------------------------------------------------
@@ -2267,6 +2825,19 @@ template <typename Entry, typename Int> void qrtest
                 spqr_free_dense <Int> (&Xdense, cc) ;
                 spqr_free_dense <Int> (&Ydense, cc) ;
 
+                // compare qmult with one thread and with several
+                err = check_qmult_threads <Entry,Int> (QR, Bdense, cc) ;
+                printf ("order %d : qmult threads     Err17: %g\n",
+                    ordering, err) ;
+                maxerr = MAX (maxerr, err) ;
+
+                // compare R\B with one thread and with several
+                err = check_rsolve_threads <Entry,Int> (QR, ordering, tol, A,
+                    Bdense, cc) ;
+                printf ("order %d : rsolve threads    Err21: %g\n",
+                    ordering, err) ;
+                maxerr = MAX (maxerr, err) ;
+
                 // -------------------------------------------------------------
                 // error testing
                 // -------------------------------------------------------------
@@ -2518,6 +3089,74 @@ template <typename Entry, typename Int> void qrtest
     errs [4] = CHECK_NAN (maxresid [1][1]) ;
 }
 
+// =============================================================================
+// === check_default_tol =======================================================
+// =============================================================================
+
+// The default tol must use the epsilon of the precision of Entry.  A is 5-by-3
+// with A(:,2) = A(:,0) + A(:,1) rounded to Entry, so the rank of A is 2 if the
+// rounding error is below the default tol, in single as well as in double
+// precision.  Returns the number of failures.
+
+template <typename Entry, typename Int> int check_default_tol
+(
+    cholmod_common *cc
+)
+{
+    Int m = 5, n = 3 ;
+    double eps = (spqr_type <Entry> ( ) & CHOLMOD_SINGLE) ?
+        std::numeric_limits<float>::epsilon ( ) :
+        std::numeric_limits<double>::epsilon ( ) ;
+    cholmod_sparse *A = spqr_allocate_sparse <Int> (m, n, m*n, TRUE, TRUE, 0,
+        spqr_type <Entry> ( ), cc) ;
+    if (A == NULL) return (1) ;
+    Int *Ap = (Int *) A->p ;
+    Int *Ai = (Int *) A->i ;
+    Entry *Ax = (Entry *) A->x ;
+    double maxnorm = 0 ;
+    for (Int j = 0 ; j < n ; j++)
+    {
+        Ap [j] = j*m ;
+        double norm = 0 ;
+        for (Int i = 0 ; i < m ; i++)
+        {
+            Int p = j*m + i ;
+            Ai [p] = i ;
+            if (j < 2)
+            {
+                Ax [p] = (Entry) (0.1 * (double) (i + 1) + (double) (j*i*i)) ;
+            }
+            else
+            {
+                Ax [p] = Ax [i] + Ax [m + i] ;
+            }
+            norm += spqr_abs (Ax [p]) * spqr_abs (Ax [p]) ;
+        }
+        maxnorm = MAX (maxnorm, sqrt (norm)) ;
+    }
+    Ap [n] = m*n ;
+
+    cholmod_sparse *R = NULL ;
+    Int *E = NULL ;
+    Int rank = SuiteSparseQR <Entry, Int> (SPQR_ORDERING_DEFAULT,
+        SPQR_DEFAULT_TOL, m, A, &R, &E, cc) ;
+    double tol = 20 * (double) (m + n) * eps * maxnorm ;
+    double err = fabs (cc->SPQR_tol_used - tol) / tol ;
+    printf ("default tol: %g (expected %g), rank %d\n", cc->SPQR_tol_used,
+        tol, (int) rank) ;
+    int nfail = (R == NULL || err > 1e-3 || rank != 2) ;
+    if (nfail)
+    {
+        fprintf (stderr, "default tol %g (expected %g), rank %d : FAIL\n",
+            cc->SPQR_tol_used, tol, (int) rank) ;
+    }
+
+    spqr_free_sparse <Int> (&R, cc) ;
+    spqr_free <Int> (n, sizeof (Int), E, cc) ;
+    spqr_free_sparse <Int> (&A, cc) ;
+    return (nfail) ;
+}
+
 // =============================================================================
 // === do_matrix2 ==============================================================
 // =============================================================================
@@ -13,6 +13,11 @@
 
 #include "SuiteSparse_config.h"
 
+/* the wrappers are defined here, not their call-site macros */
+#undef SuiteSparse_malloc
+#undef SuiteSparse_calloc
+#undef SuiteSparse_realloc
+
 /* -------------------------------------------------------------------------- */
 /* SuiteSparse_config : a static struct */
 /* -------------------------------------------------------------------------- */
@@ -176,21 +181,30 @@ void SuiteSparse_config_divcomplex_func_set (int (*divcomplex_func) (double, dou
 
 void *SuiteSparse_config_malloc (size_t s)
 {
-    return (SuiteSparse_config.malloc_func (s)) ;
+    void *p = SuiteSparse_config.malloc_func (s) ;
+    SuiteSparse_memstats_malloc (p, s, NULL, 0) ;
+    return (p) ;
 }
 
 void *SuiteSparse_config_calloc (size_t n, size_t s)
 {
-    return (SuiteSparse_config.calloc_func (n, s)) ;
+    void *p = SuiteSparse_config.calloc_func (n, s) ;
+    SuiteSparse_memstats_malloc (p, n * s, NULL, 0) ;
+    return (p) ;
 }
 
 void *SuiteSparse_config_realloc (void *p, size_t s)
 {
+    if (SuiteSparse_memstats_mode ( ) != SUITESPARSE_MEMSTATS_OFF)
+    {
+        return (SuiteSparse_memstats_realloc (p, s, NULL, 0)) ;
+    }
     return (SuiteSparse_config.realloc_func (p, s)) ;
 }
 
 void SuiteSparse_config_free (void *p)
 {
+    SuiteSparse_memstats_free (p) ;
     SuiteSparse_config.free_func (p) ;
 }
 
@@ -297,6 +311,17 @@ void *SuiteSparse_malloc    /* pointer to allocated block of memory */
     size_t nitems,          /* number of items to malloc */
     size_t size_of_item     /* sizeof each item */
 )
+{
+    return (SuiteSparse_malloc_site (nitems, size_of_item, NULL, 0)) ;
+}
+
+void *SuiteSparse_malloc_site
+(
+    size_t nitems,          /* number of items to malloc */
+    size_t size_of_item,    /* sizeof each item */
+    const char *file,       /* file of the call site, or NULL */
+    int line                /* line of the call site */
+)
 {
     void *p ;
     size_t size ;
@@ -312,6 +337,7 @@ void *SuiteSparse_malloc    /* pointer to allocated block of memory */
     else
     {
         p = (void *) (SuiteSparse_config.malloc_func) (size) ;
+        SuiteSparse_memstats_malloc (p, size, file, line) ;
     }
     return (p) ;
 }
@@ -325,6 +351,17 @@ void *SuiteSparse_calloc    /* pointer to allocated block of memory */
     size_t nitems,          /* number of items to calloc */
     size_t size_of_item     /* sizeof each item */
 )
+{
+    return (SuiteSparse_calloc_site (nitems, size_of_item, NULL, 0)) ;
+}
+
+void *SuiteSparse_calloc_site
+(
+    size_t nitems,          /* number of items to calloc */
+    size_t size_of_item,    /* sizeof each item */
+    const char *file,       /* file of the call site, or NULL */
+    int line                /* line of the call site */
+)
 {
     void *p ;
     size_t size ;
@@ -340,6 +377,7 @@ void *SuiteSparse_calloc    /* pointer to allocated block of memory */
     else
     {
         p = (void *) (SuiteSparse_config.calloc_func) (nitems, size_of_item) ;
+        SuiteSparse_memstats_malloc (p, size, file, line) ;
     }
     return (p) ;
 }
@@ -365,6 +403,21 @@ void *SuiteSparse_realloc   /* pointer to reallocated block of memory, or
     void *p,                /* old object to reallocate */
     int *ok                 /* 1 if successful, 0 otherwise */
 )
+{
+    return (SuiteSparse_realloc_site (nitems_new, nitems_old, size_of_item,
+        p, ok, NULL, 0)) ;
+}
+
+void *SuiteSparse_realloc_site
+(
+    size_t nitems_new,      /* new number of items in the object */
+    size_t nitems_old,      /* old number of items in the object */
+    size_t size_of_item,    /* sizeof each item */
+    void *p,                /* old object to reallocate */
+    int *ok,                /* 1 if successful, 0 otherwise */
+    const char *file,       /* file of the call site, or NULL */
+    int line                /* line of the call site */
+)
 {
     size_t size ;
     if (nitems_old < 1) nitems_old = 1 ;
@@ -380,7 +433,7 @@ void *SuiteSparse_realloc   /* pointer to reallocated block of memory, or
     else if (p == NULL)
     {
         /* a fresh object is being allocated */
-        p = SuiteSparse_malloc (nitems_new, size_of_item) ;
+        p = SuiteSparse_malloc_site (nitems_new, size_of_item, file, line) ;
         (*ok) = (p != NULL) ;
     }
     else if (nitems_old == nitems_new)
@@ -392,7 +445,15 @@ void *SuiteSparse_realloc   /* pointer to reallocated block of memory, or
     {
         /* change the size of the object from nitems_old to nitems_new */
         void *pnew ;
-        pnew = (void *) (SuiteSparse_config.realloc_func) (p, size) ;
+        if (SuiteSparse_memstats_mode ( ) != SUITESPARSE_MEMSTATS_OFF)
+        {
+            /* reallocate the block and update its memory accounting */
+            pnew = SuiteSparse_memstats_realloc (p, size, file, line) ;
+        }
+        else
+        {
+            pnew = (void *) (SuiteSparse_config.realloc_func) (p, size) ;
+        }
         if (pnew == NULL)
         {
             if (nitems_new < nitems_old)
@@ -428,6 +489,7 @@ void *SuiteSparse_free      /* always returns NULL */
 {
     if (p)
     {
+        SuiteSparse_memstats_free (p) ;
         (SuiteSparse_config.free_func) (p) ;
     }
     return (NULL) ;
@@ -2245,6 +2245,119 @@ void SUITESPARSE_LAPACK_CLARF
     }                                                                         \
 }
 
+//------------------------------------------------------------------------------
+// BLAS thread control
+//------------------------------------------------------------------------------
+
+// The BLAS library found by SuiteSparseBLAS.cmake is recorded at configure
+// time as the compile definition BLAS_<vendor> (BLAS_OpenBLAS, for example).
+// For Intel MKL, OpenBLAS, and BLIS, this selects the function that sets the
+// number of threads used by the BLAS:
+//
+// SUITESPARSE_BLAS_set_num_threads (nt): set the number of BLAS threads for
+//      the whole process.
+//
+// SUITESPARSE_BLAS_set_num_threads_local (nt): set the number of BLAS threads
+//      for the calling thread only (Intel MKL only; nt = 0 reverts to the
+//      setting for the process).  This is the same as
+//      SUITESPARSE_BLAS_set_num_threads for other BLAS libraries, and
+//      SUITESPARSE_BLAS_THREADS_LOCAL is then 0.
+//
+// SUITESPARSE_BLAS_get_num_threads: the number of BLAS threads for the whole
+//      process, or 0 if it is not known.  A package that changes the number
+//      of BLAS threads for its own use can restore it with this value.
+//
+// SUITESPARSE_BLAS_THREADS (work, ntasks, saved): set the number of BLAS
+//      threads for a call that does about "work" flops, while "ntasks" tasks
+//      call the BLAS at the same time, from the thread budget (see
+//      SuiteSparse_BLAS_threads below).  The int "saved" is set to the number
+//      of BLAS threads in use before the call, or to -1 if the number was not
+//      changed (the budget has not been set, for example).
+//
+// SUITESPARSE_BLAS_THREADS_RESTORE (saved): put back the number of BLAS
+//      threads saved by SUITESPARSE_BLAS_THREADS, once the BLAS call returns.
+//
+// All of these do nothing for any other BLAS library.
+
+#if defined ( BLAS_Intel10_64ilp ) || defined ( BLAS_Intel10_64lp ) || \
+    defined ( BLAS_Intel10_32 ) || defined ( BLAS_Intel10_64_dyn )
+
+    // Intel MKL
+    void MKL_Set_Num_Threads (int nt) ;
+    int MKL_Set_Num_Threads_Local (int nt) ;
+    int MKL_Get_Max_Threads (void) ;
+    #define SUITESPARSE_BLAS_set_num_threads(nt) MKL_Set_Num_Threads (nt)
+    #define SUITESPARSE_BLAS_get_num_threads MKL_Get_Max_Threads ( )
+    #define SUITESPARSE_BLAS_set_num_threads_local(nt) \
+        ((void) MKL_Set_Num_Threads_Local (nt))
+    #define SUITESPARSE_BLAS_swap_num_threads_local(nt,saved) \
+        (saved) = MKL_Set_Num_Threads_Local (nt)
+    #define SUITESPARSE_BLAS_THREADS_LOCAL 1
+
+#elif defined ( BLAS_OpenBLAS )
+
+    // OpenBLAS
+    void openblas_set_num_threads (int nt) ;
+    int openblas_get_num_threads (void) ;
+    #define SUITESPARSE_BLAS_set_num_threads(nt) openblas_set_num_threads (nt)
+    #define SUITESPARSE_BLAS_get_num_threads openblas_get_num_threads ( )
+    #define SUITESPARSE_BLAS_set_num_threads_local(nt) \
+        openblas_set_num_threads (nt)
+    #define SUITESPARSE_BLAS_swap_num_threads_local(nt,saved) \
+        (saved) = openblas_get_num_threads ( ) ; openblas_set_num_threads (nt)
+    #define SUITESPARSE_BLAS_THREADS_LOCAL 0
+
+#elif defined ( BLAS_FLAME ) || defined ( BLAS_AOCL ) || defined ( BLAS_AOCL_mt )
+
+    // BLIS (dim_t is int64_t)
+    void bli_thread_set_num_threads (int64_t nt) ;
+    int64_t bli_thread_get_num_threads (void) ;
+    #define SUITESPARSE_BLAS_set_num_threads(nt) \
+        bli_thread_set_num_threads ((int64_t) (nt))
+    #define SUITESPARSE_BLAS_get_num_threads \
+        ((int) bli_thread_get_num_threads ( ))
+    #define SUITESPARSE_BLAS_set_num_threads_local(nt) \
+        bli_thread_set_num_threads ((int64_t) (nt))
+    #define SUITESPARSE_BLAS_swap_num_threads_local(nt,saved) \
+        (saved) = (int) bli_thread_get_num_threads ( ) ; \
+        bli_thread_set_num_threads ((int64_t) (nt))
+    #define SUITESPARSE_BLAS_THREADS_LOCAL 0
+
+#endif
+
+#if defined ( SUITESPARSE_BLAS_THREADS_LOCAL )
+
+    #define SUITESPARSE_BLAS_THREADS(work,ntasks,saved)                       \
+    {                                                                         \
+        int blas_nthreads = SuiteSparse_BLAS_threads ((double) (work),        \
+            (int) (ntasks), SUITESPARSE_BLAS_THREADS_LOCAL) ;                 \
+        (saved) = -1 ;                                                        \
+        if (blas_nthreads > 0)                                                \
+        {                                                                     \
+            SUITESPARSE_BLAS_swap_num_threads_local (blas_nthreads, saved) ;  \
+        }                                                                     \
+    }
+
+    #define SUITESPARSE_BLAS_THREADS_RESTORE(saved)                           \
+    {                                                                         \
+        if ((saved) >= 0)                                                     \
+        {                                                                     \
+            SUITESPARSE_BLAS_set_num_threads_local (saved) ;                  \
+        }                                                                     \
+    }
+
+#else
+
+    // any other BLAS
+    #define SUITESPARSE_BLAS_set_num_threads(nt)
+    #define SUITESPARSE_BLAS_get_num_threads 0
+    #define SUITESPARSE_BLAS_set_num_threads_local(nt)
+    #define SUITESPARSE_BLAS_THREADS(work,ntasks,saved) { (saved) = -1 ; }
+    #define SUITESPARSE_BLAS_THREADS_RESTORE(saved) { (void) (saved) ; }
+    #define SUITESPARSE_BLAS_THREADS_LOCAL 0
+
+#endif
+
 #endif
 
 //------------------------------------------------------------------------------
@@ -2261,8 +2374,491 @@ const char *SuiteSparse_BLAS_library ( void ) ;
 
 size_t SuiteSparse_BLAS_integer_size ( void ) ;
 
+//==============================================================================
+// SuiteSparse_csc: binary file container for a sparse matrix
+//==============================================================================
+
+// A versioned binary file format for a sparse matrix held in compressed-column
+// form, which any SuiteSparse package (or user application) can use to save
+// and reload a matrix much faster than with a Matrix Market or
+// Rutherford-Boeing text file.  The column pointers, row indices, and values
+// are each split into blocks of 1 MB, which are optionally compressed with
+// LZ4.  The blocks are compressed and decompressed in parallel if
+// SuiteSparse_config is compiled with OpenMP, and files are loaded with mmap
+// where available.  Files are written in the byte order of the machine that
+// writes them, and cannot be read on a machine with the opposite byte order.
+//
+// The SuiteSparse_csc struct describes the matrix.  The p and i arrays are
+// int32_t if isize is 4, or int64_t if isize is 8.  The x array has nnz
+// entries of type double or float (dtype), or 2*nnz if complex, with the real
+// and imaginary parts interleaved.  It is not accessed if the matrix is
+// SUITESPARSE_CSC_PATTERN.  Only packed matrices are supported, with
+// p [ncol] equal to nnz.
+
+#define SUITESPARSE_CSC_VERSION 1
+
+// xtype:
+#define SUITESPARSE_CSC_PATTERN 0       // no numerical values
+#define SUITESPARSE_CSC_REAL    1       // real values
+#define SUITESPARSE_CSC_COMPLEX 2       // complex values, interleaved
+
+// dtype:
+#define SUITESPARSE_CSC_DOUBLE  0       // values are double
+#define SUITESPARSE_CSC_SINGLE  1       // values are float
+
+// compression:
+#define SUITESPARSE_CSC_NONE    0       // blocks are not compressed
+#define SUITESPARSE_CSC_LZ4     1       // blocks are compressed with LZ4
+
+// return values:
+#define SUITESPARSE_CSC_OK              0   // success
+#define SUITESPARSE_CSC_INVALID       (-1)  // invalid matrix or corrupted file
+#define SUITESPARSE_CSC_OUT_OF_MEMORY (-2)  // out of memory
+#define SUITESPARSE_CSC_IO_ERROR      (-3)  // unable to open, read, or write
+#define SUITESPARSE_CSC_UNSUPPORTED   (-4)  // file version or byte order
+                                            // not supported
+#define SUITESPARSE_CSC_NO_LZ4        (-5)  // file is compressed with LZ4, but
+                                            // SuiteSparse_config was compiled
+                                            // without LZ4
+
+typedef struct
+{
+    int64_t nrow ;      // # of rows
+    int64_t ncol ;      // # of columns
+    int64_t nnz ;       // # of entries, equal to p [ncol]
+    int isize ;         // sizeof each integer in p and i: 4 or 8
+    int xtype ;         // SUITESPARSE_CSC_PATTERN, _REAL, or _COMPLEX
+    int dtype ;         // SUITESPARSE_CSC_DOUBLE or _SINGLE
+    int stype ;         // 0: unsymmetric, >0: upper part stored, <0: lower
+    int sorted ;        // 1 if the row indices in each column are sorted
+    void *p ;           // column pointers, of size ncol+1
+    void *i ;           // row indices, of size nnz
+    void *x ;           // values, of size nnz (or 2*nnz if complex)
+} SuiteSparse_csc ;
+
+// SuiteSparse_csc_write: write a matrix to a file.  If LZ4 is requested but
+// SuiteSparse_config was compiled without it, or if a block does not compress,
+// the blocks are written uncompressed.
+int SuiteSparse_csc_write       // returns SUITESPARSE_CSC_OK or an error code
+(
+    const char *filename,       // name of the file to write
+    const SuiteSparse_csc *A,   // matrix to write
+    int compression             // SUITESPARSE_CSC_NONE or _LZ4
+) ;
+
+// SuiteSparse_csc_info: read the header of a file.  On output, A->p, A->i,
+// and A->x are NULL, and all other fields of A describe the matrix in the
+// file.  The file is not otherwise accessed.
+int SuiteSparse_csc_info        // returns SUITESPARSE_CSC_OK or an error code
+(
+    const char *filename,       // name of the file to read
+    SuiteSparse_csc *A          // output: description of the matrix
+) ;
+
+// SuiteSparse_csc_read: read a matrix from a file.  On input, A->p, A->i, and
+// A->x are each either NULL, or point to an array large enough to hold the
+// result.  Arrays that are NULL are allocated with SuiteSparse_malloc, and can
+// be freed with SuiteSparse_csc_free.  If any array is provided on input, then
+// A->ncol, A->nnz, A->xtype, and A->dtype must also be provided on input (as
+// returned by SuiteSparse_csc_info), and the file must match them.  The
+// integers are converted to isize bytes if isize is 4 or 8 (an error is
+// returned if the matrix is too large for 32-bit integers), or returned as
+// held in the file if isize is zero.  The file is checked, so that on success
+// p is monotonic with p [0] = 0 and p [ncol] = nnz, and all row indices are
+// in the range 0 to nrow-1.
+int SuiteSparse_csc_read        // returns SUITESPARSE_CSC_OK or an error code
+(
+    const char *filename,       // name of the file to read
+    int isize,                  // 4, 8, or 0 (as held in the file)
+    SuiteSparse_csc *A          // input/output: the matrix
+) ;
+
+// SuiteSparse_csc_free: free A->p, A->i, and A->x, and set them to NULL.
+void SuiteSparse_csc_free
+(
+    SuiteSparse_csc *A          // input/output: the matrix
+) ;
+
+//==============================================================================
+// SuiteSparse_trace: phase-level tracing
+//==============================================================================
+
+// CHOLMOD, UMFPACK, KLU, SPQR, and ParU report the start and end of each
+// phase of their work as a trace event: "ordering", "symbolic", "numeric",
+// "solve", and "refine".  The events are passed to a single trace function,
+// which is NULL by default (no tracing).  SuiteSparse_trace_json_open installs
+// a built-in trace function that writes the events to a Chrome trace file
+// (JSON), which can be viewed with chrome://tracing or ui.perfetto.dev.
+//
+// If no trace function has been set, and the SUITESPARSE_TRACE environment
+// variable holds the name of a file, then the JSON writer is started when the
+// first event occurs, and the file is closed when the program exits.
+
+// event kinds:
+#define SUITESPARSE_TRACE_BEGIN 0       // start of a phase
+#define SUITESPARSE_TRACE_END   1       // end of a phase
+
+typedef struct
+{
+    int kind ;              // SUITESPARSE_TRACE_BEGIN or SUITESPARSE_TRACE_END
+    const char *package ;   // name of the package ("CHOLMOD", "KLU", ...)
+    const char *phase ;     // name of the phase ("numeric", "solve", ...)
+    int thread ;            // id of the calling thread: 0, 1, 2, ...
+    double time ;           // SuiteSparse_time ( ) when the event occurred
+    double flops ;          // # of flops done in the phase (0 if not known)
+    double bytes ;          // size of the result of the phase (0 if not known)
+} SuiteSparse_trace_event ;
+
+// SuiteSparse_trace_func_set: set the trace function (NULL to disable
+// tracing).  The userdata pointer is passed to each call of the function.
+void SuiteSparse_trace_func_set
+(
+    void (*func) (const SuiteSparse_trace_event *event, void *userdata),
+    void *userdata
+) ;
+
+// SuiteSparse_trace_json_open: write all subsequent events to a JSON file.
+// Any JSON file already open is closed first.
+int SuiteSparse_trace_json_open     // returns 1 if successful, 0 otherwise
+(
+    const char *filename            // name of the file to write
+) ;
+
+// SuiteSparse_trace_json_close: finish and close the JSON file, and disable
+// tracing if the JSON writer is the current trace function.
+void SuiteSparse_trace_json_close ( void ) ;
+
+// SuiteSparse_trace_begin and SuiteSparse_trace_end: emit an event.  These
+// are used by the SuiteSparse packages, and may also be used by the user
+// application to mark its own phases.  Each begin must be matched by an end
+// with the same package and phase, in the same thread.  The phases are also
+// used by SuiteSparse_memstats, whether or not tracing is enabled.
+void SuiteSparse_trace_begin
+(
+    const char *package,            // name of the package
+    const char *phase               // name of the phase
+) ;
+
+void SuiteSparse_trace_end
+(
+    const char *package,            // name of the package
+    const char *phase,              // name of the phase
+    double flops,                   // # of flops done in the phase, or 0
+    double bytes                    // size of the result, in bytes, or 0
+) ;
+
+//==============================================================================
+// SuiteSparse_BLAS_threads: BLAS thread budget
+//==============================================================================
+
+// CHOLMOD, UMFPACK, SPQR, and ParU call the BLAS on dense blocks of widely
+// varying size, sometimes from several tasks at once.  The thread budget is
+// the total number of threads the BLAS may use for these calls.  It is 0 by
+// default, in which case SuiteSparse never changes the number of threads used
+// by the BLAS.  If the budget is set, each BLAS call in CHOLMOD, UMFPACK, and
+// SPQR uses one thread per "chunk" of flops, up to the budget divided by the
+// number of tasks calling the BLAS at the same time.  The number of BLAS
+// threads is only changed by SuiteSparse when it is set by a function that
+// affects the calling thread alone (Intel MKL), or when a single task is
+// active (OpenBLAS and BLIS).  The budget is not used for any other BLAS.
+//
+// The number of BLAS threads is set before each BLAS call that uses the
+// budget, even if it has not changed since the last call, so the user
+// application (or a package) may change it at any time.  The number in use
+// before the call is saved, and put back when the BLAS call returns, so the
+// setting of the user application is unchanged when SuiteSparse returns.
+
+// SuiteSparse_BLAS_threads_set: set the budget (0: do not change the BLAS)
+void SuiteSparse_BLAS_threads_set
+(
+    int nthreads                // total # of BLAS threads; 0: do not change
+) ;
+
+// SuiteSparse_BLAS_threads_get: return the budget
+int SuiteSparse_BLAS_threads_get ( void ) ;
+
+// SuiteSparse_BLAS_chunk_set: set the # of flops for each BLAS thread (the
+// default is 4e6)
+void SuiteSparse_BLAS_chunk_set
+(
+    double chunk                // # of flops per thread; <= 0: use default
+) ;
+
+// SuiteSparse_BLAS_chunk_get: return the # of flops for each BLAS thread
+double SuiteSparse_BLAS_chunk_get ( void ) ;
+
+// SuiteSparse_BLAS_threads: return the # of threads for the next BLAS call,
+// or 0 if the BLAS should not be changed.  Used by the SUITESPARSE_BLAS_THREADS
+// macro; not normally called by the user application.
+int SuiteSparse_BLAS_threads
+(
+    double work,                // # of flops for the BLAS call
+    int ntasks,                 // # of tasks calling the BLAS at the same time
+    int local                   // 1 if the setter only affects this thread
+) ;
+
+//==============================================================================
+// SuiteSparse_memory: placement of large arrays
+//==============================================================================
+
+// The largest arrays in SuiteSparse (the numerical values of a CHOLMOD
+// supernodal factor, and the UMFPACK Numeric->Memory workspace, for example)
+// are allocated by one thread.  On a NUMA machine, each page is placed on the
+// memory node of the thread that first touches it, so a large array that is
+// first touched by one thread ends up on one node, and the bandwidth of the
+// other nodes is not used when many threads work on it later.
+//
+// A package can mark a large array with a memory class, when it is allocated
+// with SuiteSparse_malloc_class or SuiteSparse_calloc_class, or afterwards
+// with SuiteSparse_memory_advise.  The memory class is a combination of:
+//
+//  SUITESPARSE_MEMORY_FIRST_TOUCH: the pages are first touched in parallel,
+//      each thread touching one contiguous part of the array, as a parallel
+//      loop with a static schedule would do.
+//
+//  SUITESPARSE_MEMORY_INTERLEAVE: the pages are first touched in parallel,
+//      round-robin across the threads, so the array is spread across the
+//      memory nodes of all threads.  This takes precedence over
+//      SUITESPARSE_MEMORY_FIRST_TOUCH.
+//
+//  SUITESPARSE_MEMORY_HUGEPAGE: the array is backed by transparent huge
+//      pages, if possible (Linux only, with madvise).
+//
+// The pages are touched with OpenMP, and only if SuiteSparse_config is
+// compiled with OpenMP.  Pages that have already been touched (by an earlier
+// use of the same memory by malloc) stay where they are.  The contents of the
+// array are not modified, and the array is freed in the usual way (with
+// SuiteSparse_free, or the free method of the package), so the memory class
+// can be used with any malloc/calloc/realloc/free functions in
+// SuiteSparse_config.
+//
+// By default, no memory class is used (SuiteSparse_memory_policy_set has not
+// been called), and the memory class of each array is ignored.  Like the other
+// contents of SuiteSparse_config, the policy is meant to be set once, before
+// any threads are started.
+
+#define SUITESPARSE_MEMORY_DEFAULT      0   // no special placement
+#define SUITESPARSE_MEMORY_FIRST_TOUCH  1   // parallel first touch, in blocks
+#define SUITESPARSE_MEMORY_INTERLEAVE   2   // parallel first touch, round-robin
+#define SUITESPARSE_MEMORY_HUGEPAGE     4   // transparent huge pages
+
+// SuiteSparse_memory_policy_set: set the memory classes that are used, and
+// the minimum size of an array for them to be used.
+void SuiteSparse_memory_policy_set
+(
+    int memclass,               // memory classes to use (0: none)
+    size_t threshold            // smallest array that uses them, in bytes
+                                // (0: use default of 64 MB)
+) ;
+
+// SuiteSparse_memory_policy_get: return the memory policy
+void SuiteSparse_memory_policy_get
+(
+    int *memclass,              // memory classes in use, if not NULL
+    size_t *threshold           // threshold in bytes, if not NULL
+) ;
+
+// SuiteSparse_memory_advise: apply a memory class to an allocated array
+void SuiteSparse_memory_advise
+(
+    void *p,                    // array to place (not modified)
+    size_t size,                // size of the array, in bytes
+    int memclass                // memory class of the array
+) ;
+
+void *SuiteSparse_malloc_class  // pointer to allocated block of memory
+(
+    size_t nitems,          // number of items to malloc (>=1 is enforced)
+    size_t size_of_item,    // sizeof each item
+    int memclass            // memory class of the block
+) ;
+
+void *SuiteSparse_calloc_class  // pointer to allocated block of memory
+(
+    size_t nitems,          // number of items to calloc (>=1 is enforced)
+    size_t size_of_item,    // sizeof each item
+    int memclass            // memory class of the block
+) ;
+
+//==============================================================================
+// SuiteSparse_memstats: measured memory usage
+//==============================================================================
+
+// If enabled, SuiteSparse_malloc, SuiteSparse_calloc, SuiteSparse_realloc,
+// and SuiteSparse_free (and SuiteSparse_config_malloc, _calloc, _realloc, and
+// _free, used by UMFPACK and METIS) keep track of the memory they allocate:
+// the live bytes (allocated and not yet freed), the peak live bytes, the
+// total bytes allocated, and the number of calls to each function, with a
+// histogram of the allocation sizes (bin k counts the blocks of size 2^k to
+// 2^(k+1)-1 bytes).  These are kept for all of SuiteSparse, for each package,
+// and for each phase of each package.
+//
+// Each allocation is charged to the phase of the calling thread, as marked by
+// SuiteSparse_trace_begin and SuiteSparse_trace_end (see SuiteSparse_trace
+// above), whether or not tracing is enabled.  Each thread has its own stack
+// of phases, so a thread started within a phase (by OpenMP, for example) has
+// no phase of its own.  Allocations outside of any phase of the calling thread
+// are charged to the package "(none)".  The live and peak bytes of a phase
+// count the blocks allocated in that phase; a block allocated in one phase
+// and freed in another is subtracted from the phase that allocated it.
+//
+// If SUITESPARSE_MEMSTATS_SITES is defined when a file that includes
+// SuiteSparse_config.h is compiled, its calls to SuiteSparse_malloc,
+// SuiteSparse_calloc, and SuiteSparse_realloc also record their file and line
+// (see SuiteSparse_malloc_site below), and the counters are kept for each such
+// call site as well.  Only the direct callers are seen: most packages
+// allocate through their own wrappers (cholmod_malloc, for example), so the
+// call sites are most useful in a user application, or in a package whose
+// wrappers pass on their own callers with SuiteSparse_malloc_site.  Up to 512
+// call sites are kept.
+//
+// The counters are updated with atomics, and the size of each live block is
+// kept in a table split into parts with a lock for each, so threads that
+// allocate at the same time rarely wait for each other.  The locks and
+// atomics are those of OpenMP if SuiteSparse_config is compiled with OpenMP,
+// or else POSIX or Win32 mutexes and C11 atomics, so the accounting is
+// thread-safe with or without OpenMP.  The accounting is
+// disabled by default, in which case the cost is one function call per
+// allocation.  Blocks allocated while the accounting is disabled are not
+// counted, even if they are freed after it is enabled.
+//
+// If the SUITESPARSE_MEMSTATS environment variable is set to 1 when the first
+// block is allocated, and SuiteSparse_memstats_enable has not yet been called,
+// then the accounting is started automatically, and a report is printed to
+// stderr when the program exits.
+
+#define SUITESPARSE_MEMSTATS_OFF    0   // no accounting (default)
+#define SUITESPARSE_MEMSTATS_ON     1   // per package and phase
+
+#define SUITESPARSE_MEMSTATS_NBINS  48  // # of bins in the size histograms
+
+typedef struct
+{
+    const char *package ;   // name of the package, or NULL for all packages
+    const char *phase ;     // name of the phase, or NULL for all phases
+    const char *file ;      // file of the call site, or NULL if not a site
+    int line ;              // line of the call site, or 0 if not a site
+    int64_t live_bytes ;    // bytes allocated and not yet freed
+    int64_t peak_bytes ;    // peak of live_bytes
+    int64_t total_bytes ;   // total bytes allocated (including reallocs)
+    int64_t nmalloc ;       // # of blocks allocated (malloc and calloc)
+    int64_t nrealloc ;      // # of blocks reallocated
+    int64_t nfree ;         // # of blocks freed
+    int64_t hist [SUITESPARSE_MEMSTATS_NBINS] ;  // histogram of block sizes
+} SuiteSparse_memstats ;
+
+// SuiteSparse_memstats_enable: start the accounting (or stop it, with
+// SUITESPARSE_MEMSTATS_OFF).  All counters are cleared when the accounting is
+// started.  When it is stopped, the counters are kept and can still be
+// queried.  Like the other contents of SuiteSparse_config, this is meant to
+// be called before any threads are started.
+int SuiteSparse_memstats_enable     // returns 1 if successful, 0 otherwise
+(
+    int mode                // SUITESPARSE_MEMSTATS_OFF or _ON
+) ;
+
+// SuiteSparse_memstats_mode: return the current mode
+int SuiteSparse_memstats_mode ( void ) ;
+
+// SuiteSparse_memstats_reset: clear the counters of calls, total bytes, and
+// histograms, and set each peak to the current live bytes.  This can be used
+// to measure the peak memory of a single call to a package.
+void SuiteSparse_memstats_reset ( void ) ;
+
+// SuiteSparse_memstats_get: get the counters of all of SuiteSparse (package
+// is NULL), of one package (phase is NULL), or of one phase of one package.
+int SuiteSparse_memstats_get        // returns 1 if found, 0 otherwise
+(
+    const char *package,            // name of the package, or NULL
+    const char *phase,              // name of the phase, or NULL
+    SuiteSparse_memstats *stats     // output: the counters
+) ;
+
+// SuiteSparse_memstats_phase: get the counters of the kth phase seen so far
+int SuiteSparse_memstats_phase      // returns 1 if found, 0 if k is too large
+(
+    int k,                          // 0, 1, 2, ...
+    SuiteSparse_memstats *stats     // output: the counters
+) ;
+
+// SuiteSparse_memstats_site: get the counters of the kth call site seen so
+// far (see SUITESPARSE_MEMSTATS_SITES above)
+int SuiteSparse_memstats_site       // returns 1 if found, 0 if k is too large
+(
+    int k,                          // 0, 1, 2, ...
+    SuiteSparse_memstats *stats     // output: the counters
+) ;
+
+// SuiteSparse_memstats_print: print a report of all counters
+void SuiteSparse_memstats_print
+(
+    FILE *f                         // file to print to (stdout if NULL)
+) ;
+
+// The following are used by the malloc/calloc/realloc/free functions above,
+// and by SuiteSparse_trace_begin and SuiteSparse_trace_end; they are not
+// normally called by the user application.
+void SuiteSparse_memstats_malloc
+(
+    void *p,                        // the block
+    size_t size,                    // its size, in bytes
+    const char *file,               // file of the call site, or NULL
+    int line                        // line of the call site
+) ;
+void *SuiteSparse_memstats_realloc
+(
+    void *p,                        // the block to reallocate
+    size_t size,                    // its new size, in bytes
+    const char *file,               // file of the call site, or NULL
+    int line                        // line of the call site
+) ;
+void SuiteSparse_memstats_free (void *p) ;
+void SuiteSparse_memstats_begin (const char *package, const char *phase) ;
+void SuiteSparse_memstats_end ( void ) ;
+
+// SuiteSparse_malloc_site, SuiteSparse_calloc_site, and
+// SuiteSparse_realloc_site are the same as SuiteSparse_malloc,
+// SuiteSparse_calloc, and SuiteSparse_realloc, except that they also record
+// the call site of the block, if the accounting is enabled.  A file is NULL
+// if the call site is not known.
+void *SuiteSparse_malloc_site
+(
+    size_t nitems,          // number of items to malloc (>=1 is enforced)
+    size_t size_of_item,    // sizeof each item
+    const char *file,       // file of the call site, or NULL
+    int line                // line of the call site
+) ;
+
+void *SuiteSparse_calloc_site
+(
+    size_t nitems,          // number of items to calloc (>=1 is enforced)
+    size_t size_of_item,    // sizeof each item
+    const char *file,       // file of the call site, or NULL
+    int line                // line of the call site
+) ;
+
+void *SuiteSparse_realloc_site
+(
+    size_t nitems_new,      // new number of items in the object
+    size_t nitems_old,      // old number of items in the object
+    size_t size_of_item,    // sizeof each item
+    void *p,                // old object to reallocate
+    int *ok,                // 1 if successful, 0 otherwise
+    const char *file,       // file of the call site, or NULL
+    int line                // line of the call site
+) ;
+
+#if defined ( SUITESPARSE_MEMSTATS_SITES )
+    #define SuiteSparse_malloc(nitems,size_of_item)                           \
+        SuiteSparse_malloc_site (nitems, size_of_item, __FILE__, __LINE__)
+    #define SuiteSparse_calloc(nitems,size_of_item)                           \
+        SuiteSparse_calloc_site (nitems, size_of_item, __FILE__, __LINE__)
+    #define SuiteSparse_realloc(nitems_new,nitems_old,size_of_item,p,ok)      \
+        SuiteSparse_realloc_site (nitems_new, nitems_old, size_of_item, p,    \
+            ok, __FILE__, __LINE__)
+#endif
+
 #ifdef __cplusplus
 }
 #endif
 #endif
-
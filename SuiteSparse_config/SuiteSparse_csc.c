@@ -0,0 +1,872 @@
+//------------------------------------------------------------------------------
+// SuiteSparse_config/SuiteSparse_csc.c: binary file container for a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse_config, Copyright (c) 2012-2023, Timothy A. Davis.
+// All Rights Reserved.
+// SPDX-License-Identifier: BSD-3-clause
+
+//------------------------------------------------------------------------------
+
+// Reads and writes a sparse matrix in compressed-column form, in a versioned
+// binary file.  See SuiteSparse_config.h for a description of the user-callable
+// functions.  The file consists of three parts:
+//
+//  header:     16 int64_t words: the magic string "SSparCSC", the version, a
+//              byte-order mark, nrow, ncol, nnz, isize, xtype, dtype, stype,
+//              sorted, compression, the block size, and 3 reserved words.
+//
+//  blocks:     the column pointers, row indices, and values (if any), in that
+//              order, each split into blocks of blocksize bytes.  The last
+//              block of each array may be smaller.
+//
+//  table:      one int64_t per block, for all the blocks in the file: the size
+//              of the compressed block, or -(its size) if the block is held
+//              uncompressed.
+//
+// All integers in the header and table are int64_t, in the byte order of the
+// machine that wrote the file.  The table is placed last so the file can be
+// written in a single pass, without knowing in advance the size of each
+// compressed block.
+//
+// LZ4 is available if SuiteSparse_config is compiled with the LZ4 library
+// vendored in SuiteSparse_config/lz4 (-DSUITESPARSE_CONFIG_HAS_LZ4, the
+// default).  Otherwise, files are written uncompressed, and reading a file
+// with LZ4-compressed blocks returns SUITESPARSE_CSC_NO_LZ4.
+
+#include "SuiteSparse_config.h"
+
+#if defined ( __unix__ ) || defined ( __APPLE__ )
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define SUITESPARSE_CSC_MMAP
+#endif
+
+#define CSC_HEADER      16                              // # words in header
+#define CSC_BLOCKSIZE   ((int64_t) 1 << 20)             // 1 MB blocks
+#define CSC_MAXBLOCK    ((int64_t) 1 << 30)             // largest block
+#define CSC_BOM         ((int64_t) 0x0102030405060708)  // byte-order mark
+#define CSC_MOB         ((int64_t) 0x0807060504030201)  // swapped byte order
+
+#define CSC_MIN(a,b) (((a) < (b)) ? (a) : (b))
+#define CSC_MAX(a,b) (((a) > (b)) ? (a) : (b))
+
+static const char csc_magic [8] = { 'S','S','p','a','r','C','S','C' } ;
+
+//------------------------------------------------------------------------------
+// LZ4
+//------------------------------------------------------------------------------
+
+#ifdef SUITESPARSE_CONFIG_HAS_LZ4
+
+// The user application (or GraphBLAS) may have its own copy of the LZ4
+// library.  To avoid any conflict, all global LZ4_* symbols are renamed
+// SuiteSparse_LZ4_*, as GraphBLAS does in GB_lz4.h.
+
+#define SSLZ4(x) SUITESPARSE_CAT (SuiteSparse_, x)
+
+#define LZ4_attach_dictionary               SSLZ4 (LZ4_attach_dictionary)
+#define LZ4_compress                        SSLZ4 (LZ4_compress)
+#define LZ4_compressBound                   SSLZ4 (LZ4_compressBound)
+#define LZ4_compress_continue               SSLZ4 (LZ4_compress_continue)
+#define LZ4_compress_default                SSLZ4 (LZ4_compress_default)
+#define LZ4_compress_destSize               SSLZ4 (LZ4_compress_destSize)
+#define LZ4_compress_fast                   SSLZ4 (LZ4_compress_fast)
+#define LZ4_compress_fast_continue          SSLZ4 (LZ4_compress_fast_continue)
+#define LZ4_compress_fast_extState          SSLZ4 (LZ4_compress_fast_extState)
+#define LZ4_compress_fast_extState_fastReset \
+    SSLZ4 (LZ4_compress_fast_extState_fastReset)
+#define LZ4_compress_forceExtDict           SSLZ4 (LZ4_compress_forceExtDict)
+#define LZ4_compress_limitedOutput          SSLZ4 (LZ4_compress_limitedOutput)
+#define LZ4_compress_limitedOutput_continue \
+    SSLZ4 (LZ4_compress_limitedOutput_continue)
+#define LZ4_compress_limitedOutput_withState \
+    SSLZ4 (LZ4_compress_limitedOutput_withState)
+#define LZ4_compress_withState              SSLZ4 (LZ4_compress_withState)
+#define LZ4_create                          SSLZ4 (LZ4_create)
+#define LZ4_createStream                    SSLZ4 (LZ4_createStream)
+#define LZ4_createStreamDecode              SSLZ4 (LZ4_createStreamDecode)
+#define LZ4_decoderRingBufferSize           SSLZ4 (LZ4_decoderRingBufferSize)
+#define LZ4_decompress_fast                 SSLZ4 (LZ4_decompress_fast)
+#define LZ4_decompress_fast_continue        SSLZ4 (LZ4_decompress_fast_continue)
+#define LZ4_decompress_fast_doubleDict      \
+    SSLZ4 (LZ4_decompress_fast_doubleDict)
+#define LZ4_decompress_fast_usingDict       \
+    SSLZ4 (LZ4_decompress_fast_usingDict)
+#define LZ4_decompress_fast_withPrefix64k   \
+    SSLZ4 (LZ4_decompress_fast_withPrefix64k)
+#define LZ4_decompress_safe                 SSLZ4 (LZ4_decompress_safe)
+#define LZ4_decompress_safe_continue        SSLZ4 (LZ4_decompress_safe_continue)
+#define LZ4_decompress_safe_doubleDict      \
+    SSLZ4 (LZ4_decompress_safe_doubleDict)
+#define LZ4_decompress_safe_forceExtDict    \
+    SSLZ4 (LZ4_decompress_safe_forceExtDict)
+#define LZ4_decompress_safe_partial         SSLZ4 (LZ4_decompress_safe_partial)
+#define LZ4_decompress_safe_usingDict       \
+    SSLZ4 (LZ4_decompress_safe_usingDict)
+#define LZ4_decompress_safe_withPrefix64k   \
+    SSLZ4 (LZ4_decompress_safe_withPrefix64k)
+#define LZ4_freeStream                      SSLZ4 (LZ4_freeStream)
+#define LZ4_freeStreamDecode                SSLZ4 (LZ4_freeStreamDecode)
+#define LZ4_initStream                      SSLZ4 (LZ4_initStream)
+#define LZ4_loadDict                        SSLZ4 (LZ4_loadDict)
+#define LZ4_resetStream                     SSLZ4 (LZ4_resetStream)
+#define LZ4_resetStreamState                SSLZ4 (LZ4_resetStreamState)
+#define LZ4_resetStream_fast                SSLZ4 (LZ4_resetStream_fast)
+#define LZ4_saveDict                        SSLZ4 (LZ4_saveDict)
+#define LZ4_setStreamDecode                 SSLZ4 (LZ4_setStreamDecode)
+#define LZ4_sizeofState                     SSLZ4 (LZ4_sizeofState)
+#define LZ4_sizeofStreamState               SSLZ4 (LZ4_sizeofStreamState)
+#define LZ4_slideInputBuffer                SSLZ4 (LZ4_slideInputBuffer)
+#define LZ4_uncompress                      SSLZ4 (LZ4_uncompress)
+#define LZ4_uncompress_unknownOutputSize    \
+    SSLZ4 (LZ4_uncompress_unknownOutputSize)
+#define LZ4_versionNumber                   SSLZ4 (LZ4_versionNumber)
+#define LZ4_versionString                   SSLZ4 (LZ4_versionString)
+
+// LZ4 uses the SuiteSparse memory manager (only for its stream methods, which
+// are not used here).
+#define LZ4_USER_MEMORY_FUNCTIONS
+#define LZ4_malloc  SSLZ4 (LZ4_malloc)
+#define LZ4_calloc  SSLZ4 (LZ4_calloc)
+#define LZ4_free    SSLZ4 (LZ4_free)
+void *LZ4_malloc (size_t s) ;
+void *LZ4_calloc (size_t n, size_t s) ;
+void  LZ4_free (void *p) ;
+
+void *LZ4_malloc (size_t s)
+{
+    return (SuiteSparse_malloc (s, 1)) ;
+}
+
+void *LZ4_calloc (size_t n, size_t s)
+{
+    return (SuiteSparse_calloc (n, s)) ;
+}
+
+void LZ4_free (void *p)
+{
+    SuiteSparse_free (p) ;
+}
+
+// LZ4 uses switch statements with no default case.
+#if SUITESPARSE_COMPILER_GCC
+#pragma GCC diagnostic ignored "-Wswitch-default"
+#endif
+
+// Include the unmodified lz4.c source code from SuiteSparse_config/lz4.
+#define LZ4_DISABLE_DEPRECATE_WARNINGS
+#include "lz4.c"
+
+#endif
+
+//------------------------------------------------------------------------------
+// csc_esize: size of each entry of A->x
+//------------------------------------------------------------------------------
+
+static int64_t csc_esize (int xtype, int dtype)
+{
+    if (xtype == SUITESPARSE_CSC_PATTERN) return (0) ;
+    int64_t s = (dtype == SUITESPARSE_CSC_SINGLE) ? sizeof (float) :
+        sizeof (double) ;
+    return ((xtype == SUITESPARSE_CSC_COMPLEX) ? 2*s : s) ;
+}
+
+//------------------------------------------------------------------------------
+// csc_valid: check the scalar properties of a matrix
+//------------------------------------------------------------------------------
+
+// Returns true if the dimensions and types are valid, and all arrays sizes can
+// be computed without integer overflow.
+
+static bool csc_valid (const SuiteSparse_csc *A, int isize)
+{
+    if (A->nrow < 0 || A->ncol < 0 || A->nnz < 0) return (false) ;
+    if (isize != 4 && isize != 8) return (false) ;
+    if (A->xtype < SUITESPARSE_CSC_PATTERN || A->xtype > SUITESPARSE_CSC_COMPLEX
+     || A->dtype < SUITESPARSE_CSC_DOUBLE  || A->dtype > SUITESPARSE_CSC_SINGLE)
+    {
+        return (false) ;
+    }
+    int64_t imax = (isize == 4) ? INT32_MAX : (INT64_MAX / 16) ;
+    return (A->nrow <= imax && A->ncol < imax && A->nnz <= imax) ;
+}
+
+//------------------------------------------------------------------------------
+// csc_get: get the kth integer of an int32_t or int64_t array
+//------------------------------------------------------------------------------
+
+static inline int64_t csc_get (const void *X, int isize, int64_t k)
+{
+    return ((isize == 4) ? (int64_t) (((const int32_t *) X) [k]) :
+                                      (((const int64_t *) X) [k])) ;
+}
+
+//------------------------------------------------------------------------------
+// SuiteSparse_csc_write: write a matrix to a file
+//------------------------------------------------------------------------------
+
+int SuiteSparse_csc_write
+(
+    const char *filename,
+    const SuiteSparse_csc *A,
+    int compression
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    if (filename == NULL || A == NULL || !csc_valid (A, A->isize) ||
+        A->p == NULL || (A->nnz > 0 && A->i == NULL) ||
+        (A->nnz > 0 && A->xtype != SUITESPARSE_CSC_PATTERN && A->x == NULL) ||
+        (compression != SUITESPARSE_CSC_NONE &&
+         compression != SUITESPARSE_CSC_LZ4) ||
+        csc_get (A->p, A->isize, A->ncol) != A->nnz)
+    {
+        return (SUITESPARSE_CSC_INVALID) ;
+    }
+
+    #ifndef SUITESPARSE_CONFIG_HAS_LZ4
+    compression = SUITESPARSE_CSC_NONE ;
+    #endif
+
+    //--------------------------------------------------------------------------
+    // split the arrays into blocks
+    //--------------------------------------------------------------------------
+
+    const int64_t bs = CSC_BLOCKSIZE ;
+    const void *X [3] = { A->p, A->i, A->x } ;
+    int64_t size [3] ;
+    size [0] = (A->ncol + 1) * A->isize ;
+    size [1] = A->nnz * A->isize ;
+    size [2] = A->nnz * csc_esize (A->xtype, A->dtype) ;
+    int64_t nblocks = 0 ;
+    for (int s = 0 ; s < 3 ; s++)
+    {
+        nblocks += (size [s] + bs - 1) / bs ;
+    }
+
+    int64_t *table = SuiteSparse_malloc (nblocks, sizeof (int64_t)) ;
+    if (table == NULL)
+    {
+        return (SUITESPARSE_CSC_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate workspace for the compressed blocks
+    //--------------------------------------------------------------------------
+
+    uint8_t *Work = NULL ;
+    #ifdef SUITESPARSE_CONFIG_HAS_LZ4
+    int nthreads = 1 ;
+    int64_t cap = 0 ;
+    if (compression == SUITESPARSE_CSC_LZ4)
+    {
+        nthreads = SUITESPARSE_OPENMP_MAX_THREADS ;
+        nthreads = (int) CSC_MIN (nthreads, nblocks) ;
+        nthreads = CSC_MAX (nthreads, 1) ;
+        cap = LZ4_compressBound ((int) bs) ;
+        Work = SuiteSparse_malloc (nthreads, cap) ;
+        if (Work == NULL)
+        {
+            SuiteSparse_free (table) ;
+            return (SUITESPARSE_CSC_OUT_OF_MEMORY) ;
+        }
+    }
+    #endif
+
+    //--------------------------------------------------------------------------
+    // write the header
+    //--------------------------------------------------------------------------
+
+    FILE *f = fopen (filename, "wb") ;
+    if (f == NULL)
+    {
+        SuiteSparse_free (Work) ;
+        SuiteSparse_free (table) ;
+        return (SUITESPARSE_CSC_IO_ERROR) ;
+    }
+
+    int64_t header [CSC_HEADER] ;
+    memset (header, 0, sizeof (header)) ;
+    memcpy (header, csc_magic, 8) ;
+    header [ 1] = SUITESPARSE_CSC_VERSION ;
+    header [ 2] = CSC_BOM ;
+    header [ 3] = A->nrow ;
+    header [ 4] = A->ncol ;
+    header [ 5] = A->nnz ;
+    header [ 6] = A->isize ;
+    header [ 7] = A->xtype ;
+    header [ 8] = A->dtype ;
+    header [ 9] = (A->stype > 0) ? 1 : ((A->stype < 0) ? -1 : 0) ;
+    header [10] = (A->sorted != 0) ;
+    header [11] = compression ;
+    header [12] = bs ;
+    bool ok = (fwrite (header, sizeof (int64_t), CSC_HEADER, f) == CSC_HEADER) ;
+
+    //--------------------------------------------------------------------------
+    // write the blocks
+    //--------------------------------------------------------------------------
+
+    int64_t b0 = 0 ;
+    for (int s = 0 ; ok && s < 3 ; s++)
+    {
+        const uint8_t *Src = (const uint8_t *) X [s] ;
+        int64_t nb = (size [s] + bs - 1) / bs ;
+        if (compression == SUITESPARSE_CSC_NONE)
+        {
+            // write the whole array at once
+            for (int64_t b = 0 ; b < nb ; b++)
+            {
+                table [b0 + b] = -CSC_MIN (bs, size [s] - b * bs) ;
+            }
+            ok = ok && (size [s] == 0 ||
+                fwrite (Src, 1, size [s], f) == (size_t) size [s]) ;
+        }
+        #ifdef SUITESPARSE_CONFIG_HAS_LZ4
+        else
+        {
+            // compress nthreads blocks at a time in parallel, then write them
+            for (int64_t bfirst = 0 ; ok && bfirst < nb ; bfirst += nthreads)
+            {
+                int64_t nround = CSC_MIN (nthreads, nb - bfirst) ;
+                int t ;
+                #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+                for (t = 0 ; t < nround ; t++)
+                {
+                    int64_t b = bfirst + t ;
+                    int64_t len = CSC_MIN (bs, size [s] - b * bs) ;
+                    int64_t csize = LZ4_compress_default (
+                        (const char *) (Src + b * bs),
+                        (char *) (Work + t * cap), (int) len, (int) cap) ;
+                    // hold the block uncompressed if LZ4 fails to shrink it
+                    table [b0 + b] = (csize > 0 && csize < len) ? csize : -len ;
+                }
+                for (t = 0 ; ok && t < nround ; t++)
+                {
+                    int64_t b = bfirst + t ;
+                    int64_t csize = table [b0 + b] ;
+                    const uint8_t *block = (csize > 0) ? (Work + t * cap) :
+                        (Src + b * bs) ;
+                    size_t len = (size_t) ((csize > 0) ? csize : -csize) ;
+                    ok = (fwrite (block, 1, len, f) == len) ;
+                }
+            }
+        }
+        #endif
+        b0 += nb ;
+    }
+
+    //--------------------------------------------------------------------------
+    // write the table, close the file, and free workspace
+    //--------------------------------------------------------------------------
+
+    ok = ok && (nblocks == 0 ||
+        fwrite (table, sizeof (int64_t), nblocks, f) == (size_t) nblocks) ;
+    ok = (fclose (f) == 0) && ok ;
+    SuiteSparse_free (Work) ;
+    SuiteSparse_free (table) ;
+    return (ok ? SUITESPARSE_CSC_OK : SUITESPARSE_CSC_IO_ERROR) ;
+}
+
+//------------------------------------------------------------------------------
+// csc_header: decode and check the header of a file
+//------------------------------------------------------------------------------
+
+static int csc_header
+(
+    const int64_t header [CSC_HEADER],
+    SuiteSparse_csc *A,
+    int64_t *blocksize,
+    int *compression
+)
+{
+    if (memcmp (header, csc_magic, 8) != 0)
+    {
+        return (SUITESPARSE_CSC_INVALID) ;
+    }
+    if (header [2] == CSC_MOB)
+    {
+        // the file was written on a machine with the opposite byte order
+        return (SUITESPARSE_CSC_UNSUPPORTED) ;
+    }
+    if (header [2] != CSC_BOM || header [1] < 1)
+    {
+        return (SUITESPARSE_CSC_INVALID) ;
+    }
+    if (header [1] > SUITESPARSE_CSC_VERSION)
+    {
+        // the file was written by a later version of SuiteSparse_config
+        return (SUITESPARSE_CSC_UNSUPPORTED) ;
+    }
+    A->nrow  = header [3] ;
+    A->ncol  = header [4] ;
+    A->nnz   = header [5] ;
+    A->isize = (int) header [6] ;
+    A->xtype = (int) header [7] ;
+    A->dtype = (int) header [8] ;
+    A->stype = (int) header [9] ;
+    A->sorted = (int) header [10] ;
+    A->p = NULL ;
+    A->i = NULL ;
+    A->x = NULL ;
+    (*compression) = (int) header [11] ;
+    (*blocksize) = header [12] ;
+    if (header [6] != A->isize || header [7] != A->xtype ||
+        header [8] != A->dtype || !csc_valid (A, A->isize) ||
+        A->stype < -1 || A->stype > 1 || A->sorted < 0 || A->sorted > 1 ||
+        (*blocksize) <= 0 || (*blocksize) > CSC_MAXBLOCK ||
+        (*blocksize) % 16 != 0)
+    {
+        return (SUITESPARSE_CSC_INVALID) ;
+    }
+    if ((*compression) == SUITESPARSE_CSC_NONE)
+    {
+        return (SUITESPARSE_CSC_OK) ;
+    }
+    #ifdef SUITESPARSE_CONFIG_HAS_LZ4
+    if ((*compression) == SUITESPARSE_CSC_LZ4)
+    {
+        return (SUITESPARSE_CSC_OK) ;
+    }
+    #endif
+    return (((*compression) == SUITESPARSE_CSC_LZ4) ?
+        SUITESPARSE_CSC_NO_LZ4 : SUITESPARSE_CSC_INVALID) ;
+}
+
+//------------------------------------------------------------------------------
+// SuiteSparse_csc_info: read the header of a file
+//------------------------------------------------------------------------------
+
+int SuiteSparse_csc_info
+(
+    const char *filename,
+    SuiteSparse_csc *A
+)
+{
+    if (filename == NULL || A == NULL)
+    {
+        return (SUITESPARSE_CSC_INVALID) ;
+    }
+    FILE *f = fopen (filename, "rb") ;
+    if (f == NULL)
+    {
+        return (SUITESPARSE_CSC_IO_ERROR) ;
+    }
+    int64_t header [CSC_HEADER] ;
+    bool ok = (fread (header, sizeof (int64_t), CSC_HEADER, f) == CSC_HEADER) ;
+    fclose (f) ;
+    if (!ok)
+    {
+        return (SUITESPARSE_CSC_INVALID) ;
+    }
+    int64_t blocksize ;
+    int compression ;
+    return (csc_header (header, A, &blocksize, &compression)) ;
+}
+
+//------------------------------------------------------------------------------
+// csc_load: load a whole file into memory
+//------------------------------------------------------------------------------
+
+// The file is mapped into memory with mmap if possible (in which case
+// *mapped is returned as true), or read into a buffer allocated with
+// SuiteSparse_malloc otherwise.
+
+static int csc_load
+(
+    const char *filename,
+    uint8_t **Data,
+    size_t *size,
+    bool *mapped
+)
+{
+    (*Data) = NULL ;
+    (*size) = 0 ;
+    (*mapped) = false ;
+
+    #ifdef SUITESPARSE_CSC_MMAP
+    int fd = open (filename, O_RDONLY) ;
+    if (fd < 0)
+    {
+        return (SUITESPARSE_CSC_IO_ERROR) ;
+    }
+    struct stat st ;
+    if (fstat (fd, &st) == 0 && S_ISREG (st.st_mode) && st.st_size > 0)
+    {
+        void *map = mmap (NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE,
+            fd, 0) ;
+        if (map != MAP_FAILED)
+        {
+            close (fd) ;
+            (*Data) = (uint8_t *) map ;
+            (*size) = (size_t) st.st_size ;
+            (*mapped) = true ;
+            return (SUITESPARSE_CSC_OK) ;
+        }
+    }
+    close (fd) ;
+    #endif
+
+    // mmap is not available or has failed; read the file instead
+    FILE *f = fopen (filename, "rb") ;
+    if (f == NULL)
+    {
+        return (SUITESPARSE_CSC_IO_ERROR) ;
+    }
+    size_t len = 0, cap = CSC_BLOCKSIZE ;
+    uint8_t *Buf = SuiteSparse_malloc (cap, 1) ;
+    while (Buf != NULL)
+    {
+        len += fread (Buf + len, 1, cap - len, f) ;
+        if (len < cap) break ;
+        int ok ;
+        Buf = SuiteSparse_realloc (2*cap, cap, 1, Buf, &ok) ;
+        if (!ok)
+        {
+            Buf = SuiteSparse_free (Buf) ;
+            break ;
+        }
+        cap *= 2 ;
+    }
+    bool io_error = (ferror (f) != 0) ;
+    fclose (f) ;
+    if (Buf == NULL || io_error)
+    {
+        SuiteSparse_free (Buf) ;
+        return (io_error ? SUITESPARSE_CSC_IO_ERROR :
+            SUITESPARSE_CSC_OUT_OF_MEMORY) ;
+    }
+    (*Data) = Buf ;
+    (*size) = len ;
+    return (SUITESPARSE_CSC_OK) ;
+}
+
+//------------------------------------------------------------------------------
+// csc_unload: free the data loaded by csc_load
+//------------------------------------------------------------------------------
+
+static void csc_unload (uint8_t *Data, size_t size, bool mapped)
+{
+    #ifdef SUITESPARSE_CSC_MMAP
+    if (mapped)
+    {
+        munmap (Data, size) ;
+        return ;
+    }
+    #endif
+    SuiteSparse_free (Data) ;
+}
+
+//------------------------------------------------------------------------------
+// SuiteSparse_csc_read: read a matrix from a file
+//------------------------------------------------------------------------------
+
+#undef  FREE_ALL
+#define FREE_ALL                                            \
+{                                                           \
+    if (Data != NULL) csc_unload (Data, size, mapped) ;     \
+    SuiteSparse_free (Offset) ;                             \
+    SuiteSparse_free (Tmp) ;                                \
+    if (alloc [0]) SuiteSparse_free (Out [0]) ;             \
+    if (alloc [1]) SuiteSparse_free (Out [1]) ;             \
+    if (alloc [2]) SuiteSparse_free (Out [2]) ;             \
+}
+
+int SuiteSparse_csc_read
+(
+    const char *filename,
+    int isize,
+    SuiteSparse_csc *A
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    if (filename == NULL || A == NULL ||
+        (isize != 0 && isize != 4 && isize != 8))
+    {
+        return (SUITESPARSE_CSC_INVALID) ;
+    }
+
+    uint8_t *Data = NULL, *Tmp = NULL ;
+    int64_t *Offset = NULL ;
+    size_t size = 0 ;
+    bool mapped = false ;
+    void *Out [3] = { A->p, A->i, A->x } ;
+    bool alloc [3] = { false, false, false } ;
+
+    //--------------------------------------------------------------------------
+    // load the file and decode its header
+    //--------------------------------------------------------------------------
+
+    int status = csc_load (filename, &Data, &size, &mapped) ;
+    if (status != SUITESPARSE_CSC_OK)
+    {
+        return (status) ;
+    }
+    if (size < CSC_HEADER * sizeof (int64_t))
+    {
+        FREE_ALL ;
+        return (SUITESPARSE_CSC_INVALID) ;
+    }
+
+    SuiteSparse_csc C ;
+    int64_t header [CSC_HEADER], bs ;
+    int compression ;
+    memcpy (header, Data, sizeof (header)) ;
+    status = csc_header (header, &C, &bs, &compression) ;
+    if (status == SUITESPARSE_CSC_OK && isize == 0)
+    {
+        isize = C.isize ;
+    }
+    if (status == SUITESPARSE_CSC_OK && !csc_valid (&C, isize))
+    {
+        // the matrix is too large for 32-bit integers
+        status = SUITESPARSE_CSC_INVALID ;
+    }
+    if (status == SUITESPARSE_CSC_OK &&
+        (Out [0] != NULL || Out [1] != NULL || Out [2] != NULL) &&
+        (C.ncol != A->ncol || C.nnz != A->nnz || C.xtype != A->xtype ||
+         C.dtype != A->dtype))
+    {
+        // the arrays provided on input do not match the file
+        status = SUITESPARSE_CSC_INVALID ;
+    }
+    if (status != SUITESPARSE_CSC_OK)
+    {
+        FREE_ALL ;
+        return (status) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // read the table and find the offset of each block
+    //--------------------------------------------------------------------------
+
+    int64_t fsize [3], nb [3] ;
+    int64_t esize = csc_esize (C.xtype, C.dtype) ;
+    fsize [0] = (C.ncol + 1) * C.isize ;
+    fsize [1] = C.nnz * C.isize ;
+    fsize [2] = C.nnz * esize ;
+    int64_t nblocks = 0 ;
+    for (int s = 0 ; s < 3 ; s++)
+    {
+        nb [s] = (fsize [s] + bs - 1) / bs ;
+        nblocks += nb [s] ;
+    }
+
+    int64_t hsize = CSC_HEADER * sizeof (int64_t) ;
+    int64_t tsize = nblocks * sizeof (int64_t) ;
+    if ((int64_t) size < hsize + tsize)
+    {
+        FREE_ALL ;
+        return (SUITESPARSE_CSC_INVALID) ;
+    }
+
+    Offset = SuiteSparse_malloc (2*nblocks + 1, sizeof (int64_t)) ;
+    if (Offset == NULL)
+    {
+        FREE_ALL ;
+        return (SUITESPARSE_CSC_OUT_OF_MEMORY) ;
+    }
+
+    // Offset [b] is the position of block b in the file, and Csize [b] is
+    // its entry in the table
+    const uint8_t *Table = Data + size - tsize ;
+    int64_t *Csize = Offset + nblocks + 1 ;
+    memcpy (Csize, Table, tsize) ;
+    Offset [0] = hsize ;
+    int64_t b0 = 0 ;
+    bool ok = true ;
+    for (int s = 0 ; ok && s < 3 ; s++)
+    {
+        for (int64_t b = 0 ; ok && b < nb [s] ; b++)
+        {
+            int64_t len = CSC_MIN (bs, fsize [s] - b * bs) ;
+            int64_t csize = Csize [b0 + b] ;
+            // an uncompressed block must have the exact size, and a
+            // compressed block must be no larger than the original
+            ok = (csize < 0) ? (csize == -len) :
+                (csize > 0 && csize < len && compression != 0) ;
+            if (ok)
+            {
+                csize = (csize < 0) ? (-csize) : csize ;
+                ok = (csize <= ((int64_t) size - tsize) - Offset [b0 + b]) ;
+                Offset [b0 + b + 1] = Offset [b0 + b] + csize ;
+            }
+        }
+        b0 += nb [s] ;
+    }
+    if (!ok || Offset [nblocks] != (int64_t) size - tsize)
+    {
+        FREE_ALL ;
+        return (SUITESPARSE_CSC_INVALID) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the output arrays, and workspace to convert the integers
+    //--------------------------------------------------------------------------
+
+    int64_t osize [3] ;
+    osize [0] = (C.ncol + 1) * isize ;
+    osize [1] = C.nnz * isize ;
+    osize [2] = (C.xtype == SUITESPARSE_CSC_PATTERN) ? 0 : (C.nnz * esize) ;
+    for (int s = 0 ; s < 3 ; s++)
+    {
+        if (Out [s] == NULL && (s < 2 || osize [s] > 0))
+        {
+            Out [s] = SuiteSparse_malloc (osize [s], 1) ;
+            alloc [s] = true ;
+            if (Out [s] == NULL)
+            {
+                FREE_ALL ;
+                return (SUITESPARSE_CSC_OUT_OF_MEMORY) ;
+            }
+        }
+    }
+    if (isize != C.isize)
+    {
+        Tmp = SuiteSparse_malloc (CSC_MAX (fsize [0], fsize [1]), 1) ;
+        if (Tmp == NULL)
+        {
+            FREE_ALL ;
+            return (SUITESPARSE_CSC_OUT_OF_MEMORY) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // decompress or copy each array, in parallel
+    //--------------------------------------------------------------------------
+
+    int nthreads = SUITESPARSE_OPENMP_MAX_THREADS ;
+    nthreads = CSC_MAX (nthreads, 1) ;
+    b0 = 0 ;
+    for (int s = 0 ; ok && s < 3 ; s++)
+    {
+        bool convert = (s < 2 && isize != C.isize) ;
+        uint8_t *Dst = convert ? Tmp : ((uint8_t *) Out [s]) ;
+        int64_t n = nb [s] ;
+        int64_t b ;
+        // an empty array has no blocks, but num_threads must be at least 1
+        int nth = (int) CSC_MIN (nthreads, n) ;
+        nth = CSC_MAX (nth, 1) ;
+        #pragma omp parallel for num_threads(nth) \
+            schedule(dynamic,1) reduction(&&:ok)
+        for (b = 0 ; b < n ; b++)
+        {
+            int64_t len = CSC_MIN (bs, fsize [s] - b * bs) ;
+            int64_t csize = Csize [b0 + b] ;
+            const uint8_t *Src = Data + Offset [b0 + b] ;
+            if (csize < 0)
+            {
+                memcpy (Dst + b * bs, Src, len) ;
+            }
+            #ifdef SUITESPARSE_CONFIG_HAS_LZ4
+            else
+            {
+                int result = LZ4_decompress_safe ((const char *) Src,
+                    (char *) (Dst + b * bs), (int) csize, (int) len) ;
+                ok = ok && (result == len) ;
+            }
+            #endif
+        }
+        b0 += n ;
+
+        if (ok && convert)
+        {
+            // convert the integers from C.isize to isize bytes
+            int64_t k, nk = fsize [s] / C.isize ;
+            if (isize == 8)
+            {
+                const int32_t *Src = (const int32_t *) Tmp ;
+                int64_t *Y = (int64_t *) Out [s] ;
+                #pragma omp parallel for num_threads(nthreads) \
+                    schedule(static)
+                for (k = 0 ; k < nk ; k++)
+                {
+                    Y [k] = (int64_t) Src [k] ;
+                }
+            }
+            else
+            {
+                const int64_t *Src = (const int64_t *) Tmp ;
+                int32_t *Y = (int32_t *) Out [s] ;
+                #pragma omp parallel for num_threads(nthreads) \
+                    schedule(static) reduction(&&:ok)
+                for (k = 0 ; k < nk ; k++)
+                {
+                    int64_t t = Src [k] ;
+                    ok = ok && (t >= 0 && t <= INT32_MAX) ;
+                    Y [k] = (int32_t) t ;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // check the column pointers and row indices
+    //--------------------------------------------------------------------------
+
+    if (ok)
+    {
+        const void *Ap = Out [0], *Ai = Out [1] ;
+        ok = (csc_get (Ap, isize, 0) == 0 &&
+              csc_get (Ap, isize, C.ncol) == C.nnz) ;
+        int64_t j, k ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(&&:ok)
+        for (j = 0 ; j < C.ncol ; j++)
+        {
+            ok = ok && (csc_get (Ap, isize, j) <= csc_get (Ap, isize, j+1)) ;
+        }
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(&&:ok)
+        for (k = 0 ; k < C.nnz ; k++)
+        {
+            int64_t i = csc_get (Ai, isize, k) ;
+            ok = ok && (i >= 0 && i < C.nrow) ;
+        }
+    }
+
+    if (!ok)
+    {
+        FREE_ALL ;
+        return (SUITESPARSE_CSC_INVALID) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return the result
+    //--------------------------------------------------------------------------
+
+    csc_unload (Data, size, mapped) ;
+    SuiteSparse_free (Offset) ;
+    SuiteSparse_free (Tmp) ;
+    C.isize = isize ;
+    C.p = Out [0] ;
+    C.i = Out [1] ;
+    C.x = Out [2] ;
+    (*A) = C ;
+    return (SUITESPARSE_CSC_OK) ;
+}
+
+//------------------------------------------------------------------------------
+// SuiteSparse_csc_free: free the arrays of a matrix
+//------------------------------------------------------------------------------
+
+void SuiteSparse_csc_free
+(
+    SuiteSparse_csc *A
+)
+{
+    if (A == NULL) return ;
+    A->p = SuiteSparse_free (A->p) ;
+    A->i = SuiteSparse_free (A->i) ;
+    A->x = SuiteSparse_free (A->x) ;
+}
@@ -0,0 +1,297 @@
+//------------------------------------------------------------------------------
+// SuiteSparse_config/SuiteSparse_memory.c: placement of large arrays
+//------------------------------------------------------------------------------
+
+// SuiteSparse_config, Copyright (c) 2012-2023, Timothy A. Davis.
+// All Rights Reserved.
+// SPDX-License-Identifier: BSD-3-clause
+
+//------------------------------------------------------------------------------
+
+// On a NUMA machine, the operating system places each page of memory on the
+// node of the thread that first touches it.  The large arrays of SuiteSparse
+// are allocated, and often first written, by a single thread, so they end up
+// on a single node.  The functions here let a package mark a large array with
+// a memory class, which controls how its pages are first touched (in
+// parallel, in contiguous blocks or round-robin across the threads), and
+// whether it is backed by transparent huge pages.  See SuiteSparse_config.h
+// for a description of the user-callable functions.
+//
+// No NUMA library is required.  The pages are placed by touching them from
+// an OpenMP parallel loop, so the placement follows the threads (and their
+// binding, with OMP_PROC_BIND and OMP_PLACES, for example).  Huge pages are
+// requested with madvise (MADV_HUGEPAGE), on Linux only.
+//
+// The memory class is only a hint.  It is ignored unless it has been enabled
+// by SuiteSparse_memory_policy_set, and it never changes the contents of an
+// array, or how the array is freed.
+
+#include "SuiteSparse_config.h"
+
+#if defined ( __unix__ ) || defined ( __APPLE__ )
+#include <unistd.h>
+#endif
+
+#if defined ( __linux__ )
+#include <sys/mman.h>
+#endif
+
+// default smallest array that uses the memory class: 64 MB
+#define MEMORY_DEFAULT_THRESHOLD ((size_t) 1 << 26)
+
+#define MEMORY_MIN(a,b) (((a) < (b)) ? (a) : (b))
+#define MEMORY_MAX(a,b) (((a) > (b)) ? (a) : (b))
+
+//------------------------------------------------------------------------------
+// memory policy
+//------------------------------------------------------------------------------
+
+static int memory_class = SUITESPARSE_MEMORY_DEFAULT ;
+static size_t memory_threshold = MEMORY_DEFAULT_THRESHOLD ;
+
+//------------------------------------------------------------------------------
+// SuiteSparse_memory_policy_set: set the memory policy
+//------------------------------------------------------------------------------
+
+void SuiteSparse_memory_policy_set
+(
+    int memclass,               // memory classes to use (0: none)
+    size_t threshold            // smallest array that uses them, in bytes
+                                // (0: use default of 64 MB)
+)
+{
+    memory_class = memclass & (SUITESPARSE_MEMORY_FIRST_TOUCH |
+        SUITESPARSE_MEMORY_INTERLEAVE | SUITESPARSE_MEMORY_HUGEPAGE) ;
+    memory_threshold = (threshold > 0) ? threshold : MEMORY_DEFAULT_THRESHOLD ;
+}
+
+//------------------------------------------------------------------------------
+// SuiteSparse_memory_policy_get: get the memory policy
+//------------------------------------------------------------------------------
+
+void SuiteSparse_memory_policy_get
+(
+    int *memclass,              // memory classes in use, if not NULL
+    size_t *threshold           // threshold in bytes, if not NULL
+)
+{
+    if (memclass != NULL) (*memclass) = memory_class ;
+    if (threshold != NULL) (*threshold) = memory_threshold ;
+}
+
+//------------------------------------------------------------------------------
+// memory_class_of: the memory class used for an array of a given size
+//------------------------------------------------------------------------------
+
+static int memory_class_of (size_t size, int memclass)
+{
+    if (size < memory_threshold)
+    {
+        // array is too small for any special placement
+        return (SUITESPARSE_MEMORY_DEFAULT) ;
+    }
+    memclass &= memory_class ;
+    #if !defined ( _OPENMP )
+    // the pages cannot be touched in parallel
+    memclass &= ~(SUITESPARSE_MEMORY_FIRST_TOUCH|SUITESPARSE_MEMORY_INTERLEAVE);
+    #endif
+    return (memclass) ;
+}
+
+//------------------------------------------------------------------------------
+// memory_page_size: return the size of a page
+//------------------------------------------------------------------------------
+
+static size_t memory_page_size (void)
+{
+    #if defined ( _SC_PAGESIZE )
+    long s = sysconf (_SC_PAGESIZE) ;
+    if (s > 0) return ((size_t) s) ;
+    #endif
+    return (4096) ;
+}
+
+//------------------------------------------------------------------------------
+// memory_hugepage: ask for transparent huge pages for p [0:size-1]
+//------------------------------------------------------------------------------
+
+// Only the pages entirely inside the array are advised, since the first and
+// last page may be shared with other blocks of memory.
+
+static void memory_hugepage (void *p, size_t size)
+{
+    #if defined ( __linux__ ) && defined ( MADV_HUGEPAGE )
+    size_t page = memory_page_size ( ) ;
+    uintptr_t first = (uintptr_t) p ;
+    uintptr_t last = first + size ;
+    first = ((first + page - 1) / page) * page ;
+    last = (last / page) * page ;
+    if (last > first)
+    {
+        // ignore the result; the array is still usable without huge pages
+        (void) madvise ((void *) first, (size_t) (last - first),
+            MADV_HUGEPAGE) ;
+    }
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// memory_touch: first touch the pages of p [0:size-1] in parallel
+//------------------------------------------------------------------------------
+
+// Each page is touched by one thread: the pages are split into one
+// contiguous block per thread (FIRST_TOUCH), or dealt out one page at a time
+// (INTERLEAVE).  If clear is true, the array is set to zero; otherwise one
+// byte of each page is rewritten with its own value, so the contents do not
+// change.
+
+static void memory_touch (void *p, size_t size, int memclass, int clear)
+{
+    #if defined ( _OPENMP )
+
+    //--------------------------------------------------------------------------
+    // split the array into pages
+    //--------------------------------------------------------------------------
+
+    // page k holds the bytes p [k*page-offset : (k+1)*page-offset-1], clipped
+    // to the array p [0:size-1].
+    size_t page = memory_page_size ( ) ;
+    size_t offset = (size_t) (((uintptr_t) p) % page) ;
+    int64_t npages = (int64_t) ((offset + size + page - 1) / page) ;
+    int nthreads = SUITESPARSE_OPENMP_MAX_THREADS ;
+    nthreads = (int) MEMORY_MIN ((int64_t) nthreads, npages) ;
+    nthreads = MEMORY_MAX (nthreads, 1) ;
+    uint8_t *X = (uint8_t *) p ;
+
+    //--------------------------------------------------------------------------
+    // touch each page
+    //--------------------------------------------------------------------------
+
+    #define MEMORY_TOUCH_PAGE                                           \
+    {                                                                   \
+        size_t lo = (k == 0) ? 0 : ((size_t) k) * page - offset ;       \
+        size_t hi = MEMORY_MIN (((size_t) k+1) * page - offset, size) ;  \
+        if (clear)                                                      \
+        {                                                               \
+            memset (X + lo, 0, hi - lo) ;                               \
+        }                                                               \
+        else                                                            \
+        {                                                               \
+            volatile uint8_t *x = X + lo ;                              \
+            (*x) = (*x) ;                                               \
+        }                                                               \
+    }
+
+    if (memclass & SUITESPARSE_MEMORY_INTERLEAVE)
+    {
+        int64_t k ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+        for (k = 0 ; k < npages ; k++)
+        {
+            MEMORY_TOUCH_PAGE ;
+        }
+    }
+    else
+    {
+        int64_t k ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < npages ; k++)
+        {
+            MEMORY_TOUCH_PAGE ;
+        }
+    }
+
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// SuiteSparse_memory_advise: apply a memory class to an allocated array
+//------------------------------------------------------------------------------
+
+void SuiteSparse_memory_advise
+(
+    void *p,                    // array to place (not modified)
+    size_t size,                // size of the array, in bytes
+    int memclass                // memory class of the array
+)
+{
+    if (p == NULL) return ;
+    memclass = memory_class_of (size, memclass) ;
+    if (memclass & SUITESPARSE_MEMORY_HUGEPAGE)
+    {
+        // huge pages must be requested before the pages are touched
+        memory_hugepage (p, size) ;
+    }
+    if (memclass & (SUITESPARSE_MEMORY_FIRST_TOUCH |
+        SUITESPARSE_MEMORY_INTERLEAVE))
+    {
+        memory_touch (p, size, memclass, 0) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// SuiteSparse_malloc_class: malloc an array with a memory class
+//------------------------------------------------------------------------------
+
+void *SuiteSparse_malloc_class  // pointer to allocated block of memory
+(
+    size_t nitems,          // number of items to malloc (>=1 is enforced)
+    size_t size_of_item,    // sizeof each item
+    int memclass            // memory class of the block
+)
+{
+    void *p = SuiteSparse_malloc (nitems, size_of_item) ;
+    if (p != NULL)
+    {
+        // nitems*size_of_item cannot overflow, since the malloc succeeded
+        SuiteSparse_memory_advise (p, MEMORY_MAX (nitems, 1) *
+            MEMORY_MAX (size_of_item, 1), memclass) ;
+    }
+    return (p) ;
+}
+
+//------------------------------------------------------------------------------
+// SuiteSparse_calloc_class: calloc an array with a memory class
+//------------------------------------------------------------------------------
+
+// If the pages are to be touched in parallel, the array is allocated with
+// malloc and then cleared in parallel, rather than cleared by calloc.
+
+void *SuiteSparse_calloc_class  // pointer to allocated block of memory
+(
+    size_t nitems,          // number of items to calloc (>=1 is enforced)
+    size_t size_of_item,    // sizeof each item
+    int memclass            // memory class of the block
+)
+{
+    nitems = MEMORY_MAX (nitems, 1) ;
+    size_of_item = MEMORY_MAX (size_of_item, 1) ;
+    size_t size = nitems * size_of_item ;
+    if (size != ((double) nitems) * size_of_item)
+    {
+        // size_t overflow
+        return (NULL) ;
+    }
+    memclass = memory_class_of (size, memclass) ;
+    if (!(memclass & (SUITESPARSE_MEMORY_FIRST_TOUCH |
+        SUITESPARSE_MEMORY_INTERLEAVE)))
+    {
+        // no parallel first touch: use calloc, and maybe huge pages
+        void *p = SuiteSparse_calloc (nitems, size_of_item) ;
+        if (p != NULL && (memclass & SUITESPARSE_MEMORY_HUGEPAGE))
+        {
+            memory_hugepage (p, size) ;
+        }
+        return (p) ;
+    }
+    void *p = SuiteSparse_malloc (nitems, size_of_item) ;
+    if (p != NULL)
+    {
+        if (memclass & SUITESPARSE_MEMORY_HUGEPAGE)
+        {
+            memory_hugepage (p, size) ;
+        }
+        memory_touch (p, size, memclass, 1) ;
+    }
+    return (p) ;
+}
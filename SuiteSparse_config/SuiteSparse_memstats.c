@@ -0,0 +1,1234 @@
+//------------------------------------------------------------------------------
+// SuiteSparse_config/SuiteSparse_memstats.c: measured memory usage
+//------------------------------------------------------------------------------
+
+// SuiteSparse_config, Copyright (c) 2012-2023, Timothy A. Davis.
+// All Rights Reserved.
+// SPDX-License-Identifier: BSD-3-clause
+
+//------------------------------------------------------------------------------
+
+// CHOLMOD keeps track of the memory it allocates itself (in Common), and
+// UMFPACK, SPQR, and ParU report estimates of their peak memory usage.  The
+// functions here measure the memory that all packages allocate through
+// SuiteSparse_malloc and the other memory functions in SuiteSparse_config, for
+// all of SuiteSparse, for each package, and for each phase of each package.
+// See SuiteSparse_config.h for a description of the user-callable functions.
+//
+// The phases are marked by SuiteSparse_trace_begin and SuiteSparse_trace_end,
+// which call SuiteSparse_memstats_begin and SuiteSparse_memstats_end.  Each
+// thread has its own stack of phases, so that the phases of user threads that
+// call SuiteSparse at the same time are kept apart.  A thread with no phase of
+// its own (an OpenMP thread started within a phase, for example) is charged to
+// the phase "(none)".
+//
+// SuiteSparse_free is given only a pointer, so the size, phase, and call site
+// of each live block are kept in a hash table (open addressing, with linear
+// probing), which is allocated with malloc/free from the C library rather than
+// the functions in SuiteSparse_config.  The table is split into
+// MEMSTATS_NSHARDS parts by the hash of the pointer, each with its own lock,
+// so that threads contend only if they allocate or free blocks in the same
+// part of the table at the same time.  The counters are updated with atomics,
+// outside of any lock.  A realloc is done outside of any lock as well: the old
+// block is removed from the table before the realloc, so that no other thread
+// can find it once the C library has freed it, and it is put back if the
+// realloc fails.
+//
+// The call sites (the file and line of a call to SuiteSparse_malloc,
+// SuiteSparse_calloc, or SuiteSparse_realloc, in code compiled with
+// SUITESPARSE_MEMSTATS_SITES) are kept in the same parts of the table, keyed
+// by the line number, with up to MEMSTATS_SHARDSITES sites in each part.
+//
+// The names of the packages and phases are kept in a small registry, which is
+// guarded by its own lock.  It is used only when a phase is started and when
+// the counters are read, not when a block is allocated or freed.
+//
+// The locks are OpenMP locks if SuiteSparse_config is compiled with OpenMP,
+// and Win32 or POSIX mutexes otherwise.  The atomics are OpenMP atomics, C11
+// atomics, or Win32 interlocked functions, in that order of preference.
+
+#include "SuiteSparse_config.h"
+
+// thread-local storage for the stack of phases, if available
+#if defined ( _MSC_VER )
+    #define MEMSTATS_THREAD_LOCAL __declspec ( thread )
+#elif defined ( __GNUC__ ) || defined ( __clang__ )
+    #define MEMSTATS_THREAD_LOCAL __thread
+#elif SUITESPARSE_STDC_VERSION >= 201112L
+    #define MEMSTATS_THREAD_LOCAL _Thread_local
+#else
+    // a single stack of phases, shared by all threads
+    #define MEMSTATS_THREAD_LOCAL
+#endif
+
+// locks for the registry and the parts of the table of live blocks
+#if defined ( _OPENMP )
+    #define MEMSTATS_LOCK_T         omp_lock_t
+    #define MEMSTATS_LOCK_INIT(l)   omp_init_lock (l)
+    #define MEMSTATS_LOCK(l)        omp_set_lock (l)
+    #define MEMSTATS_UNLOCK(l)      omp_unset_lock (l)
+#elif defined ( _WIN32 )
+    #include <windows.h>
+    #define MEMSTATS_LOCK_T         SRWLOCK
+    #define MEMSTATS_LOCK_STATIC    SRWLOCK_INIT
+    #define MEMSTATS_LOCK_INIT(l)   InitializeSRWLock (l)
+    #define MEMSTATS_LOCK(l)        AcquireSRWLockExclusive (l)
+    #define MEMSTATS_UNLOCK(l)      ReleaseSRWLockExclusive (l)
+#else
+    #include <pthread.h>
+    #define MEMSTATS_LOCK_T         pthread_mutex_t
+    #define MEMSTATS_LOCK_STATIC    PTHREAD_MUTEX_INITIALIZER
+    #define MEMSTATS_LOCK_INIT(l)   pthread_mutex_init (l, NULL)
+    #define MEMSTATS_LOCK(l)        pthread_mutex_lock (l)
+    #define MEMSTATS_UNLOCK(l)      pthread_mutex_unlock (l)
+#endif
+
+// integers shared by all threads, updated with atomics
+#if defined ( _OPENMP )
+    typedef int64_t memstats_int ;
+#elif !defined ( __STDC_NO_ATOMICS__ )
+    #include <stdatomic.h>
+    #define MEMSTATS_STDATOMIC
+    typedef _Atomic int64_t memstats_int ;
+#elif defined ( _WIN32 )
+    #define MEMSTATS_INTERLOCKED
+    typedef volatile LONG64 memstats_int ;
+#else
+    #error "SuiteSparse_memstats requires OpenMP, C11 atomics, or Win32"
+#endif
+
+#define MEMSTATS_MIN(a,b) (((a) < (b)) ? (a) : (b))
+
+#define MEMSTATS_MAXPACKAGES    32      // max # of packages
+#define MEMSTATS_MAXPHASES      128     // max # of phases, of all packages
+#define MEMSTATS_MAXDEPTH       16      // max depth of nested phases
+#define MEMSTATS_NAMELEN        32      // max length of a name, plus one
+
+// the table of live blocks is split into 2^MEMSTATS_SHARDBITS parts, selected
+// by the top bits of the hash of the pointer (or of the line of a call site)
+#define MEMSTATS_SHARDBITS      6
+#define MEMSTATS_NSHARDS        (1 << MEMSTATS_SHARDBITS)
+#define MEMSTATS_SHARD(h)       ((int) ((h) >> (64 - MEMSTATS_SHARDBITS)))
+#define MEMSTATS_SHARDSITES     8       // max # of call sites in each part
+
+//------------------------------------------------------------------------------
+// memstats state
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    memstats_int live ;     // bytes allocated and not yet freed
+    memstats_int peak ;     // peak of live
+    memstats_int total ;    // total bytes allocated
+    memstats_int nmalloc ;  // # of blocks allocated
+    memstats_int nrealloc ; // # of blocks reallocated
+    memstats_int nfree ;    // # of blocks freed
+    memstats_int hist [SUITESPARSE_MEMSTATS_NBINS] ;
+}
+memstats_counter ;
+
+typedef struct
+{
+    void *p ;               // the block, or NULL if this entry is empty
+    size_t size ;           // size of the block, in bytes
+    int phase ;             // phase charged for the block
+    int site ;              // call site charged for the block, or -1
+}
+memstats_block ;
+
+typedef struct
+{
+    const char *file ;      // file of the call site
+    int line ;              // line of the call site
+    memstats_counter count ;
+}
+memstats_site ;
+
+typedef struct
+{
+    memstats_block *table ; // the blocks, or NULL if not accounting
+    size_t tsize ;          // size of the table (a power of 2)
+    size_t n ;              // # of blocks in the table
+    int nsites ;            // # of call sites in this part
+    memstats_site site [MEMSTATS_SHARDSITES] ;
+    MEMSTATS_LOCK_T lock ;  // guards this part of the table
+}
+memstats_shard ;
+
+static memstats_int memstats_mode = SUITESPARSE_MEMSTATS_OFF ;
+static memstats_int memstats_initialized = 0 ;  // 1 once memstats_init is done
+static int memstats_locked = 0 ;        // 1 once the locks are initialized
+static int memstats_atexit = 0 ;        // 1 if memstats_print_atexit is set
+static memstats_int memstats_nlost = 0 ;        // # of blocks not in the table
+static memstats_int memstats_nsitelost = 0 ;    // # of blocks with no site
+
+// locks for the registry and for memstats_init
+static MEMSTATS_LOCK_T memstats_registry ;
+static MEMSTATS_LOCK_T memstats_initlock ;
+#if !defined ( _OPENMP )
+// guards the initialization of the other locks
+static MEMSTATS_LOCK_T memstats_oncelock = MEMSTATS_LOCK_STATIC ;
+#endif
+
+// counters for all of SuiteSparse
+static memstats_counter memstats_all ;
+
+// counters for each package; package 0 is "(none)"
+static int memstats_npackages = 0 ;
+static char package_name [MEMSTATS_MAXPACKAGES][MEMSTATS_NAMELEN] ;
+static memstats_counter package_count [MEMSTATS_MAXPACKAGES] ;
+
+// counters for each phase; phase 0 is "(none)", of package 0
+static memstats_int memstats_nphases = 0 ;
+static char phase_name [MEMSTATS_MAXPHASES][MEMSTATS_NAMELEN] ;
+static int phase_package [MEMSTATS_MAXPHASES] ;
+static memstats_counter phase_count [MEMSTATS_MAXPHASES] ;
+
+// table of live blocks, and of call sites
+static memstats_shard block_shard [MEMSTATS_NSHARDS] ;
+
+// stack of phases of this thread
+static MEMSTATS_THREAD_LOCAL int memstats_stack [MEMSTATS_MAXDEPTH] ;
+static MEMSTATS_THREAD_LOCAL int memstats_depth = 0 ;
+
+//------------------------------------------------------------------------------
+// memstats_hash: hash a pointer
+//------------------------------------------------------------------------------
+
+static inline uint64_t memstats_hash (const void *p)
+{
+    uint64_t h = (uint64_t) (uintptr_t) p ;
+    h ^= h >> 33 ;
+    h *= UINT64_C (0xFF51AFD7ED558CCD) ;
+    h ^= h >> 33 ;
+    return (h) ;
+}
+
+//------------------------------------------------------------------------------
+// atomic access to the state shared by all threads
+//------------------------------------------------------------------------------
+
+#if defined ( _OPENMP )
+
+    static inline int64_t memstats_get (memstats_int *x)
+    {
+        int64_t t ;
+        #pragma omp atomic read
+        t = *x ;
+        return (t) ;
+    }
+
+    static inline void memstats_set (memstats_int *x, int64_t t)
+    {
+        #pragma omp atomic write
+        *x = t ;
+        (void) t ;      // gcc warns that t is unused with the atomic write
+    }
+
+    // memstats_add: add t to x, and return the new value of x
+    static inline int64_t memstats_add (memstats_int *x, int64_t t)
+    {
+        int64_t result ;
+        #pragma omp atomic capture
+        result = *x += t ;
+        return (result) ;
+    }
+
+    // memstats_max: x = max (x,t)
+    static inline void memstats_max (memstats_int *x, int64_t t)
+    {
+        if (t > memstats_get (x))
+        {
+            // the peak rarely grows, so a critical section is cheap here
+            #pragma omp critical (SuiteSparse_memstats_peak)
+            {
+                if (t > memstats_get (x))
+                {
+                    memstats_set (x, t) ;
+                }
+            }
+        }
+    }
+
+#elif defined ( MEMSTATS_STDATOMIC )
+
+    static inline int64_t memstats_get (memstats_int *x)
+    {
+        return (atomic_load (x)) ;
+    }
+
+    static inline void memstats_set (memstats_int *x, int64_t t)
+    {
+        atomic_store (x, t) ;
+    }
+
+    static inline int64_t memstats_add (memstats_int *x, int64_t t)
+    {
+        return (atomic_fetch_add (x, t) + t) ;
+    }
+
+    static inline void memstats_max (memstats_int *x, int64_t t)
+    {
+        int64_t old = atomic_load (x) ;
+        while (t > old && !atomic_compare_exchange_weak (x, &old, t)) ;
+    }
+
+#else
+
+    static inline int64_t memstats_get (memstats_int *x)
+    {
+        return (InterlockedCompareExchange64 (x, 0, 0)) ;
+    }
+
+    static inline void memstats_set (memstats_int *x, int64_t t)
+    {
+        (void) InterlockedExchange64 (x, t) ;
+    }
+
+    static inline int64_t memstats_add (memstats_int *x, int64_t t)
+    {
+        return (InterlockedExchangeAdd64 (x, t) + t) ;
+    }
+
+    static inline void memstats_max (memstats_int *x, int64_t t)
+    {
+        int64_t old = memstats_get (x) ;
+        while (t > old)
+        {
+            int64_t prior = InterlockedCompareExchange64 (x, t, old) ;
+            if (prior == old) break ;
+            old = prior ;
+        }
+    }
+
+#endif
+
+static inline int memstats_mode_get (void)
+{
+    return ((int) memstats_get (&memstats_mode)) ;
+}
+
+//------------------------------------------------------------------------------
+// counters
+//------------------------------------------------------------------------------
+
+// memstats_bin: the histogram bin of a block of a given size
+static inline int memstats_bin (size_t size)
+{
+    int k = 0 ;
+    while (size > 1 && k < SUITESPARSE_MEMSTATS_NBINS - 1)
+    {
+        size >>= 1 ;
+        k++ ;
+    }
+    return (k) ;
+}
+
+static void counter_add (memstats_counter *c, size_t size, int bin,
+    int isrealloc)
+{
+    memstats_max (&c->peak, memstats_add (&c->live, (int64_t) size)) ;
+    memstats_add (&c->total, (int64_t) size) ;
+    memstats_add (isrealloc ? &c->nrealloc : &c->nmalloc, 1) ;
+    memstats_add (&c->hist [bin], 1) ;
+}
+
+static void counter_remove (memstats_counter *c, size_t size, int isfree)
+{
+    memstats_add (&c->live, -((int64_t) size)) ;
+    if (isfree)
+    {
+        memstats_add (&c->nfree, 1) ;
+    }
+}
+
+static void counter_clear (memstats_counter *c)
+{
+    memstats_set (&c->live, 0) ;
+    memstats_set (&c->peak, 0) ;
+    memstats_set (&c->total, 0) ;
+    memstats_set (&c->nmalloc, 0) ;
+    memstats_set (&c->nrealloc, 0) ;
+    memstats_set (&c->nfree, 0) ;
+    for (int k = 0 ; k < SUITESPARSE_MEMSTATS_NBINS ; k++)
+    {
+        memstats_set (&c->hist [k], 0) ;
+    }
+}
+
+static void counter_reset (memstats_counter *c)
+{
+    int64_t live = memstats_get (&c->live) ;
+    memstats_set (&c->peak, live) ;
+    memstats_set (&c->total, 0) ;
+    memstats_set (&c->nmalloc, 0) ;
+    memstats_set (&c->nrealloc, 0) ;
+    memstats_set (&c->nfree, 0) ;
+    for (int k = 0 ; k < SUITESPARSE_MEMSTATS_NBINS ; k++)
+    {
+        memstats_set (&c->hist [k], 0) ;
+    }
+}
+
+// counter_read: take a snapshot of a counter
+static void counter_read (SuiteSparse_memstats *stats, memstats_counter *c)
+{
+    stats->live_bytes = memstats_get (&c->live) ;
+    stats->peak_bytes = memstats_get (&c->peak) ;
+    stats->total_bytes = memstats_get (&c->total) ;
+    stats->nmalloc = memstats_get (&c->nmalloc) ;
+    stats->nrealloc = memstats_get (&c->nrealloc) ;
+    stats->nfree = memstats_get (&c->nfree) ;
+    for (int k = 0 ; k < SUITESPARSE_MEMSTATS_NBINS ; k++)
+    {
+        stats->hist [k] = memstats_get (&c->hist [k]) ;
+    }
+}
+
+// site_count: the counters of a call site
+static inline memstats_counter *site_count (int site)
+{
+    return (&block_shard [site / MEMSTATS_SHARDSITES].site
+        [site % MEMSTATS_SHARDSITES].count) ;
+}
+
+// memstats_charge: add a block to all counters it belongs to
+static void memstats_charge (size_t size, int phase, int site, int isrealloc)
+{
+    int bin = memstats_bin (size) ;
+    int pkg = phase_package [phase] ;
+    counter_add (&memstats_all, size, bin, isrealloc) ;
+    counter_add (&package_count [pkg], size, bin, isrealloc) ;
+    counter_add (&phase_count [phase], size, bin, isrealloc) ;
+    if (site >= 0)
+    {
+        counter_add (site_count (site), size, bin, isrealloc) ;
+    }
+}
+
+// memstats_uncharge: remove a block from all counters it belongs to
+static void memstats_uncharge (const memstats_block *b, int isfree)
+{
+    int pkg = phase_package [b->phase] ;
+    counter_remove (&memstats_all, b->size, isfree) ;
+    counter_remove (&package_count [pkg], b->size, isfree) ;
+    counter_remove (&phase_count [b->phase], b->size, isfree) ;
+    if (b->site >= 0)
+    {
+        counter_remove (site_count (b->site), b->size, isfree) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// table of live blocks
+//------------------------------------------------------------------------------
+
+// The block_* functions operate on one part of the table, and are called with
+// its lock held.
+
+// block_find: return the entry of p, or the empty entry where it would go
+static size_t block_find (const memstats_shard *s, const void *p, uint64_t h)
+{
+    size_t mask = s->tsize - 1 ;
+    size_t k = (size_t) h & mask ;
+    while (s->table [k].p != NULL && s->table [k].p != p)
+    {
+        k = (k + 1) & mask ;
+    }
+    return (k) ;
+}
+
+// block_grow: double the size of the table
+static int block_grow (memstats_shard *s)
+{
+    size_t tsize = (s->tsize == 0) ? 64 : (2 * s->tsize) ;
+    memstats_block *t = calloc (tsize, sizeof (memstats_block)) ;
+    if (t == NULL)
+    {
+        return (0) ;
+    }
+    memstats_block *old = s->table ;
+    size_t oldsize = s->tsize ;
+    s->table = t ;
+    s->tsize = tsize ;
+    for (size_t k = 0 ; k < oldsize ; k++)
+    {
+        if (old [k].p != NULL)
+        {
+            s->table [block_find (s, old [k].p, memstats_hash (old [k].p))] =
+                old [k] ;
+        }
+    }
+    free (old) ;
+    return (1) ;
+}
+
+// block_insert: add a block to the table (returns 0 if out of memory).  If p
+// was freed without SuiteSparse_free and is now being reused, its stale entry
+// is returned in *stale, for the caller to uncharge.
+static int block_insert (memstats_shard *s, const memstats_block *b,
+    uint64_t h, memstats_block *stale)
+{
+    if (2 * (s->n + 1) > s->tsize && !block_grow (s))
+    {
+        return (0) ;
+    }
+    size_t k = block_find (s, b->p, h) ;
+    if (s->table [k].p == NULL)
+    {
+        s->n++ ;
+    }
+    else
+    {
+        (*stale) = s->table [k] ;
+    }
+    s->table [k] = (*b) ;
+    return (1) ;
+}
+
+// block_remove: remove a block from the table (returns 0 if not found)
+static int block_remove (memstats_shard *s, const void *p, uint64_t h,
+    memstats_block *b)
+{
+    if (s->n == 0)
+    {
+        return (0) ;
+    }
+    size_t k = block_find (s, p, h) ;
+    if (s->table [k].p == NULL)
+    {
+        return (0) ;
+    }
+    (*b) = s->table [k] ;
+
+    // shift later entries of the same probe sequence back into the hole
+    size_t mask = s->tsize - 1 ;
+    size_t hole = k ;
+    for (size_t j = (k + 1) & mask ; s->table [j].p != NULL ;
+        j = (j + 1) & mask)
+    {
+        size_t home = (size_t) memstats_hash (s->table [j].p) & mask ;
+        if (((j - home) & mask) >= ((j - hole) & mask))
+        {
+            s->table [hole] = s->table [j] ;
+            hole = j ;
+        }
+    }
+    s->table [hole].p = NULL ;
+    s->n-- ;
+    return (1) ;
+}
+
+// block_clear: free the table (with no lock held)
+static void block_clear (void)
+{
+    for (int k = 0 ; k < MEMSTATS_NSHARDS ; k++)
+    {
+        memstats_shard *s = &block_shard [k] ;
+        MEMSTATS_LOCK (&s->lock) ;
+        free (s->table) ;
+        s->table = NULL ;
+        s->tsize = 0 ;
+        s->n = 0 ;
+        MEMSTATS_UNLOCK (&s->lock) ;
+    }
+}
+
+// block_start: allocate the table and clear the call sites (with no lock
+// held)
+static int block_start (void)
+{
+    int ok = 1 ;
+    for (int k = 0 ; k < MEMSTATS_NSHARDS && ok ; k++)
+    {
+        memstats_shard *s = &block_shard [k] ;
+        MEMSTATS_LOCK (&s->lock) ;
+        ok = block_grow (s) ;
+        s->nsites = 0 ;
+        for (int j = 0 ; j < MEMSTATS_SHARDSITES ; j++)
+        {
+            counter_clear (&s->site [j].count) ;
+        }
+        MEMSTATS_UNLOCK (&s->lock) ;
+    }
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+// call sites
+//------------------------------------------------------------------------------
+
+// memstats_site_index: find or add a call site (-1 if there is no site, or if
+// its part of the table is full).  The part is selected by the line alone,
+// since the same file can have more than one name string.
+static int memstats_site_index (const char *file, int line)
+{
+    if (file == NULL)
+    {
+        return (-1) ;
+    }
+    int shard = MEMSTATS_SHARD (memstats_hash ((void *) (uintptr_t) line)) ;
+    memstats_shard *s = &block_shard [shard] ;
+    int site = -1 ;
+    MEMSTATS_LOCK (&s->lock) ;
+    for (int j = 0 ; j < s->nsites && site < 0 ; j++)
+    {
+        if (s->site [j].line == line && (s->site [j].file == file ||
+            strcmp (s->site [j].file, file) == 0))
+        {
+            site = shard * MEMSTATS_SHARDSITES + j ;
+        }
+    }
+    if (site < 0 && s->table != NULL && s->nsites < MEMSTATS_SHARDSITES)
+    {
+        int j = s->nsites++ ;
+        s->site [j].file = file ;
+        s->site [j].line = line ;
+        counter_clear (&s->site [j].count) ;
+        site = shard * MEMSTATS_SHARDSITES + j ;
+    }
+    MEMSTATS_UNLOCK (&s->lock) ;
+    if (site < 0)
+    {
+        memstats_add (&memstats_nsitelost, 1) ;
+    }
+    return (site) ;
+}
+
+//------------------------------------------------------------------------------
+// packages and phases
+//------------------------------------------------------------------------------
+
+// The registry of packages and phases is guarded by the memstats_registry
+// lock.  The count of phases is also read, atomically, by memstats_record.
+
+// memstats_name: copy a name, truncating it if needed
+static void memstats_name (char *dst, const char *src)
+{
+    strncpy (dst, (src == NULL) ? "" : src, MEMSTATS_NAMELEN - 1) ;
+    dst [MEMSTATS_NAMELEN - 1] = '\0' ;
+}
+
+// package_index: find or add a package (0 if the list is full)
+static int package_index (const char *package)
+{
+    char name [MEMSTATS_NAMELEN] ;
+    memstats_name (name, package) ;
+    for (int k = 0 ; k < memstats_npackages ; k++)
+    {
+        if (strcmp (package_name [k], name) == 0)
+        {
+            return (k) ;
+        }
+    }
+    if (memstats_npackages >= MEMSTATS_MAXPACKAGES)
+    {
+        return (0) ;
+    }
+    int k = memstats_npackages++ ;
+    memcpy (package_name [k], name, MEMSTATS_NAMELEN) ;
+    counter_clear (&package_count [k]) ;
+    return (k) ;
+}
+
+// phase_index: find or add a phase of a package (0 if the list is full)
+static int phase_index (const char *package, const char *phase)
+{
+    int pkg = package_index (package) ;
+    char name [MEMSTATS_NAMELEN] ;
+    memstats_name (name, phase) ;
+    int nphases = (int) memstats_get (&memstats_nphases) ;
+    for (int k = 0 ; k < nphases ; k++)
+    {
+        if (phase_package [k] == pkg && strcmp (phase_name [k], name) == 0)
+        {
+            return (k) ;
+        }
+    }
+    if (nphases >= MEMSTATS_MAXPHASES)
+    {
+        return (0) ;
+    }
+    int k = nphases ;
+    memcpy (phase_name [k], name, MEMSTATS_NAMELEN) ;
+    phase_package [k] = pkg ;
+    counter_clear (&phase_count [k]) ;
+    memstats_set (&memstats_nphases, k + 1) ;
+    return (k) ;
+}
+
+// memstats_clear: clear all counters (while the accounting is off)
+static void memstats_clear (void)
+{
+    counter_clear (&memstats_all) ;
+    memstats_npackages = 0 ;
+    memstats_set (&memstats_nphases, 0) ;
+    (void) phase_index ("(none)", "(none)") ;
+    memstats_set (&memstats_nlost, 0) ;
+    memstats_set (&memstats_nsitelost, 0) ;
+}
+
+// memstats_phase_current: the phase to charge for this thread
+static int memstats_phase_current (void)
+{
+    return ((memstats_depth == 0) ? 0 :
+        memstats_stack [MEMSTATS_MIN (memstats_depth, MEMSTATS_MAXDEPTH) - 1]) ;
+}
+
+// memstats_record: add a new block to the table, and charge it
+static void memstats_record (void *p, size_t size, int phase, int site,
+    int isrealloc)
+{
+    if (phase < 0 || phase >= (int) memstats_get (&memstats_nphases))
+    {
+        // the phase was started before the accounting was last enabled
+        phase = 0 ;
+    }
+    memstats_block b, stale ;
+    b.p = p ;
+    b.size = size ;
+    b.phase = phase ;
+    b.site = site ;
+    stale.p = NULL ;
+    uint64_t h = memstats_hash (p) ;
+    memstats_shard *s = &block_shard [MEMSTATS_SHARD (h)] ;
+    int on, ok ;
+    MEMSTATS_LOCK (&s->lock) ;
+    on = (s->table != NULL) ;
+    ok = on && block_insert (s, &b, h, &stale) ;
+    MEMSTATS_UNLOCK (&s->lock) ;
+    if (ok)
+    {
+        if (stale.p != NULL)
+        {
+            memstats_uncharge (&stale, 1) ;
+        }
+        memstats_charge (size, phase, site, isrealloc) ;
+    }
+    else if (on)
+    {
+        memstats_add (&memstats_nlost, 1) ;
+    }
+}
+
+// memstats_forget: remove a block from the table (returns 0 if not found)
+static int memstats_forget (const void *p, memstats_block *b)
+{
+    uint64_t h = memstats_hash (p) ;
+    memstats_shard *s = &block_shard [MEMSTATS_SHARD (h)] ;
+    int found ;
+    MEMSTATS_LOCK (&s->lock) ;
+    found = (s->table != NULL) && block_remove (s, p, h, b) ;
+    MEMSTATS_UNLOCK (&s->lock) ;
+    return (found) ;
+}
+
+// memstats_restore: put back a block removed by memstats_forget
+static void memstats_restore (const memstats_block *b)
+{
+    memstats_block stale ;
+    stale.p = NULL ;
+    uint64_t h = memstats_hash (b->p) ;
+    memstats_shard *s = &block_shard [MEMSTATS_SHARD (h)] ;
+    int ok ;
+    MEMSTATS_LOCK (&s->lock) ;
+    ok = (s->table != NULL) && block_insert (s, b, h, &stale) ;
+    MEMSTATS_UNLOCK (&s->lock) ;
+    if (!ok)
+    {
+        // the block is still live, but it can no longer be tracked
+        memstats_uncharge (b, 0) ;
+        memstats_add (&memstats_nlost, 1) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// memstats_init: start the accounting if SUITESPARSE_MEMSTATS is set
+//------------------------------------------------------------------------------
+
+// memstats_locks_init: initialize the locks, once
+static void memstats_locks_init (void)
+{
+    #if defined ( _OPENMP )
+    #pragma omp critical (SuiteSparse_memstats_locks)
+    #else
+    MEMSTATS_LOCK (&memstats_oncelock) ;
+    #endif
+    {
+        if (!memstats_locked)
+        {
+            MEMSTATS_LOCK_INIT (&memstats_registry) ;
+            MEMSTATS_LOCK_INIT (&memstats_initlock) ;
+            for (int k = 0 ; k < MEMSTATS_NSHARDS ; k++)
+            {
+                MEMSTATS_LOCK_INIT (&block_shard [k].lock) ;
+            }
+            memstats_locked = 1 ;
+        }
+    }
+    #if !defined ( _OPENMP )
+    MEMSTATS_UNLOCK (&memstats_oncelock) ;
+    #endif
+}
+
+static void memstats_print_atexit (void)
+{
+    SuiteSparse_memstats_print (stderr) ;
+}
+
+static void memstats_init (void)
+{
+    memstats_locks_init ( ) ;
+    MEMSTATS_LOCK (&memstats_initlock) ;
+    if (!memstats_get (&memstats_initialized))
+    {
+        const char *s = getenv ("SUITESPARSE_MEMSTATS") ;
+        int mode = (s == NULL) ? 0 : atoi (s) ;
+        if (mode == SUITESPARSE_MEMSTATS_ON &&
+            SuiteSparse_memstats_enable (mode) && !memstats_atexit)
+        {
+            memstats_atexit = (atexit (memstats_print_atexit) == 0) ;
+        }
+        memstats_set (&memstats_initialized, 1) ;
+    }
+    MEMSTATS_UNLOCK (&memstats_initlock) ;
+}
+
+//------------------------------------------------------------------------------
+// SuiteSparse_memstats_enable: start or stop the accounting
+//------------------------------------------------------------------------------
+
+int SuiteSparse_memstats_enable     // returns 1 if successful, 0 otherwise
+(
+    int mode                // SUITESPARSE_MEMSTATS_OFF or _ON
+)
+{
+    if (mode != SUITESPARSE_MEMSTATS_OFF && mode != SUITESPARSE_MEMSTATS_ON)
+    {
+        return (0) ;
+    }
+    int ok = 1 ;
+    memstats_set (&memstats_initialized, 1) ;
+    memstats_locks_init ( ) ;
+    MEMSTATS_LOCK (&memstats_registry) ;
+
+    // stop the accounting, but keep the counters
+    memstats_set (&memstats_mode, SUITESPARSE_MEMSTATS_OFF) ;
+    block_clear ( ) ;
+
+    if (mode != SUITESPARSE_MEMSTATS_OFF)
+    {
+        // start the accounting from scratch
+        memstats_clear ( ) ;
+        ok = block_start ( ) ;
+        if (ok)
+        {
+            memstats_set (&memstats_mode, mode) ;
+        }
+        else
+        {
+            block_clear ( ) ;
+            memstats_clear ( ) ;
+        }
+    }
+
+    MEMSTATS_UNLOCK (&memstats_registry) ;
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+// SuiteSparse_memstats_mode: return the current mode
+//------------------------------------------------------------------------------
+
+int SuiteSparse_memstats_mode ( void )
+{
+    return (memstats_mode_get ( )) ;
+}
+
+//------------------------------------------------------------------------------
+// SuiteSparse_memstats_reset: clear the counters, except for the live bytes
+//------------------------------------------------------------------------------
+
+void SuiteSparse_memstats_reset ( void )
+{
+    memstats_locks_init ( ) ;
+    MEMSTATS_LOCK (&memstats_registry) ;
+    counter_reset (&memstats_all) ;
+    for (int k = 0 ; k < memstats_npackages ; k++)
+    {
+        counter_reset (&package_count [k]) ;
+    }
+    int nphases = (int) memstats_get (&memstats_nphases) ;
+    for (int k = 0 ; k < nphases ; k++)
+    {
+        counter_reset (&phase_count [k]) ;
+    }
+    MEMSTATS_UNLOCK (&memstats_registry) ;
+    for (int k = 0 ; k < MEMSTATS_NSHARDS ; k++)
+    {
+        memstats_shard *s = &block_shard [k] ;
+        MEMSTATS_LOCK (&s->lock) ;
+        for (int j = 0 ; j < s->nsites ; j++)
+        {
+            counter_reset (&s->site [j].count) ;
+        }
+        MEMSTATS_UNLOCK (&s->lock) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// SuiteSparse_memstats_get: get the counters of SuiteSparse, a package, or a
+// phase
+//------------------------------------------------------------------------------
+
+static void memstats_copy
+(
+    SuiteSparse_memstats *stats,
+    memstats_counter *c,
+    const char *package,
+    const char *phase
+)
+{
+    counter_read (stats, c) ;
+    stats->package = package ;
+    stats->phase = phase ;
+    stats->file = NULL ;
+    stats->line = 0 ;
+}
+
+int SuiteSparse_memstats_get        // returns 1 if found, 0 otherwise
+(
+    const char *package,            // name of the package, or NULL
+    const char *phase,              // name of the phase, or NULL
+    SuiteSparse_memstats *stats     // output: the counters
+)
+{
+    if (stats == NULL)
+    {
+        return (0) ;
+    }
+    memset (stats, 0, sizeof (SuiteSparse_memstats)) ;
+    int found = 0 ;
+    memstats_locks_init ( ) ;
+    MEMSTATS_LOCK (&memstats_registry) ;
+    if (package == NULL)
+    {
+        found = (phase == NULL) ;
+        if (found)
+        {
+            memstats_copy (stats, &memstats_all, NULL, NULL) ;
+        }
+    }
+    else
+    {
+        int nphases = (int) memstats_get (&memstats_nphases) ;
+        for (int k = 0 ; k < memstats_npackages && !found ; k++)
+        {
+            if (strcmp (package_name [k], package) != 0) continue ;
+            if (phase == NULL)
+            {
+                found = 1 ;
+                memstats_copy (stats, &package_count [k], package_name [k],
+                    NULL) ;
+            }
+            for (int j = 0 ; j < nphases && !found ; j++)
+            {
+                if (phase_package [j] == k &&
+                    strcmp (phase_name [j], phase) == 0)
+                {
+                    found = 1 ;
+                    memstats_copy (stats, &phase_count [j],
+                        package_name [k], phase_name [j]) ;
+                }
+            }
+        }
+    }
+    MEMSTATS_UNLOCK (&memstats_registry) ;
+    return (found) ;
+}
+
+//------------------------------------------------------------------------------
+// SuiteSparse_memstats_phase: get the counters of the kth phase
+//------------------------------------------------------------------------------
+
+int SuiteSparse_memstats_phase      // returns 1 if found, 0 if k is too large
+(
+    int k,                          // 0, 1, 2, ...
+    SuiteSparse_memstats *stats     // output: the counters
+)
+{
+    if (stats == NULL)
+    {
+        return (0) ;
+    }
+    memset (stats, 0, sizeof (SuiteSparse_memstats)) ;
+    int found = 0 ;
+    memstats_locks_init ( ) ;
+    MEMSTATS_LOCK (&memstats_registry) ;
+    found = (k >= 0 && k < (int) memstats_get (&memstats_nphases)) ;
+    if (found)
+    {
+        memstats_copy (stats, &phase_count [k],
+            package_name [phase_package [k]], phase_name [k]) ;
+    }
+    MEMSTATS_UNLOCK (&memstats_registry) ;
+    return (found) ;
+}
+
+//------------------------------------------------------------------------------
+// SuiteSparse_memstats_site: get the counters of the kth call site
+//------------------------------------------------------------------------------
+
+int SuiteSparse_memstats_site       // returns 1 if found, 0 if k is too large
+(
+    int k,                          // 0, 1, 2, ...
+    SuiteSparse_memstats *stats     // output: the counters
+)
+{
+    if (stats == NULL)
+    {
+        return (0) ;
+    }
+    memset (stats, 0, sizeof (SuiteSparse_memstats)) ;
+    int found = 0 ;
+    memstats_locks_init ( ) ;
+    for (int shard = 0 ; shard < MEMSTATS_NSHARDS && !found && k >= 0 ;
+        shard++)
+    {
+        memstats_shard *s = &block_shard [shard] ;
+        MEMSTATS_LOCK (&s->lock) ;
+        if (k < s->nsites)
+        {
+            found = 1 ;
+            memstats_copy (stats, &s->site [k].count, NULL, NULL) ;
+            stats->file = s->site [k].file ;
+            stats->line = s->site [k].line ;
+        }
+        k -= s->nsites ;
+        MEMSTATS_UNLOCK (&s->lock) ;
+    }
+    return (found) ;
+}
+
+//------------------------------------------------------------------------------
+// SuiteSparse_memstats_print: print a report of all counters
+//------------------------------------------------------------------------------
+
+static void memstats_print_counter (FILE *f, memstats_counter *c)
+{
+    SuiteSparse_memstats t ;
+    counter_read (&t, c) ;
+    fprintf (f, " live %13" PRId64 " peak %13" PRId64 " total %14" PRId64
+        " malloc %9" PRId64 " realloc %8" PRId64 " free %9" PRId64 "\n",
+        t.live_bytes, t.peak_bytes, t.total_bytes, t.nmalloc, t.nrealloc,
+        t.nfree) ;
+}
+
+static void memstats_print_hist (FILE *f, memstats_counter *c)
+{
+    SuiteSparse_memstats t ;
+    counter_read (&t, c) ;
+    if (t.nmalloc + t.nrealloc == 0)
+    {
+        return ;
+    }
+    fprintf (f, "    sizes:") ;
+    int n = 0 ;
+    for (int k = 0 ; k < SUITESPARSE_MEMSTATS_NBINS ; k++)
+    {
+        if (t.hist [k] == 0) continue ;
+        if (n > 0 && n % 6 == 0) fprintf (f, "\n          ") ;
+        fprintf (f, " 2^%d:%" PRId64, k, t.hist [k]) ;
+        n++ ;
+    }
+    fprintf (f, "\n") ;
+}
+
+// memstats_print_file: print a call site, with the end of its file name
+static void memstats_print_file (FILE *f, const char *file, int line)
+{
+    size_t len = strlen (file) ;
+    fprintf (f, "  %18s:%-5d", (len > 18) ? (file + len - 18) : file, line) ;
+}
+
+void SuiteSparse_memstats_print
+(
+    FILE *f                         // file to print to (stdout if NULL)
+)
+{
+    if (f == NULL)
+    {
+        f = stdout ;
+    }
+    memstats_locks_init ( ) ;
+    MEMSTATS_LOCK (&memstats_registry) ;
+    fprintf (f, "SuiteSparse memory usage (bytes):\n") ;
+    fprintf (f, "%-26s", "all") ;
+    memstats_print_counter (f, &memstats_all) ;
+    memstats_print_hist (f, &memstats_all) ;
+    int nphases = (int) memstats_get (&memstats_nphases) ;
+    for (int k = 0 ; k < memstats_npackages ; k++)
+    {
+        fprintf (f, "%-26s", package_name [k]) ;
+        memstats_print_counter (f, &package_count [k]) ;
+        for (int j = 0 ; j < nphases ; j++)
+        {
+            if (phase_package [j] != k) continue ;
+            fprintf (f, "  %-24s", phase_name [j]) ;
+            memstats_print_counter (f, &phase_count [j]) ;
+        }
+    }
+    MEMSTATS_UNLOCK (&memstats_registry) ;
+    int header = 0 ;
+    for (int k = 0 ; k < MEMSTATS_NSHARDS ; k++)
+    {
+        memstats_shard *s = &block_shard [k] ;
+        MEMSTATS_LOCK (&s->lock) ;
+        for (int j = 0 ; j < s->nsites ; j++)
+        {
+            if (!header)
+            {
+                fprintf (f, "call sites:\n") ;
+                header = 1 ;
+            }
+            memstats_print_file (f, s->site [j].file, s->site [j].line) ;
+            memstats_print_counter (f, &s->site [j].count) ;
+            memstats_print_hist (f, &s->site [j].count) ;
+        }
+        MEMSTATS_UNLOCK (&s->lock) ;
+    }
+    int64_t nlost = memstats_get (&memstats_nlost) ;
+    if (nlost > 0)
+    {
+        fprintf (f, "blocks not counted (out of memory): %" PRId64 "\n",
+            nlost) ;
+    }
+    int64_t nsitelost = memstats_get (&memstats_nsitelost) ;
+    if (nsitelost > 0)
+    {
+        fprintf (f, "blocks with no call site (too many sites): %" PRId64
+            "\n", nsitelost) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// SuiteSparse_memstats_malloc: record a block allocated by malloc or calloc
+//------------------------------------------------------------------------------
+
+void SuiteSparse_memstats_malloc
+(
+    void *p,                        // the block
+    size_t size,                    // its size, in bytes
+    const char *file,               // file of the call site, or NULL
+    int line                        // line of the call site
+)
+{
+    if (!memstats_get (&memstats_initialized))
+    {
+        memstats_init ( ) ;
+    }
+    if (memstats_mode_get ( ) == SUITESPARSE_MEMSTATS_OFF || p == NULL)
+    {
+        return ;
+    }
+    memstats_record (p, size, memstats_phase_current ( ),
+        memstats_site_index (file, line), 0) ;
+}
+
+//------------------------------------------------------------------------------
+// SuiteSparse_memstats_realloc: reallocate a block, and record it
+//------------------------------------------------------------------------------
+
+// Returns the new block, or NULL if the realloc failed (in which case p is
+// unchanged).  If p is NULL, a new block is allocated, as realloc does.  The
+// new block is charged to the given call site, or to the call site of p if
+// file is NULL.
+
+void *SuiteSparse_memstats_realloc
+(
+    void *p,                        // the block to reallocate
+    size_t size,                    // its new size, in bytes
+    const char *file,               // file of the call site, or NULL
+    int line                        // line of the call site
+)
+{
+    int phase = memstats_phase_current ( ) ;
+    memstats_block b ;
+    int found = (p != NULL) && memstats_forget (p, &b) ;
+    void *pnew = SuiteSparse_config_realloc_func_get ( ) (p, size) ;
+    if (pnew == NULL)
+    {
+        // p is unchanged, and still live
+        if (found)
+        {
+            memstats_restore (&b) ;
+        }
+    }
+    else
+    {
+        if (found)
+        {
+            memstats_uncharge (&b, 0) ;
+        }
+        if (memstats_mode_get ( ) != SUITESPARSE_MEMSTATS_OFF)
+        {
+            int site = (file != NULL) ? memstats_site_index (file, line) :
+                (found ? b.site : -1) ;
+            memstats_record (pnew, size, phase, site, p != NULL) ;
+        }
+    }
+    return (pnew) ;
+}
+
+//------------------------------------------------------------------------------
+// SuiteSparse_memstats_free: remove a block about to be freed
+//------------------------------------------------------------------------------
+
+void SuiteSparse_memstats_free (void *p)
+{
+    if (memstats_mode_get ( ) == SUITESPARSE_MEMSTATS_OFF || p == NULL)
+    {
+        return ;
+    }
+    memstats_block b ;
+    if (memstats_forget (p, &b))
+    {
+        memstats_uncharge (&b, 1) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// SuiteSparse_memstats_begin: start a phase in this thread
+//------------------------------------------------------------------------------
+
+void SuiteSparse_memstats_begin (const char *package, const char *phase)
+{
+    if (!memstats_get (&memstats_initialized))
+    {
+        memstats_init ( ) ;
+    }
+    int k = 0 ;
+    if (memstats_mode_get ( ) != SUITESPARSE_MEMSTATS_OFF)
+    {
+        MEMSTATS_LOCK (&memstats_registry) ;
+        k = phase_index (package, phase) ;
+        MEMSTATS_UNLOCK (&memstats_registry) ;
+    }
+    if (memstats_depth < MEMSTATS_MAXDEPTH)
+    {
+        memstats_stack [memstats_depth] = k ;
+    }
+    memstats_depth++ ;
+}
+
+//------------------------------------------------------------------------------
+// SuiteSparse_memstats_end: end the current phase of this thread
+//------------------------------------------------------------------------------
+
+void SuiteSparse_memstats_end ( void )
+{
+    if (memstats_depth > 0)
+    {
+        memstats_depth-- ;
+    }
+}
@@ -0,0 +1,129 @@
+//------------------------------------------------------------------------------
+// SuiteSparse_config/SuiteSparse_threads.c: BLAS thread budget
+//------------------------------------------------------------------------------
+
+// SuiteSparse_config, Copyright (c) 2012-2023, Timothy A. Davis.
+// All Rights Reserved.
+// SPDX-License-Identifier: BSD-3-clause
+
+//------------------------------------------------------------------------------
+
+// CHOLMOD, UMFPACK, SPQR, and ParU call the BLAS on dense frontal matrices
+// and supernodes of widely varying size.  A multithreaded BLAS is slow on
+// small calls, and it oversubscribes the cores if it is called from several
+// OpenMP tasks at once, each of which starts its own team of BLAS threads.
+// The thread budget lets the user application decide how many threads the
+// BLAS may use in total, and the packages then pick the number of threads for
+// each call from the work it does and the number of tasks active at once.
+//
+// SuiteSparse_config does not link against the BLAS, so the number of threads
+// is only computed here.  The BLAS itself is told by the
+// SUITESPARSE_BLAS_THREADS macro in SuiteSparse_config.h, in the package that
+// makes the BLAS call.
+//
+// The budget is 0 by default, which means the number of BLAS threads is never
+// changed by SuiteSparse.  The budget is meant to be set once, before any
+// threads are started, like the other contents of SuiteSparse_config.
+
+#include "SuiteSparse_config.h"
+
+// default # of flops for each BLAS thread
+#define THREADS_DEFAULT_CHUNK (4e6)
+
+//------------------------------------------------------------------------------
+// thread budget state
+//------------------------------------------------------------------------------
+
+static int blas_budget = 0 ;                    // 0: leave the BLAS alone
+static double blas_chunk = THREADS_DEFAULT_CHUNK ;
+
+//------------------------------------------------------------------------------
+// SuiteSparse_BLAS_threads_set: set the BLAS thread budget
+//------------------------------------------------------------------------------
+
+void SuiteSparse_BLAS_threads_set
+(
+    int nthreads                // total # of BLAS threads; 0: do not change
+)
+{
+    blas_budget = (nthreads > 0) ? nthreads : 0 ;
+}
+
+//------------------------------------------------------------------------------
+// SuiteSparse_BLAS_threads_get: get the BLAS thread budget
+//------------------------------------------------------------------------------
+
+int SuiteSparse_BLAS_threads_get ( void )
+{
+    return (blas_budget) ;
+}
+
+//------------------------------------------------------------------------------
+// SuiteSparse_BLAS_chunk_set: set the work per BLAS thread
+//------------------------------------------------------------------------------
+
+void SuiteSparse_BLAS_chunk_set
+(
+    double chunk                // # of flops per thread; <= 0: use default
+)
+{
+    blas_chunk = (chunk > 0) ? chunk : THREADS_DEFAULT_CHUNK ;
+}
+
+//------------------------------------------------------------------------------
+// SuiteSparse_BLAS_chunk_get: get the work per BLAS thread
+//------------------------------------------------------------------------------
+
+double SuiteSparse_BLAS_chunk_get ( void )
+{
+    return (blas_chunk) ;
+}
+
+//------------------------------------------------------------------------------
+// SuiteSparse_BLAS_threads: # of threads for the next BLAS call
+//------------------------------------------------------------------------------
+
+// Returns the number of threads the BLAS should use for a call that does
+// about "work" flops, while "ntasks" tasks (including the caller) are calling
+// the BLAS at the same time.  Each task gets an equal share of the budget,
+// and no more threads than the work can keep busy (one per chunk of flops).
+//
+// Returns 0 if the BLAS should not be told anything: if the budget is 0, or
+// if the setter is process-wide (local is 0) and other tasks are active, since
+// the number of threads would then change under the feet of the other tasks.
+//
+// The number of threads is returned even if it is the same as for the last
+// call.  The last value set is not cached, since the packages (and the user
+// application) also set the number of BLAS threads directly, and a cached
+// value would then be stale.  Setting the number of threads costs little
+// compared with the BLAS call itself.
+
+int SuiteSparse_BLAS_threads
+(
+    double work,                // # of flops for the BLAS call
+    int ntasks,                 // # of tasks calling the BLAS at the same time
+    int local                   // 1 if the setter only affects this thread
+)
+{
+    int budget = blas_budget ;
+    if (budget <= 0 || (!local && ntasks > 1))
+    {
+        return (0) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // # of threads for this call
+    //--------------------------------------------------------------------------
+
+    int nthreads = budget / ((ntasks > 1) ? ntasks : 1) ;
+    double nchunks = work / blas_chunk ;
+    if (nchunks < nthreads)
+    {
+        nthreads = (int) nchunks ;
+    }
+    if (nthreads < 1)
+    {
+        nthreads = 1 ;
+    }
+    return (nthreads) ;
+}
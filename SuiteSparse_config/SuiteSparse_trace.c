@@ -0,0 +1,321 @@
+//------------------------------------------------------------------------------
+// SuiteSparse_config/SuiteSparse_trace.c: phase-level tracing
+//------------------------------------------------------------------------------
+
+// SuiteSparse_config, Copyright (c) 2012-2023, Timothy A. Davis.
+// All Rights Reserved.
+// SPDX-License-Identifier: BSD-3-clause
+
+//------------------------------------------------------------------------------
+
+// SuiteSparse packages mark the start and end of each major phase of their
+// work (ordering, symbolic analysis, numeric factorization, solve, and
+// iterative refinement) with SuiteSparse_trace_begin and SuiteSparse_trace_end.
+// Each event is passed to a single user-provided trace function, or to the
+// built-in writer of Chrome trace files (JSON), which can be viewed with
+// chrome://tracing or https://ui.perfetto.dev.  See SuiteSparse_config.h for
+// a description of the user-callable functions.
+//
+// If no trace function has been set when the first event occurs, and the
+// SUITESPARSE_TRACE environment variable is set to a filename, then the JSON
+// writer is started automatically, and the file is closed when the program
+// exits.  This allows an existing application to be traced without modifying
+// or recompiling it.
+//
+// When no trace function is installed, SuiteSparse_trace_begin and
+// SuiteSparse_trace_end do not read the timer.  They always mark the phase of
+// the calling thread for SuiteSparse_memstats, however.
+//
+// The trace function is meant to be set once, before any threads are started,
+// like the other contents of SuiteSparse_config.  The events themselves may be
+// emitted by multiple threads at once.  The JSON writer is thread-safe if
+// SuiteSparse_config is compiled with OpenMP.
+
+#include "SuiteSparse_config.h"
+
+#if defined ( __unix__ ) || defined ( __APPLE__ )
+#include <unistd.h>
+#define TRACE_PID ((int) getpid ( ))
+#else
+#define TRACE_PID (0)
+#endif
+
+// thread-local storage for the thread id, if available
+#if defined ( _MSC_VER )
+    #define TRACE_THREAD_LOCAL __declspec ( thread )
+#elif defined ( __GNUC__ ) || defined ( __clang__ )
+    #define TRACE_THREAD_LOCAL __thread
+#elif SUITESPARSE_STDC_VERSION >= 201112L
+    #define TRACE_THREAD_LOCAL _Thread_local
+#endif
+
+//------------------------------------------------------------------------------
+// trace state
+//------------------------------------------------------------------------------
+
+static void (*trace_func) (const SuiteSparse_trace_event *, void *) = NULL ;
+static void *trace_userdata = NULL ;
+static int trace_initialized = 0 ;      // 1 once trace_init has been done
+
+// state of the JSON writer
+static FILE *trace_file = NULL ;        // output file, if open
+static double trace_t0 = 0 ;            // time when the file was opened
+static int trace_nevents = 0 ;          // # of events written to the file
+static int trace_atexit = 0 ;           // 1 if trace_json_atexit registered
+
+#ifdef TRACE_THREAD_LOCAL
+static int trace_nthreads = 0 ;         // # of thread ids handed out
+static TRACE_THREAD_LOCAL int trace_tid = -1 ;
+#endif
+
+//------------------------------------------------------------------------------
+// trace_thread_id: return a small integer that identifies the calling thread
+//------------------------------------------------------------------------------
+
+// Thread ids are handed out in the order that threads first emit an event.
+// OpenMP thread numbers are not used since they are only unique within a
+// single parallel region, and the events from the user's own threads must be
+// kept apart as well.
+
+static int trace_thread_id (void)
+{
+    #ifdef TRACE_THREAD_LOCAL
+    if (trace_tid < 0)
+    {
+        int tid ;
+        #pragma omp atomic capture
+        tid = trace_nthreads++ ;
+        trace_tid = tid ;
+    }
+    return (trace_tid) ;
+    #else
+    return (SUITESPARSE_OPENMP_GET_THREAD_ID) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// trace_json_string: write a string to the JSON file
+//------------------------------------------------------------------------------
+
+static void trace_json_string (const char *s)
+{
+    fputc ('"', trace_file) ;
+    for ( ; s != NULL && *s != '\0' ; s++)
+    {
+        unsigned char c = (unsigned char) (*s) ;
+        if (c == '"' || c == '\\')
+        {
+            fputc ('\\', trace_file) ;
+            fputc (c, trace_file) ;
+        }
+        else if (c >= ' ')
+        {
+            fputc (c, trace_file) ;
+        }
+    }
+    fputc ('"', trace_file) ;
+}
+
+//------------------------------------------------------------------------------
+// trace_json_event: the trace function for the JSON writer
+//------------------------------------------------------------------------------
+
+// Each event is written as a "B" (begin) or "E" (end) duration event, with the
+// time in microseconds since the file was opened.  The flop count and bytes
+// are attached to the end event.
+
+static void trace_json_event
+(
+    const SuiteSparse_trace_event *event,
+    void *userdata
+)
+{
+    (void) userdata ;
+    #pragma omp critical (SuiteSparse_trace)
+    {
+        if (trace_file != NULL)
+        {
+            fputs ((trace_nevents == 0) ? "\n" : ",\n", trace_file) ;
+            fputs ("{\"name\":", trace_file) ;
+            trace_json_string (event->phase) ;
+            fputs (",\"cat\":", trace_file) ;
+            trace_json_string (event->package) ;
+            fprintf (trace_file, ",\"ph\":\"%s\",\"ts\":%.3f,\"pid\":%d,"
+                "\"tid\":%d", (event->kind == SUITESPARSE_TRACE_BEGIN) ?
+                "B" : "E", 1e6 * (event->time - trace_t0), TRACE_PID,
+                event->thread) ;
+            if (event->kind == SUITESPARSE_TRACE_END)
+            {
+                fprintf (trace_file, ",\"args\":{\"flops\":%.17g,"
+                    "\"bytes\":%.17g}", event->flops, event->bytes) ;
+            }
+            fputc ('}', trace_file) ;
+            trace_nevents++ ;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// trace_json_atexit: close the JSON file when the program exits
+//------------------------------------------------------------------------------
+
+static void trace_json_atexit (void)
+{
+    SuiteSparse_trace_json_close ( ) ;
+}
+
+//------------------------------------------------------------------------------
+// trace_init: start the JSON writer if SUITESPARSE_TRACE is set
+//------------------------------------------------------------------------------
+
+static void trace_init (void)
+{
+    #pragma omp critical (SuiteSparse_trace_init)
+    {
+        if (!trace_initialized)
+        {
+            const char *filename = getenv ("SUITESPARSE_TRACE") ;
+            if (filename != NULL && filename [0] != '\0' && trace_func == NULL)
+            {
+                (void) SuiteSparse_trace_json_open (filename) ;
+            }
+            trace_initialized = 1 ;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// SuiteSparse_trace_func_set: set the trace function
+//------------------------------------------------------------------------------
+
+void SuiteSparse_trace_func_set
+(
+    void (*func) (const SuiteSparse_trace_event *event, void *userdata),
+    void *userdata
+)
+{
+    trace_userdata = userdata ;
+    trace_func = func ;
+    trace_initialized = 1 ;
+}
+
+//------------------------------------------------------------------------------
+// SuiteSparse_trace_json_open: start writing events to a JSON file
+//------------------------------------------------------------------------------
+
+int SuiteSparse_trace_json_open     // returns 1 if successful, 0 otherwise
+(
+    const char *filename            // name of the file to write
+)
+{
+    if (filename == NULL)
+    {
+        return (0) ;
+    }
+    SuiteSparse_trace_json_close ( ) ;
+    int ok = 1 ;
+    #pragma omp critical (SuiteSparse_trace)
+    {
+        trace_file = fopen (filename, "w") ;
+        ok = (trace_file != NULL) ;
+        if (ok)
+        {
+            fputc ('[', trace_file) ;
+            trace_nevents = 0 ;
+            trace_t0 = SuiteSparse_time ( ) ;
+            if (!trace_atexit)
+            {
+                trace_atexit = (atexit (trace_json_atexit) == 0) ;
+            }
+        }
+    }
+    if (ok)
+    {
+        SuiteSparse_trace_func_set (trace_json_event, NULL) ;
+    }
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+// SuiteSparse_trace_json_close: finish the JSON file
+//------------------------------------------------------------------------------
+
+void SuiteSparse_trace_json_close ( void )
+{
+    if (trace_func == trace_json_event)
+    {
+        trace_func = NULL ;
+    }
+    #pragma omp critical (SuiteSparse_trace)
+    {
+        if (trace_file != NULL)
+        {
+            fputs ("\n]\n", trace_file) ;
+            fclose (trace_file) ;
+            trace_file = NULL ;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// trace_emit: pass an event to the trace function
+//------------------------------------------------------------------------------
+
+static void trace_emit
+(
+    int kind,
+    const char *package,
+    const char *phase,
+    double flops,
+    double bytes
+)
+{
+    if (!trace_initialized)
+    {
+        trace_init ( ) ;
+    }
+    void (*func) (const SuiteSparse_trace_event *, void *) = trace_func ;
+    if (func == NULL)
+    {
+        return ;
+    }
+    SuiteSparse_trace_event event ;
+    event.kind = kind ;
+    event.package = package ;
+    event.phase = phase ;
+    event.thread = trace_thread_id ( ) ;
+    event.time = SuiteSparse_time ( ) ;
+    event.flops = flops ;
+    event.bytes = bytes ;
+    func (&event, trace_userdata) ;
+}
+
+//------------------------------------------------------------------------------
+// SuiteSparse_trace_begin: mark the start of a phase
+//------------------------------------------------------------------------------
+
+void SuiteSparse_trace_begin
+(
+    const char *package,            // name of the package
+    const char *phase               // name of the phase
+)
+{
+    SuiteSparse_memstats_begin (package, phase) ;
+    trace_emit (SUITESPARSE_TRACE_BEGIN, package, phase, 0, 0) ;
+}
+
+//------------------------------------------------------------------------------
+// SuiteSparse_trace_end: mark the end of a phase
+//------------------------------------------------------------------------------
+
+void SuiteSparse_trace_end
+(
+    const char *package,            // name of the package
+    const char *phase,              // name of the phase
+    double flops,                   // # of flops done in the phase, or 0
+    double bytes                    // size of the result, in bytes, or 0
+)
+{
+    trace_emit (SUITESPARSE_TRACE_END, package, phase, flops, bytes) ;
+    SuiteSparse_memstats_end ( ) ;
+}
@@ -114,7 +114,7 @@ end
 
 if (with_cholmod)
     fprintf ('with CHOLMOD, CAMD, CCOLAMD, and METIS\n') ;
-    flags = [' -DNSUPERNODAL -DNMODIFY -DNMATRIXOPS ' flags] ;
+    flags = [' -DNSUPERNODAL -DNMODIFY -DNMATRIXOPS -DNMONGOOSE ' flags] ;
 else
     fprintf ('without CHOLMOD, CAMD, CCOLAMD, and METIS\n') ;
     flags = [' -DNCHOLMOD ' flags] ;
@@ -166,7 +166,11 @@ generic = { 'timer', 'tictoc' } ;
 M = cell (0) ;
 
 % add the SuiteSparse_time function
-other_source = { '../../SuiteSparse_config/SuiteSparse_config' } ;
+other_source = { ...
+    '../../SuiteSparse_config/SuiteSparse_config', ...
+    '../../SuiteSparse_config/SuiteSparse_memstats', ...
+    '../../SuiteSparse_config/SuiteSparse_trace', ...
+    '../../SuiteSparse_config/SuiteSparse_memory' } ;
 
 % add CHOLMOD and its supporting libraries
 if (with_cholmod)
@@ -24,6 +24,7 @@ void UMF_blas3_update
 
 #ifndef NBLAS
     Int blas_ok = TRUE ;
+    int blas_saved ;
 #endif
 
     DEBUG5 (("In UMF_blas3_update "ID" "ID" "ID"\n",
@@ -93,6 +94,9 @@ void UMF_blas3_update
 	/* triangular solve to update the U block */
 
 #ifndef NBLAS
+	/* set the BLAS threads for the trsm and gemm */
+	SUITESPARSE_BLAS_THREADS (((double) n) * k * (k + 2 * m), 1,
+	    blas_saved) ;
 	BLAS_TRSM_RIGHT (n, k, LU, nb, U, dc, blas_ok) ;
         if (sizeof (SUITESPARSE_BLAS_INT) < sizeof (Int) && !blas_ok)
 #endif
@@ -154,6 +158,11 @@ void UMF_blas3_update
 		}
 	    }
 	}
+
+#ifndef NBLAS
+	/* put back the BLAS threads of the user application */
+	SUITESPARSE_BLAS_THREADS_RESTORE (blas_saved) ;
+#endif
     }
 
 #ifndef NDEBUG
@@ -181,6 +181,11 @@ Int UMF_get_memory
     {
 	/* reallocation succeeded */
 
+	/* spread the pages of the new memory across all threads */
+	SuiteSparse_memory_advise (Numeric->Memory + Numeric->size,
+	    ((size_t) newmem) * sizeof (Unit),
+	    SUITESPARSE_MEMORY_INTERLEAVE | SUITESPARSE_MEMORY_HUGEPAGE) ;
+
 	/* point to the old tail marker block of size 1 + header */
 	p = Numeric->Memory + Numeric->size - 2 ;
 
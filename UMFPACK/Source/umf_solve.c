@@ -77,7 +77,7 @@ Int UMF_solve
     /* ---------------------------------------------------------------------- */
 
     Entry axx, wi, xj, zi, xi, aij, bi ;
-    double omega [3], d, z2i, yi, flops ;
+    double omega [3], d, z2i, yi, flops, refine_flops ;
     Entry *W, *Z, *S, *X ;
     double *Z2, *Y, *B2, *Rs ;
     Int *Rperm, *Cperm, i, n, p, step, j, nz, status, p2, do_scale ;
@@ -107,6 +107,7 @@ Int UMF_solve
     Rs = Numeric->Rs ;		/* row scale factors */
     do_scale = (Rs != (double *) NULL) ;
     flops = 0 ;
+    refine_flops = 0 ;
     Info [UMFPACK_SOLVE_FLOPS] = 0 ;
     Info [UMFPACK_IR_TAKEN] = 0 ;
     Info [UMFPACK_IR_ATTEMPTED] = 0 ;
@@ -262,6 +263,12 @@ Int UMF_solve
 
 	for (step = 0 ; step <= irstep ; step++)
 	{
+	    if (step == 1)
+	    {
+		/* iterative refinement starts */
+		SuiteSparse_trace_begin ("UMFPACK", "refine") ;
+		refine_flops = flops ;
+	    }
 
 	    /* -------------------------------------------------------------- */
 	    /* Solve A x = b (step 0): */
@@ -460,6 +467,11 @@ Int UMF_solve
 
 	}
 
+	if (irstep > 0 && step > 0)
+	{
+	    SuiteSparse_trace_end ("UMFPACK", "refine", flops - refine_flops, 0) ;
+	}
+
     }
     else if (sys == UMFPACK_At)
     {
@@ -560,6 +572,12 @@ Int UMF_solve
 
 	for (step = 0 ; step <= irstep ; step++)
 	{
+	    if (step == 1)
+	    {
+		/* iterative refinement starts */
+		SuiteSparse_trace_begin ("UMFPACK", "refine") ;
+		refine_flops = flops ;
+	    }
 
 	    /* -------------------------------------------------------------- */
 	    /* Solve A' x = b (step 0): */
@@ -733,6 +751,11 @@ Int UMF_solve
 
 	}
 
+	if (irstep > 0 && step > 0)
+	{
+	    SuiteSparse_trace_end ("UMFPACK", "refine", flops - refine_flops, 0) ;
+	}
+
     }
     else if (sys == UMFPACK_Aat)
     {
@@ -833,6 +856,12 @@ Int UMF_solve
 
 	for (step = 0 ; step <= irstep ; step++)
 	{
+	    if (step == 1)
+	    {
+		/* iterative refinement starts */
+		SuiteSparse_trace_begin ("UMFPACK", "refine") ;
+		refine_flops = flops ;
+	    }
 
 	    /* -------------------------------------------------------------- */
 	    /* Solve A.' x = b (step 0): */
@@ -1006,6 +1035,11 @@ Int UMF_solve
 
 	}
 
+	if (irstep > 0 && step > 0)
+	{
+	    SuiteSparse_trace_end ("UMFPACK", "refine", flops - refine_flops, 0) ;
+	}
+
     }
     else if (sys == UMFPACK_Pt_L)
     {
@@ -286,11 +286,15 @@ int UMFPACK_numeric
      */
 
     DEBUG0 (("Calling umf_kernel\n")) ;
+    SuiteSparse_trace_begin ("UMFPACK", "numeric") ;
     status = UMF_kernel (Ap, Ai, Ax,
 #ifdef COMPLEX
 	Az,
 #endif
 	Numeric, Work, Symbolic) ;
+    SuiteSparse_trace_end ("UMFPACK", "numeric",
+	(status < UMFPACK_OK) ? 0 : Numeric->flops,
+	(status < UMFPACK_OK) ? 0 : (double) Numeric->size * sizeof (Unit)) ;
 
     Info [UMFPACK_STATUS] = status ;
     if (status < UMFPACK_OK)
@@ -637,6 +641,10 @@ PRIVATE Int numeric_alloc
 	Numeric->Memory = (Unit *) UMF_malloc (Numeric->size, sizeof (Unit)) ;
 	if (Numeric->Memory)
 	{
+	    /* spread the pages across the memory of all threads */
+	    SuiteSparse_memory_advise (Numeric->Memory,
+		((size_t) Numeric->size) * sizeof (Unit),
+		SUITESPARSE_MEMORY_INTERLEAVE | SUITESPARSE_MEMORY_HUGEPAGE) ;
 	    DEBUG0 (("Successful Numeric->size: "ID"\n", Numeric->size)) ;
 	    return (TRUE) ;
 	}
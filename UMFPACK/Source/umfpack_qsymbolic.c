@@ -1300,6 +1300,8 @@ PRIVATE int symbolic_analysis
     /* get the AMD ordering for the symmetric strategy */
     /* ---------------------------------------------------------------------- */
 
+    SuiteSparse_trace_begin ("UMFPACK", "ordering") ;
+
     if (strategy == UMFPACK_STRATEGY_SYMMETRIC && Quser == (Int *) NULL)
     {
 	/* symmetric strategy for a matrix with mostly symmetric pattern */
@@ -1322,6 +1324,7 @@ PRIVATE int symbolic_analysis
             status = UMFPACK_ERROR_ordering_failed ;
             Info [UMFPACK_STATUS] = status ;
 	    error (&Symbolic, &SW) ;
+            SuiteSparse_trace_end ("UMFPACK", "ordering", 0, 0) ;
             return (status) ;
         }
 	/* combine the singleton ordering and the AMD ordering */
@@ -1481,6 +1484,7 @@ PRIVATE int symbolic_analysis
                 status = UMFPACK_ERROR_ordering_failed ;
                 Info [UMFPACK_STATUS] = status ;
 	        error (&Symbolic, &SW) ;
+                SuiteSparse_trace_end ("UMFPACK", "ordering", 0, 0) ;
                 return (status) ;
             }
 
@@ -1565,6 +1569,7 @@ PRIVATE int symbolic_analysis
 
     /* ordering has been finalized */
     Info [UMFPACK_ORDERING_USED] = Symbolic->ordering ;
+    SuiteSparse_trace_end ("UMFPACK", "ordering", 0, 0) ;
     DEBUG0 (("Final ordering used: "ID"\n", Symbolic->ordering)) ;
 
     Cperm_init [n_col] = EMPTY ;	/* unused in Cperm_init */
@@ -2749,7 +2754,9 @@ int UMFPACK_qsymbolic
     double User_Info [UMFPACK_INFO]
 )
 {
-    return (symbolic_analysis (n_row, n_col, Ap, Ai, Ax,
+    int status ;
+    SuiteSparse_trace_begin ("UMFPACK", "symbolic") ;
+    status = symbolic_analysis (n_row, n_col, Ap, Ai, Ax,
 #ifdef COMPLEX
         Az,
 #endif
@@ -2766,7 +2773,9 @@ int UMFPACK_qsymbolic
         /* do not return SW to the caller */
         (void *) NULL,
 
-        Control, User_Info, 0)) ;
+        Control, User_Info, 0) ;
+    SuiteSparse_trace_end ("UMFPACK", "symbolic", 0, 0) ;
+    return (status) ;
 }
 
 
@@ -2810,7 +2819,9 @@ int UMFPACK_fsymbolic
     double User_Info [UMFPACK_INFO]
 )
 {
-    return (symbolic_analysis (n_row, n_col, Ap, Ai, Ax,
+    int status ;
+    SuiteSparse_trace_begin ("UMFPACK", "symbolic") ;
+    status = symbolic_analysis (n_row, n_col, Ap, Ai, Ax,
 #ifdef COMPLEX
         Az,
 #endif
@@ -2827,7 +2838,9 @@ int UMFPACK_fsymbolic
         /* do not return SW to the caller */
         (void *) NULL,
 
-        Control, User_Info, 0)) ;
+        Control, User_Info, 0) ;
+    SuiteSparse_trace_end ("UMFPACK", "symbolic", 0, 0) ;
+    return (status) ;
 }
 
 
@@ -2875,7 +2888,9 @@ int UMFPACK_paru_symbolic
     double User_Info [UMFPACK_INFO]
 )
 {
-    return (symbolic_analysis (n_row, n_col, Ap, Ai, Ax,
+    int status ;
+    SuiteSparse_trace_begin ("UMFPACK", "symbolic") ;
+    status = symbolic_analysis (n_row, n_col, Ap, Ai, Ax,
 #ifdef COMPLEX
         Az,
 #endif
@@ -2892,6 +2907,8 @@ int UMFPACK_paru_symbolic
         /* also return SW to the caller */
         SW_Handle,
 
-        Control, User_Info, 1)) ;
+        Control, User_Info, 1) ;
+    SuiteSparse_trace_end ("UMFPACK", "symbolic", 0, 0) ;
+    return (status) ;
 }
 
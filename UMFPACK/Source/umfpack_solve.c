@@ -212,11 +212,13 @@ UMFPACK_solve
     /* solve the system */
     /* ---------------------------------------------------------------------- */
 
+    SuiteSparse_trace_begin ("UMFPACK", "solve") ;
     status = UMF_solve (sys, Ap, Ai, Ax, Xx, Bx,
 #ifdef COMPLEX
 	Az, Xz, Bz,
 #endif
 	Numeric, irstep, Info, Pattern, W) ;
+    SuiteSparse_trace_end ("UMFPACK", "solve", Info [UMFPACK_SOLVE_FLOPS], 0) ;
 
     /* ---------------------------------------------------------------------- */
     /* free the workspace (if allocated) */